@@ -14,13 +14,23 @@ uniform vec3 point_light_position;
 uniform float point_light_power;
 uniform float custom_alpha;
 uniform bool affected_by_light;
+uniform bool atlas_texture;
+uniform vec4 atlas_uv_rect;
 out vec4 frag_color;
 
 void main()
 {
     float final_uv_x = uv_frag.x * 0.999f;
     float final_uv_y = 1.0 - uv_frag.y;
-    frag_color = texture(tex, vec2(final_uv_x, final_uv_y));
+    vec2 final_uv = vec2(final_uv_x, final_uv_y);
+    
+    // Remap to the sub rect of the atlas page the texture was packed in
+    if (atlas_texture)
+    {
+        final_uv = atlas_uv_rect.xy + final_uv * atlas_uv_rect.zw;
+    }
+    
+    frag_color = texture(tex, final_uv);
 
     if (frag_color.a < 0.1) discard;
     
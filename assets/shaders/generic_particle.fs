@@ -10,6 +10,8 @@ in vec3 frag_unprojected_pos;
 out vec4 frag_color;
 
 uniform float custom_alpha;
+uniform bool atlas_texture;
+uniform vec4 atlas_uv_rect;
 uniform sampler2D tex;
 
 void main()
@@ -17,9 +19,16 @@ void main()
     // Calculate final uvs
     float finalUvX = uv_frag.x;
     float finalUvY = 1.00 - uv_frag.y;
+    vec2 finalUv = vec2(finalUvX, finalUvY);
+    
+    // Remap to the sub rect of the atlas page the texture was packed in
+    if (atlas_texture)
+    {
+        finalUv = atlas_uv_rect.xy + finalUv * atlas_uv_rect.zw;
+    }
 
     // Get texture color
-    frag_color = texture(tex, vec2(finalUvX, finalUvY));
+    frag_color = texture(tex, finalUv);
     frag_color.r = frag_color.r * min(1.0f, frag_lifetime);
     frag_color.g = frag_color.g * min(1.0f, frag_lifetime);
     frag_color.b = frag_color.b * min(1.0f, frag_lifetime);
@@ -60,9 +60,9 @@ else()
     # On Ubuntu, install with: apt-get install libsdl2-dev
     find_path(SDL2_INCLUDE_DIRS SDL.h PATH_SUFFIXES SDL2)
     find_library(_SDL2_LIB SDL2)
-    set(SDL2_LIBS ${SDL2})
+    set(SDL2_LIBS ${_SDL2_LIB})
     if(_SDL2_use_main)
-        find_library(_SDL2main_LIB SDL2)
+        find_library(_SDL2main_LIB SDL2main)
         list(APPEND SDL2_LIBS ${_SDL2main_LIB})
     endif()
     
@@ -59,7 +59,7 @@ if(NOT SDL2_IMAGE_LIBRARY AND SDL2IMAGE_LIBRARY)
   set(SDL2_IMAGE_LIBRARY ${SDL2IMAGE_LIBRARY} CACHE FILEPATH "file cache entry initialized from old variable name")
 endif()
 find_library(SDL2_IMAGE_LIBRARY
-  NAMES sdl2_image
+  NAMES sdl2_image SDL2_image
   HINTS
     ENV SDL2IMAGEDIR
     ENV SDL2DIR
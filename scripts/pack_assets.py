@@ -0,0 +1,64 @@
+# Packs every file under the assets folder into a single indexed archive (assets/assets.tmaa)
+# that the runtime VirtualFileSystem memory-maps on startup (see engine/resloading/AssetArchive.h).
+#
+# Usage: python3 pack_assets.py [assets_dir] [output_archive]
+
+import os
+import struct
+import sys
+
+ARCHIVE_MAGIC = b'TMAA'
+ARCHIVE_VERSION = 1
+ARCHIVE_HEADER_SIZE = 32
+ARCHIVE_DATA_ALIGNMENT = 16
+ARCHIVE_FILE_NAME = 'assets.tmaa'
+
+# Files that are written at runtime and should keep living on disk
+EXCLUDED_FILE_NAMES = { ARCHIVE_FILE_NAME, 'client_imgui.ini', 'editor_imgui.ini', '.DS_Store' }
+
+def collect_asset_paths(assets_dir):
+    asset_paths = []
+    for root, dirs, files in os.walk(assets_dir):
+        dirs[:] = sorted(d for d in dirs if not d.startswith('.'))
+        for file_name in sorted(files):
+            if file_name in EXCLUDED_FILE_NAMES or file_name.startswith('.'):
+                continue
+            full_path = os.path.join(root, file_name)
+            asset_paths.append(os.path.relpath(full_path, assets_dir).replace(os.sep, '/'))
+    return asset_paths
+
+def pack_assets(assets_dir, output_path):
+    asset_paths = collect_asset_paths(assets_dir)
+    index_entries = []
+
+    with open(output_path, 'wb') as archive:
+        # Header is patched once the index location is known
+        archive.write(b'\0' * ARCHIVE_HEADER_SIZE)
+
+        for relative_path in asset_paths:
+            padding = (-archive.tell()) % ARCHIVE_DATA_ALIGNMENT
+            archive.write(b'\0' * padding)
+
+            with open(os.path.join(assets_dir, relative_path), 'rb') as asset_file:
+                contents = asset_file.read()
+
+            index_entries.append((archive.tell(), len(contents), relative_path.encode('utf-8')))
+            archive.write(contents)
+
+        index_offset = archive.tell()
+        for offset, size, encoded_path in index_entries:
+            archive.write(struct.pack('<QQI', offset, size, len(encoded_path)))
+            archive.write(encoded_path)
+        index_size = archive.tell() - index_offset
+
+        archive.seek(0)
+        archive.write(struct.pack('<4sIIIQQ', ARCHIVE_MAGIC, ARCHIVE_VERSION, len(index_entries), 0, index_offset, index_size))
+
+    total_size = sum(size for _, size, _ in index_entries)
+    print('Packed {} assets ({} bytes) into {}'.format(len(index_entries), total_size, output_path))
+
+if __name__ == '__main__':
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    assets_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(script_dir, '..', 'assets')
+    output_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(assets_dir, ARCHIVE_FILE_NAME)
+    pack_assets(assets_dir, output_path)
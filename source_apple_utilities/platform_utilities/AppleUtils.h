@@ -35,6 +35,7 @@ struct PurchaseResultData
 
 bool IsConnectedToTheInternet();
 std::string GetPersistentDataDirectoryPath();
+double GetProcessCPUTimeSecs();
 std::string GetDeviceId();
 std::string GetDeviceName();
 std::string GetAppVersion();
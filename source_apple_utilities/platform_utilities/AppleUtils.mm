@@ -19,6 +19,7 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
+#include <sys/resource.h>
 #import <StoreKit/StoreKit.h>
 #import <StoreKit/SKStoreReviewController.h>
 #import <UserNotifications/UserNotifications.h>
@@ -268,6 +269,16 @@ std::string GetPersistentDataDirectoryPath()
 
 ///-----------------------------------------------------------------------------------------------
 
+double GetProcessCPUTimeSecs()
+{
+    // User + system time of all threads (std::clock is wall time on some platforms)
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec)/1000000.0;
+}
+
+///-----------------------------------------------------------------------------------------------
+
 std::string GetDeviceId()
 {
 #if defined(MACOS)
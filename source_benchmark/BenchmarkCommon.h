@@ -0,0 +1,46 @@
+///------------------------------------------------------------------------------------------------
+///  BenchmarkCommon.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef BenchmarkCommon_h
+#define BenchmarkCommon_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/utils/MathUtils.h>
+#include <random>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace benchmark_common
+{
+
+///------------------------------------------------------------------------------------------------
+/// Every benchmark draws its random inputs from this seed, so that runs (and their JSON results) are
+/// comparable between commits. Job system threads draw from seeds derived from it and their index.
+inline constexpr unsigned int BENCHMARK_SEED = 1337;
+
+inline const std::string BENCHMARK_ASSETS_ROOT = BENCHMARK_ASSETS_DIR;
+
+///------------------------------------------------------------------------------------------------
+/// Reseeds the engine's random generators on every thread (used e.g. by particle spawning on the
+/// job system's threads) and returns a fresh generator for the benchmark's own inputs. To be called
+/// at the start of every benchmark.
+inline std::mt19937 CreateSeededRandomEngine()
+{
+    math::SeedRandomEngines(BENCHMARK_SEED);
+    math::SetControlSeed(static_cast<int>(BENCHMARK_SEED));
+    return std::mt19937(BENCHMARK_SEED);
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* BenchmarkCommon_h */
@@ -0,0 +1,66 @@
+///------------------------------------------------------------------------------------------------
+///  BenchmarkMain.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/resloading/ResourceLoadingService.h>
+#include <engine/utils/Profiler.h>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string DEFAULT_RESULTS_FILE_NAME = "benchmark_results.json";
+
+///------------------------------------------------------------------------------------------------
+/// Runs every benchmark against a headless engine (no window/GL context needed, so CI machines can run
+/// it), reading the source tree's assets. Unless specified otherwise (via --benchmark_out=...), results
+/// are also written as JSON to benchmark_results.json, ready to be diffed between commits, e.g. with
+/// Google Benchmark's tools/compare.py benchmarks before.json after.json
+int main(int argc, char** argv)
+{
+    std::vector<char*> args(argv, argv + argc);
+
+    bool hasOutputFile = false;
+    bool hasOutputFormat = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto arg = std::string(argv[i]);
+        hasOutputFile |= arg.starts_with("--benchmark_out=");
+        hasOutputFormat |= arg.starts_with("--benchmark_out_format=");
+    }
+
+    std::string outputFileArg = "--benchmark_out=" + DEFAULT_RESULTS_FILE_NAME;
+    std::string outputFormatArg = "--benchmark_out_format=json";
+    if (!hasOutputFile) args.push_back(outputFileArg.data());
+    if (!hasOutputFormat) args.push_back(outputFormatArg.data());
+
+    auto adjustedArgc = static_cast<int>(args.size());
+    args.push_back(nullptr);
+
+    benchmark::Initialize(&adjustedArgc, args.data());
+    if (benchmark::ReportUnrecognizedArguments(adjustedArgc, args.data()))
+    {
+        return 1;
+    }
+
+    benchmark::AddCustomContext("seed", std::to_string(benchmark_common::BENCHMARK_SEED));
+
+    // Measure the hot paths themselves, not the profiler's scope bookkeeping
+    profiling::Profiler::GetInstance().SetEnabled(false);
+    
+    CoreSystemsEngine::SetHeadless(true);
+    resources::ResourceLoadingService::RES_ROOT = benchmark_common::BENCHMARK_ASSETS_ROOT;
+    CoreSystemsEngine::GetInstance();
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
+
+///------------------------------------------------------------------------------------------------
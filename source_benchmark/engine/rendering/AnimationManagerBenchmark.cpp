@@ -0,0 +1,138 @@
+///------------------------------------------------------------------------------------------------
+///  AnimationManagerBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/AnimationManager.h>
+#include <engine/rendering/CommonUniforms.h>
+#include <engine/scene/SceneObject.h>
+#include <memory>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const float BENCHMARK_FRAME_MILLIS = 16.0f;
+static const float NEVER_ENDING_SECS_DURATION = 1e6f; // steady state, i.e. no tween finishes mid benchmark
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<std::shared_ptr<scene::SceneObject>> CreateTweenTargets(const int count, std::mt19937& randomEngine)
+{
+    std::uniform_real_distribution<float> positionDistribution(-1.0f, 1.0f);
+
+    std::vector<std::shared_ptr<scene::SceneObject>> sceneObjects;
+    for (int i = 0; i < count; ++i)
+    {
+        auto sceneObject = std::make_shared<scene::SceneObject>();
+        sceneObject->mPosition = glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine), 1.0f);
+        sceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 1.0f;
+        sceneObjects.push_back(sceneObject);
+    }
+    return sceneObjects;
+}
+
+///------------------------------------------------------------------------------------------------
+/// A game-like mix of tweens, one per scene object: 40% position/scale, 30% alpha, 20% rotation, 10% pulse.
+static void StartTweenMix(const std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects, const bool asTypedTweens)
+{
+    auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
+    for (size_t i = 0; i < sceneObjects.size(); ++i)
+    {
+        const auto& sceneObject = sceneObjects[i];
+        const auto targetPosition = sceneObject->mPosition + glm::vec3(1.0f, 1.0f, 0.0f);
+        switch (i % 10)
+        {
+            case 0: case 1: case 2: case 3:
+            {
+                if (asTypedTweens) animationManager.StartAnimation(rendering::PositionScaleTween(sceneObject, targetPosition, glm::vec3(2.0f), NEVER_ENDING_SECS_DURATION, animation_flags::NONE, 0.0f, math::QuadFunction, math::TweeningMode::EASE_OUT), [](){});
+                else animationManager.StartAnimation(std::make_unique<rendering::TweenPositionScaleAnimation>(sceneObject, targetPosition, glm::vec3(2.0f), NEVER_ENDING_SECS_DURATION, animation_flags::NONE, 0.0f, math::QuadFunction, math::TweeningMode::EASE_OUT), [](){});
+            } break;
+
+            case 4: case 5: case 6:
+            {
+                if (asTypedTweens) animationManager.StartAnimation(rendering::AlphaTween(sceneObject, 0.0f, NEVER_ENDING_SECS_DURATION), [](){});
+                else animationManager.StartAnimation(std::make_unique<rendering::TweenAlphaAnimation>(sceneObject, 0.0f, NEVER_ENDING_SECS_DURATION), [](){});
+            } break;
+
+            case 7: case 8:
+            {
+                if (asTypedTweens) animationManager.StartAnimation(rendering::RotationTween(sceneObject, glm::vec3(0.0f, 0.0f, 3.14f), NEVER_ENDING_SECS_DURATION), [](){});
+                else animationManager.StartAnimation(std::make_unique<rendering::TweenRotationAnimation>(sceneObject, glm::vec3(0.0f, 0.0f, 3.14f), NEVER_ENDING_SECS_DURATION), [](){});
+            } break;
+
+            default:
+            {
+                if (asTypedTweens) animationManager.StartAnimation(rendering::PulseTween(sceneObject, 1.2f, 0.5f, animation_flags::ANIMATE_CONTINUOUSLY), [](){});
+                else animationManager.StartAnimation(std::make_unique<rendering::PulseAnimation>(sceneObject, 1.2f, 0.5f, animation_flags::ANIMATE_CONTINUOUSLY), [](){});
+            } break;
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// Arg: concurrent tweens. Typed tween pools.
+static void BM_UpdateConcurrentTweens(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
+    const auto sceneObjects = CreateTweenTargets(static_cast<int>(state.range(0)), randomEngine);
+    StartTweenMix(sceneObjects, true);
+
+    for (auto _: state)
+    {
+        animationManager.Update(BENCHMARK_FRAME_MILLIS);
+        benchmark::ClobberMemory();
+    }
+
+    animationManager.StopAllAnimations();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UpdateConcurrentTweens)->Arg(1000)->Arg(20000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+/// Arg: concurrent tweens. Same workload through the IAnimation classes (generic pool), for reference.
+static void BM_UpdateConcurrentAnimations(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
+    const auto sceneObjects = CreateTweenTargets(static_cast<int>(state.range(0)), randomEngine);
+    StartTweenMix(sceneObjects, false);
+
+    for (auto _: state)
+    {
+        animationManager.Update(BENCHMARK_FRAME_MILLIS);
+        benchmark::ClobberMemory();
+    }
+
+    animationManager.StopAllAnimations();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UpdateConcurrentAnimations)->Arg(1000)->Arg(20000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+/// Arg: concurrent tweens. Starting a tween per scene object, then stopping them through the scene object index.
+static void BM_StartAndStopTweensPerSceneObject(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
+    const auto sceneObjects = CreateTweenTargets(static_cast<int>(state.range(0)), randomEngine);
+
+    for (auto _: state)
+    {
+        StartTweenMix(sceneObjects, true);
+        for (const auto& sceneObject: sceneObjects)
+        {
+            animationManager.StopAllAnimationsPlayingForSceneObject(*sceneObject);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StartAndStopTweensPerSceneObject)->Arg(1000)->Arg(20000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,68 @@
+///------------------------------------------------------------------------------------------------
+///  FontBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/Fonts.h>
+#include <game/GameConstants.h>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string PRINTABLE_ASCII_CHARACTERS = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+static const std::string MULTI_BYTE_CHARACTERS[] = { "\xC3\xA9", "\xCE\xB1", "\xE2\x82\xAC", "\xE3\x81\x82", "\xF0\x9F\x98\x80" }; // é, α, €, あ, 😀
+
+///------------------------------------------------------------------------------------------------
+
+static const rendering::Font& GetBenchmarkFont()
+{
+    auto& fontRepository = CoreSystemsEngine::GetInstance().GetFontRepository();
+    fontRepository.LoadFont(game_constants::DEFAULT_FONT_NAME.GetString());
+    return fontRepository.GetFont(game_constants::DEFAULT_FONT_NAME)->get();
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::string CreateRandomText(const size_t characterCount, const bool includeMultiByteCharacters, std::mt19937& randomEngine)
+{
+    std::uniform_int_distribution<size_t> asciiDistribution(0, PRINTABLE_ASCII_CHARACTERS.size() - 1);
+    std::uniform_int_distribution<size_t> multiByteDistribution(0, std::size(MULTI_BYTE_CHARACTERS) - 1);
+    std::uniform_int_distribution<int> multiByteChanceDistribution(0, 9);
+
+    std::string text;
+    for (size_t i = 0; i < characterCount; ++i)
+    {
+        if (includeMultiByteCharacters && multiByteChanceDistribution(randomEngine) == 0)
+        {
+            text += MULTI_BYTE_CHARACTERS[multiByteDistribution(randomEngine)];
+        }
+        else
+        {
+            text += PRINTABLE_ASCII_CHARACTERS[asciiDistribution(randomEngine)];
+        }
+    }
+    return text;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_FontFindGlyphs(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto& font = GetBenchmarkFont();
+    const auto text = CreateRandomText(static_cast<size_t>(state.range(0)), state.range(1) != 0, randomEngine);
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(font.FindGlyphs(text));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FontFindGlyphs)->ArgNames({"chars", "multibyte"})->ArgsProduct({{16, 128, 1024}, {0, 1}});
+
+///------------------------------------------------------------------------------------------------
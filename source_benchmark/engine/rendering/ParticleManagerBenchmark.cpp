@@ -0,0 +1,54 @@
+///------------------------------------------------------------------------------------------------
+///  ParticleManagerBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/ParticleManager.h>
+#include <engine/scene/Scene.h>
+#include <engine/scene/SceneObject.h>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+static const strutils::StringId BENCHMARK_PARTICLE_EMITTER_NAME = strutils::StringId("test_particle");
+static const float BENCHMARK_FRAME_MILLIS = 16.0f;
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_UpdateSceneParticles(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    std::uniform_real_distribution<float> positionDistribution(-1.0f, 1.0f);
+
+    auto& particleManager = CoreSystemsEngine::GetInstance().GetParticleManager();
+    particleManager.LoadParticleData();
+
+    scene::Scene benchmarkScene(strutils::StringId("particle_benchmark_scene"));
+    size_t particleCount = 0;
+    for (int i = 0; i < state.range(0); ++i)
+    {
+        auto particleEmitter = particleManager.CreateParticleEmitterAtPosition(BENCHMARK_PARTICLE_EMITTER_NAME, glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine), 1.0f), benchmarkScene, strutils::StringId("particle_emitter_" + std::to_string(i)));
+
+        // Keep respawning particles, so that every iteration measures the same (steady state) workload
+        auto& particleEmitterData = std::get<scene::ParticleEmitterObjectData>(particleEmitter->mSceneObjectTypeData);
+        particleEmitterData.mParticleFlags |= particle_flags::CONTINUOUS_PARTICLE_GENERATION;
+        particleCount += particleEmitterData.mParticleCount;
+    }
+
+    for (auto _: state)
+    {
+        particleManager.UpdateSceneParticles(BENCHMARK_FRAME_MILLIS, benchmarkScene);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(particleCount));
+    state.counters["particles"] = static_cast<double>(particleCount);
+}
+BENCHMARK(BM_UpdateSceneParticles)->Arg(1)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,162 @@
+///------------------------------------------------------------------------------------------------
+///  AssetArchiveBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <engine/resloading/AssetArchive.h>
+#include <engine/resloading/VirtualFileSystem.h>
+#include <engine/utils/PlatformMacros.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#if defined(LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+///------------------------------------------------------------------------------------------------
+/// Compares the startup cost of reading every shipped asset through the VirtualFileSystem,
+/// with the packed archive mounted vs. as loose files. Each iteration mounts (or not) from
+/// scratch and touches every byte, as the loaders would on a cold start. Before every iteration
+/// (untimed) the pages of every file read are evicted from the OS page cache, so that each one
+/// goes to disk again. Eviction is only available on Linux (the "page_cache_evicted" counter is 0
+/// elsewhere, where the numbers are those of a warm page cache). Directory and inode caches are
+/// not dropped, so for fully cold numbers still drop caches system wide before a run
+/// (e.g. `sync && echo 3 > /proc/sys/vm/drop_caches`).
+///------------------------------------------------------------------------------------------------
+
+static const std::string ASSETS_DIR = BENCHMARK_ASSETS_DIR;
+static const std::string ARCHIVE_PATH = (std::filesystem::temp_directory_path() / "asset_archive_benchmark.tmaa").string();
+
+///------------------------------------------------------------------------------------------------
+
+static bool EvictFromPageCache(const std::string& filePath)
+{
+#if defined(LINUX)
+    const auto fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor == -1)
+    {
+        return false;
+    }
+
+    // Dirty pages (e.g. of the just written archive) are not dropped, so write them back first
+    fdatasync(fileDescriptor);
+    const auto evicted = posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_DONTNEED) == 0;
+    close(fileDescriptor);
+    return evicted;
+#else
+    (void)filePath;
+    return false;
+#endif
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool EvictAllAssetsFromPageCache(const std::vector<std::string>& relativePaths)
+{
+    bool evicted = true;
+    for (const auto& relativePath: relativePaths)
+    {
+        evicted &= EvictFromPageCache(ASSETS_DIR + relativePath);
+    }
+    return evicted;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<std::string> GetAllAssetRelativePaths()
+{
+    std::vector<std::string> relativePaths;
+    for (const auto& entry: std::filesystem::recursive_directory_iterator(ASSETS_DIR))
+    {
+        if (entry.is_regular_file() && entry.path().filename() != resources::VirtualFileSystem::ASSET_ARCHIVE_FILE_NAME)
+        {
+            relativePaths.push_back(std::filesystem::relative(entry.path(), ASSETS_DIR).generic_string());
+        }
+    }
+    return relativePaths;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void PackAllAssets(const std::vector<std::string>& relativePaths)
+{
+    std::vector<std::pair<std::string, std::string>> relativePathsAndContents;
+    for (const auto& relativePath: relativePaths)
+    {
+        std::ifstream file(ASSETS_DIR + relativePath, std::ios::binary);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        relativePathsAndContents.emplace_back(relativePath, contents.str());
+    }
+    resources::AssetArchive::WriteArchive(ARCHIVE_PATH, relativePathsAndContents);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static size_t ReadAllAssets(const resources::VirtualFileSystem& virtualFileSystem, const std::vector<std::string>& relativePaths)
+{
+    size_t checksum = 0;
+    for (const auto& relativePath: relativePaths)
+    {
+        const auto fileContents = virtualFileSystem.ReadFile(ASSETS_DIR + relativePath);
+        const auto* data = fileContents.GetData();
+        for (size_t i = 0; i < fileContents.GetSize(); i += 4096)
+        {
+            checksum += static_cast<unsigned char>(data[i]);
+        }
+    }
+    return checksum;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_ColdStartLooseFiles(benchmark::State& state)
+{
+    const auto relativePaths = GetAllAssetRelativePaths();
+    bool pageCacheEvicted = true;
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        pageCacheEvicted &= EvictAllAssetsFromPageCache(relativePaths);
+        state.ResumeTiming();
+
+        resources::VirtualFileSystem virtualFileSystem;
+        benchmark::DoNotOptimize(ReadAllAssets(virtualFileSystem, relativePaths));
+    }
+    state.counters["files"] = static_cast<double>(relativePaths.size());
+    state.counters["page_cache_evicted"] = pageCacheEvicted ? 1.0 : 0.0;
+}
+BENCHMARK(BM_ColdStartLooseFiles)->Unit(benchmark::kMillisecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_ColdStartPackedArchive(benchmark::State& state)
+{
+    const auto relativePaths = GetAllAssetRelativePaths();
+    PackAllAssets(relativePaths);
+
+    bool pageCacheEvicted = true;
+    for (auto _: state)
+    {
+        // The previous iteration's mapping is gone by now, so the archive's pages can be dropped
+        state.PauseTiming();
+        pageCacheEvicted &= EvictFromPageCache(ARCHIVE_PATH);
+        state.ResumeTiming();
+
+        resources::VirtualFileSystem virtualFileSystem;
+        virtualFileSystem.MountArchive(ARCHIVE_PATH, ASSETS_DIR);
+        benchmark::DoNotOptimize(ReadAllAssets(virtualFileSystem, relativePaths));
+    }
+    state.counters["files"] = static_cast<double>(relativePaths.size());
+    state.counters["page_cache_evicted"] = pageCacheEvicted ? 1.0 : 0.0;
+
+    std::filesystem::remove(ARCHIVE_PATH);
+}
+BENCHMARK(BM_ColdStartPackedArchive)->Unit(benchmark::kMillisecond);
+
+///------------------------------------------------------------------------------------------------
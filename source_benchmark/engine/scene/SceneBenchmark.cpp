@@ -0,0 +1,117 @@
+///------------------------------------------------------------------------------------------------
+///  SceneBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/scene/Scene.h>
+#include <engine/scene/SceneManager.h>
+#include <engine/scene/SceneObject.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static std::shared_ptr<scene::Scene> CreatePopulatedScene(const int sceneObjectCount, std::mt19937& randomEngine)
+{
+    auto benchmarkScene = std::make_shared<scene::Scene>(strutils::StringId("benchmark_scene"));
+
+    // Few distinct z layers (as with map layers, entities, UI etc.), so that name tie breaks are exercised too
+    std::uniform_int_distribution<int> zLayerDistribution(0, 15);
+    for (int i = 0; i < sceneObjectCount; ++i)
+    {
+        auto sceneObject = benchmarkScene->CreateSceneObject(strutils::StringId("scene_object_" + std::to_string(i)));
+        sceneObject->mPosition.z = static_cast<float>(zLayerDistribution(randomEngine)) * 0.1f;
+    }
+
+    return benchmarkScene;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_SortSceneObjects(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto benchmarkScene = CreatePopulatedScene(static_cast<int>(state.range(0)), randomEngine);
+    auto& sceneManager = CoreSystemsEngine::GetInstance().GetSceneManager();
+
+    for (auto _: state)
+    {
+        // Objects come in unsorted every time (as when entities move between z layers)
+        state.PauseTiming();
+        std::shuffle(benchmarkScene->GetSceneObjects().begin(), benchmarkScene->GetSceneObjects().end(), randomEngine);
+        state.ResumeTiming();
+
+        sceneManager.SortSceneObjects(benchmarkScene);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortSceneObjects)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_SortAlreadySortedSceneObjects(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto benchmarkScene = CreatePopulatedScene(static_cast<int>(state.range(0)), randomEngine);
+    auto& sceneManager = CoreSystemsEngine::GetInstance().GetSceneManager();
+    sceneManager.SortSceneObjects(benchmarkScene);
+
+    // The steady state of every frame (objects rarely change z layer)
+    for (auto _: state)
+    {
+        sceneManager.SortSceneObjects(benchmarkScene);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortAlreadySortedSceneObjects)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_FindSceneObject(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto sceneObjectCount = static_cast<int>(state.range(0));
+    auto benchmarkScene = CreatePopulatedScene(sceneObjectCount, randomEngine);
+
+    std::vector<strutils::StringId> lookupNames;
+    std::uniform_int_distribution<int> sceneObjectIndexDistribution(0, sceneObjectCount - 1);
+    for (int i = 0; i < 1024; ++i)
+    {
+        lookupNames.emplace_back("scene_object_" + std::to_string(sceneObjectIndexDistribution(randomEngine)));
+    }
+
+    size_t lookupIndex = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(benchmarkScene->FindSceneObject(lookupNames[lookupIndex++ & 1023]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindSceneObject)->Arg(100)->Arg(1000)->Arg(10000);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_FindMissingSceneObject(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto benchmarkScene = CreatePopulatedScene(static_cast<int>(state.range(0)), randomEngine);
+    const auto missingName = strutils::StringId("missing_scene_object");
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(benchmarkScene->FindSceneObject(missingName));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindMissingSceneObject)->Arg(100)->Arg(1000)->Arg(10000);
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,128 @@
+///------------------------------------------------------------------------------------------------
+///  SceneObjectTransformBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/scene/SceneObject.h>
+#include <engine/scene/SceneObjectUtils.h>
+#include <memory>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const int STATIC_SCENE_OBJECT_COUNT = 10000;
+static const int MOVING_SCENE_OBJECT_COUNT = 1000;
+static const float MOVING_SCENE_OBJECT_SPEED = 0.001f;
+
+///------------------------------------------------------------------------------------------------
+
+// How the renderer built each object's world matrix every frame prior to the transform cache, for reference
+static glm::mat4 CalculateLegacyWorldMatrix(const scene::SceneObject& sceneObject)
+{
+    glm::mat4 world(1.0f);
+    glm::mat4 rot(1.0f);
+    
+    world = glm::translate(world, sceneObject.mPosition);
+    rot = glm::rotate(rot, sceneObject.mRotation.x, math::X_AXIS);
+    rot = glm::rotate(rot, sceneObject.mRotation.y, math::Y_AXIS);
+    rot = glm::rotate(rot, sceneObject.mRotation.z, math::Z_AXIS);
+    world = world * rot;
+    world = glm::scale(world, sceneObject.mScale);
+    return world;
+}
+
+///------------------------------------------------------------------------------------------------
+/// Static map tiles/props followed by moving entities (each a root & a child collider as in NetworkEntitySceneObjectFactory).
+static std::vector<std::shared_ptr<scene::SceneObject>> CreateSceneObjects(std::mt19937& randomEngine)
+{
+    std::uniform_real_distribution<float> positionDistribution(-1.0f, 1.0f);
+    std::vector<std::shared_ptr<scene::SceneObject>> sceneObjects;
+    
+    for (int i = 0; i < STATIC_SCENE_OBJECT_COUNT; ++i)
+    {
+        sceneObjects.push_back(std::make_shared<scene::SceneObject>());
+        sceneObjects.back()->mPosition = glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine), 0.1f);
+        sceneObjects.back()->mScale = glm::vec3(0.01f);
+    }
+    
+    for (int i = 0; i < MOVING_SCENE_OBJECT_COUNT; ++i)
+    {
+        auto rootSceneObject = std::make_shared<scene::SceneObject>();
+        rootSceneObject->mPosition = glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine), 1.0f);
+        rootSceneObject->mScale = glm::vec3(0.02f);
+        sceneObjects.push_back(rootSceneObject);
+        
+        auto colliderSceneObject = std::make_shared<scene::SceneObject>();
+        colliderSceneObject->mParent = rootSceneObject;
+        colliderSceneObject->mScale = glm::vec3(0.5f, 0.5f, 1.0f);
+        sceneObjects.push_back(colliderSceneObject);
+    }
+    
+    return sceneObjects;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void MoveSceneObjects(std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects)
+{
+    for (size_t i = STATIC_SCENE_OBJECT_COUNT; i < sceneObjects.size(); i += 2)
+    {
+        sceneObjects[i]->mPosition.x += MOVING_SCENE_OBJECT_SPEED;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_LegacyWorldMatrices(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto sceneObjects = CreateSceneObjects(randomEngine);
+    
+    for (auto _: state)
+    {
+        MoveSceneObjects(sceneObjects);
+        
+        // Colliders were kept in sync with their root by copying its position over every frame
+        for (size_t i = STATIC_SCENE_OBJECT_COUNT; i < sceneObjects.size(); i += 2)
+        {
+            sceneObjects[i + 1]->mPosition = glm::vec3(sceneObjects[i]->mPosition.x, sceneObjects[i]->mPosition.y, sceneObjects[i + 1]->mPosition.z);
+        }
+        
+        for (const auto& sceneObject: sceneObjects)
+        {
+            auto world = CalculateLegacyWorldMatrix(*sceneObject);
+            benchmark::DoNotOptimize(world);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * sceneObjects.size());
+}
+BENCHMARK(BM_LegacyWorldMatrices)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_CachedWorldMatrices(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto sceneObjects = CreateSceneObjects(randomEngine);
+    
+    for (auto _: state)
+    {
+        MoveSceneObjects(sceneObjects);
+        
+        for (const auto& sceneObject: sceneObjects)
+        {
+            const auto& world = scene_object_utils::GetWorldMatrix(*sceneObject);
+            benchmark::DoNotOptimize(world);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * sceneObjects.size());
+}
+BENCHMARK(BM_CachedWorldMatrices)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
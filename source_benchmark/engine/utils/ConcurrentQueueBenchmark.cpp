@@ -0,0 +1,124 @@
+///------------------------------------------------------------------------------------------------
+///  ConcurrentQueueBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <engine/utils/BlockingQueue.h>
+#include <engine/utils/MPSCRingBuffer.h>
+#include <engine/utils/SPSCRingBuffer.h>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr size_t QUEUE_BENCHMARK_CAPACITY = 1024;
+static constexpr int QUEUE_BENCHMARK_BATCH_SIZE = 4096;
+
+///------------------------------------------------------------------------------------------------
+/// Baseline the new primitives are measured against (what ThreadSafeQueue used to do).
+template<typename T>
+class MutexQueue final
+{
+public:
+    bool TryPush(T value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mElements.push(std::move(value));
+        return true;
+    }
+    
+    bool TryPop(T& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mElements.empty())
+        {
+            return false;
+        }
+        value = std::move(mElements.front());
+        mElements.pop();
+        return true;
+    }
+    
+private:
+    std::mutex mMutex;
+    std::queue<T> mElements;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Hands a batch of elements from one producer thread to the (benchmark) consumer thread per iteration.
+template<typename QueueType, typename PushFunction, typename PopFunction>
+static void RunProducerConsumerBatches(benchmark::State& state, QueueType& queue, PushFunction pushFunction, PopFunction popFunction)
+{
+    for (auto _: state)
+    {
+        std::thread producer([&]()
+        {
+            for (int i = 0; i < QUEUE_BENCHMARK_BATCH_SIZE; ++i)
+            {
+                while (!pushFunction(queue, i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        
+        int poppedCount = 0;
+        int value = 0;
+        while (poppedCount < QUEUE_BENCHMARK_BATCH_SIZE)
+        {
+            if (popFunction(queue, value))
+            {
+                benchmark::DoNotOptimize(value);
+                poppedCount++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * QUEUE_BENCHMARK_BATCH_SIZE);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_SPSCRingBufferThroughput(benchmark::State& state)
+{
+    SPSCRingBuffer<int> queue(QUEUE_BENCHMARK_CAPACITY);
+    RunProducerConsumerBatches(state, queue, [](auto& q, int v){ return q.TryPush(v); }, [](auto& q, int& v){ return q.TryPop(v); });
+}
+BENCHMARK(BM_SPSCRingBufferThroughput)->UseRealTime();
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_MPSCRingBufferThroughput(benchmark::State& state)
+{
+    MPSCRingBuffer<int> queue(QUEUE_BENCHMARK_CAPACITY);
+    RunProducerConsumerBatches(state, queue, [](auto& q, int v){ return q.TryPush(v); }, [](auto& q, int& v){ return q.TryPop(v); });
+}
+BENCHMARK(BM_MPSCRingBufferThroughput)->UseRealTime();
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_BlockingQueueThroughput(benchmark::State& state)
+{
+    BlockingQueue<int> queue;
+    RunProducerConsumerBatches(state, queue, [](auto& q, int v){ return q.Push(v); }, [](auto& q, int& v){ return q.TryPop(v); });
+}
+BENCHMARK(BM_BlockingQueueThroughput)->UseRealTime();
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_MutexQueueThroughput(benchmark::State& state)
+{
+    MutexQueue<int> queue;
+    RunProducerConsumerBatches(state, queue, [](auto& q, int v){ return q.TryPush(v); }, [](auto& q, int& v){ return q.TryPop(v); });
+}
+BENCHMARK(BM_MutexQueueThroughput)->UseRealTime();
+
+///------------------------------------------------------------------------------------------------
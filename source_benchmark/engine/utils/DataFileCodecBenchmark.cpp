@@ -0,0 +1,84 @@
+///------------------------------------------------------------------------------------------------
+///  DataFileCodecBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/utils/DataFileCodec.h>
+#include <engine/utils/StringUtils.h>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+static nlohmann::json CreateRandomState(const int entryCount, std::mt19937& randomEngine)
+{
+    std::uniform_real_distribution<float> valueDistribution(-1000.0f, 1000.0f);
+    
+    nlohmann::json state;
+    for (int i = 0; i < entryCount; ++i)
+    {
+        nlohmann::json entry;
+        entry["name"] = "entry_" + std::to_string(i);
+        entry["position"] = { valueDistribution(randomEngine), valueDistribution(randomEngine), valueDistribution(randomEngine) };
+        entry["count"] = i;
+        state["entries"].push_back(entry);
+    }
+    return state;
+}
+
+///------------------------------------------------------------------------------------------------
+/// How data files were validated prior to CRC32C checksums (re-parse, re-serialize, hash), for reference.
+/// Arg: entry count.
+static void BM_DecodeLegacyJsonDataFile(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto dataFileState = CreateRandomState(static_cast<int>(state.range(0)), randomEngine);
+    const auto contents = dataFileState.dump(4) + "&" + std::to_string(strutils::GetLegacyStringHash(dataFileState.dump(4)));
+    
+    for (auto _: state)
+    {
+        nlohmann::json decodedState;
+        benchmark::DoNotOptimize(serial::DecodeDataFile(contents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, decodedState));
+    }
+    state.SetBytesProcessed(state.iterations() * contents.size());
+}
+BENCHMARK(BM_DecodeLegacyJsonDataFile)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+/// Arg: entry count.
+static void BM_DecodeJsonDataFile(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto contents = serial::EncodeDataFile(CreateRandomState(static_cast<int>(state.range(0)), randomEngine), serial::DataFileEncoding::JSON);
+    
+    for (auto _: state)
+    {
+        nlohmann::json decodedState;
+        benchmark::DoNotOptimize(serial::DecodeDataFile(contents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, decodedState));
+    }
+    state.SetBytesProcessed(state.iterations() * contents.size());
+    state.counters["file_bytes"] = static_cast<double>(contents.size());
+}
+BENCHMARK(BM_DecodeJsonDataFile)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+/// Arg: entry count.
+static void BM_DecodeBinaryDataFile(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto contents = serial::EncodeDataFile(CreateRandomState(static_cast<int>(state.range(0)), randomEngine), serial::DataFileEncoding::BINARY);
+    
+    for (auto _: state)
+    {
+        nlohmann::json decodedState;
+        benchmark::DoNotOptimize(serial::DecodeDataFile(contents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, decodedState));
+    }
+    state.SetBytesProcessed(state.iterations() * contents.size());
+    state.counters["file_bytes"] = static_cast<double>(contents.size());
+}
+BENCHMARK(BM_DecodeBinaryDataFile)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,79 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystemBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <engine/utils/JobSystem.h>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr size_t SCALING_BENCHMARK_ELEMENT_COUNT = 1 << 18;
+
+///------------------------------------------------------------------------------------------------
+/// Arg: total participating threads (1 to the core count).
+static void ApplyThreadCounts(benchmark::internal::Benchmark* benchmark)
+{
+    const auto coreCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int threadCount = 1; threadCount <= coreCount; threadCount *= 2)
+    {
+        benchmark->Arg(threadCount);
+    }
+    if ((coreCount & (coreCount - 1)) != 0)
+    {
+        benchmark->Arg(coreCount);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// Particle style integration over a large array, split into batches with ParallelFor.
+static void BM_ParallelForScaling(benchmark::State& state)
+{
+    JobSystem jobSystem(static_cast<int>(state.range(0)) - 1);
+
+    std::vector<float> positions(SCALING_BENCHMARK_ELEMENT_COUNT, 0.0f);
+    std::vector<float> velocities(SCALING_BENCHMARK_ELEMENT_COUNT, 1.0f);
+    for (auto _: state)
+    {
+        jobSystem.ParallelFor(positions.size(), 1024, [&](const size_t begin, const size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                velocities[i] += std::sin(positions[i]) * 0.016f;
+                positions[i] += velocities[i] * 0.016f;
+            }
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SCALING_BENCHMARK_ELEMENT_COUNT);
+}
+BENCHMARK(BM_ParallelForScaling)->Apply(ApplyThreadCounts)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+/// Overhead of tiny jobs, i.e. of the deques, stealing and parent/child bookkeeping themselves.
+static void BM_EmptyJobThroughput(benchmark::State& state)
+{
+    constexpr int JOBS_PER_ITERATION = 1024;
+    JobSystem jobSystem(static_cast<int>(state.range(0)) - 1);
+
+    for (auto _: state)
+    {
+        auto* rootJob = jobSystem.CreateJob(nullptr);
+        for (int i = 0; i < JOBS_PER_ITERATION; ++i)
+        {
+            jobSystem.Run(jobSystem.CreateJob([](){}, rootJob));
+        }
+        jobSystem.Run(rootJob);
+        jobSystem.Wait(rootJob);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+}
+BENCHMARK(BM_EmptyJobThroughput)->Apply(ApplyThreadCounts)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
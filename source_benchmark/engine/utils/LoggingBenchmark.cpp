@@ -0,0 +1,45 @@
+///------------------------------------------------------------------------------------------------
+///  LoggingBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/utils/Logging.h>
+#include <filesystem>
+
+///------------------------------------------------------------------------------------------------
+/// Log throughput of both logging modes (arg 0: synchronous, 1: asynchronous) under contention,
+/// writing to a file sink only so that terminal speed doesn't skew the results.
+static void BM_LogThroughput(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        logging::SetLoggingMode(state.range(0) == 0 ? logging::LoggingMode::SYNCHRONOUS : logging::LoggingMode::ASYNCHRONOUS);
+        logging::SetConsoleSinkEnabled(false);
+        logging::SetFileSink((std::filesystem::temp_directory_path() / "tinymmo_log_benchmark.log").string());
+    }
+
+    int messageIndex = 0;
+    for (auto _: state)
+    {
+        logging::Log(logging::LogType::INFO, "Benchmark message %d from thread %d at %.2f", messageIndex, state.thread_index(), 1.5f * messageIndex);
+        messageIndex++;
+    }
+
+    // Asynchronous messages only count once they have actually been written out
+    logging::Flush();
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        logging::SetFileSink("");
+        logging::SetConsoleSinkEnabled(true);
+        logging::SetLoggingMode(logging::LoggingMode::ASYNCHRONOUS);
+    }
+}
+BENCHMARK(BM_LogThroughput)->Arg(0)->Arg(1)->Threads(4)->UseRealTime();
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,164 @@
+///------------------------------------------------------------------------------------------------
+///  StringUtilsBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/utils/StringUtils.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+// The StringId layout prior to the interned 64-bit ids, for reference
+struct LegacyStringId
+{
+    explicit LegacyStringId(const std::string& str)
+    : mString(str)
+    , mStringId(strutils::GetLegacyStringHash(str))
+    {
+    }
+    
+    bool operator == (const LegacyStringId& rhs) const { return mStringId == rhs.mStringId; }
+    
+    std::string mString;
+    uint32_t mStringId;
+};
+
+struct LegacyStringIdHasher
+{
+    std::size_t operator()(const LegacyStringId& key) const { return key.mStringId; }
+};
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<std::string> CreateRandomStrings(const size_t stringLength, std::mt19937& randomEngine)
+{
+    std::uniform_int_distribution<int> characterDistribution('a', 'z');
+
+    std::vector<std::string> strings(1024);
+    for (auto& string: strings)
+    {
+        for (size_t i = 0; i < stringLength; ++i)
+        {
+            string += static_cast<char>(characterDistribution(randomEngine));
+        }
+    }
+    return strings;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_GetStringHash(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto strings = CreateRandomStrings(static_cast<size_t>(state.range(0)), randomEngine);
+
+    size_t stringIndex = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(strutils::GetStringHash(strings[stringIndex++ & 1023]));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GetStringHash)->Arg(8)->Arg(32)->Arg(128);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_GetLegacyStringHash(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto strings = CreateRandomStrings(static_cast<size_t>(state.range(0)), randomEngine);
+
+    size_t stringIndex = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(strutils::GetLegacyStringHash(strings[stringIndex++ & 1023]));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GetLegacyStringHash)->Arg(8)->Arg(32)->Arg(128);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_StringIdConstruction(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto strings = CreateRandomStrings(static_cast<size_t>(state.range(0)), randomEngine);
+
+    size_t stringIndex = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(strutils::StringId(strings[stringIndex++ & 1023]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["sizeof"] = sizeof(strutils::StringId);
+}
+BENCHMARK(BM_StringIdConstruction)->Arg(8)->Arg(32)->Arg(128);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_LegacyStringIdConstruction(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    const auto strings = CreateRandomStrings(static_cast<size_t>(state.range(0)), randomEngine);
+
+    size_t stringIndex = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(LegacyStringId(strings[stringIndex++ & 1023]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["sizeof"] = sizeof(LegacyStringId);
+}
+BENCHMARK(BM_LegacyStringIdConstruction)->Arg(8)->Arg(32)->Arg(128);
+
+///------------------------------------------------------------------------------------------------
+/// Keyed lookups (e.g. uniform values by name) with pre-constructed ids.
+static void BM_StringIdMapLookup(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    std::vector<strutils::StringId> stringIds;
+    std::unordered_map<strutils::StringId, float, strutils::StringIdHasher> values;
+    for (const auto& string: CreateRandomStrings(static_cast<size_t>(state.range(0)), randomEngine))
+    {
+        stringIds.emplace_back(string);
+        values[stringIds.back()] = 1.0f;
+    }
+
+    size_t stringIndex = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(values.find(stringIds[stringIndex++ & 1023]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StringIdMapLookup)->Arg(32);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_LegacyStringIdMapLookup(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    std::vector<LegacyStringId> stringIds;
+    std::unordered_map<LegacyStringId, float, LegacyStringIdHasher> values;
+    for (const auto& string: CreateRandomStrings(static_cast<size_t>(state.range(0)), randomEngine))
+    {
+        stringIds.emplace_back(string);
+        values[stringIds.back()] = 1.0f;
+    }
+
+    size_t stringIndex = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(values.find(stringIds[stringIndex++ & 1023]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LegacyStringIdMapLookup)->Arg(32);
+
+///------------------------------------------------------------------------------------------------
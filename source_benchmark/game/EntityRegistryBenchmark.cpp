@@ -0,0 +1,131 @@
+///------------------------------------------------------------------------------------------------
+///  EntityRegistryBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/scene/SceneObject.h>
+#include <game/EntityRegistry.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const float BENCHMARK_FRAME_MILLIS = 16.0f;
+static const float BENCHMARK_OBJECT_SPEED = 0.0001f;
+static const int SCENE_OBJECTS_PER_ENTITY = 2; // root & collider
+
+///------------------------------------------------------------------------------------------------
+
+// The container Game kept network objects in prior to the EntityRegistry, for reference
+struct LegacyObjectWrapper
+{
+    network::ObjectData mObjectData;
+    std::vector<std::shared_ptr<scene::SceneObject>> mSceneObjects;
+    ObjectAnimationHandle mAnimationHandle;
+};
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<network::ObjectData> CreateRemoteObjectData(const int objectCount, std::mt19937& randomEngine)
+{
+    std::uniform_real_distribution<float> positionDistribution(-1.0f, 1.0f);
+    std::vector<network::ObjectData> objectData(objectCount);
+
+    for (int i = 0; i < objectCount; ++i)
+    {
+        objectData[i] = {};
+        objectData[i].objectId = static_cast<network::objectId_t>(i + 1);
+        objectData[i].objectType = network::ObjectType::NPC;
+        objectData[i].speed = BENCHMARK_OBJECT_SPEED;
+        objectData[i].position = glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine), 1.0f);
+    }
+
+    return objectData;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void CreateSceneObjects(std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects)
+{
+    for (int i = 0; i < SCENE_OBJECTS_PER_ENTITY; ++i)
+    {
+        sceneObjects.push_back(std::make_shared<scene::SceneObject>());
+        if (i > 0)
+        {
+            sceneObjects.back()->mParent = sceneObjects.front();
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// Game's per frame pass over remote objects: chase the latest server position (the object's other layers follow as children).
+static void UpdateRemoteObject(const glm::vec3& targetPosition, const float speed, const std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects)
+{
+    const auto& rootSceneObject = sceneObjects.front();
+    auto vecToPosition = targetPosition - rootSceneObject->mPosition;
+    if (glm::length(vecToPosition) > 0.002f)
+    {
+        auto direction = glm::normalize(vecToPosition);
+        rootSceneObject->mPosition += glm::vec3(direction.x, direction.y, 0.0f) * speed * BENCHMARK_FRAME_MILLIS;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// Arg: entity count.
+static void BM_IterateEntitiesUnorderedMap(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    std::unordered_map<network::objectId_t, LegacyObjectWrapper> localObjectWrappers;
+    for (const auto& objectData: CreateRemoteObjectData(static_cast<int>(state.range(0)), randomEngine))
+    {
+        localObjectWrappers[objectData.objectId].mObjectData = objectData;
+        CreateSceneObjects(localObjectWrappers[objectData.objectId].mSceneObjects);
+    }
+
+    for (auto _: state)
+    {
+        for (auto& [objectId, objectWrapperData]: localObjectWrappers)
+        {
+            UpdateRemoteObject(objectWrapperData.mObjectData.position, objectWrapperData.mObjectData.speed, objectWrapperData.mSceneObjects);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IterateEntitiesUnorderedMap)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+/// Arg: entity count.
+static void BM_IterateEntityRegistry(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    EntityRegistry entityRegistry;
+    for (const auto& objectData: CreateRemoteObjectData(static_cast<int>(state.range(0)), randomEngine))
+    {
+        const auto entityHandle = entityRegistry.CreateEntity(objectData);
+        CreateSceneObjects(entityRegistry.GetRenderLink(entityHandle).mSceneObjects);
+    }
+
+    for (auto _: state)
+    {
+        const auto& networkStates = entityRegistry.GetNetworkStates();
+        const auto& interpolationBuffers = entityRegistry.GetInterpolationBuffers();
+        const auto& renderLinks = entityRegistry.GetRenderLinks();
+        for (size_t entityIndex = 0; entityIndex < entityRegistry.GetEntityCount(); ++entityIndex)
+        {
+            UpdateRemoteObject(interpolationBuffers[entityIndex].GetLatest(), networkStates[entityIndex].speed, renderLinks[entityIndex].mSceneObjects);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IterateEntityRegistry)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,177 @@
+///------------------------------------------------------------------------------------------------
+///  GameMessageHandlingBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/AnimationManager.h>
+#include <game/Game.h>
+#include <net_common/NetworkMessages.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const float BENCHMARK_OBJECT_SCALE = 0.1f;
+static const float FADE_OUT_FLUSH_MILLIS = 1000.0f;
+
+///------------------------------------------------------------------------------------------------
+
+static Game& GetBenchmarkGame()
+{
+    // Init() creates the game's scenes, so it only runs once for all benchmarks. No server connection is made.
+    static Game game;
+    static bool initialized = false;
+    if (!initialized)
+    {
+        game.Init();
+        initialized = true;
+    }
+    return game;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<network::ObjectData> CreateRemoteObjectData(const int objectCount, std::mt19937& randomEngine)
+{
+    std::uniform_real_distribution<float> positionDistribution(-1.0f, 1.0f);
+    std::vector<network::ObjectData> objectData(objectCount);
+
+    for (int i = 0; i < objectCount; ++i)
+    {
+        // Object ids start at 1 since 0 is the (unset) local player id, whose creation also loads its map
+        objectData[i] = {};
+        objectData[i].objectId = static_cast<network::objectId_t>(i + 1);
+        objectData[i].objectType = i % 4 == 0 ? network::ObjectType::PLAYER : network::ObjectType::NPC;
+        objectData[i].objectState = network::ObjectState::RUNNING;
+        objectData[i].objectScale = BENCHMARK_OBJECT_SCALE;
+        objectData[i].position = glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine), 1.0f);
+        objectData[i].velocity = glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine), 0.0f);
+    }
+
+    return objectData;
+}
+
+///------------------------------------------------------------------------------------------------
+
+template<typename MessageType>
+static void HandleMessage(Game& game, const MessageType& message)
+{
+    game.HandleServerMessage(reinterpret_cast<const unsigned char*>(&message), sizeof(message));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void DestroyRemoteObjects(Game& game, const std::vector<network::ObjectData>& objectData)
+{
+    for (const auto& data: objectData)
+    {
+        network::ObjectDestroyedMessage destroyedMessage = {};
+        destroyedMessage.objectId = data.objectId;
+        HandleMessage(game, destroyedMessage);
+    }
+
+    // Destroyed objects fade out first, and only then leave the world scene
+    CoreSystemsEngine::GetInstance().GetAnimationManager().Update(FADE_OUT_FLUSH_MILLIS);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_HandleObjectStateUpdateMessages(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto& game = GetBenchmarkGame();
+    const auto objectData = CreateRemoteObjectData(static_cast<int>(state.range(0)), randomEngine);
+
+    std::vector<network::ObjectStateUpdateMessage> stateUpdateMessages(objectData.size());
+    for (size_t i = 0; i < objectData.size(); ++i)
+    {
+        network::ObjectCreatedMessage createdMessage = {};
+        createdMessage.objectData = objectData[i];
+        HandleMessage(game, createdMessage);
+
+        stateUpdateMessages[i] = {};
+        stateUpdateMessages[i].objectData = objectData[i];
+    }
+
+    // The bulk of the server's traffic: a state update for every object in view, every tick
+    for (auto _: state)
+    {
+        for (const auto& stateUpdateMessage: stateUpdateMessages)
+        {
+            HandleMessage(game, stateUpdateMessage);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    DestroyRemoteObjects(game, objectData);
+}
+BENCHMARK(BM_HandleObjectStateUpdateMessages)->Arg(16)->Arg(128)->Arg(1024)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_HandleObjectCreatedMessages(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto& game = GetBenchmarkGame();
+    const auto objectData = CreateRemoteObjectData(static_cast<int>(state.range(0)), randomEngine);
+
+    std::vector<network::ObjectCreatedMessage> createdMessages(objectData.size());
+    for (size_t i = 0; i < objectData.size(); ++i)
+    {
+        createdMessages[i] = {};
+        createdMessages[i].objectData = objectData[i];
+    }
+
+    // Objects streaming into view (scene object & collider creation, texture/shader lookups)
+    for (auto _: state)
+    {
+        for (const auto& createdMessage: createdMessages)
+        {
+            HandleMessage(game, createdMessage);
+        }
+
+        state.PauseTiming();
+        DestroyRemoteObjects(game, objectData);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HandleObjectCreatedMessages)->Arg(16)->Arg(128)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_HandleNPCAttackMessages(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    auto& game = GetBenchmarkGame();
+    const auto objectData = CreateRemoteObjectData(static_cast<int>(state.range(0)), randomEngine);
+
+    std::vector<network::NPCAttackMessage> attackMessages(objectData.size());
+    for (size_t i = 0; i < objectData.size(); ++i)
+    {
+        network::ObjectCreatedMessage createdMessage = {};
+        createdMessage.objectData = objectData[i];
+        HandleMessage(game, createdMessage);
+
+        attackMessages[i] = {};
+        attackMessages[i].attackerId = objectData[i].objectId;
+    }
+
+    for (auto _: state)
+    {
+        for (const auto& attackMessage: attackMessages)
+        {
+            HandleMessage(game, attackMessage);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    DestroyRemoteObjects(game, objectData);
+}
+BENCHMARK(BM_HandleNPCAttackMessages)->Arg(16)->Arg(128)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,97 @@
+///------------------------------------------------------------------------------------------------
+///  EventSystemBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <game/events/EventSystem.h>
+#include <memory>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+class BenchmarkEvent final
+{
+public:
+    BenchmarkEvent(const int val) : mVal(val) {}
+    int GetVal() const { return mVal; }
+
+private:
+    int mVal = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+class UnlistenedBenchmarkEvent final
+{
+};
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_EventSystemDispatch(benchmark::State& state)
+{
+    auto randomEngine = benchmark_common::CreateSeededRandomEngine();
+    std::uniform_int_distribution<int> eventValueDistribution(0, 1000);
+
+    auto& eventSystem = events::EventSystem::GetInstance();
+
+    int64_t valueAccumulator = 0;
+    std::vector<std::unique_ptr<events::IListener>> listeners;
+    for (int i = 0; i < state.range(0); ++i)
+    {
+        listeners.push_back(eventSystem.RegisterForEvent<BenchmarkEvent>([&](const BenchmarkEvent& event){ valueAccumulator += event.GetVal(); }));
+    }
+
+    const auto eventValue = eventValueDistribution(randomEngine);
+    for (auto _: state)
+    {
+        eventSystem.DispatchEvent<BenchmarkEvent>(eventValue);
+    }
+    benchmark::DoNotOptimize(valueAccumulator);
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventSystemDispatch)->Arg(1)->Arg(16)->Arg(256);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_EventSystemDispatchWithoutListeners(benchmark::State& state)
+{
+    auto& eventSystem = events::EventSystem::GetInstance();
+    for (auto _: state)
+    {
+        eventSystem.DispatchEvent<UnlistenedBenchmarkEvent>();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventSystemDispatchWithoutListeners);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_EventSystemRegisterDispatchAndDestroyListener(benchmark::State& state)
+{
+    auto& eventSystem = events::EventSystem::GetInstance();
+
+    // Short lived listeners on top of long lived ones (e.g. UI elements coming & going on a populated scene)
+    int64_t valueAccumulator = 0;
+    std::vector<std::unique_ptr<events::IListener>> listeners;
+    for (int i = 0; i < state.range(0); ++i)
+    {
+        listeners.push_back(eventSystem.RegisterForEvent<BenchmarkEvent>([&](const BenchmarkEvent& event){ valueAccumulator += event.GetVal(); }));
+    }
+
+    for (auto _: state)
+    {
+        auto listener = eventSystem.RegisterForEvent<BenchmarkEvent>([&](const BenchmarkEvent& event){ valueAccumulator -= event.GetVal(); });
+        eventSystem.DispatchEvent<BenchmarkEvent>(1);
+    }
+    benchmark::DoNotOptimize(valueAccumulator);
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventSystemRegisterDispatchAndDestroyListener)->Arg(1)->Arg(16)->Arg(256);
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,167 @@
+///------------------------------------------------------------------------------------------------
+///  MapLoadingBenchmark.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <BenchmarkCommon.h>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/resloading/ResourceLoadingService.h>
+#include <filesystem>
+#include <fstream>
+#include <map/GlobalMapDataRepository.h>
+#include <nlohmann/json.hpp>
+#include <SDL_image.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string EDITOR_MAPS_DIRECTORY = benchmark_common::BENCHMARK_ASSETS_ROOT + "data/editor/maps/";
+static const std::string MAP_TEXTURES_DIRECTORY = benchmark_common::BENCHMARK_ASSETS_ROOT + "textures/world/maps/";
+static const std::string MAP_LAYER_SUFFIXES[] = { "_top_layer.png", "_bottom_layer.png", "_navmap.png" };
+
+///------------------------------------------------------------------------------------------------
+
+static std::string ReadFileContents(const std::string& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<std::string> GetEditorMapFilePaths()
+{
+    // Sorted, so that the order (and the result of every iteration) is identical between runs
+    std::vector<std::string> filePaths;
+    for (const auto& entry: std::filesystem::directory_iterator(EDITOR_MAPS_DIRECTORY))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".json")
+        {
+            filePaths.push_back(entry.path().generic_string());
+        }
+    }
+    std::sort(filePaths.begin(), filePaths.end());
+    return filePaths;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<std::string> GetMapLayerTextureFilePaths()
+{
+    std::vector<std::string> filePaths;
+    for (const auto& mapFilePath: GetEditorMapFilePaths())
+    {
+        const auto mapName = std::filesystem::path(mapFilePath).stem().string();
+        for (const auto& mapLayerSuffix: MAP_LAYER_SUFFIXES)
+        {
+            const auto mapLayerFilePath = MAP_TEXTURES_DIRECTORY + mapName + "/" + mapName + mapLayerSuffix;
+            if (std::filesystem::exists(mapLayerFilePath))
+            {
+                filePaths.push_back(mapLayerFilePath);
+            }
+        }
+    }
+    return filePaths;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_ParseEditorMapJson(benchmark::State& state)
+{
+    std::vector<std::string> mapFileContents;
+    int64_t totalBytes = 0;
+    for (const auto& mapFilePath: GetEditorMapFilePaths())
+    {
+        mapFileContents.push_back(ReadFileContents(mapFilePath));
+        totalBytes += static_cast<int64_t>(mapFileContents.back().size());
+    }
+
+    for (auto _: state)
+    {
+        for (const auto& contents: mapFileContents)
+        {
+            benchmark::DoNotOptimize(nlohmann::json::parse(contents));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * totalBytes);
+    state.counters["maps"] = static_cast<double>(mapFileContents.size());
+}
+BENCHMARK(BM_ParseEditorMapJson)->Unit(benchmark::kMillisecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_LoadMapDefinitions(benchmark::State& state)
+{
+    // Includes the (cached after the first iteration) data file lookup through the ResourceLoadingService
+    auto& globalMapDataRepository = GlobalMapDataRepository::GetInstance();
+    for (auto _: state)
+    {
+        globalMapDataRepository.LoadMapDefinitions();
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_LoadMapDefinitions)->Unit(benchmark::kMicrosecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_DecodeMapLayerPNGs(benchmark::State& state)
+{
+    std::vector<std::string> pngFileContents;
+    int64_t totalPixels = 0;
+    for (const auto& mapLayerFilePath: GetMapLayerTextureFilePaths())
+    {
+        pngFileContents.push_back(ReadFileContents(mapLayerFilePath));
+    }
+
+    for (auto _: state)
+    {
+        totalPixels = 0;
+        for (const auto& contents: pngFileContents)
+        {
+            auto* surface = IMG_Load_RW(SDL_RWFromConstMem(contents.data(), static_cast<int>(contents.size())), 1);
+            if (surface)
+            {
+                totalPixels += static_cast<int64_t>(surface->w) * surface->h;
+                SDL_FreeSurface(surface);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * totalPixels);
+    state.counters["images"] = static_cast<double>(pngFileContents.size());
+}
+BENCHMARK(BM_DecodeMapLayerPNGs)->Unit(benchmark::kMillisecond);
+
+///------------------------------------------------------------------------------------------------
+
+static void BM_LoadMapLayerTextureResources(benchmark::State& state)
+{
+    // The whole loading path (file system, decoded image cache, texture creation) the game goes through
+    // on a map change. The decoded image cache is warm after the first iteration, as on any non first launch.
+    auto& resourceLoadingService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+    const auto mapLayerFilePaths = GetMapLayerTextureFilePaths();
+
+    for (auto _: state)
+    {
+        for (const auto& mapLayerFilePath: mapLayerFilePaths)
+        {
+            const auto resourceId = resourceLoadingService.LoadResource(mapLayerFilePath, resources::ResourceReloadMode::DONT_RELOAD, resources::ResourceLoadingPathType::ABSOLUTE);
+            benchmark::DoNotOptimize(resourceId);
+
+            state.PauseTiming();
+            resourceLoadingService.UnloadResource(resourceId);
+            state.ResumeTiming();
+        }
+    }
+    state.counters["images"] = static_cast<double>(mapLayerFilePaths.size());
+}
+BENCHMARK(BM_LoadMapLayerTextureResources)->Unit(benchmark::kMillisecond);
+
+///------------------------------------------------------------------------------------------------
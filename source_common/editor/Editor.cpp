@@ -18,6 +18,7 @@
 #include <engine/rendering/Fonts.h>
 #include <engine/rendering/ParticleManager.h>
 #include <engine/rendering/RenderingUtils.h>
+#include <engine/rendering/TextureCooking.h>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/resloading/ImageSurfaceResource.h>
 #include <engine/resloading/TextureResource.h>
@@ -44,6 +45,8 @@
 #include <platform_utilities/AppleUtils.h>
 #elif defined(WINDOWS)
 #include <platform_utilities/WindowsUtils.h>
+#elif defined(LINUX)
+#include <platform_utilities/LinuxUtils.h>
 #endif
 
 ///------------------------------------------------------------------------------------------------
@@ -75,6 +78,7 @@ static Editor::MapTileData BLANK_TRANSPARENT_TILE_DATA = {};
 static constexpr int TILESET_SIZE = 64;
 static constexpr int TILESET_TILE_SIZE = 16;
 static const float TILE_UV_SIZE = static_cast<float>(TILESET_TILE_SIZE)/static_cast<float>(TILESET_SIZE);
+static constexpr bool MAP_LAYER_TEXTURE_NN_FILTERING = true; // Pixel art tiles, kept crisp when magnified
 
 static constexpr int DEFAULT_GRID_ROWS = 32;
 static constexpr int DEFAULT_GRID_COLS = 32;
@@ -109,6 +113,8 @@ Editor::Editor(const int argc, char** argv)
     
 #if defined(MACOS) || defined(MOBILE_FLOW)
     apple_utils::SetAssetFolder();
+#elif defined(LINUX)
+    linux_utils::SetAssetFolder();
 #endif
     
     CoreSystemsEngine::GetInstance().Start([&](){ Init(); }, [&](const float dtMillis){ Update(dtMillis); }, [&](){ ApplicationMovedToBackground(); }, [&](){ WindowResize(); }, [&](){ CreateDebugWidgets(); }, [&](){ OnOneSecondElapsed(); });
@@ -156,7 +162,7 @@ void Editor::Update(const float dtMillis)
     auto& inputStateManager = systemsEngine.GetInputStateManager();
     auto scene = systemsEngine.GetSceneManager().FindScene(EDITOR_SCENE);
     
-    auto worldTouchPos = inputStateManager.VGetPointingPosInWorldSpace(scene->GetCamera().GetViewMatrix(), scene->GetCamera().GetProjMatrix());
+    auto worldTouchPos = inputStateManager.VGetPointingPosInWorldSpace(scene->GetCamera());
     
     // Skip input handling if ImGUI wants it
     ImGuiIO& io = ImGui::GetIO();
@@ -261,7 +267,7 @@ void Editor::Update(const float dtMillis)
     bool commandModifierDown =
 #if defined(MACOS)
         (inputStateManager.VKeyPressed(input::Key::LCMD) || inputStateManager.VKeyPressed(input::Key::RCMD));
-#elif defined(WINDOWS)
+#elif defined(WINDOWS) || defined(LINUX)
         (inputStateManager.VKeyPressed(input::Key::LCTL) || inputStateManager.VKeyPressed(input::Key::RCTL));
 #endif
     bool shiftModifierDown = (inputStateManager.VKeyPressed(input::Key::LSFT) || inputStateManager.VKeyPressed(input::Key::RSFT));
@@ -275,7 +281,7 @@ void Editor::Update(const float dtMillis)
             mViewOptions.mCameraZoom = mViewOptions.mCameraZoom * (scrollDelta.y > 0 ? ZOOM_SPEED : 1/ZOOM_SPEED);
             scene->GetCamera().SetZoomFactor(mViewOptions.mCameraZoom);
             
-            auto newWorldTouchPos = inputStateManager.VGetPointingPosInWorldSpace(scene->GetCamera().GetViewMatrix(), scene->GetCamera().GetProjMatrix());
+            auto newWorldTouchPos = inputStateManager.VGetPointingPosInWorldSpace(scene->GetCamera());
             mViewOptions.mCameraPosition.x -= newWorldTouchPos.x - worldTouchPos.x;
             mViewOptions.mCameraPosition.y -= newWorldTouchPos.y - worldTouchPos.y;
         }
@@ -870,6 +876,10 @@ void Editor::CreateDebugWidgets()
                     rendering::ExportPixelsToPNG(NON_SANDBOXED_MAP_TEXTURES_FOLDER + mapName + "/" + mapName + "_bottom_layer.png", &botLayerPixels[0], map_constants::CLIENT_WORLD_MAP_IMAGE_SIZE);
                     rendering::ExportPixelsToPNG(NON_SANDBOXED_MAP_TEXTURES_FOLDER + mapName + "/" + mapName + "_top_layer.png", &topLayerPixels[0], map_constants::CLIENT_WORLD_MAP_IMAGE_SIZE);
                     
+                    // Cook mipmapped, GPU compressed versions of the layers for the runtime to prefer
+                    rendering::CookAndExportTexture(NON_SANDBOXED_MAP_TEXTURES_FOLDER + mapName + "/" + mapName + "_bottom_layer.png", &botLayerPixels[0], map_constants::CLIENT_WORLD_MAP_IMAGE_SIZE, MAP_LAYER_TEXTURE_NN_FILTERING);
+                    rendering::CookAndExportTexture(NON_SANDBOXED_MAP_TEXTURES_FOLDER + mapName + "/" + mapName + "_top_layer.png", &topLayerPixels[0], map_constants::CLIENT_WORLD_MAP_IMAGE_SIZE, MAP_LAYER_TEXTURE_NN_FILTERING);
+                    
                     // Render map navmap texture
                     unsigned char navmapPixels[network::NAVMAP_SIZE * network::NAVMAP_SIZE * 4] = { 0 };
                     
@@ -26,6 +26,7 @@ namespace resources { class ResourceLoadingService; }
 namespace sound { class SoundManager; }
 namespace scene { class SceneManager; }
 
+class JobSystem;
 struct SDL_Window;
 using SDL_GLContext = void*;
 
@@ -42,6 +43,27 @@ public:
     const CoreSystemsEngine& operator = (const CoreSystemsEngine&) = delete;
     CoreSystemsEngine& operator = (CoreSystemsEngine&&) = delete;
     
+    /// Runs the engine without a window or GL context (for simulation, networking and resource
+    /// decoding runs on machines without a display/GPU). Must be set before the first GetInstance() call.
+    /// Setting the TINYMMO_HEADLESS=1 environment variable has the same effect. Headless runs record
+    /// scenes through a null renderer instead (see rendering::NullRenderer), whereas setting
+    /// TINYMMO_OFFSCREEN=1 keeps the platform renderer but renders into a hidden offscreen (EGL) window.
+    static void SetHeadless(const bool headless);
+    static bool IsHeadless();
+    
+    ///-----------------------------------------------------------------------------------------------
+    /// Game logic (client updates, animations, particles & camera updates) runs in fixed steps of
+    /// 1/stepsPerSecond seconds (60 by default) decoupled from the render rate, with scenes rendered
+    /// interpolated between the last two simulated states \see FixedTimestep.
+    void SetSimulationStepsPerSecond(const float stepsPerSecond);
+    float GetSimulationStepsPerSecond() const;
+    
+    ///-----------------------------------------------------------------------------------------------
+    /// Unfocused, input idle and minimized clients are throttled to lower frame rates \see FrameLimiter.
+    /// The given function is invoked at a steady cadence (see FrameLimiter::MAX_SLEEP_SLICE_MILLIS) while
+    /// throttled frames are slept off, e.g. to keep servicing the network regardless of the frame rate.
+    void SetThrottledFrameTickFunction(std::function<void()> throttledFrameTickFunction);
+    
     bool IsShuttingDown();
     void Start(std::function<void()> clientInitFunction, std::function<void(const float)> clientUpdateFunction, std::function<void()> clientApplicationMovedToBackgroundFunction, std::function<void()> clientApplicationWindowResizeFunction, std::function<void()> clientCreateDebugWidgetsFunction, std::function<void()> clientOnOneSecondElapsedFunction);
     
@@ -53,6 +75,7 @@ public:
     scene::SceneManager& GetSceneManager();
     resources::ResourceLoadingService& GetResourceLoadingService();
     sound::SoundManager& GetSoundManager();
+    JobSystem& GetJobSystem();
     
     float GetDefaultAspectRatio() const;
     SDL_Window& GetContextWindow() const;
@@ -65,6 +88,7 @@ public:
 private:
     CoreSystemsEngine() = default;
     void Initialize();
+    void InitializeHeadless();
     void CreateEngineDebugWidgets();
 
 private:
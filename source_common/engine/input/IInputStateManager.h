@@ -15,6 +15,10 @@
 
 ///------------------------------------------------------------------------------------------------
 
+namespace rendering { class Camera; }
+
+///------------------------------------------------------------------------------------------------
+
 namespace input
 {
 
@@ -59,7 +63,7 @@ public:
     
     virtual const glm::vec2& VGetPointingPos() const = 0;
     virtual const glm::ivec2& VGetScrollDelta() const = 0;
-    virtual glm::vec2 VGetPointingPosInWorldSpace(const glm::mat4& viewMatrix, const glm::mat4& projMatrix) const = 0;
+    virtual glm::vec2 VGetPointingPosInWorldSpace(const rendering::Camera& camera) const = 0;
     
     virtual bool VButtonPressed(const Button button) const = 0;
     virtual bool VButtonTapped(const Button button) const = 0;
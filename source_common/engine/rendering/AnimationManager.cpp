@@ -5,10 +5,13 @@
 ///  Created by Alex Koukoulas on 09/10/2023
 ///------------------------------------------------------------------------------------------------
 
+#include <algorithm>
 #include <engine/rendering/AnimationManager.h>
 #include <engine/scene/SceneObject.h>
 #include <engine/scene/Scene.h>
+#include <engine/utils/JobSystem.h>
 #include <engine/utils/Logging.h>
+#include <engine/utils/Profiler.h>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -17,15 +20,77 @@ namespace rendering
 
 ///------------------------------------------------------------------------------------------------
 
-void AnimationManager::StartAnimation(std::unique_ptr<IAnimation> animation, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+// Tweens are cheap to update, so jobs only pay off for largish batches of them
+static constexpr size_t PARALLEL_UPDATE_MIN_TWEENS_PER_JOB = 256;
+
+///------------------------------------------------------------------------------------------------
+
+static float GetUpdateTimeMillis(const scene::SceneObject* sceneObject, const float dtMillis)
 {
-    if (mAnimationContainerLocked)
-    {
-        mAnimationsToAdd.emplace_back(AnimationEntry{ std::move(animation), onCompleteCallback, animationName });
-    }
-    else
+    return dtMillis * (sceneObject && sceneObject->mScene ? sceneObject->mScene->GetUpdateTimeSpeedFactor() : 1.0f);
+}
+
+template<typename TweenType>
+static AnimationUpdateResult UpdateAnimation(TweenType& tween, const float dtMillis)
+{
+    return tween.Update(GetUpdateTimeMillis(tween.GetSceneObject(), dtMillis));
+}
+
+static AnimationUpdateResult UpdateAnimation(std::unique_ptr<IAnimation>& animation, const float dtMillis)
+{
+    return animation->VUpdate(GetUpdateTimeMillis(animation->VGetSceneObject().get(), dtMillis));
+}
+
+///------------------------------------------------------------------------------------------------
+
+AnimationHandle AnimationManager::StartAnimation(std::unique_ptr<IAnimation> animation, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+{
+    const auto* sceneObject = animation->VGetSceneObject().get();
+    return AddAnimation(mGenericAnimations, AnimationKind::GENERIC, std::move(animation), sceneObject, std::move(onCompleteCallback), animationName);
+}
+
+AnimationHandle AnimationManager::StartAnimation(PositionScaleTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+{
+    const auto* sceneObject = tween.GetSceneObject();
+    return AddAnimation(mPositionScaleTweens, AnimationKind::POSITION_SCALE_TWEEN, std::move(tween), sceneObject, std::move(onCompleteCallback), animationName);
+}
+
+AnimationHandle AnimationManager::StartAnimation(RotationTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+{
+    const auto* sceneObject = tween.GetSceneObject();
+    return AddAnimation(mRotationTweens, AnimationKind::ROTATION_TWEEN, std::move(tween), sceneObject, std::move(onCompleteCallback), animationName);
+}
+
+AnimationHandle AnimationManager::StartAnimation(AlphaTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+{
+    const auto* sceneObject = tween.GetSceneObject();
+    return AddAnimation(mAlphaTweens, AnimationKind::ALPHA_TWEEN, std::move(tween), sceneObject, std::move(onCompleteCallback), animationName);
+}
+
+AnimationHandle AnimationManager::StartAnimation(ValueTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+{
+    return AddAnimation(mValueTweens, AnimationKind::VALUE_TWEEN, std::move(tween), nullptr, std::move(onCompleteCallback), animationName);
+}
+
+AnimationHandle AnimationManager::StartAnimation(PulseTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+{
+    const auto* sceneObject = tween.GetSceneObject();
+    return AddAnimation(mPulseTweens, AnimationKind::PULSE_TWEEN, std::move(tween), sceneObject, std::move(onCompleteCallback), animationName);
+}
+
+AnimationHandle AnimationManager::StartAnimation(BezierTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName /* = strutils::StringId() */)
+{
+    const auto* sceneObject = tween.GetSceneObject();
+    return AddAnimation(mBezierTweens, AnimationKind::BEZIER_TWEEN, std::move(tween), sceneObject, std::move(onCompleteCallback), animationName);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AnimationManager::StopAnimation(const AnimationHandle& animationHandle)
+{
+    if (IsAnimationPlaying(animationHandle))
     {
-        mAnimations.emplace_back(AnimationEntry{ std::move(animation), onCompleteCallback, animationName });
+        RemoveAnimation(animationHandle.mSlotIndex);
     }
 }
 
@@ -33,42 +98,29 @@ void AnimationManager::StartAnimation(std::unique_ptr<IAnimation> animation, std
 
 void AnimationManager::StopAnimation(const strutils::StringId& animationName)
 {
-    if (mAnimationContainerLocked)
+    auto findIter = mNamedSlotIndices.find(animationName);
+    if (findIter != mNamedSlotIndices.end())
     {
-        mAnimationNamesToRemove.emplace_back(animationName);
-    }
-    else
-    {
-        auto findIter = std::find_if(mAnimations.cbegin(), mAnimations.cend(), [&](const AnimationEntry& entry) { return entry.mAnimationName == animationName; });
-        if (findIter != mAnimations.cend())
-        {
-            mAnimations.erase(findIter);
-        }
+        RemoveAnimation(findIter->second.front());
     }
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void AnimationManager::StopAllAnimationsPlayingForSceneObject(const strutils::StringId& sceneObjectName)
+void AnimationManager::StopAllAnimationsPlayingForSceneObject(const scene::SceneObject& sceneObject)
 {
-    for(auto iter = mAnimations.begin(); iter != mAnimations.end();)
+    auto findIter = mSceneObjectSlotIndices.find(&sceneObject);
+    if (findIter == mSceneObjectSlotIndices.end())
     {
-        if (iter->mAnimation->VGetSceneObject() && iter->mAnimation->VGetSceneObject()->mName == sceneObjectName)
-        {
-            if (mAnimationContainerLocked)
-            {
-                auto tempAnimationName = strutils::StringId("TEMP");
-                iter->mAnimationName = tempAnimationName;
-                mAnimationNamesToRemove.emplace_back(tempAnimationName);
-            }
-            else
-            {
-                iter = mAnimations.erase(iter);
-                continue;
-            }
-        }
-        
-        iter++;
+        return;
+    }
+    
+    const auto slotIndices = std::move(findIter->second);
+    mSceneObjectSlotIndices.erase(findIter);
+    
+    for (const auto slotIndex: slotIndices)
+    {
+        RemoveAnimation(slotIndex);
     }
 }
 
@@ -76,107 +128,286 @@ void AnimationManager::StopAllAnimationsPlayingForSceneObject(const strutils::St
 
 void AnimationManager::StopAllAnimations()
 {
-    if (mAnimationContainerLocked)
+    ForEachPool([&](auto& pool)
     {
-        for (auto& animation: mAnimationsToAdd)
-        {
-            mAnimationNamesToRemove.push_back(animation.mAnimationName);
-        }
-        for (auto& animation: mAnimations)
+        for (const auto slotIndex: pool.mSlotIndices)
         {
-            mAnimationNamesToRemove.push_back(animation.mAnimationName);
+            auto& slot = mSlots[slotIndex];
+            slot.mGeneration++;
+            slot.mCompletionCallback = nullptr;
+            slot.mAnimationName = strutils::StringId();
+            mFreeSlotIndices.push_back(slotIndex);
         }
-    }
-    else
-    {
-        mAnimationsToAdd.clear();
-        mAnimations.clear();
-    }
+        
+        pool.mAnimations.clear();
+        pool.mSlotIndices.clear();
+        pool.mSharedTargetAnimationCount = 0;
+    });
+    
+    mSceneObjectSlotIndices.clear();
+    mNamedSlotIndices.clear();
 }
 
 ///------------------------------------------------------------------------------------------------
 
 void AnimationManager::Update(const float dtMillis)
 {
-    mAnimationContainerLocked = true;
-    for(auto iter = mAnimations.begin(); iter != mAnimations.end();)
+    PROFILE_SCOPE("AnimationManager::Update");
+    
+    // Pools are updated one after the other, so that animations of different kinds never race each other
+    UpdatePool(mPositionScaleTweens, dtMillis, true);
+    UpdatePool(mRotationTweens, dtMillis, true);
+    UpdatePool(mAlphaTweens, dtMillis, true);
+    UpdatePool(mPulseTweens, dtMillis, true);
+    
+    // Value & bezier tweens write through arbitrary (possibly shared) pointers, and generic animations to arbitrary state
+    UpdatePool(mValueTweens, dtMillis, false);
+    UpdatePool(mBezierTweens, dtMillis, false);
+    UpdatePool(mGenericAnimations, dtMillis, false);
+    
+    mFinishedAnimations.clear();
+    ForEachPool([&](auto& pool)
+    {
+        for (size_t i = 0; i < pool.mUpdateResults.size(); ++i)
+        {
+            if (pool.mUpdateResults[i] == AnimationUpdateResult::FINISHED)
+            {
+                const auto slotIndex = pool.mSlotIndices[i];
+                mFinishedAnimations.push_back(AnimationHandle{ slotIndex, mSlots[slotIndex].mGeneration });
+            }
+        }
+    });
+    
+    std::sort(mFinishedAnimations.begin(), mFinishedAnimations.end(), [&](const AnimationHandle& lhs, const AnimationHandle& rhs){ return mSlots[lhs.mSlotIndex].mStartIndex < mSlots[rhs.mSlotIndex].mStartIndex; });
+    
+    for (const auto& animationHandle: mFinishedAnimations)
     {
-        if (std::find(mAnimationNamesToRemove.cbegin(), mAnimationNamesToRemove.cend(), iter->mAnimationName) != mAnimationNamesToRemove.cend())
+        // Stopped by an earlier callback
+        if (!IsAnimationPlaying(animationHandle))
         {
-            ++iter;
             continue;
         }
         
-        auto updateTimeMillis = dtMillis * (iter->mAnimation->VGetSceneObject() && iter->mAnimation->VGetSceneObject()->mScene ? iter->mAnimation->VGetSceneObject()->mScene->GetUpdateTimeSpeedFactor() : 1.0f);
+        auto completionCallback = std::move(mSlots[animationHandle.mSlotIndex].mCompletionCallback);
+        RemoveAnimation(animationHandle.mSlotIndex);
         
-        if (iter->mAnimation->VUpdate(updateTimeMillis) == AnimationUpdateResult::FINISHED)
-        {
-            iter->mCompletionCallback();
-            iter = mAnimations.erase(iter);
-        }
-        else
+        if (completionCallback)
         {
-            ++iter;
+            completionCallback();
         }
     }
-    mAnimationContainerLocked = false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AnimationManager::IsAnimationPlaying(const AnimationHandle& animationHandle) const
+{
+    return animationHandle.mSlotIndex < mSlots.size() && mSlots[animationHandle.mSlotIndex].mGeneration == animationHandle.mGeneration;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AnimationManager::IsAnimationPlaying(const strutils::StringId& animationName) const
+{
+    return mNamedSlotIndices.count(animationName) != 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+int AnimationManager::GetAnimationCountPlayingForSceneObject(const scene::SceneObject& sceneObject) const
+{
+    auto findIter = mSceneObjectSlotIndices.find(&sceneObject);
+    return findIter != mSceneObjectSlotIndices.cend() ? static_cast<int>(findIter->second.size()) : 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+int AnimationManager::GetAnimationsPlayingCount() const
+{
+    return static_cast<int>(mSlots.size() - mFreeSlotIndices.size());
+}
+
+///------------------------------------------------------------------------------------------------
+
+int AnimationManager::GetAnimationCountPlayingWithName(const strutils::StringId& animationName) const
+{
+    auto findIter = mNamedSlotIndices.find(animationName);
+    return findIter != mNamedSlotIndices.cend() ? static_cast<int>(findIter->second.size()) : 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+template<typename AnimationType>
+AnimationHandle AnimationManager::AddAnimation(AnimationPool<AnimationType>& pool, const AnimationKind kind, AnimationType animation, const scene::SceneObject* sceneObject, std::function<void()> onCompleteCallback, const strutils::StringId& animationName)
+{
+    uint32_t slotIndex = 0;
+    if (mFreeSlotIndices.empty())
+    {
+        slotIndex = static_cast<uint32_t>(mSlots.size());
+        mSlots.emplace_back();
+    }
+    else
+    {
+        slotIndex = mFreeSlotIndices.back();
+        mFreeSlotIndices.pop_back();
+    }
+    
+    auto& slot = mSlots[slotIndex];
+    slot.mCompletionCallback = std::move(onCompleteCallback);
+    slot.mAnimationName = animationName;
+    slot.mSceneObject = sceneObject;
+    slot.mStartIndex = mNextStartIndex++;
+    slot.mAnimationIndex = static_cast<uint32_t>(pool.mAnimations.size());
+    slot.mKind = kind;
+    slot.mSharesTarget = false;
     
-    for (const auto& animationName: mAnimationNamesToRemove)
+    pool.mAnimations.push_back(std::move(animation));
+    pool.mSlotIndices.push_back(slotIndex);
+    
+    if (sceneObject)
     {
-        auto findIter = std::find_if(mAnimations.cbegin(), mAnimations.cend(), [&](const AnimationEntry& entry) { return entry.mAnimationName == animationName; });
-        if (findIter != mAnimations.cend())
-        {
-            mAnimations.erase(findIter);
-        }
+        auto& sceneObjectSlotIndices = mSceneObjectSlotIndices[sceneObject];
+        slot.mSharesTarget = std::any_of(sceneObjectSlotIndices.cbegin(), sceneObjectSlotIndices.cend(), [&](const uint32_t otherSlotIndex){ return mSlots[otherSlotIndex].mKind == kind; });
+        sceneObjectSlotIndices.push_back(slotIndex);
+    }
+    
+    if (slot.mSharesTarget)
+    {
+        pool.mSharedTargetAnimationCount++;
     }
     
-    for (auto& animationEntry: mAnimationsToAdd)
+    if (!animationName.isEmpty())
     {
-        mAnimations.emplace_back(std::move(animationEntry));
+        mNamedSlotIndices[animationName].push_back(slotIndex);
     }
     
-    mAnimationsToAdd.clear();
-    mAnimationNamesToRemove.clear();
+    return AnimationHandle{ slotIndex, slot.mGeneration };
 }
 
 ///------------------------------------------------------------------------------------------------
 
-bool AnimationManager::IsAnimationPlaying(const strutils::StringId& animationName) const
+template<typename AnimationType>
+void AnimationManager::UpdatePool(AnimationPool<AnimationType>& pool, const float dtMillis, const bool allowParallelUpdate)
 {
-    auto findIter = std::find_if(mAnimations.cbegin(), mAnimations.cend(), [&](const AnimationEntry& entry) { return entry.mAnimationName == animationName; });
-    return findIter != mAnimations.cend();
+    const auto animationCount = pool.mAnimations.size();
+    pool.mUpdateResults.resize(animationCount);
+    
+    const auto updateAnimations = [&pool, dtMillis](const size_t begin, const size_t end)
+    {
+        for (auto i = begin; i < end; ++i)
+        {
+            pool.mUpdateResults[i] = UpdateAnimation(pool.mAnimations[i], dtMillis);
+        }
+    };
+    
+    // Tweens of the same kind on the same target would race each other
+    if (allowParallelUpdate && pool.mSharedTargetAnimationCount == 0)
+    {
+        CoreSystemsEngine::GetInstance().GetJobSystem().ParallelFor(animationCount, PARALLEL_UPDATE_MIN_TWEENS_PER_JOB, updateAnimations);
+    }
+    else
+    {
+        updateAnimations(0, animationCount);
+    }
 }
 
 ///------------------------------------------------------------------------------------------------
 
-int AnimationManager::GetAnimationCountPlayingForSceneObject(const strutils::StringId& sceneObjectName)
+template<typename AnimationType>
+void AnimationManager::RemoveFromPool(AnimationPool<AnimationType>& pool, const AnimationSlot& slot)
 {
-    auto count = 0;
-    for(auto iter = mAnimations.begin(); iter != mAnimations.end(); iter++)
+    // Swap-remove, repointing the slot of the animation moved into the gap
+    const auto animationIndex = slot.mAnimationIndex;
+    const auto lastAnimationIndex = pool.mAnimations.size() - 1;
+    if (animationIndex != lastAnimationIndex)
     {
-        if (iter->mAnimation->VGetSceneObject() && iter->mAnimation->VGetSceneObject()->mName == sceneObjectName)
-        {
-            count++;
-        }
+        pool.mAnimations[animationIndex] = std::move(pool.mAnimations[lastAnimationIndex]);
+        pool.mSlotIndices[animationIndex] = pool.mSlotIndices[lastAnimationIndex];
+        mSlots[pool.mSlotIndices[animationIndex]].mAnimationIndex = animationIndex;
     }
     
-    return count;
+    pool.mAnimations.pop_back();
+    pool.mSlotIndices.pop_back();
+    
+    if (slot.mSharesTarget)
+    {
+        pool.mSharedTargetAnimationCount--;
+    }
 }
 
 ///------------------------------------------------------------------------------------------------
 
-int AnimationManager::GetAnimationsPlayingCount() const
+template<typename Function>
+void AnimationManager::VisitPool(const AnimationKind kind, Function&& function)
+{
+    switch (kind)
+    {
+        case AnimationKind::POSITION_SCALE_TWEEN: function(mPositionScaleTweens); break;
+        case AnimationKind::ROTATION_TWEEN: function(mRotationTweens); break;
+        case AnimationKind::ALPHA_TWEEN: function(mAlphaTweens); break;
+        case AnimationKind::VALUE_TWEEN: function(mValueTweens); break;
+        case AnimationKind::PULSE_TWEEN: function(mPulseTweens); break;
+        case AnimationKind::BEZIER_TWEEN: function(mBezierTweens); break;
+        case AnimationKind::GENERIC: function(mGenericAnimations); break;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+template<typename Function>
+void AnimationManager::ForEachPool(Function&& function)
 {
-    return static_cast<int>(mAnimations.size());
+    function(mPositionScaleTweens);
+    function(mRotationTweens);
+    function(mAlphaTweens);
+    function(mValueTweens);
+    function(mPulseTweens);
+    function(mBezierTweens);
+    function(mGenericAnimations);
 }
 
 ///------------------------------------------------------------------------------------------------
 
-int AnimationManager::GetAnimationCountPlayingWithName(const strutils::StringId& animationName) const
+void AnimationManager::RemoveAnimation(const uint32_t slotIndex)
 {
-    return
-          static_cast<int>(std::count_if(mAnimations.begin(), mAnimations.end(), [=](const AnimationEntry& animationEntry){ return animationEntry.mAnimationName == animationName; }))
-    + static_cast<int>(std::count_if(mAnimationsToAdd.begin(), mAnimationsToAdd.end(), [=](const AnimationEntry& animationEntry){ return animationEntry.mAnimationName == animationName; })) - static_cast<int>(std::count(mAnimationNamesToRemove.begin(), mAnimationNamesToRemove.end(), animationName));
+    auto& slot = mSlots[slotIndex];
+    VisitPool(slot.mKind, [&](auto& pool){ RemoveFromPool(pool, slot); });
+    
+    if (slot.mSceneObject)
+    {
+        // Already gone when stopping all of the scene object's animations
+        auto findIter = mSceneObjectSlotIndices.find(slot.mSceneObject);
+        if (findIter != mSceneObjectSlotIndices.end())
+        {
+            auto& sceneObjectSlotIndices = findIter->second;
+            auto slotIndexIter = std::find(sceneObjectSlotIndices.begin(), sceneObjectSlotIndices.end(), slotIndex);
+            *slotIndexIter = sceneObjectSlotIndices.back();
+            sceneObjectSlotIndices.pop_back();
+            
+            if (sceneObjectSlotIndices.empty())
+            {
+                mSceneObjectSlotIndices.erase(findIter);
+            }
+        }
+    }
+    
+    if (!slot.mAnimationName.isEmpty())
+    {
+        auto findIter = mNamedSlotIndices.find(slot.mAnimationName);
+        auto& namedSlotIndices = findIter->second;
+        namedSlotIndices.erase(std::find(namedSlotIndices.begin(), namedSlotIndices.end(), slotIndex));
+        
+        if (namedSlotIndices.empty())
+        {
+            mNamedSlotIndices.erase(findIter);
+        }
+    }
+    
+    slot.mGeneration++;
+    slot.mCompletionCallback = nullptr;
+    slot.mAnimationName = strutils::StringId();
+    slot.mSceneObject = nullptr;
+    mFreeSlotIndices.push_back(slotIndex);
 }
 
 ///------------------------------------------------------------------------------------------------
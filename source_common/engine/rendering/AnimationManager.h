@@ -10,10 +10,13 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include <cstdint>
 #include <engine/CoreSystemsEngine.h>
 #include <engine/rendering/Animations.h>
+#include <engine/rendering/Tweens.h>
 #include <engine/utils/StringUtils.h>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -24,19 +27,48 @@ namespace rendering
 {
 
 ///------------------------------------------------------------------------------------------------
+/// Identifies a started animation. Handles outlive their animations: once an animation has finished
+/// or been stopped its handle simply reports it as no longer playing, even if its slot gets reused.
+struct AnimationHandle
+{
+    static constexpr uint32_t INVALID_SLOT_INDEX = std::numeric_limits<uint32_t>::max();
+    
+    uint32_t mSlotIndex = INVALID_SLOT_INDEX;
+    uint32_t mGeneration = 0;
+};
 
+///------------------------------------------------------------------------------------------------
+/// Animations are kept in one densely packed pool per kind: one per tween type (\see Tweens.h), updated
+/// without any virtual dispatch, plus one for all other (IAnimation based) animations. Finished and
+/// stopped animations are swap-removed from their pool, and the animations of each scene object and
+/// name are indexed, so that stopping & querying them does not scan the pools.
+/// To be used from the main thread only.
 class AnimationManager final
 {
     friend struct CoreSystemsEngine::SystemsImpl;
 public:
-    void StartAnimation(std::unique_ptr<IAnimation> animation, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    AnimationHandle StartAnimation(std::unique_ptr<IAnimation> animation, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    AnimationHandle StartAnimation(PositionScaleTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    AnimationHandle StartAnimation(RotationTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    AnimationHandle StartAnimation(AlphaTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    AnimationHandle StartAnimation(ValueTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    AnimationHandle StartAnimation(PulseTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    AnimationHandle StartAnimation(BezierTween tween, std::function<void()> onCompleteCallback, const strutils::StringId animationName = strutils::StringId());
+    
+    void StopAnimation(const AnimationHandle& animationHandle);
+    
+    /// Stops the oldest animation playing with the given (non empty) name.
     void StopAnimation(const strutils::StringId& animationName);
-    void StopAllAnimationsPlayingForSceneObject(const strutils::StringId& sceneObjectName);
+    void StopAllAnimationsPlayingForSceneObject(const scene::SceneObject& sceneObject);
     void StopAllAnimations();
+    
+    /// Completion callbacks are invoked after all animations have been updated, in the order the
+    /// animations were started, and can freely start & stop animations.
     void Update(const float dtMillis);
     
+    bool IsAnimationPlaying(const AnimationHandle& animationHandle) const;
     bool IsAnimationPlaying(const strutils::StringId& animationName) const;
-    int GetAnimationCountPlayingForSceneObject(const strutils::StringId& sceneObjectName);
+    int GetAnimationCountPlayingForSceneObject(const scene::SceneObject& sceneObject) const;
     int GetAnimationsPlayingCount() const;
     int GetAnimationCountPlayingWithName(const strutils::StringId& animationName) const;
     
@@ -44,17 +76,71 @@ private:
     AnimationManager() = default;
     
 private:
-    struct AnimationEntry
+    enum class AnimationKind : uint8_t
+    {
+        POSITION_SCALE_TWEEN,
+        ROTATION_TWEEN,
+        ALPHA_TWEEN,
+        VALUE_TWEEN,
+        PULSE_TWEEN,
+        BEZIER_TWEEN,
+        GENERIC
+    };
+    
+    template<typename AnimationType>
+    struct AnimationPool
+    {
+        std::vector<AnimationType> mAnimations;
+        std::vector<uint32_t> mSlotIndices; // per animation
+        std::vector<AnimationUpdateResult> mUpdateResults; // per animation, as of the last update
+        size_t mSharedTargetAnimationCount = 0; // animations started on a target that already had one of the same kind
+    };
+    
+    // Per started animation data that is not needed for updating it
+    struct AnimationSlot
     {
-        std::unique_ptr<IAnimation> mAnimation;
         std::function<void()> mCompletionCallback;
         strutils::StringId mAnimationName;
+        const scene::SceneObject* mSceneObject = nullptr;
+        uint64_t mStartIndex = 0;
+        uint32_t mGeneration = 0;
+        uint32_t mAnimationIndex = 0; // in its kind's pool
+        AnimationKind mKind = AnimationKind::GENERIC;
+        bool mSharesTarget = false;
     };
     
-    std::vector<AnimationEntry> mAnimations;
-    std::vector<AnimationEntry> mAnimationsToAdd;
-    std::vector<strutils::StringId> mAnimationNamesToRemove;
-    bool mAnimationContainerLocked = false;
+    template<typename AnimationType>
+    AnimationHandle AddAnimation(AnimationPool<AnimationType>& pool, const AnimationKind kind, AnimationType animation, const scene::SceneObject* sceneObject, std::function<void()> onCompleteCallback, const strutils::StringId& animationName);
+    
+    template<typename AnimationType>
+    void UpdatePool(AnimationPool<AnimationType>& pool, const float dtMillis, const bool allowParallelUpdate);
+    
+    template<typename AnimationType>
+    void RemoveFromPool(AnimationPool<AnimationType>& pool, const AnimationSlot& slot);
+    
+    template<typename Function>
+    void VisitPool(const AnimationKind kind, Function&& function);
+    
+    template<typename Function>
+    void ForEachPool(Function&& function);
+    
+    void RemoveAnimation(const uint32_t slotIndex);
+    
+private:
+    AnimationPool<PositionScaleTween> mPositionScaleTweens;
+    AnimationPool<RotationTween> mRotationTweens;
+    AnimationPool<AlphaTween> mAlphaTweens;
+    AnimationPool<ValueTween> mValueTweens;
+    AnimationPool<PulseTween> mPulseTweens;
+    AnimationPool<BezierTween> mBezierTweens;
+    AnimationPool<std::unique_ptr<IAnimation>> mGenericAnimations;
+    
+    std::vector<AnimationSlot> mSlots;
+    std::vector<uint32_t> mFreeSlotIndices;
+    std::unordered_map<const scene::SceneObject*, std::vector<uint32_t>> mSceneObjectSlotIndices;
+    std::unordered_map<strutils::StringId, std::vector<uint32_t>, strutils::StringIdHasher> mNamedSlotIndices; // in starting order
+    std::vector<AnimationHandle> mFinishedAnimations;
+    uint64_t mNextStartIndex = 0;
 };
 
 ///------------------------------------------------------------------------------------------------
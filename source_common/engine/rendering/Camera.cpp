@@ -5,6 +5,7 @@
 ///  Created by Alex Koukoulas on 20/09/2023
 ///------------------------------------------------------------------------------------------------
 
+#include <atomic>
 #include <engine/CoreSystemsEngine.h>
 #include <engine/rendering/Camera.h>
 #include <engine/utils/Logging.h>
@@ -32,6 +33,9 @@ static const float DEFAULT_CAMERA_ZFAR        = 50.0f;
 static const float DEFAULT_CAMERA_ZOOM_FACTOR = 60.0f;
 static const float SHAKE_MIN_RADIUS = 0.00001f;
 
+// Shared by all cameras, so that no two cameras (or two states of the same camera) share a version
+static std::atomic<uint64_t> sNextCameraVersion = 1;
+
 #if defined(MOBILE_FLOW)
 //static const float IPAD_TARGET_LANDSCAPE_ZOOM_FACTOR = 48.483414f;
 //static const float IPAD_TARGET_PORTRAIT_ZOOM_FACTOR = 20.0f;
@@ -51,6 +55,9 @@ Camera::Camera(const float cameraLenseHeight)
     : mZoomFactor(DEFAULT_CAMERA_ZOOM_FACTOR)
     , mTargetAspectRatio(CoreSystemsEngine::GetInstance().GetDefaultAspectRatio())
     , mPosition(DEFAULT_CAMERA_POSITION)
+    , mView(0.0f)
+    , mProj(0.0f)
+    , mVersion(0)
 {
     mCameraLenseWidth = cameraLenseHeight * DEVICE_INVARIABLE_ASPECT;
     mCameraLenseHeight = cameraLenseHeight;
@@ -61,19 +68,60 @@ Camera::Camera(const float cameraLenseHeight)
 ///------------------------------------------------------------------------------------------------
 
 void Camera::RecalculateMatrices()
+{
+    RecalculateMatrices(CoreSystemsEngine::GetInstance().GetContextRenderableDimensions());
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Camera::RecalculateMatrices(const glm::vec2& renderableDimensions)
 {
     //float previousZoomFactor = mZoomFactor;
-    const auto& windowDimensions = CoreSystemsEngine::GetInstance().GetContextRenderableDimensions();
-    const auto& currentAspect = static_cast<float>(windowDimensions.x)/windowDimensions.y;
+    const auto& currentAspect = static_cast<float>(renderableDimensions.x)/renderableDimensions.y;
     const auto& currentToDefaultAspectRatio = (currentAspect/mTargetAspectRatio + 1.0f)/2.0f;
     float zoomFactor = mZoomFactor * currentToDefaultAspectRatio;
-    //logging::Log(logging::LogType::INFO, "Recalculating Matrices for %.3f, %.3f (AR %.6f)", windowDimensions.x, windowDimensions.y, windowDimensions.x/windowDimensions.y);
+    //logging::Log(logging::LogType::INFO, "Recalculating Matrices for %.3f, %.3f (AR %.6f)", renderableDimensions.x, renderableDimensions.y, renderableDimensions.x/renderableDimensions.y);
     
-    float aspect = windowDimensions.x/windowDimensions.y;
-    mView = glm::lookAt(mPosition, mPosition + DEFAULT_CAMERA_FRONT_VECTOR, DEFAULT_CAMERA_UP_VECTOR);
-    mProj = glm::ortho((-mCameraLenseWidth/(DEVICE_INVARIABLE_ASPECT/aspect))/2.0f/zoomFactor, (mCameraLenseWidth/((DEVICE_INVARIABLE_ASPECT/aspect)))/2.0f/zoomFactor, -mCameraLenseHeight/2.0f/zoomFactor, mCameraLenseHeight/2.0f/zoomFactor, DEFAULT_CAMERA_ZNEAR, DEFAULT_CAMERA_ZFAR);
+    float aspect = renderableDimensions.x/renderableDimensions.y;
+    const auto view = glm::lookAt(mPosition, mPosition + DEFAULT_CAMERA_FRONT_VECTOR, DEFAULT_CAMERA_UP_VECTOR);
+    const auto proj = glm::ortho((-mCameraLenseWidth/(DEVICE_INVARIABLE_ASPECT/aspect))/2.0f/zoomFactor, (mCameraLenseWidth/((DEVICE_INVARIABLE_ASPECT/aspect)))/2.0f/zoomFactor, -mCameraLenseHeight/2.0f/zoomFactor, mCameraLenseHeight/2.0f/zoomFactor, DEFAULT_CAMERA_ZNEAR, DEFAULT_CAMERA_ZFAR);
     
     mTargetAspectRatio = currentAspect;
+    
+    // Nothing derived needs to change (and nothing downstream needs to be redone) if the matrices are the same
+    if (mVersion != 0 && view == mView && proj == mProj)
+    {
+        return;
+    }
+    
+    mView = view;
+    mProj = proj;
+    mViewProj = mProj * mView;
+    mInverseViewProj = glm::inverse(mViewProj);
+    
+    // Extract rows from combined view projection matrix
+    const auto rowX = glm::row(mViewProj, 0);
+    const auto rowY = glm::row(mViewProj, 1);
+    const auto rowZ = glm::row(mViewProj, 2);
+    const auto rowW = glm::row(mViewProj, 3);
+
+    // Calculate planes
+    mFrustum[0] = glm::normalize(rowW + rowX);
+    mFrustum[1] = glm::normalize(rowW - rowX);
+    mFrustum[2] = glm::normalize(rowW + rowY);
+    mFrustum[3] = glm::normalize(rowW - rowY);
+    mFrustum[4] = glm::normalize(rowW + rowZ);
+    mFrustum[5] = glm::normalize(rowW - rowZ);
+
+    // Normalize planes
+    for (auto i = 0U; i < math::FRUSTUM_SIDES; ++i)
+    {
+        glm::vec3 planeNormal(mFrustum[i].x, mFrustum[i].y, mFrustum[i].z);
+        const auto length = glm::length(planeNormal);
+        mFrustum[i] = -mFrustum[i] / length;
+    }
+    
+    mVersion = sNextCameraVersion++;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -120,34 +168,46 @@ const glm::mat4& Camera::GetProjMatrix() const
 
 ///------------------------------------------------------------------------------------------------
 
-math::Frustum Camera::CalculateFrustum() const
+const glm::mat4& Camera::GetViewProjMatrix() const
 {
-    math::Frustum cameraFrustum;
-    auto viewProjectionMatrix = mProj * mView;
+    return mViewProj;
+}
 
-    // Extract rows from combined view projection matrix
-    const auto rowX = glm::row(viewProjectionMatrix, 0);
-    const auto rowY = glm::row(viewProjectionMatrix, 1);
-    const auto rowZ = glm::row(viewProjectionMatrix, 2);
-    const auto rowW = glm::row(viewProjectionMatrix, 3);
+///------------------------------------------------------------------------------------------------
 
-    // Calculate planes
-    cameraFrustum[0] = glm::normalize(rowW + rowX);
-    cameraFrustum[1] = glm::normalize(rowW - rowX);
-    cameraFrustum[2] = glm::normalize(rowW + rowY);
-    cameraFrustum[3] = glm::normalize(rowW - rowY);
-    cameraFrustum[4] = glm::normalize(rowW + rowZ);
-    cameraFrustum[5] = glm::normalize(rowW - rowZ);
+const glm::mat4& Camera::GetInverseViewProjMatrix() const
+{
+    return mInverseViewProj;
+}
 
-    // Normalize planes
-    for (auto i = 0U; i < math::FRUSTUM_SIDES; ++i)
-    {
-        glm::vec3 planeNormal(cameraFrustum[i].x, cameraFrustum[i].y, cameraFrustum[i].z);
-        const auto length = glm::length(planeNormal);
-        cameraFrustum[i] = -cameraFrustum[i] / length;
-    }
+///------------------------------------------------------------------------------------------------
+
+const math::Frustum& Camera::GetFrustum() const
+{
+    return mFrustum;
+}
+
+///------------------------------------------------------------------------------------------------
+
+uint64_t Camera::GetVersion() const
+{
+    return mVersion;
+}
+
+///------------------------------------------------------------------------------------------------
 
-    return cameraFrustum;
+glm::vec2 Camera::ScreenToWorldPos(const glm::vec2& screenPos) const
+{
+    const auto worldPos = mInverseViewProj * glm::vec4(screenPos.x, screenPos.y, 1.0f, 1.0f);
+    return glm::vec2(worldPos.x, worldPos.y);
+}
+
+///------------------------------------------------------------------------------------------------
+
+glm::vec2 Camera::WorldToScreenPos(const glm::vec3& worldPos) const
+{
+    const auto screenPos = mViewProj * glm::vec4(worldPos, 1.0f);
+    return glm::vec2(screenPos.x, screenPos.y)/screenPos.w;
 }
 
 ///------------------------------------------------------------------------------------------------
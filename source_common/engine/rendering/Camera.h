@@ -10,6 +10,7 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include <cstdint>
 #include <engine/utils/MathUtils.h>
 #include <functional>
 
@@ -30,6 +31,7 @@ public:
     Camera(const float cameraLenseHeight);
     
     void RecalculateMatrices();
+    void RecalculateMatrices(const glm::vec2& renderableDimensions);
     
     float GetZoomFactor() const;
     float GetCameraLenseWidth() const;
@@ -37,7 +39,20 @@ public:
     const glm::vec3& GetPosition() const;
     const glm::mat4& GetViewMatrix() const;
     const glm::mat4& GetProjMatrix() const;
-    math::Frustum CalculateFrustum() const;
+    const glm::mat4& GetViewProjMatrix() const;
+    const glm::mat4& GetInverseViewProjMatrix() const;
+    const math::Frustum& GetFrustum() const;
+    
+    ///-----------------------------------------------------------------------------------------------
+    /// Changes whenever any of the camera's matrices (or its frustum) change. Versions are unique across
+    /// cameras too, so a single cached version is enough to tell whether some derived state (e.g. uploaded
+    /// shader uniforms) is stale.
+    uint64_t GetVersion() const;
+    
+    ///-----------------------------------------------------------------------------------------------
+    /// Conversions between world space & normalized screen space ([-1, 1] on both axes, y pointing up).
+    glm::vec2 ScreenToWorldPos(const glm::vec2& screenPos) const;
+    glm::vec2 WorldToScreenPos(const glm::vec3& worldPos) const;
     
     ///-----------------------------------------------------------------------------------------------
     /// Performs a camera shake.
@@ -75,6 +90,10 @@ private:
     glm::vec3 mPosition;
     glm::mat4 mView;
     glm::mat4 mProj;
+    glm::mat4 mViewProj;
+    glm::mat4 mInverseViewProj;
+    math::Frustum mFrustum;
+    uint64_t mVersion;
     std::function<void()> mCameraShakeEndCallback;
 };
 
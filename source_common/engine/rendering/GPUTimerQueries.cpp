@@ -0,0 +1,178 @@
+///------------------------------------------------------------------------------------------------
+///  GPUTimerQueries.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <cassert>
+#include <engine/rendering/GPUTimerQueries.h>
+#include <engine/rendering/OpenGL.h>
+#include <engine/rendering/RenderingUtils.h>
+#include <engine/utils/Logging.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+GPUTimerQueries::~GPUTimerQueries()
+{
+#if defined(GL_TIME_ELAPSED)
+    if (!mSupported)
+    {
+        return;
+    }
+
+    for (auto& frame: mBufferedFrames)
+    {
+        for (auto& pass: frame.mPasses)
+        {
+            GL_CALL(glDeleteQueries(1, &pass.mQueryId));
+        }
+        frame.mPasses.clear();
+    }
+#endif
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GPUTimerQueries::Initialize()
+{
+#if defined(GL_TIME_ELAPSED)
+    // Core since desktop GL 3.3
+    GLint majorVersion = 0, minorVersion = 0;
+    GL_CALL(glGetIntegerv(GL_MAJOR_VERSION, &majorVersion));
+    GL_CALL(glGetIntegerv(GL_MINOR_VERSION, &minorVersion));
+    mSupported = majorVersion > 3 || (majorVersion == 3 && minorVersion >= 3) || IsGLExtensionSupported("GL_ARB_timer_query");
+#else
+    mSupported = false;
+#endif
+
+    if (!mSupported)
+    {
+        logging::Log(logging::LogType::WARNING, "GPU timer queries unsupported, only CPU render pass timings will be available");
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool GPUTimerQueries::IsSupported() const
+{
+    return mSupported;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GPUTimerQueries::BeginFrame()
+{
+    assert(!mPassActive);
+
+    mCurrentFrameIndex = (mCurrentFrameIndex + 1) % BUFFERED_FRAME_COUNT;
+    auto& frame = mBufferedFrames[mCurrentFrameIndex];
+
+    ResolveFrame(frame);
+    frame.mRecordedPassCount = 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GPUTimerQueries::BeginPass(const strutils::StringId& passName)
+{
+    assert(!mPassActive && "GPU timed passes can't be nested");
+
+    auto& frame = mBufferedFrames[mCurrentFrameIndex];
+    if (frame.mRecordedPassCount == frame.mPasses.size())
+    {
+        frame.mPasses.emplace_back();
+#if defined(GL_TIME_ELAPSED)
+        if (mSupported)
+        {
+            GL_CALL(glGenQueries(1, &frame.mPasses.back().mQueryId));
+        }
+#endif
+    }
+
+    auto& pass = frame.mPasses[frame.mRecordedPassCount];
+    pass.mTiming = PassTiming();
+    pass.mTiming.mPassName = passName;
+
+#if defined(GL_TIME_ELAPSED)
+    if (mSupported)
+    {
+        GL_CALL(glBeginQuery(GL_TIME_ELAPSED, pass.mQueryId));
+    }
+#endif
+
+    mPassActive = true;
+    mPassCPUStartTime = std::chrono::steady_clock::now();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GPUTimerQueries::EndPass()
+{
+    assert(mPassActive);
+
+    auto& frame = mBufferedFrames[mCurrentFrameIndex];
+    auto& pass = frame.mPasses[frame.mRecordedPassCount++];
+    pass.mTiming.mCPUMillis = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mPassCPUStartTime).count()/1000.0f;
+
+#if defined(GL_TIME_ELAPSED)
+    if (mSupported)
+    {
+        GL_CALL(glEndQuery(GL_TIME_ELAPSED));
+    }
+#endif
+
+    mPassActive = false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::vector<PassTiming>& GPUTimerQueries::GetResolvedPassTimings() const
+{
+    return mResolvedPassTimings;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GPUTimerQueries::ResolveFrame(BufferedFrame& frame)
+{
+    if (frame.mRecordedPassCount == 0)
+    {
+        return;
+    }
+
+    mResolvedPassTimings.clear();
+    for (size_t i = 0; i < frame.mRecordedPassCount; ++i)
+    {
+        auto timing = frame.mPasses[i].mTiming;
+
+#if defined(GL_TIME_ELAPSED)
+        if (mSupported)
+        {
+            // Never wait on results (that would stall the CPU on the GPU), rather skip them for this frame
+            GLint resultAvailable = 0;
+            GL_CALL(glGetQueryObjectiv(frame.mPasses[i].mQueryId, GL_QUERY_RESULT_AVAILABLE, &resultAvailable));
+            if (resultAvailable)
+            {
+                GLuint64 elapsedNanos = 0;
+                GL_CALL(glGetQueryObjectui64v(frame.mPasses[i].mQueryId, GL_QUERY_RESULT, &elapsedNanos));
+                timing.mGPUMillis = static_cast<float>(elapsedNanos/1000000.0);
+                timing.mGPUMillisAvailable = true;
+            }
+        }
+#endif
+
+        mResolvedPassTimings.push_back(timing);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
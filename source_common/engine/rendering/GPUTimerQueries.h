@@ -0,0 +1,99 @@
+///------------------------------------------------------------------------------------------------
+///  GPUTimerQueries.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef GPUTimerQueries_h
+#define GPUTimerQueries_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <engine/utils/StringUtils.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+using GLuint = unsigned int;
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+/// CPU submission and GPU execution time of a single render pass.
+struct PassTiming
+{
+    strutils::StringId mPassName;
+    float mCPUMillis = 0.0f;
+    float mGPUMillis = 0.0f;
+    bool mGPUMillisAvailable = false; // unsupported queries, or results not ready in time
+};
+
+///------------------------------------------------------------------------------------------------
+/// Times render passes (scene renders, the deferred object pass etc.) on both the CPU and the GPU,
+/// the latter via GL_TIME_ELAPSED queries. Queries are double buffered: the results of a frame are
+/// only read back two frames later (by which point the GPU is done with them), so that the CPU never
+/// stalls waiting on the GPU. Where timer queries are unsupported (e.g. OpenGL ES) only the CPU side
+/// is timed. Passes can't be nested (only one GL_TIME_ELAPSED query can be active at a time).
+class GPUTimerQueries final
+{
+public:
+    static constexpr size_t BUFFERED_FRAME_COUNT = 2;
+
+    GPUTimerQueries() = default;
+
+    /// Releases the generated queries (the GL context they were generated in needs to still be current).
+    ~GPUTimerQueries();
+
+    GPUTimerQueries(const GPUTimerQueries&) = delete;
+    GPUTimerQueries(GPUTimerQueries&&) = delete;
+    const GPUTimerQueries& operator = (const GPUTimerQueries&) = delete;
+    GPUTimerQueries& operator = (GPUTimerQueries&&) = delete;
+
+    /// To be called once a GL context is current.
+    void Initialize();
+    bool IsSupported() const;
+
+    /// Resolves the oldest buffered frame's passes, and starts recording the current frame's in its place.
+    void BeginFrame();
+    void BeginPass(const strutils::StringId& passName);
+    void EndPass();
+
+    /// @returns the passes of the latest resolved frame (i.e. BUFFERED_FRAME_COUNT frames ago) in recording order.
+    const std::vector<PassTiming>& GetResolvedPassTimings() const;
+
+private:
+    struct BufferedPass
+    {
+        PassTiming mTiming;
+        GLuint mQueryId = 0;
+    };
+
+    struct BufferedFrame
+    {
+        std::vector<BufferedPass> mPasses; // grown on demand, and reused (along with their queries) frame to frame
+        size_t mRecordedPassCount = 0;
+    };
+
+    void ResolveFrame(BufferedFrame& frame);
+
+private:
+    BufferedFrame mBufferedFrames[BUFFERED_FRAME_COUNT];
+    std::vector<PassTiming> mResolvedPassTimings;
+    std::chrono::steady_clock::time_point mPassCPUStartTime;
+    size_t mCurrentFrameIndex = 0;
+    bool mSupported = false;
+    bool mPassActive = false;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* GPUTimerQueries_h */
@@ -0,0 +1,656 @@
+///------------------------------------------------------------------------------------------------
+///  MeshCooking.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <engine/rendering/MeshCooking.h>
+#include <engine/utils/FileUtils.h>
+#include <engine/utils/StringUtils.h>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float) && sizeof(glm::vec2) == 2 * sizeof(float), "Cooked mesh attributes are expected to be tightly packed");
+
+struct CookedMeshFileHeader
+{
+    char mMagic[4];
+    uint32_t mVersion;
+    uint32_t mVertexCount;
+    uint32_t mIndexCount;
+    uint32_t mIndexSize;
+    float mDimensions[3];
+};
+
+static_assert(sizeof(CookedMeshFileHeader) == 32, "Cooked mesh header is expected to be 32 bytes");
+
+///------------------------------------------------------------------------------------------------
+/// Forsyth's vertex cache optimization tuning (https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html)
+static constexpr float CACHE_DECAY_POWER = 1.5f;
+static constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+///------------------------------------------------------------------------------------------------
+
+struct OBJVertexKey
+{
+    int32_t mPositionIndex;
+    int32_t mTexCoordIndex;
+    int32_t mNormalIndex;
+
+    bool operator == (const OBJVertexKey& other) const
+    {
+        return mPositionIndex == other.mPositionIndex && mTexCoordIndex == other.mTexCoordIndex && mNormalIndex == other.mNormalIndex;
+    }
+};
+
+struct OBJVertexKeyHasher
+{
+    std::size_t operator()(const OBJVertexKey& key) const
+    {
+        auto hash = static_cast<uint64_t>(static_cast<uint32_t>(key.mPositionIndex));
+        hash = hash * 0x9E3779B97F4A7C15ULL + static_cast<uint32_t>(key.mTexCoordIndex);
+        hash = hash * 0x9E3779B97F4A7C15ULL + static_cast<uint32_t>(key.mNormalIndex);
+        return static_cast<std::size_t>(hash ^ (hash >> 32));
+    }
+};
+
+///------------------------------------------------------------------------------------------------
+
+static inline void SkipSpaces(const char*& cursor, const char* end)
+{
+    while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r'))
+    {
+        ++cursor;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// Locale independent (unlike scanf/strtof) decimal float parsing
+static bool ParseFloat(const char*& cursor, const char* end, float& outValue)
+{
+    SkipSpaces(cursor, end);
+
+    auto isNegative = false;
+    if (cursor < end && (*cursor == '-' || *cursor == '+'))
+    {
+        isNegative = *cursor == '-';
+        ++cursor;
+    }
+
+    uint64_t mantissa = 0;
+    int decimalExponent = 0;
+    auto digitCount = 0;
+
+    for (; cursor < end && *cursor >= '0' && *cursor <= '9'; ++cursor, ++digitCount)
+    {
+        if (mantissa < 1000000000000000000ULL) mantissa = mantissa * 10 + static_cast<uint64_t>(*cursor - '0');
+        else decimalExponent++;
+    }
+
+    if (cursor < end && *cursor == '.')
+    {
+        for (++cursor; cursor < end && *cursor >= '0' && *cursor <= '9'; ++cursor, ++digitCount)
+        {
+            if (mantissa < 1000000000000000000ULL)
+            {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*cursor - '0');
+                decimalExponent--;
+            }
+        }
+    }
+
+    if (digitCount == 0)
+    {
+        return false;
+    }
+
+    if (cursor < end && (*cursor == 'e' || *cursor == 'E'))
+    {
+        ++cursor;
+        auto isExponentNegative = false;
+        if (cursor < end && (*cursor == '-' || *cursor == '+'))
+        {
+            isExponentNegative = *cursor == '-';
+            ++cursor;
+        }
+
+        auto exponent = 0;
+        for (; cursor < end && *cursor >= '0' && *cursor <= '9'; ++cursor)
+        {
+            exponent = std::min(exponent * 10 + (*cursor - '0'), 1000);
+        }
+        decimalExponent += isExponentNegative ? -exponent : exponent;
+    }
+
+    const auto value = static_cast<double>(mantissa) * std::pow(10.0, decimalExponent);
+    outValue = static_cast<float>(isNegative ? -value : value);
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool ParseInt(const char*& cursor, const char* end, int32_t& outValue)
+{
+    auto isNegative = false;
+    if (cursor < end && (*cursor == '-' || *cursor == '+'))
+    {
+        isNegative = *cursor == '-';
+        ++cursor;
+    }
+
+    if (cursor == end || *cursor < '0' || *cursor > '9')
+    {
+        return false;
+    }
+
+    int64_t value = 0;
+    for (; cursor < end && *cursor >= '0' && *cursor <= '9'; ++cursor)
+    {
+        value = std::min<int64_t>(value * 10 + (*cursor - '0'), std::numeric_limits<int32_t>::max());
+    }
+
+    outValue = static_cast<int32_t>(isNegative ? -value : value);
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+/// Resolves a 1 based (or negative, relative to the end) OBJ index to a 0 based one
+static bool ResolveOBJIndex(const int32_t objIndex, const size_t elementCount, int32_t& outIndex)
+{
+    const auto resolvedIndex = objIndex > 0 ? static_cast<int64_t>(objIndex) - 1 : static_cast<int64_t>(elementCount) + objIndex;
+    if (objIndex == 0 || resolvedIndex < 0 || resolvedIndex >= static_cast<int64_t>(elementCount))
+    {
+        return false;
+    }
+
+    outIndex = static_cast<int32_t>(resolvedIndex);
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static float ComputeVertexScore(const int cachePosition, const uint32_t remainingValence)
+{
+    if (remainingValence == 0)
+    {
+        return -1.0f;
+    }
+
+    auto score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        // The vertices of the last triangle get a fixed score so that strips of triangles are not favoured over fans
+        score = cachePosition < 3 ? LAST_TRIANGLE_SCORE : std::pow(1.0f - static_cast<float>(cachePosition - 3)/(VERTEX_CACHE_OPTIMIZATION_CACHE_SIZE - 3), CACHE_DECAY_POWER);
+    }
+
+    // Vertices with few triangles left get boosted, so that lone triangles don't get left behind
+    return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingValence), -VALENCE_BOOST_POWER);
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ImportOBJMesh(const char* data, const size_t size, CookedMesh& outMesh)
+{
+    outMesh = CookedMesh();
+
+    std::vector<glm::vec3> objPositions;
+    std::vector<glm::vec2> objTexCoords;
+    std::vector<glm::vec3> objNormals;
+    std::unordered_map<OBJVertexKey, uint32_t, OBJVertexKeyHasher> vertexKeysToIndices;
+    std::vector<uint32_t> faceVertexIndices;
+
+    glm::vec3 minPosition(std::numeric_limits<float>::max());
+    glm::vec3 maxPosition(std::numeric_limits<float>::lowest());
+
+    const char* cursor = data;
+    const char* const end = data + size;
+    while (cursor < end)
+    {
+        const auto* lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        if (!lineEnd)
+        {
+            lineEnd = end;
+        }
+
+        SkipSpaces(cursor, lineEnd);
+        const auto* keywordStart = cursor;
+        while (cursor < lineEnd && *cursor != ' ' && *cursor != '\t' && *cursor != '\r')
+        {
+            ++cursor;
+        }
+        const auto keyword = std::string_view(keywordStart, static_cast<size_t>(cursor - keywordStart));
+
+        if (keyword == "v")
+        {
+            glm::vec3 position;
+            if (!ParseFloat(cursor, lineEnd, position.x) || !ParseFloat(cursor, lineEnd, position.y) || !ParseFloat(cursor, lineEnd, position.z))
+            {
+                return false;
+            }
+
+            objPositions.push_back(position);
+            minPosition = glm::min(minPosition, position);
+            maxPosition = glm::max(maxPosition, position);
+        }
+        else if (keyword == "vt")
+        {
+            glm::vec2 texCoord;
+            if (!ParseFloat(cursor, lineEnd, texCoord.x) || !ParseFloat(cursor, lineEnd, texCoord.y))
+            {
+                return false;
+            }
+            objTexCoords.push_back(texCoord);
+        }
+        else if (keyword == "vn")
+        {
+            glm::vec3 normal;
+            if (!ParseFloat(cursor, lineEnd, normal.x) || !ParseFloat(cursor, lineEnd, normal.y) || !ParseFloat(cursor, lineEnd, normal.z))
+            {
+                return false;
+            }
+            objNormals.push_back(normal);
+        }
+        else if (keyword == "f")
+        {
+            faceVertexIndices.clear();
+
+            while (true)
+            {
+                SkipSpaces(cursor, lineEnd);
+                if (cursor == lineEnd)
+                {
+                    break;
+                }
+
+                // v, v/vt, v//vn or v/vt/vn
+                OBJVertexKey vertexKey = { -1, -1, -1 };
+                int32_t objIndex = 0;
+                if (!ParseInt(cursor, lineEnd, objIndex) || !ResolveOBJIndex(objIndex, objPositions.size(), vertexKey.mPositionIndex))
+                {
+                    return false;
+                }
+
+                if (cursor < lineEnd && *cursor == '/')
+                {
+                    ++cursor;
+                    if (cursor < lineEnd && *cursor != '/')
+                    {
+                        if (!ParseInt(cursor, lineEnd, objIndex) || !ResolveOBJIndex(objIndex, objTexCoords.size(), vertexKey.mTexCoordIndex))
+                        {
+                            return false;
+                        }
+                    }
+
+                    if (cursor < lineEnd && *cursor == '/')
+                    {
+                        ++cursor;
+                        if (!ParseInt(cursor, lineEnd, objIndex) || !ResolveOBJIndex(objIndex, objNormals.size(), vertexKey.mNormalIndex))
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                auto vertexIter = vertexKeysToIndices.find(vertexKey);
+                if (vertexIter == vertexKeysToIndices.end())
+                {
+                    vertexIter = vertexKeysToIndices.emplace(vertexKey, static_cast<uint32_t>(outMesh.mPositions.size())).first;
+                    outMesh.mPositions.push_back(objPositions[vertexKey.mPositionIndex]);
+                    outMesh.mTexCoords.push_back(vertexKey.mTexCoordIndex >= 0 ? objTexCoords[vertexKey.mTexCoordIndex] : glm::vec2(0.0f));
+                    outMesh.mNormals.push_back(vertexKey.mNormalIndex >= 0 ? objNormals[vertexKey.mNormalIndex] : glm::vec3(0.0f));
+                }
+                faceVertexIndices.push_back(vertexIter->second);
+            }
+
+            if (faceVertexIndices.size() < 3)
+            {
+                return false;
+            }
+
+            // Polygons are triangulated as fans
+            for (size_t i = 1; i + 1 < faceVertexIndices.size(); ++i)
+            {
+                outMesh.mIndices.push_back(faceVertexIndices[0]);
+                outMesh.mIndices.push_back(faceVertexIndices[i]);
+                outMesh.mIndices.push_back(faceVertexIndices[i + 1]);
+            }
+        }
+
+        // Anything else (comments, groups, materials, smoothing groups etc.) is ignored
+        cursor = lineEnd + 1;
+    }
+
+    if (outMesh.mIndices.empty())
+    {
+        return false;
+    }
+
+    outMesh.mDimensions = glm::abs(maxPosition - minPosition);
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void OptimizeVertexCache(CookedMesh& mesh)
+{
+    const auto vertexCount = mesh.mPositions.size();
+    const auto triangleCount = mesh.mIndices.size()/3;
+    if (triangleCount == 0)
+    {
+        return;
+    }
+
+    // Vertex -> (not yet emitted) triangles adjacency
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (const auto index: mesh.mIndices)
+    {
+        adjacencyOffsets[index + 1]++;
+    }
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+    }
+
+    std::vector<uint32_t> remainingValences(vertexCount, 0);
+    std::vector<uint32_t> adjacentTriangles(mesh.mIndices.size());
+    for (size_t i = 0; i < mesh.mIndices.size(); ++i)
+    {
+        const auto vertex = mesh.mIndices[i];
+        adjacentTriangles[adjacencyOffsets[vertex] + remainingValences[vertex]++] = static_cast<uint32_t>(i/3);
+    }
+
+    std::vector<int> cachePositions(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        vertexScores[i] = ComputeVertexScore(-1, remainingValences[i]);
+    }
+
+    std::vector<float> triangleScores(triangleCount);
+    for (size_t i = 0; i < triangleCount; ++i)
+    {
+        triangleScores[i] = vertexScores[mesh.mIndices[i * 3]] + vertexScores[mesh.mIndices[i * 3 + 1]] + vertexScores[mesh.mIndices[i * 3 + 2]];
+    }
+
+    std::vector<bool> emittedTriangles(triangleCount, false);
+    std::vector<uint32_t> optimizedIndices;
+    optimizedIndices.reserve(mesh.mIndices.size());
+
+    std::vector<uint32_t> cache, nextCache;
+    cache.reserve(VERTEX_CACHE_OPTIMIZATION_CACHE_SIZE + 3);
+    nextCache.reserve(VERTEX_CACHE_OPTIMIZATION_CACHE_SIZE + 3);
+
+    auto bestTriangle = -1;
+    size_t nextUnemittedTriangleCandidate = 0;
+    for (size_t emittedTriangleCount = 0; emittedTriangleCount < triangleCount; ++emittedTriangleCount)
+    {
+        // Nothing left to continue from the cache with, start from the next not yet emitted triangle
+        if (bestTriangle == -1)
+        {
+            while (emittedTriangles[nextUnemittedTriangleCandidate])
+            {
+                nextUnemittedTriangleCandidate++;
+            }
+            bestTriangle = static_cast<int>(nextUnemittedTriangleCandidate);
+        }
+
+        const uint32_t* triangleVertices = &mesh.mIndices[static_cast<size_t>(bestTriangle) * 3];
+        optimizedIndices.insert(optimizedIndices.end(), triangleVertices, triangleVertices + 3);
+        emittedTriangles[bestTriangle] = true;
+
+        nextCache.clear();
+        for (int i = 0; i < 3; ++i)
+        {
+            const auto vertex = triangleVertices[i];
+
+            // Remove the emitted triangle from the vertex's adjacency
+            const auto adjacencyBegin = adjacentTriangles.begin() + adjacencyOffsets[vertex];
+            const auto adjacencyEnd = adjacencyBegin + remainingValences[vertex];
+            std::iter_swap(std::find(adjacencyBegin, adjacencyEnd, static_cast<uint32_t>(bestTriangle)), adjacencyEnd - 1);
+            remainingValences[vertex]--;
+
+            if (std::find(nextCache.begin(), nextCache.end(), vertex) == nextCache.end())
+            {
+                nextCache.push_back(vertex);
+            }
+        }
+
+        // LRU: the triangle's vertices move to the front, followed by the rest of the previous cache contents
+        const auto triangleCacheEnd = nextCache.size();
+        for (const auto vertex: cache)
+        {
+            if (std::find(nextCache.begin(), nextCache.begin() + triangleCacheEnd, vertex) == nextCache.begin() + triangleCacheEnd)
+            {
+                nextCache.push_back(vertex);
+            }
+        }
+
+        // Rescore every vertex whose cache position changed (including the ones that just got evicted)
+        for (size_t i = 0; i < nextCache.size(); ++i)
+        {
+            const auto vertex = nextCache[i];
+            cachePositions[vertex] = i < static_cast<size_t>(VERTEX_CACHE_OPTIMIZATION_CACHE_SIZE) ? static_cast<int>(i) : -1;
+
+            const auto newScore = ComputeVertexScore(cachePositions[vertex], remainingValences[vertex]);
+            const auto scoreDelta = newScore - vertexScores[vertex];
+            vertexScores[vertex] = newScore;
+
+            for (auto j = adjacencyOffsets[vertex]; j < adjacencyOffsets[vertex] + remainingValences[vertex]; ++j)
+            {
+                triangleScores[adjacentTriangles[j]] += scoreDelta;
+            }
+        }
+
+        nextCache.resize(std::min<size_t>(nextCache.size(), VERTEX_CACHE_OPTIMIZATION_CACHE_SIZE));
+        std::swap(cache, nextCache);
+
+        // The next triangle is the best scoring one among the ones using cached vertices
+        bestTriangle = -1;
+        auto bestScore = std::numeric_limits<float>::lowest();
+        for (const auto vertex: cache)
+        {
+            for (auto j = adjacencyOffsets[vertex]; j < adjacencyOffsets[vertex] + remainingValences[vertex]; ++j)
+            {
+                const auto triangle = adjacentTriangles[j];
+                if (triangleScores[triangle] > bestScore)
+                {
+                    bestScore = triangleScores[triangle];
+                    bestTriangle = static_cast<int>(triangle);
+                }
+            }
+        }
+    }
+
+    // Reorder vertices by first use, so that vertex fetches walk the buffers linearly (unreferenced vertices are dropped)
+    std::vector<uint32_t> vertexRemap(vertexCount, std::numeric_limits<uint32_t>::max());
+    uint32_t remappedVertexCount = 0;
+    for (auto& index: optimizedIndices)
+    {
+        if (vertexRemap[index] == std::numeric_limits<uint32_t>::max())
+        {
+            vertexRemap[index] = remappedVertexCount++;
+        }
+        index = vertexRemap[index];
+    }
+
+    std::vector<glm::vec3> remappedPositions(remappedVertexCount);
+    std::vector<glm::vec2> remappedTexCoords(remappedVertexCount);
+    std::vector<glm::vec3> remappedNormals(remappedVertexCount);
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        if (vertexRemap[i] != std::numeric_limits<uint32_t>::max())
+        {
+            remappedPositions[vertexRemap[i]] = mesh.mPositions[i];
+            remappedTexCoords[vertexRemap[i]] = mesh.mTexCoords[i];
+            remappedNormals[vertexRemap[i]] = mesh.mNormals[i];
+        }
+    }
+
+    mesh.mPositions = std::move(remappedPositions);
+    mesh.mTexCoords = std::move(remappedTexCoords);
+    mesh.mNormals = std::move(remappedNormals);
+    mesh.mIndices = std::move(optimizedIndices);
+}
+
+///------------------------------------------------------------------------------------------------
+
+float ComputeAverageCacheMissRatio(const std::vector<uint32_t>& indices, const size_t vertexCount, const int cacheSize)
+{
+    if (indices.size() < 3)
+    {
+        return 0.0f;
+    }
+
+    // FIFO cache: a vertex is cached if fewer than cacheSize misses happened since it was last transformed
+    std::vector<uint64_t> vertexMissTimestamps(vertexCount, 0);
+    uint64_t missCount = 0;
+    for (const auto index: indices)
+    {
+        if (vertexMissTimestamps[index] == 0 || missCount - vertexMissTimestamps[index] >= static_cast<uint64_t>(cacheSize))
+        {
+            vertexMissTimestamps[index] = ++missCount;
+        }
+    }
+
+    return static_cast<float>(missCount)/static_cast<float>(indices.size()/3);
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string GetCookedMeshFilePath(const std::string& sourceMeshFilePath)
+{
+    return sourceMeshFilePath.substr(0, sourceMeshFilePath.find_last_of('.')) + COOKED_MESH_FILE_EXTENSION;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string GetCookedMeshCacheFilePath(const std::string& cacheDirectoryPath, const std::string& sourceMeshFilePath)
+{
+    return cacheDirectoryPath + fileutils::GetFileNameWithoutExtension(sourceMeshFilePath) + "_" + std::to_string(strutils::GetStringHash(sourceMeshFilePath)) + COOKED_MESH_FILE_EXTENSION;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string SerializeCookedMesh(const CookedMesh& cookedMesh)
+{
+    const auto vertexCount = cookedMesh.mPositions.size();
+    const auto indexSize = vertexCount <= static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1 ? sizeof(uint16_t) : sizeof(uint32_t);
+    const auto indicesSize = cookedMesh.mIndices.size() * indexSize;
+
+    CookedMeshFileHeader header = {};
+    std::memcpy(header.mMagic, COOKED_MESH_MAGIC, sizeof(COOKED_MESH_MAGIC));
+    header.mVersion = COOKED_MESH_VERSION;
+    header.mVertexCount = static_cast<uint32_t>(vertexCount);
+    header.mIndexCount = static_cast<uint32_t>(cookedMesh.mIndices.size());
+    header.mIndexSize = static_cast<uint32_t>(indexSize);
+    header.mDimensions[0] = cookedMesh.mDimensions.x;
+    header.mDimensions[1] = cookedMesh.mDimensions.y;
+    header.mDimensions[2] = cookedMesh.mDimensions.z;
+
+    std::string serializedMesh;
+    serializedMesh.reserve(sizeof(header) + vertexCount * (sizeof(glm::vec3) * 2 + sizeof(glm::vec2)) + indicesSize + 2);
+    serializedMesh.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    serializedMesh.append(reinterpret_cast<const char*>(cookedMesh.mPositions.data()), vertexCount * sizeof(glm::vec3));
+    serializedMesh.append(reinterpret_cast<const char*>(cookedMesh.mTexCoords.data()), vertexCount * sizeof(glm::vec2));
+    serializedMesh.append(reinterpret_cast<const char*>(cookedMesh.mNormals.data()), vertexCount * sizeof(glm::vec3));
+
+    if (indexSize == sizeof(uint16_t))
+    {
+        std::vector<uint16_t> shortIndices(cookedMesh.mIndices.begin(), cookedMesh.mIndices.end());
+        serializedMesh.append(reinterpret_cast<const char*>(shortIndices.data()), indicesSize);
+    }
+    else
+    {
+        serializedMesh.append(reinterpret_cast<const char*>(cookedMesh.mIndices.data()), indicesSize);
+    }
+
+    serializedMesh.append((4 - serializedMesh.size() % 4) % 4, '\0');
+    return serializedMesh;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool WriteCookedMesh(const std::string& filePath, const CookedMesh& cookedMesh)
+{
+    const auto serializedMesh = SerializeCookedMesh(cookedMesh);
+    const auto temporaryFilePath = filePath + ".tmp";
+    {
+        std::ofstream file(temporaryFilePath, std::ios::binary | std::ios::trunc);
+        if (!file.good())
+        {
+            return false;
+        }
+
+        file.write(serializedMesh.data(), static_cast<std::streamsize>(serializedMesh.size()));
+        if (!file.good())
+        {
+            return false;
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryFilePath, filePath, errorCode);
+    return !errorCode;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ParseCookedMesh(const char* data, const size_t size, CookedMeshView& outView)
+{
+    if (size < sizeof(CookedMeshFileHeader) || reinterpret_cast<uintptr_t>(data) % alignof(float) != 0)
+    {
+        return false;
+    }
+
+    CookedMeshFileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.mMagic, COOKED_MESH_MAGIC, sizeof(COOKED_MESH_MAGIC)) != 0 || header.mVersion != COOKED_MESH_VERSION || (header.mIndexSize != sizeof(uint16_t) && header.mIndexSize != sizeof(uint32_t)))
+    {
+        return false;
+    }
+
+    const auto vertexCount = static_cast<uint64_t>(header.mVertexCount);
+    const auto positionsOffset = static_cast<uint64_t>(sizeof(header));
+    const auto texCoordsOffset = positionsOffset + vertexCount * sizeof(glm::vec3);
+    const auto normalsOffset = texCoordsOffset + vertexCount * sizeof(glm::vec2);
+    const auto indicesOffset = normalsOffset + vertexCount * sizeof(glm::vec3);
+    const auto requiredSize = indicesOffset + static_cast<uint64_t>(header.mIndexCount) * header.mIndexSize;
+
+    if (requiredSize > size)
+    {
+        return false;
+    }
+
+    outView.mVertexCount = header.mVertexCount;
+    outView.mIndexCount = header.mIndexCount;
+    outView.mIndexSize = header.mIndexSize;
+    outView.mDimensions = glm::vec3(header.mDimensions[0], header.mDimensions[1], header.mDimensions[2]);
+    outView.mPositions = data + positionsOffset;
+    outView.mTexCoords = data + texCoordsOffset;
+    outView.mNormals = data + normalsOffset;
+    outView.mIndices = data + indicesOffset;
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
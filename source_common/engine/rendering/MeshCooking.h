@@ -0,0 +1,112 @@
+///------------------------------------------------------------------------------------------------
+///  MeshCooking.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef MeshCooking_h
+#define MeshCooking_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/utils/MathUtils.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+/// An indexed triangle mesh, with one (deduplicated) vertex per unique position/uv/normal combination.
+struct CookedMesh
+{
+    std::vector<glm::vec3> mPositions;
+    std::vector<glm::vec2> mTexCoords;
+    std::vector<glm::vec3> mNormals;
+    std::vector<uint32_t> mIndices;
+    glm::vec3 mDimensions = {};
+};
+
+///------------------------------------------------------------------------------------------------
+/// Zero copy view of a serialized cooked mesh (e.g. straight into a memory mapped cooked mesh file).
+/// Attribute/index blocks are tightly packed and 4 byte aligned, ready to be handed to glBufferData.
+struct CookedMeshView
+{
+    uint32_t mVertexCount = 0;
+    uint32_t mIndexCount = 0;
+    uint32_t mIndexSize = 0; // 2 (u16) or 4 (u32) bytes
+    glm::vec3 mDimensions = {};
+    const char* mPositions = nullptr;
+    const char* mTexCoords = nullptr;
+    const char* mNormals = nullptr;
+    const char* mIndices = nullptr;
+};
+
+///------------------------------------------------------------------------------------------------
+
+inline constexpr char COOKED_MESH_MAGIC[4] = { 'T', 'M', 'M', 'S' };
+inline constexpr uint32_t COOKED_MESH_VERSION = 1;
+inline constexpr int VERTEX_CACHE_OPTIMIZATION_CACHE_SIZE = 32;
+inline const std::string COOKED_MESH_FILE_EXTENSION = ".tmmesh";
+
+///------------------------------------------------------------------------------------------------
+/// Parses the contents of an OBJ file into a deduplicated indexed mesh. Supports v, v/vt, v//vn and
+/// v/vt/vn face corners, negative (relative) indices and polygons (triangulated as fans).
+/// @param[in] data the contents of the OBJ file (need not be null terminated).
+/// @param[in] size the size of the contents.
+/// @param[out] outMesh the imported mesh.
+/// @returns whether the contents were a valid OBJ mesh.
+bool ImportOBJMesh(const char* data, const size_t size, CookedMesh& outMesh);
+
+///------------------------------------------------------------------------------------------------
+/// Reorders the triangles of the mesh for post-transform vertex cache locality (Forsyth's linear
+/// speed algorithm), and then the vertices in the order they are first referenced (for fetch locality).
+void OptimizeVertexCache(CookedMesh& mesh);
+
+///------------------------------------------------------------------------------------------------
+/// @returns the average cache miss ratio (transformed vertices per triangle) of the given index order,
+/// simulating a FIFO post-transform cache of the given size.
+float ComputeAverageCacheMissRatio(const std::vector<uint32_t>& indices, const size_t vertexCount, const int cacheSize);
+
+///------------------------------------------------------------------------------------------------
+/// @returns the file path a cooked mesh shipped alongside its source mesh (i.e. cooked at build time and
+/// packed in the asset archive) is stored under (e.g. quad.obj -> quad.tmmesh).
+std::string GetCookedMeshFilePath(const std::string& sourceMeshFilePath);
+
+///------------------------------------------------------------------------------------------------
+/// @returns the file path, within the given (writable) cache directory, the cooked mesh of the
+/// given source mesh is cached under at runtime (e.g. quad.obj -> <cache directory>quad_<path hash>.tmmesh).
+std::string GetCookedMeshCacheFilePath(const std::string& cacheDirectoryPath, const std::string& sourceMeshFilePath);
+
+///------------------------------------------------------------------------------------------------
+/// Serializes a cooked mesh. Indices are stored as u16 when every vertex is addressable by them, as u32 otherwise.
+/// The layout is:
+///   Header:   char[4] magic "TMMS", u32 version, u32 vertex count, u32 index count, u32 index size, f32[3] dimensions
+///   Data:     positions (f32[3] per vertex), uvs (f32[2] per vertex), normals (f32[3] per vertex), indices (padded to 4 bytes)
+/// @returns the serialized mesh.
+std::string SerializeCookedMesh(const CookedMesh& cookedMesh);
+
+///------------------------------------------------------------------------------------------------
+/// Serializes a cooked mesh to the given file (via a temporary file, so readers never see a torn one).
+/// @returns whether or not the file was written successfully.
+bool WriteCookedMesh(const std::string& filePath, const CookedMesh& cookedMesh);
+
+///------------------------------------------------------------------------------------------------
+/// Creates a view into a serialized cooked mesh, without copying any of its data.
+/// @param[in] data the serialized mesh (must be 4 byte aligned and outlive the view).
+/// @param[in] size the size of the serialized mesh.
+/// @param[out] outView the view into the serialized mesh.
+/// @returns whether the data was a valid cooked mesh.
+bool ParseCookedMesh(const char* data, const size_t size, CookedMeshView& outView);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* MeshCooking_h */
@@ -0,0 +1,354 @@
+///------------------------------------------------------------------------------------------------
+///  NullRenderer.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/Camera.h>
+#include <engine/rendering/CommonUniforms.h>
+#include <engine/rendering/Fonts.h>
+#include <engine/rendering/NullRenderer.h>
+#include <engine/resloading/MeshResource.h>
+#include <engine/resloading/ResourceLoadingService.h>
+#include <engine/resloading/ShaderResource.h>
+#include <engine/scene/Scene.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+// Vertex arrays are keyed by mesh resource id (scene objects sharing a mesh share its VAO), whereas
+// every particle emitter owns its own VAO (keyed by the emitter's address) and all text shares one
+static const size_t FONT_VERTEX_ARRAY_KEY = static_cast<size_t>(-2);
+static const size_t UNBOUND_VERTEX_ARRAY_KEY = 0;
+
+// Per glyph instance data streamed every time a font batch is drawn (positions, scales, min uvs, max uvs, alphas)
+static const size_t GLYPH_INSTANCE_BYTES = sizeof(glm::vec3) + sizeof(glm::vec3) + sizeof(glm::vec2) + sizeof(glm::vec2) + sizeof(float);
+
+// Uniforms the platform renderers set on every default scene object (custom alpha, affected by light,
+// texture sheet flag, world and rotation matrices), every particle emitter (custom alpha) and every
+// font batch (custom alpha). The view & projection matrices are only uploaded through ShaderResource::SetCameraMatrices
+// when the shader has not yet seen the current camera version (see RecordCameraMatricesUpload)
+static const size_t DEFAULT_SCENE_OBJECT_UNIFORM_COUNT = 5;
+static const size_t PARTICLE_EMITTER_UNIFORM_COUNT = 1;
+static const size_t FONT_BATCH_UNIFORM_COUNT = 1;
+static const size_t CAMERA_MATRICES_UNIFORM_COUNT = 2;
+
+///------------------------------------------------------------------------------------------------
+
+static const resources::ShaderResource* FindLoadedShader(const resources::ResourceId shaderResourceId)
+{
+    auto& resService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+    return resService.HasLoadedResource(shaderResourceId) ? &(resService.GetResource<resources::ShaderResource>(shaderResourceId)) : nullptr;
+}
+
+///------------------------------------------------------------------------------------------------
+
+class SceneObjectTypeRecorderVisitor
+{
+public:
+    SceneObjectTypeRecorderVisitor(const scene::SceneObject& sceneObject, const Camera& camera, NullRenderer& renderer)
+    : mSceneObject(sceneObject)
+    , mCamera(camera)
+    , mRenderer(renderer)
+    {
+    }
+
+    void operator()(const scene::DefaultSceneObjectData&)
+    {
+        auto& resService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+        auto& stats = mRenderer.mCurrentFrameStats;
+
+        mRenderer.RecordShaderBind(mSceneObject.mShaderResourceId);
+        mRenderer.RecordSamplerUniformUploads(mSceneObject.mShaderResourceId);
+        mRenderer.RecordVertexArrayBind(mSceneObject.mMeshResourceId);
+        mRenderer.RecordSceneObjectTextureBinds(mSceneObject, mSceneObject.mShaderResourceId);
+
+        stats.mUniformUploads += DEFAULT_SCENE_OBJECT_UNIFORM_COUNT;
+        mRenderer.RecordCameraMatricesUpload(mSceneObject.mShaderResourceId, mCamera);
+        mRenderer.RecordSceneObjectUniformUploads(mSceneObject);
+
+        if (resService.HasLoadedResource(mSceneObject.mMeshResourceId))
+        {
+            stats.mDrawnIndices += resService.GetResource<resources::MeshResource>(mSceneObject.mMeshResourceId).GetElementCount();
+        }
+        stats.mDrawCalls++;
+    }
+
+    void operator()(const scene::TextSceneObjectData& sceneObjectTypeData)
+    {
+        // Glyphs are only accumulated here, and drawn in one batch per font & shader at the end of the scene
+        auto& glyphCount = mRenderer.mFontGlyphCounts[sceneObjectTypeData.mFontName][mSceneObject.mShaderResourceId];
+
+        auto fontOpt = CoreSystemsEngine::GetInstance().GetFontRepository().GetFont(sceneObjectTypeData.mFontName);
+        if (fontOpt)
+        {
+            glyphCount += fontOpt->get().FindGlyphs(sceneObjectTypeData.mText).size();
+        }
+    }
+
+    void operator()(const scene::ParticleEmitterObjectData& particleEmitterData)
+    {
+        auto& stats = mRenderer.mCurrentFrameStats;
+
+        mRenderer.RecordShaderBind(mSceneObject.mShaderResourceId);
+        mRenderer.RecordSamplerUniformUploads(mSceneObject.mShaderResourceId);
+        mRenderer.RecordSceneObjectTextureBinds(mSceneObject, mSceneObject.mShaderResourceId);
+
+        stats.mUniformUploads += PARTICLE_EMITTER_UNIFORM_COUNT;
+        mRenderer.RecordCameraMatricesUpload(mSceneObject.mShaderResourceId, mCamera);
+        mRenderer.RecordSceneObjectUniformUploads(mSceneObject);
+
+        mRenderer.RecordVertexArrayBind(reinterpret_cast<size_t>(&mSceneObject));
+
+        // Positions, lifetimes, sizes and angles are streamed every frame
+        const auto particleCount = particleEmitterData.mParticlePositions.size();
+        stats.mBufferUploadBytes += particleCount * sizeof(glm::vec3);
+        stats.mBufferUploadBytes += particleCount * sizeof(float);
+        stats.mBufferUploadBytes += particleEmitterData.mParticleSizes.size() * sizeof(float);
+        stats.mBufferUploadBytes += particleEmitterData.mParticleAngles.size() * sizeof(float);
+
+        stats.mDrawnInstances += particleCount;
+        stats.mDrawCalls++;
+
+        mRenderer.RecordVertexArrayBind(UNBOUND_VERTEX_ARRAY_KEY);
+    }
+
+private:
+    const scene::SceneObject& mSceneObject;
+    const Camera& mCamera;
+    NullRenderer& mRenderer;
+};
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::VInitialize()
+{
+    mCurrentFrameStats.Reset();
+    mLastFrameStats.Reset();
+    mFrameCount = 0;
+    mUploadedCameraVersions.clear();
+    ResetBindings();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::VBeginRenderPass()
+{
+    mCurrentFrameStats.Reset();
+    mSceneObjectsWithDeferredRendering.clear();
+    ResetBindings();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::VRenderScene(scene::Scene& scene)
+{
+    mFontGlyphCounts.clear();
+
+    for (const auto& sceneObject: scene.GetSceneObjects())
+    {
+        if (sceneObject->mInvisible) continue;
+        if (sceneObject->mDeferredRendering)
+        {
+            mSceneObjectsWithDeferredRendering.push_back(std::make_pair(&scene.GetCamera(), sceneObject));
+            continue;
+        }
+        RecordSceneObject(*sceneObject, scene.GetCamera());
+    }
+
+    RecordSceneText(scene.GetCamera());
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::VRenderSceneObjectsToTexture(const std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects, const rendering::Camera& camera)
+{
+    for (const auto& sceneObject: sceneObjects)
+    {
+        RecordSceneObject(*sceneObject, camera);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::VEndRenderPass()
+{
+    for (const auto& sceneObjectEntry: mSceneObjectsWithDeferredRendering)
+    {
+        RecordSceneObject(*sceneObjectEntry.second, *sceneObjectEntry.first);
+    }
+    mSceneObjectsWithDeferredRendering.clear();
+
+    mLastFrameStats = mCurrentFrameStats;
+    mFrameCount++;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const RenderStats& NullRenderer::GetCurrentFrameStats() const
+{
+    return mCurrentFrameStats;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const RenderStats& NullRenderer::GetLastFrameStats() const
+{
+    return mLastFrameStats;
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t NullRenderer::GetFrameCount() const
+{
+    return mFrameCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::ResetBindings()
+{
+    mBoundShaderResourceId = NO_BINDING;
+    std::fill(std::begin(mBoundTextureResourceIds), std::end(mBoundTextureResourceIds), NO_BINDING);
+    mBoundVertexArrayKey = NO_BINDING;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordSceneObject(const scene::SceneObject& sceneObject, const Camera& camera)
+{
+    std::visit(SceneObjectTypeRecorderVisitor(sceneObject, camera, *this), sceneObject.mSceneObjectTypeData);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordSceneText(const Camera& camera)
+{
+    for (const auto& [fontName, fontShaderMap]: mFontGlyphCounts)
+    {
+        for (const auto& [shaderResourceId, glyphCount]: fontShaderMap)
+        {
+            RecordShaderBind(shaderResourceId);
+            RecordSamplerUniformUploads(shaderResourceId);
+
+            auto fontOpt = CoreSystemsEngine::GetInstance().GetFontRepository().GetFont(fontName);
+            RecordTextureBind(0, fontOpt ? fontOpt->get().mFontTextureResourceId : NO_BINDING);
+
+            mCurrentFrameStats.mUniformUploads += FONT_BATCH_UNIFORM_COUNT;
+            RecordCameraMatricesUpload(shaderResourceId, camera);
+
+            RecordVertexArrayBind(FONT_VERTEX_ARRAY_KEY);
+            mCurrentFrameStats.mBufferUploadBytes += glyphCount * GLYPH_INSTANCE_BYTES;
+            mCurrentFrameStats.mDrawnInstances += glyphCount;
+            mCurrentFrameStats.mDrawCalls++;
+            RecordVertexArrayBind(UNBOUND_VERTEX_ARRAY_KEY);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordShaderBind(const resources::ResourceId shaderResourceId)
+{
+    mCurrentFrameStats.mShaderBinds++;
+    if (mBoundShaderResourceId == shaderResourceId)
+    {
+        mCurrentFrameStats.mRedundantStateChanges++;
+    }
+    mBoundShaderResourceId = shaderResourceId;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordTextureBind(const size_t textureUnit, const resources::ResourceId textureResourceId)
+{
+    mCurrentFrameStats.mTextureBinds++;
+    if (mBoundTextureResourceIds[textureUnit] == textureResourceId)
+    {
+        mCurrentFrameStats.mRedundantStateChanges++;
+    }
+    mBoundTextureResourceIds[textureUnit] = textureResourceId;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordVertexArrayBind(const size_t vertexArrayKey)
+{
+    mCurrentFrameStats.mVertexArrayBinds++;
+    if (mBoundVertexArrayKey == vertexArrayKey)
+    {
+        mCurrentFrameStats.mRedundantStateChanges++;
+    }
+    mBoundVertexArrayKey = vertexArrayKey;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordSceneObjectTextureBinds(const scene::SceneObject& sceneObject, const resources::ResourceId shaderResourceId)
+{
+    auto& resService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+
+    // Same atlas page redirection as the platform renderers, for shaders that can sample from atlas pages
+    const auto* shader = FindLoadedShader(shaderResourceId);
+    const auto* atlasEntry = shader && shader->GetUniformNamesToLocations().contains(ATLAS_UV_RECT_UNIFORM_NAME) ? resService.GetTextureAtlasEntry(sceneObject.mTextureResourceId) : nullptr;
+    RecordTextureBind(0, atlasEntry ? atlasEntry->mAtlasPageTextureResourceId : sceneObject.mTextureResourceId);
+
+    mCurrentFrameStats.mUniformUploads += atlasEntry ? 2 : 1;
+
+    for (int i = 0; i < scene::EFFECT_TEXTURES_COUNT; ++i)
+    {
+        if (sceneObject.mEffectTextureResourceIds[i] != 0)
+        {
+            RecordTextureBind(static_cast<size_t>(i + 1), sceneObject.mEffectTextureResourceIds[i]);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordCameraMatricesUpload(const resources::ResourceId shaderResourceId, const Camera& camera)
+{
+    // Same version check as ShaderResource::SetCameraMatrices, tracked here so that the (shared) shader resources are left untouched
+    auto& uploadedCameraVersion = mUploadedCameraVersions[shaderResourceId];
+    if (uploadedCameraVersion == camera.GetVersion())
+    {
+        return;
+    }
+
+    mCurrentFrameStats.mUniformUploads += CAMERA_MATRICES_UNIFORM_COUNT;
+    uploadedCameraVersion = camera.GetVersion();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordSamplerUniformUploads(const resources::ResourceId shaderResourceId)
+{
+    if (const auto* shader = FindLoadedShader(shaderResourceId))
+    {
+        mCurrentFrameStats.mUniformUploads += shader->GetUniformSamplerNames().size();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NullRenderer::RecordSceneObjectUniformUploads(const scene::SceneObject& sceneObject)
+{
+    mCurrentFrameStats.mUniformUploads += sceneObject.mShaderVec3UniformValues.size();
+    mCurrentFrameStats.mUniformUploads += sceneObject.mShaderVec4UniformValues.size();
+    mCurrentFrameStats.mUniformUploads += sceneObject.mShaderFloatUniformValues.size();
+    mCurrentFrameStats.mUniformUploads += sceneObject.mShaderIntUniformValues.size();
+    mCurrentFrameStats.mUniformUploads += sceneObject.mShaderBoolUniformValues.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
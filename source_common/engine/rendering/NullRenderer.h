@@ -0,0 +1,110 @@
+///------------------------------------------------------------------------------------------------
+///  NullRenderer.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef NullRenderer_h
+#define NullRenderer_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/rendering/IRenderer.h>
+#include <engine/scene/SceneObject.h>
+#include <engine/utils/StringUtils.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+/// What a frame would have submitted to the GPU.
+struct RenderStats
+{
+    size_t mDrawCalls = 0;
+    size_t mDrawnInstances = 0;      // particles and glyphs drawn by instanced draw calls
+    size_t mDrawnIndices = 0;        // indices submitted by indexed (mesh) draw calls
+    size_t mUniformUploads = 0;
+    size_t mBufferUploadBytes = 0;   // per frame vertex data streamed (particle/glyph instance buffers)
+    size_t mShaderBinds = 0;
+    size_t mTextureBinds = 0;
+    size_t mVertexArrayBinds = 0;
+    size_t mRedundantStateChanges = 0; // binds of the shader/texture/vertex array that was already bound
+
+    size_t GetStateChanges() const { return mShaderBinds + mTextureBinds + mVertexArrayBinds; }
+    void Reset() { *this = RenderStats(); }
+};
+
+///------------------------------------------------------------------------------------------------
+/// A renderer that walks scenes exactly like the platform renderers do (invisible objects skipped,
+/// deferred objects at the end of the pass, text batched per font & shader at the end of every scene),
+/// but instead of issuing any GL calls it records what would have been submitted. Used by headless
+/// runs, so that pipelines without a GPU can still catch draw call and CPU submission cost regressions.
+class NullRenderer final: public IRenderer
+{
+public:
+    // FontName -> ShaderResourceId -> Glyph count
+    using FontGlyphCountMap = std::unordered_map<strutils::StringId, std::unordered_map<resources::ResourceId, size_t>, strutils::StringIdHasher>;
+
+public:
+    NullRenderer() = default;
+
+    void VInitialize() override;
+    void VBeginRenderPass() override;
+    void VRenderScene(scene::Scene& scene) override;
+    void VRenderSceneObjectsToTexture(const std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects, const rendering::Camera& camera) override;
+    void VEndRenderPass() override;
+
+    /// @returns the stats of the frame currently being recorded (i.e. since the last VBeginRenderPass).
+    const RenderStats& GetCurrentFrameStats() const;
+
+    /// @returns the stats of the last completed frame (i.e. up to the last VEndRenderPass).
+    const RenderStats& GetLastFrameStats() const;
+
+    /// @returns the number of completed frames.
+    size_t GetFrameCount() const;
+
+private:
+    friend class SceneObjectTypeRecorderVisitor;
+
+    void ResetBindings();
+    void RecordSceneObject(const scene::SceneObject& sceneObject, const Camera& camera);
+    void RecordSceneText(const Camera& camera);
+    void RecordShaderBind(const resources::ResourceId shaderResourceId);
+    void RecordTextureBind(const size_t textureUnit, const resources::ResourceId textureResourceId);
+    void RecordVertexArrayBind(const size_t vertexArrayKey);
+    void RecordSceneObjectTextureBinds(const scene::SceneObject& sceneObject, const resources::ResourceId shaderResourceId);
+    void RecordCameraMatricesUpload(const resources::ResourceId shaderResourceId, const Camera& camera);
+    void RecordSamplerUniformUploads(const resources::ResourceId shaderResourceId);
+    void RecordSceneObjectUniformUploads(const scene::SceneObject& sceneObject);
+
+private:
+    static constexpr size_t TEXTURE_UNIT_COUNT = scene::EFFECT_TEXTURES_COUNT + 1;
+    static constexpr size_t NO_BINDING = static_cast<size_t>(-1);
+
+    RenderStats mCurrentFrameStats;
+    RenderStats mLastFrameStats;
+    size_t mFrameCount = 0;
+    std::vector<std::pair<const Camera*, std::shared_ptr<scene::SceneObject>>> mSceneObjectsWithDeferredRendering;
+    FontGlyphCountMap mFontGlyphCounts;
+    std::unordered_map<resources::ResourceId, uint64_t> mUploadedCameraVersions; // ShaderResourceId -> last camera version whose matrices it was given
+    resources::ResourceId mBoundShaderResourceId = NO_BINDING;
+    resources::ResourceId mBoundTextureResourceIds[TEXTURE_UNIT_COUNT] = {};
+    size_t mBoundVertexArrayKey = NO_BINDING;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* NullRenderer_h */
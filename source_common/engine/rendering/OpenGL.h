@@ -23,8 +23,13 @@
     #define GL_CALL(func) do { func; auto err = glGetError(); if (err != GL_NO_ERROR) { printf("GLError: %d\n", err); assert(false); } } while (0)
     #define GL_NO_CHECK_CALL(func) func
 #else
-    #define GLEW_STATIC
-    #include <engine/rendering/glew/glew.h>
+    #if defined(__linux__)
+        // The bundled GLEW lacks its GLX loader, so Linux builds use the system one
+        #include <GL/glew.h>
+    #else
+        #define GLEW_STATIC
+        #include <engine/rendering/glew/glew.h>
+    #endif
     #define GL_CALL(func) do { func; auto err = glGetError(); if (err != GL_NO_ERROR) { printf("GLError: %d\n", err); assert(false); } } while (0)
     #define GL_NO_CHECK_CALL(func) func
 #endif
@@ -5,13 +5,16 @@
 ///  Created by Alex Koukoulas on 18/10/2023                                                       
 ///------------------------------------------------------------------------------------------------
 
+#include <engine/CoreSystemsEngine.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/rendering/ParticleManager.h>
 #include <engine/resloading/DataFileResource.h>
 #include <engine/scene/Scene.h>
 #include <engine/scene/SceneObject.h>
 #include <engine/utils/BaseDataFileDeserializer.h>
+#include <engine/utils/JobSystem.h>
 #include <engine/utils/OSMessageBox.h>
+#include <engine/utils/Profiler.h>
 #include <nlohmann/json.hpp>
 #include <numeric>
 
@@ -52,78 +55,108 @@ namespace rendering
 
 void ParticleManager::UpdateSceneParticles(const float dtMillis, scene::Scene& scene)
 {
+    PROFILE_SCOPE("ParticleManager::UpdateSceneParticles");
     mParticleEmittersToDelete.clear();
+    mParticleEmittersToUpdate.clear();
     for (auto& sceneObject: scene.GetSceneObjects())
     {
         if (std::holds_alternative<scene::ParticleEmitterObjectData>(sceneObject->mSceneObjectTypeData))
         {
             auto& particleEmitterData = std::get<scene::ParticleEmitterObjectData>(sceneObject->mSceneObjectTypeData);
             
+            // Custom updates are client code, so they stay on the main thread
             if (IS_FLAG_SET(particle_flags::CUSTOM_UPDATE))
             {
                 particleEmitterData.mCustomUpdateFunction(dtMillis, particleEmitterData);
                 continue;
             }
             
-            particleEmitterData.mParticleGenerationCurrentDelaySecs -= dtMillis/1000.0f;
-            if (particleEmitterData.mParticleGenerationCurrentDelaySecs <= 0.0f)
-            {
-                particleEmitterData.mParticleGenerationCurrentDelaySecs = 0.0f;
-            }
-            
-            size_t deadParticles = 0;
-            for (size_t i = 0; i < particleEmitterData.mParticleCount; ++i)
-            {
-                // subtract from the particles lifetime
-                particleEmitterData.mParticleLifetimeSecs[i] -= dtMillis/1000.0f;
-                
-                // if the lifetime is below add to the count of finished particles
-                if (particleEmitterData.mParticleLifetimeSecs[i] <= 0.0f )
-                {
-                    if (IS_FLAG_SET(particle_flags::CONTINUOUS_PARTICLE_GENERATION) && particleEmitterData.mParticleGenerationCurrentDelaySecs <= 0.0f)
-                    {
-                        SpawnParticleAtIndex(i, sceneObject->mPosition, particleEmitterData);
-                        particleEmitterData.mParticleGenerationCurrentDelaySecs = particleEmitterData.mParticleGenerationMaxDelaySecs;
-                    }
-                    else
-                    {
-                        particleEmitterData.mParticleLifetimeSecs[i] = 0.0f;
-                        deadParticles++;
-                    }
-                }
-                
-                // change particle size depending on the delta time
-                if (IS_FLAG_SET(particle_flags::RESIZE_OVER_TIME))
-                {
-                    particleEmitterData.mParticleSizes[i] += particleEmitterData.mParticleEnlargementSpeed * dtMillis;
-                    particleEmitterData.mParticleSizes[i] = math::Max(0.0f, particleEmitterData.mParticleSizes[i]);
-                }
-                
-                // rotate the particle depending on the delta time
-                if (IS_FLAG_SET(particle_flags::ROTATE_OVER_TIME))
-                {
-                    particleEmitterData.mParticleAngles[i] += particleEmitterData.mParticleRotationSpeed * dtMillis;
-                }
-                
-                particleEmitterData.mParticleVelocities[i] += particleEmitterData.mParticleGravityVelocity * dtMillis;
-                particleEmitterData.mParticlePositions[i] += particleEmitterData.mParticleVelocities[i] * dtMillis;
-            }
-            
-            if (deadParticles == particleEmitterData.mParticleCount && (!IS_FLAG_SET(particle_flags::CONTINUOUS_PARTICLE_GENERATION) && !IS_FLAG_SET(particle_flags::PERSISTENT_EVEN_WHEN_EMPTY)))
+            mParticleEmittersToUpdate.push_back(sceneObject);
+        }
+    }
+    
+    // Emitters are independent of each other, so they are simulated in parallel
+    mParticleEmitterExpiredFlags.assign(mParticleEmittersToUpdate.size(), 0);
+    CoreSystemsEngine::GetInstance().GetJobSystem().ParallelFor(mParticleEmittersToUpdate.size(), 1, [&](const size_t begin, const size_t end)
+    {
+        for (auto i = begin; i < end; ++i)
+        {
+            mParticleEmitterExpiredFlags[i] = UpdateParticleEmitter(dtMillis, *mParticleEmittersToUpdate[i]) ? 1 : 0;
+        }
+    });
+    
+    for (size_t i = 0; i < mParticleEmittersToUpdate.size(); ++i)
+    {
+        if (mParticleEmitterExpiredFlags[i])
+        {
+            mParticleEmittersToDelete.push_back(mParticleEmittersToUpdate[i]);
+        }
+    }
+    mParticleEmittersToUpdate.clear();
+    
+    for (const auto& particleEmitter: mParticleEmittersToDelete)
+    {
+        scene.RemoveSceneObject(particleEmitter->mName);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ParticleManager::UpdateParticleEmitter(const float dtMillis, scene::SceneObject& particleEmitterSceneObject) const
+{
+    auto& particleEmitterData = std::get<scene::ParticleEmitterObjectData>(particleEmitterSceneObject.mSceneObjectTypeData);
+    
+    particleEmitterData.mParticleGenerationCurrentDelaySecs -= dtMillis/1000.0f;
+    if (particleEmitterData.mParticleGenerationCurrentDelaySecs <= 0.0f)
+    {
+        particleEmitterData.mParticleGenerationCurrentDelaySecs = 0.0f;
+    }
+    
+    size_t deadParticles = 0;
+    for (size_t i = 0; i < particleEmitterData.mParticleCount; ++i)
+    {
+        // subtract from the particles lifetime
+        particleEmitterData.mParticleLifetimeSecs[i] -= dtMillis/1000.0f;
+        
+        // if the lifetime is below add to the count of finished particles
+        if (particleEmitterData.mParticleLifetimeSecs[i] <= 0.0f )
+        {
+            if (IS_FLAG_SET(particle_flags::CONTINUOUS_PARTICLE_GENERATION) && particleEmitterData.mParticleGenerationCurrentDelaySecs <= 0.0f)
             {
-                mParticleEmittersToDelete.push_back(sceneObject);
+                SpawnParticleAtIndex(i, particleEmitterSceneObject.mPosition, particleEmitterData);
+                particleEmitterData.mParticleGenerationCurrentDelaySecs = particleEmitterData.mParticleGenerationMaxDelaySecs;
             }
             else
             {
-                SortParticles(particleEmitterData);
+                particleEmitterData.mParticleLifetimeSecs[i] = 0.0f;
+                deadParticles++;
             }
         }
+        
+        // change particle size depending on the delta time
+        if (IS_FLAG_SET(particle_flags::RESIZE_OVER_TIME))
+        {
+            particleEmitterData.mParticleSizes[i] += particleEmitterData.mParticleEnlargementSpeed * dtMillis;
+            particleEmitterData.mParticleSizes[i] = math::Max(0.0f, particleEmitterData.mParticleSizes[i]);
+        }
+        
+        // rotate the particle depending on the delta time
+        if (IS_FLAG_SET(particle_flags::ROTATE_OVER_TIME))
+        {
+            particleEmitterData.mParticleAngles[i] += particleEmitterData.mParticleRotationSpeed * dtMillis;
+        }
+        
+        particleEmitterData.mParticleVelocities[i] += particleEmitterData.mParticleGravityVelocity * dtMillis;
+        particleEmitterData.mParticlePositions[i] += particleEmitterData.mParticleVelocities[i] * dtMillis;
     }
     
-    for (const auto& particleEmitter: mParticleEmittersToDelete)
+    if (deadParticles == particleEmitterData.mParticleCount && (!IS_FLAG_SET(particle_flags::CONTINUOUS_PARTICLE_GENERATION) && !IS_FLAG_SET(particle_flags::PERSISTENT_EVEN_WHEN_EMPTY)))
     {
-        scene.RemoveSceneObject(particleEmitter->mName);
+        return true;
     }
+    
+    SortParticles(particleEmitterData);
+    return false;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -195,33 +228,37 @@ std::shared_ptr<scene::SceneObject> ParticleManager::CreateParticleEmitterAtPosi
         }
     }
     
-    GL_CALL(glGenVertexArrays(1, &particleEmitterData.mParticleVertexArrayObject));
-    GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleVertexBuffer));
-    GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleUVBuffer));
-    GL_CALL(glGenBuffers(1, &particleEmitterData.mParticlePositionsBuffer));
-    GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleLifetimeSecsBuffer));
-    GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleSizesBuffer));
-    GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleAnglesBuffer));
-    
-    GL_CALL(glBindVertexArray(particleEmitterData.mParticleVertexArrayObject));
-    
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleVertexBuffer));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, PARTICLE_VERTEX_POSITIONS[0].size() * sizeof(float) , PARTICLE_VERTEX_POSITIONS[0].data(), GL_STATIC_DRAW));
-    
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleUVBuffer));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, PARTICLE_UVS.size() * sizeof(float) , PARTICLE_UVS.data(), GL_STATIC_DRAW));
-    
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticlePositionsBuffer));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(glm::vec3), particleEmitterData.mParticlePositions.data(), GL_DYNAMIC_DRAW));
-    
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleLifetimeSecsBuffer));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(float), particleEmitterData.mParticleLifetimeSecs.data(), GL_DYNAMIC_DRAW));
-    
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleSizesBuffer));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(float), particleEmitterData.mParticleSizes.data(), GL_DYNAMIC_DRAW));
-    
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleAnglesBuffer));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(float), particleEmitterData.mParticleAngles.data(), GL_DYNAMIC_DRAW));
+    // Headless runs (no GL context) only simulate the particles
+    if (!CoreSystemsEngine::IsHeadless())
+    {
+        GL_CALL(glGenVertexArrays(1, &particleEmitterData.mParticleVertexArrayObject));
+        GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleVertexBuffer));
+        GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleUVBuffer));
+        GL_CALL(glGenBuffers(1, &particleEmitterData.mParticlePositionsBuffer));
+        GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleLifetimeSecsBuffer));
+        GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleSizesBuffer));
+        GL_CALL(glGenBuffers(1, &particleEmitterData.mParticleAnglesBuffer));
+        
+        GL_CALL(glBindVertexArray(particleEmitterData.mParticleVertexArrayObject));
+        
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleVertexBuffer));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, PARTICLE_VERTEX_POSITIONS[0].size() * sizeof(float) , PARTICLE_VERTEX_POSITIONS[0].data(), GL_STATIC_DRAW));
+        
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleUVBuffer));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, PARTICLE_UVS.size() * sizeof(float) , PARTICLE_UVS.data(), GL_STATIC_DRAW));
+        
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticlePositionsBuffer));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(glm::vec3), particleEmitterData.mParticlePositions.data(), GL_DYNAMIC_DRAW));
+        
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleLifetimeSecsBuffer));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(float), particleEmitterData.mParticleLifetimeSecs.data(), GL_DYNAMIC_DRAW));
+        
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleSizesBuffer));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(float), particleEmitterData.mParticleSizes.data(), GL_DYNAMIC_DRAW));
+        
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterData.mParticleAnglesBuffer));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, particleEmitterData.mParticleCount * sizeof(float), particleEmitterData.mParticleAngles.data(), GL_DYNAMIC_DRAW));
+    }
     
     particleSystemSo->mSceneObjectTypeData = std::move(particleEmitterData);
     
@@ -410,7 +447,7 @@ void ParticleManager::ChangeParticleTexture(const strutils::StringId& particleEm
 
 ///------------------------------------------------------------------------------------------------
 
-void ParticleManager::SpawnParticleAtIndex(const size_t index, const glm::vec3& sceneObjectPosition, scene::ParticleEmitterObjectData& particleEmitterData)
+void ParticleManager::SpawnParticleAtIndex(const size_t index, const glm::vec3& sceneObjectPosition, scene::ParticleEmitterObjectData& particleEmitterData) const
 {
     const auto lifeTime = math::RandomFloat(particleEmitterData.mParticleLifetimeRangeSecs.x, particleEmitterData.mParticleLifetimeRangeSecs.y);
     const auto xOffset = math::RandomFloat(particleEmitterData.mParticlePositionXOffsetRange.x, particleEmitterData.mParticlePositionXOffsetRange.y);
@@ -455,6 +492,12 @@ void ParticleManager::RemoveParticleGraphicsData(scene::SceneObject& particleEmi
 {
     assert(std::holds_alternative<scene::ParticleEmitterObjectData>(particleEmitterSceneObject.mSceneObjectTypeData));
     auto& particleEmitterData = std::get<scene::ParticleEmitterObjectData>(particleEmitterSceneObject.mSceneObjectTypeData);
+    
+    if (CoreSystemsEngine::IsHeadless())
+    {
+        return;
+    }
+    
     GL_CALL(glDeleteBuffers(1, &particleEmitterData.mParticleUVBuffer));
     GL_CALL(glDeleteBuffers(1, &particleEmitterData.mParticleSizesBuffer));
     GL_CALL(glDeleteBuffers(1, &particleEmitterData.mParticleAnglesBuffer));
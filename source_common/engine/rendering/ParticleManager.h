@@ -70,11 +70,16 @@ public:
     
 private:
     ParticleManager() = default;
-    void SpawnParticleAtIndex(const size_t index, const glm::vec3& sceneObjectPosition, scene::ParticleEmitterObjectData& particleEmitterObjectData);
+    
+    /// Runs on job system threads. @returns whether the emitter has expired
+    bool UpdateParticleEmitter(const float dtMillis, scene::SceneObject& particleEmitterSceneObject) const;
+    void SpawnParticleAtIndex(const size_t index, const glm::vec3& sceneObjectPosition, scene::ParticleEmitterObjectData& particleEmitterObjectData) const;
     void SpawnParticleAtIndex(const size_t index, scene::SceneObject& particleEmitterSceneObject);
     
 private:
     std::vector<std::shared_ptr<scene::SceneObject>> mParticleEmittersToDelete;
+    std::vector<std::shared_ptr<scene::SceneObject>> mParticleEmittersToUpdate;
+    std::vector<uint8_t> mParticleEmitterExpiredFlags;
     std::unordered_map<strutils::StringId, scene::ParticleEmitterObjectData, strutils::StringIdHasher> mParticleNamesToData;
     resources::ResourceReloadMode mResourceReloadMode;
 };
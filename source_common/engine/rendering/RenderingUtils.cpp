@@ -5,20 +5,41 @@
 ///  Created by Alex Koukoulas on 31/10/2023                                                       
 ///------------------------------------------------------------------------------------------------
 
+#include <algorithm>
 #include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/CommonUniforms.h>
 #include <engine/rendering/RenderingUtils.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/rendering/IRenderer.h>
 #define STB_IMAGE_WRITE_IMPLEMENTATION
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
 #include <engine/rendering/stb_image_write.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#include <engine/resloading/ShaderResource.h>
 #include <engine/resloading/TextureResource.h>
 #include <engine/scene/Scene.h>
+#include <engine/scene/SceneObject.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/PlatformMacros.h>
 #include <SDL_surface.h>
 
 ///------------------------------------------------------------------------------------------------
 
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#endif
+
+///------------------------------------------------------------------------------------------------
+
 //static constexpr int NEW_TEXTURE_SIZE = 4096;
 //static constexpr int DOWNSCALED_NAVMAP_IMAGE_SIZE = 4096;
 
@@ -68,6 +89,132 @@ void CreateGLTextureFromSurface(SDL_Surface* surface, GLuint& glTextureId, int&
 
 ///------------------------------------------------------------------------------------------------
 
+void CreateGLTextureFromRGBAPixels(const unsigned char* rgbaPixels, const int width, const int height, GLuint& glTextureId, const bool nnFiltering)
+{
+    GL_CALL(glGenTextures(1, &glTextureId));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, glTextureId));
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaPixels));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, nnFiltering ? GL_NEAREST : GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, nnFiltering ? GL_NEAREST : GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CreateGLTextureFromCookedTexture(const CookedTexture& cookedTexture, GLuint& glTextureId, const bool nnFiltering)
+{
+    const auto glInternalFormat = cookedTexture.mFormat == CookedTextureFormat::BC3 ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA8_ETC2_EAC;
+    
+    GL_CALL(glGenTextures(1, &glTextureId));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, glTextureId));
+    
+    for (size_t i = 0; i < cookedTexture.mMipLevels.size(); ++i)
+    {
+        const auto& mipLevel = cookedTexture.mMipLevels[i];
+        GL_CALL(glCompressedTexImage2D
+        (
+            GL_TEXTURE_2D,
+            static_cast<GLint>(i),
+            glInternalFormat,
+            mipLevel.mWidth,
+            mipLevel.mHeight,
+            0,
+            static_cast<GLsizei>(mipLevel.mData.size()),
+            mipLevel.mData.data()
+        ));
+    }
+    
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(cookedTexture.mMipLevels.size()) - 1));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, nnFiltering ? GL_NEAREST_MIPMAP_LINEAR : GL_LINEAR_MIPMAP_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, nnFiltering ? GL_NEAREST : GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void BindSceneObjectTexture(const scene::SceneObject& sceneObject, const resources::ShaderResource& shader)
+{
+    auto& resService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+    
+    // Atlased textures drawn with a shader that can't sample atlas pages fall back to a standalone upload
+    const auto shaderSamplesAtlasPages = shader.GetUniformNamesToLocations().contains(ATLAS_UV_RECT_UNIFORM_NAME);
+    const auto* atlasEntry = shaderSamplesAtlasPages ? resService.GetTextureAtlasEntry(sceneObject.mTextureResourceId) : nullptr;
+    
+    const auto& currentTexture = atlasEntry ? resService.GetResource<resources::TextureResource>(atlasEntry->mAtlasPageTextureResourceId) : resService.GetStandaloneTexture(sceneObject.mTextureResourceId);
+    GL_CALL(glActiveTexture(GL_TEXTURE0));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, currentTexture.GetGLTextureId()));
+    
+    shader.SetBool(IS_ATLAS_TEXTURE_UNIFORM_NAME, atlasEntry != nullptr);
+    if (atlasEntry)
+    {
+        shader.SetFloatVec4(ATLAS_UV_RECT_UNIFORM_NAME, atlasEntry->mUVRect);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void BindSceneObjectEffectTextures(const scene::SceneObject& sceneObject)
+{
+    auto& resService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+    
+    for (int i = 0; i < scene::EFFECT_TEXTURES_COUNT; ++i)
+    {
+        if (sceneObject.mEffectTextureResourceIds[i] != 0)
+        {
+            const auto& currentEffectTexture = resService.GetStandaloneTexture(sceneObject.mEffectTextureResourceIds[i]);
+            GL_CALL(glActiveTexture(GL_TEXTURE1 + i));
+            GL_CALL(glBindTexture(GL_TEXTURE_2D, currentEffectTexture.GetGLTextureId()));
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool IsGLExtensionSupported(const std::string& extensionName)
+{
+    GLint extensionCount = 0;
+    GL_CALL(glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount));
+    for (GLint i = 0; i < extensionCount; ++i)
+    {
+        const auto* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+        if (extension && extensionName == extension)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool IsCookedTextureFormatSupported(const CookedTextureFormat format)
+{
+    switch (format)
+    {
+        case CookedTextureFormat::BC3:
+        {
+            static const bool sIsSupported = IsGLExtensionSupported("GL_EXT_texture_compression_s3tc");
+            return sIsSupported;
+        }
+            
+        case CookedTextureFormat::ETC2_RGBA8:
+        {
+#if defined(MOBILE_FLOW)
+            // Mandatory in OpenGL ES 3.0
+            return true;
+#else
+            // Core in desktop GL 4.3, but drivers commonly decompress it to RGBA8 on upload
+            return false;
+#endif
+        }
+    }
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
 void ExportPixelsToPNG(const std::string& exportFilePath, unsigned char* pixels, const int imageSize)
 {
     stbi_write_png(exportFilePath.c_str(), imageSize, imageSize, 4, pixels, imageSize * 4);
@@ -75,13 +222,40 @@ void ExportPixelsToPNG(const std::string& exportFilePath, unsigned char* pixels,
 
 ///------------------------------------------------------------------------------------------------
 
+void CaptureFramebufferPixels(std::vector<unsigned char>& outRGBAPixels, int& outWidth, int& outHeight)
+{
+    GLint viewport[4];
+    GL_CALL(glGetIntegerv(GL_VIEWPORT, viewport));
+    outWidth = viewport[2];
+    outHeight = viewport[3];
+    
+    const auto rowBytes = static_cast<size_t>(outWidth) * 4;
+    outRGBAPixels.resize(rowBytes * outHeight);
+    
+    GL_CALL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+    GL_CALL(glReadPixels(viewport[0], viewport[1], outWidth, outHeight, GL_RGBA, GL_UNSIGNED_BYTE, outRGBAPixels.data()));
+    
+    // GL rows start from the bottom
+    for (int y = 0; y < outHeight / 2; ++y)
+    {
+        std::swap_ranges(outRGBAPixels.begin() + y * rowBytes, outRGBAPixels.begin() + (y + 1) * rowBytes, outRGBAPixels.begin() + (outHeight - 1 - y) * rowBytes);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
 int GetDisplayRefreshRate()
 {
+    // If we can't find the refresh rate, we'll return this:
+    constexpr int DEFAULT_REFRESH_RATE = 60;
+    if (CoreSystemsEngine::IsHeadless())
+    {
+        return DEFAULT_REFRESH_RATE;
+    }
+    
     SDL_DisplayMode mode;
     int displayIndex = SDL_GetWindowDisplayIndex(&CoreSystemsEngine::GetInstance().GetContextWindow());
     
-    // If we can't find the refresh rate, we'll return this:
-    constexpr int DEFAULT_REFRESH_RATE = 60;
     if (SDL_GetDesktopDisplayMode(displayIndex, &mode) != 0)
     {
         return DEFAULT_REFRESH_RATE;
@@ -10,6 +10,7 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include <engine/rendering/TextureCooking.h>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/utils/MathUtils.h>
 #include <memory>
@@ -17,6 +18,7 @@
 
 namespace scene { struct SceneObject; }
 namespace scene { class Scene; }
+namespace resources { class ShaderResource; }
 
 ///------------------------------------------------------------------------------------------------
 
@@ -42,8 +44,41 @@ void CreateGLTextureFromSurface(SDL_Surface* surface, GLuint& glTextureId, int&
 
 ///------------------------------------------------------------------------------------------------
 
+void CreateGLTextureFromRGBAPixels(const unsigned char* rgbaPixels, const int width, const int height, GLuint& glTextureId, const bool nnFiltering);
+
+///------------------------------------------------------------------------------------------------
+
+void CreateGLTextureFromCookedTexture(const CookedTexture& cookedTexture, GLuint& glTextureId, const bool nnFiltering);
+
+///------------------------------------------------------------------------------------------------
+
+// Binds the scene object's texture, or the atlas page it has been packed in if the shader samples
+// atlas pages (otherwise atlased textures are bound through their standalone fallback upload).
+void BindSceneObjectTexture(const scene::SceneObject& sceneObject, const resources::ShaderResource& shader);
+
+///------------------------------------------------------------------------------------------------
+
+// Binds the scene object's effect textures to the texture units after the main one. Effect textures
+// are always sampled on their own, so atlased ones are bound through their standalone fallback upload.
+void BindSceneObjectEffectTextures(const scene::SceneObject& sceneObject);
+
+///------------------------------------------------------------------------------------------------
+
+bool IsCookedTextureFormatSupported(const CookedTextureFormat format);
+
+///------------------------------------------------------------------------------------------------
+
+bool IsGLExtensionSupported(const std::string& extensionName);
+
+///------------------------------------------------------------------------------------------------
+
 void ExportPixelsToPNG(const std::string& exportFilePath, unsigned char* pixels, const int imageSize);
 
+///------------------------------------------------------------------------------------------------
+/// Reads back the RGBA pixels of the currently bound framebuffer (top row first), e.g. for pixel tests
+/// on offscreen runs. Needs to be called before the render pass ends (i.e. before the buffers are swapped).
+void CaptureFramebufferPixels(std::vector<unsigned char>& outRGBAPixels, int& outWidth, int& outHeight);
+
 ///------------------------------------------------------------------------------------------------
 
 int GetDisplayRefreshRate();
@@ -0,0 +1,235 @@
+///------------------------------------------------------------------------------------------------
+///  TextureAtlas.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <engine/rendering/TextureAtlas.h>
+#include <limits>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr int BYTES_PER_PIXEL = 4;
+
+///------------------------------------------------------------------------------------------------
+
+TextureAtlasBuilder::TextureAtlasBuilder(const int pageSize, const int padding)
+    : mPageSize(pageSize)
+    , mPadding(padding)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool TextureAtlasBuilder::AddImage(const std::string& name, const unsigned char* rgbaPixels, const int width, const int height)
+{
+    if (width <= 0 || height <= 0 || width + 2 * mPadding > mPageSize || height + 2 * mPadding > mPageSize)
+    {
+        return false;
+    }
+
+    PendingImage image;
+    image.mName = name;
+    image.mPixels.assign(rgbaPixels, rgbaPixels + static_cast<size_t>(width) * height * BYTES_PER_PIXEL);
+    image.mWidth = width;
+    image.mHeight = height;
+    mPendingImages.push_back(std::move(image));
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TextureAtlasBuilder::Build()
+{
+    mPages.clear();
+    mManifest.clear();
+
+    // Tallest (then widest) first keeps the skyline flat, which is where most of the packing efficiency comes from
+    std::stable_sort(mPendingImages.begin(), mPendingImages.end(), [](const PendingImage& lhs, const PendingImage& rhs)
+    {
+        return lhs.mHeight != rhs.mHeight ? lhs.mHeight > rhs.mHeight : lhs.mWidth > rhs.mWidth;
+    });
+
+    std::vector<std::vector<SkylineSegment>> pageSkylines;
+    for (const auto& image: mPendingImages)
+    {
+        const auto paddedWidth = image.mWidth + 2 * mPadding;
+        const auto paddedHeight = image.mHeight + 2 * mPadding;
+
+        glm::ivec2 paddedPosition = {};
+        auto pageIndex = 0;
+        for (; pageIndex < static_cast<int>(pageSkylines.size()); ++pageIndex)
+        {
+            if (TryPackInPage(pageSkylines[pageIndex], paddedWidth, paddedHeight, paddedPosition))
+            {
+                break;
+            }
+        }
+
+        if (pageIndex == static_cast<int>(pageSkylines.size()))
+        {
+            pageSkylines.push_back({ SkylineSegment{ 0, 0, mPageSize } });
+            mPages.emplace_back(static_cast<size_t>(mPageSize) * mPageSize * BYTES_PER_PIXEL, 0);
+
+            [[maybe_unused]] const auto packed = TryPackInPage(pageSkylines.back(), paddedWidth, paddedHeight, paddedPosition);
+            assert(packed && "Image should always fit in an empty page");
+        }
+
+        BlitImage(image, mPages[pageIndex], paddedPosition);
+
+        TextureAtlasRegion region;
+        region.mPageIndex = pageIndex;
+        region.mPixelRect = glm::ivec4(paddedPosition.x + mPadding, paddedPosition.y + mPadding, image.mWidth, image.mHeight);
+        region.mUVRect = glm::vec4(region.mPixelRect)/static_cast<float>(mPageSize);
+        mManifest[image.mName] = region;
+    }
+
+    mPendingImages.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+int TextureAtlasBuilder::GetPageSize() const
+{
+    return mPageSize;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::vector<std::vector<unsigned char>>& TextureAtlasBuilder::GetPages() const
+{
+    return mPages;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const TextureAtlasManifest& TextureAtlasBuilder::GetManifest() const
+{
+    return mManifest;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float TextureAtlasBuilder::GetPackingEfficiency() const
+{
+    if (mPages.empty())
+    {
+        return 0.0f;
+    }
+
+    size_t usedTexels = 0;
+    for (const auto& [name, region]: mManifest)
+    {
+        usedTexels += static_cast<size_t>(region.mPixelRect.z) * region.mPixelRect.w;
+    }
+
+    return static_cast<float>(usedTexels)/(static_cast<float>(mPageSize) * mPageSize * mPages.size());
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool TextureAtlasBuilder::TryPackInPage(std::vector<SkylineSegment>& skyline, const int width, const int height, glm::ivec2& outPosition) const
+{
+    auto bestSegmentIndex = -1;
+    auto bestY = std::numeric_limits<int>::max();
+
+    for (int i = 0; i < static_cast<int>(skyline.size()); ++i)
+    {
+        const auto x = skyline[i].mX;
+        if (x + width > mPageSize)
+        {
+            break;
+        }
+
+        // The rect rests on the highest segment it spans
+        auto y = 0;
+        auto remainingWidth = width;
+        for (int j = i; remainingWidth > 0; ++j)
+        {
+            y = std::max(y, skyline[j].mY);
+            remainingWidth -= skyline[j].mWidth;
+        }
+
+        if (y + height <= mPageSize && y < bestY)
+        {
+            bestY = y;
+            bestSegmentIndex = i;
+        }
+    }
+
+    if (bestSegmentIndex == -1)
+    {
+        return false;
+    }
+
+    outPosition = glm::ivec2(skyline[bestSegmentIndex].mX, bestY);
+
+    // Raise the skyline over the newly placed rect, and trim/remove whatever segments it now covers
+    skyline.insert(skyline.begin() + bestSegmentIndex, SkylineSegment{ outPosition.x, bestY + height, width });
+    const auto rectEndX = outPosition.x + width;
+    for (auto i = bestSegmentIndex + 1; i < static_cast<int>(skyline.size()) && skyline[i].mX < rectEndX;)
+    {
+        const auto overlap = rectEndX - skyline[i].mX;
+        if (overlap >= skyline[i].mWidth)
+        {
+            skyline.erase(skyline.begin() + i);
+        }
+        else
+        {
+            skyline[i].mX += overlap;
+            skyline[i].mWidth -= overlap;
+            break;
+        }
+    }
+
+    // Merge neighbouring segments of the same height
+    for (int i = 0; i + 1 < static_cast<int>(skyline.size());)
+    {
+        if (skyline[i].mY == skyline[i + 1].mY)
+        {
+            skyline[i].mWidth += skyline[i + 1].mWidth;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TextureAtlasBuilder::BlitImage(const PendingImage& image, std::vector<unsigned char>& page, const glm::ivec2& paddedPosition) const
+{
+    // Padding texels replicate the closest edge texel of the image
+    for (int y = -mPadding; y < image.mHeight + mPadding; ++y)
+    {
+        const auto sourceY = std::clamp(y, 0, image.mHeight - 1);
+        const auto targetY = paddedPosition.y + mPadding + y;
+
+        for (int x = -mPadding; x < image.mWidth + mPadding; ++x)
+        {
+            const auto sourceX = std::clamp(x, 0, image.mWidth - 1);
+            const auto targetX = paddedPosition.x + mPadding + x;
+
+            std::memcpy(&page[(static_cast<size_t>(targetY) * mPageSize + targetX) * BYTES_PER_PIXEL], &image.mPixels[(static_cast<size_t>(sourceY) * image.mWidth + sourceX) * BYTES_PER_PIXEL], BYTES_PER_PIXEL);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
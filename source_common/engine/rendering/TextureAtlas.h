@@ -0,0 +1,96 @@
+///------------------------------------------------------------------------------------------------
+///  TextureAtlas.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef TextureAtlas_h
+#define TextureAtlas_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/utils/MathUtils.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+/// Where a packed image ended up in the atlas.
+struct TextureAtlasRegion
+{
+    int mPageIndex = 0;
+    glm::ivec4 mPixelRect = {}; // x, y, width, height (in page pixels, row 0 being the first uploaded row)
+    glm::vec4 mUVRect = {};     // min u, min v, u extent, v extent (i.e. atlasUv = mUVRect.xy + localUv * mUVRect.zw)
+};
+
+///------------------------------------------------------------------------------------------------
+/// The manifest of an atlas, i.e. the region of every image packed in it, keyed by image name.
+using TextureAtlasManifest = std::unordered_map<std::string, TextureAtlasRegion>;
+
+///------------------------------------------------------------------------------------------------
+/// Packs a number of small RGBA8 images into as few square pages as possible
+/// (skyline bottom-left heuristic, tallest images first). Every image is surrounded
+/// by its own edge texels (padding) so that filtering/mip sampling never bleeds neighbouring images in.
+class TextureAtlasBuilder final
+{
+public:
+    TextureAtlasBuilder(const int pageSize, const int padding);
+
+    /// Queues an image to be packed by the next call to Build().
+    /// @param[in] name the name the region of the image will be recorded under in the manifest.
+    /// @param[in] rgbaPixels the tightly packed RGBA8 pixels of the image (copied).
+    /// @param[in] width the width of the image.
+    /// @param[in] height the height of the image.
+    /// @returns whether or not the image can fit in a page (images that can't are not queued).
+    bool AddImage(const std::string& name, const unsigned char* rgbaPixels, const int width, const int height);
+
+    /// Packs all queued images, creating the pages and the manifest.
+    void Build();
+
+    int GetPageSize() const;
+    const std::vector<std::vector<unsigned char>>& GetPages() const;
+    const TextureAtlasManifest& GetManifest() const;
+
+    /// @returns the ratio of the pages' texels that are covered by the packed images (excluding their padding).
+    float GetPackingEfficiency() const;
+
+private:
+    struct PendingImage
+    {
+        std::string mName;
+        std::vector<unsigned char> mPixels;
+        int mWidth;
+        int mHeight;
+    };
+
+    struct SkylineSegment
+    {
+        int mX;
+        int mY;
+        int mWidth;
+    };
+
+    bool TryPackInPage(std::vector<SkylineSegment>& skyline, const int width, const int height, glm::ivec2& outPosition) const;
+    void BlitImage(const PendingImage& image, std::vector<unsigned char>& page, const glm::ivec2& paddedPosition) const;
+
+private:
+    const int mPageSize;
+    const int mPadding;
+    std::vector<PendingImage> mPendingImages;
+    std::vector<std::vector<unsigned char>> mPages;
+    TextureAtlasManifest mManifest;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* TextureAtlas_h */
@@ -0,0 +1,780 @@
+///------------------------------------------------------------------------------------------------
+///  TextureCooking.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <engine/rendering/TextureCooking.h>
+#include <engine/utils/Logging.h>
+#include <fstream>
+#include <limits>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr CookedTextureFormat ALL_COOKED_TEXTURE_FORMATS[] = { CookedTextureFormat::BC3, CookedTextureFormat::ETC2_RGBA8 };
+
+// ETC1/ETC2 color modifier tables (per subblock, added to all 3 channels)
+static constexpr int ETC_COLOR_MODIFIER_TABLES[8][2] =
+{
+    { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+};
+
+// EAC alpha modifier tables (scaled by the block's multiplier)
+static constexpr int EAC_ALPHA_MODIFIER_TABLES[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+
+// Table/index pair of the EAC alpha modifier that is exactly 0
+static constexpr int EAC_ALPHA_ZERO_MODIFIER_TABLE = 13;
+static constexpr int EAC_ALPHA_ZERO_MODIFIER_INDEX = 4;
+
+///------------------------------------------------------------------------------------------------
+
+static inline int ClampToByte(const int value)
+{
+    return std::clamp(value, 0, 255);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static inline int ColorDistanceSquared(const int r0, const int g0, const int b0, const int r1, const int g1, const int b1)
+{
+    return (r0 - r1) * (r0 - r1) + (g0 - g1) * (g0 - g1) + (b0 - b1) * (b0 - b1);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static inline int QuantizeToBits(const int value, const int bits)
+{
+    const auto maxValue = (1 << bits) - 1;
+    return (value * maxValue + 127) / 255;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static inline int ExpandFromBits(const int value, const int bits)
+{
+    return (value << (8 - bits)) | (value >> (2 * bits - 8));
+}
+
+///------------------------------------------------------------------------------------------------
+/// BC3 (DXT5)
+///------------------------------------------------------------------------------------------------
+
+static void CompressBC3AlphaBlock(const unsigned char* blockRGBAPixels, unsigned char* outBlock)
+{
+    auto minAlpha = 255, maxAlpha = 0;
+    auto minInnerAlpha = 255, maxInnerAlpha = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        const auto alpha = static_cast<int>(blockRGBAPixels[i * 4 + 3]);
+        minAlpha = std::min(minAlpha, alpha);
+        maxAlpha = std::max(maxAlpha, alpha);
+        if (alpha != 0 && alpha != 255)
+        {
+            minInnerAlpha = std::min(minInnerAlpha, alpha);
+            maxInnerAlpha = std::max(maxInnerAlpha, alpha);
+        }
+    }
+    if (minInnerAlpha > maxInnerAlpha)
+    {
+        minInnerAlpha = maxInnerAlpha = 0;
+    }
+
+    // Candidate 1: 8 interpolated values between min/max (a0 > a1).
+    // Candidate 2: 6 interpolated values between the non 0/255 extremes, plus explicit 0 and 255 (a0 <= a1),
+    // which is what blocks on the edge of cut-out sprites want.
+    const int candidateEndpoints[2][2] = { { maxAlpha, minAlpha }, { minInnerAlpha, maxInnerAlpha } };
+
+    auto bestError = std::numeric_limits<int>::max();
+    for (const auto& endpoints: candidateEndpoints)
+    {
+        const auto a0 = endpoints[0];
+        const auto a1 = endpoints[1];
+
+        int palette[8] = { a0, a1 };
+        if (a0 > a1)
+        {
+            for (int k = 2; k < 8; ++k) palette[k] = ((8 - k) * a0 + (k - 1) * a1) / 7;
+        }
+        else
+        {
+            for (int k = 2; k < 6; ++k) palette[k] = ((6 - k) * a0 + (k - 1) * a1) / 5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        auto error = 0;
+        uint64_t indices = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            const auto alpha = static_cast<int>(blockRGBAPixels[i * 4 + 3]);
+            auto bestIndex = 0;
+            auto bestIndexError = std::numeric_limits<int>::max();
+            for (int k = 0; k < 8; ++k)
+            {
+                const auto indexError = (palette[k] - alpha) * (palette[k] - alpha);
+                if (indexError < bestIndexError)
+                {
+                    bestIndexError = indexError;
+                    bestIndex = k;
+                }
+            }
+            error += bestIndexError;
+            indices |= static_cast<uint64_t>(bestIndex) << (3 * i);
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            outBlock[0] = static_cast<unsigned char>(a0);
+            outBlock[1] = static_cast<unsigned char>(a1);
+            for (int b = 0; b < 6; ++b)
+            {
+                outBlock[2 + b] = static_cast<unsigned char>((indices >> (8 * b)) & 0xFF);
+            }
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void CompressBC3ColorBlock(const unsigned char* blockRGBAPixels, unsigned char* outBlock)
+{
+    // Fully transparent texels don't contribute to the endpoint fit
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    auto contributingTexelCount = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        if (blockRGBAPixels[i * 4 + 3] == 0) continue;
+        for (int c = 0; c < 3; ++c) mean[c] += blockRGBAPixels[i * 4 + c];
+        contributingTexelCount++;
+    }
+
+    if (contributingTexelCount == 0)
+    {
+        std::memset(outBlock, 0, 8);
+        return;
+    }
+
+    for (int c = 0; c < 3; ++c) mean[c] /= contributingTexelCount;
+
+    // Principal axis of the texel colors via a few power iterations on their covariance
+    float covariance[3][3] = {};
+    for (int i = 0; i < 16; ++i)
+    {
+        if (blockRGBAPixels[i * 4 + 3] == 0) continue;
+        const float delta[3] = { blockRGBAPixels[i * 4 + 0] - mean[0], blockRGBAPixels[i * 4 + 1] - mean[1], blockRGBAPixels[i * 4 + 2] - mean[2] };
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 3; ++col)
+            {
+                covariance[row][col] += delta[row] * delta[col];
+            }
+        }
+    }
+
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+    for (int iteration = 0; iteration < 8; ++iteration)
+    {
+        float nextAxis[3] = {};
+        for (int row = 0; row < 3; ++row)
+        {
+            nextAxis[row] = covariance[row][0] * axis[0] + covariance[row][1] * axis[1] + covariance[row][2] * axis[2];
+        }
+
+        const auto maxComponent = std::max({ std::abs(nextAxis[0]), std::abs(nextAxis[1]), std::abs(nextAxis[2]) });
+        if (maxComponent < 1e-6f)
+        {
+            break;
+        }
+        for (int c = 0; c < 3; ++c) axis[c] = nextAxis[c] / maxComponent;
+    }
+
+    const auto axisLengthSquared = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    auto minProjection = 0.0f, maxProjection = 0.0f;
+    for (int i = 0; i < 16; ++i)
+    {
+        if (blockRGBAPixels[i * 4 + 3] == 0) continue;
+        const auto projection = ((blockRGBAPixels[i * 4 + 0] - mean[0]) * axis[0] + (blockRGBAPixels[i * 4 + 1] - mean[1]) * axis[1] + (blockRGBAPixels[i * 4 + 2] - mean[2]) * axis[2]) / axisLengthSquared;
+        minProjection = std::min(minProjection, projection);
+        maxProjection = std::max(maxProjection, projection);
+    }
+
+    int endpoints565[2];
+    for (int e = 0; e < 2; ++e)
+    {
+        const auto projection = e == 0 ? maxProjection : minProjection;
+        const auto r = ClampToByte(static_cast<int>(mean[0] + axis[0] * projection + 0.5f));
+        const auto g = ClampToByte(static_cast<int>(mean[1] + axis[1] * projection + 0.5f));
+        const auto b = ClampToByte(static_cast<int>(mean[2] + axis[2] * projection + 0.5f));
+        endpoints565[e] = (QuantizeToBits(r, 5) << 11) | (QuantizeToBits(g, 6) << 5) | QuantizeToBits(b, 5);
+    }
+
+    // c0 > c1 keeps the block in 4 color mode even for decoders that treat BC3 color like BC1
+    if (endpoints565[0] < endpoints565[1])
+    {
+        std::swap(endpoints565[0], endpoints565[1]);
+    }
+
+    int palette[4][3];
+    for (int e = 0; e < 2; ++e)
+    {
+        palette[e][0] = ExpandFromBits((endpoints565[e] >> 11) & 0x1F, 5);
+        palette[e][1] = ExpandFromBits((endpoints565[e] >> 5) & 0x3F, 6);
+        palette[e][2] = ExpandFromBits(endpoints565[e] & 0x1F, 5);
+    }
+    for (int c = 0; c < 3; ++c)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    uint32_t indices = 0;
+    if (endpoints565[0] != endpoints565[1])
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            auto bestIndex = 0;
+            auto bestIndexError = std::numeric_limits<int>::max();
+            for (int k = 0; k < 4; ++k)
+            {
+                const auto indexError = ColorDistanceSquared(palette[k][0], palette[k][1], palette[k][2], blockRGBAPixels[i * 4 + 0], blockRGBAPixels[i * 4 + 1], blockRGBAPixels[i * 4 + 2]);
+                if (indexError < bestIndexError)
+                {
+                    bestIndexError = indexError;
+                    bestIndex = k;
+                }
+            }
+            indices |= static_cast<uint32_t>(bestIndex) << (2 * i);
+        }
+    }
+
+    outBlock[0] = static_cast<unsigned char>(endpoints565[0] & 0xFF);
+    outBlock[1] = static_cast<unsigned char>(endpoints565[0] >> 8);
+    outBlock[2] = static_cast<unsigned char>(endpoints565[1] & 0xFF);
+    outBlock[3] = static_cast<unsigned char>(endpoints565[1] >> 8);
+    for (int b = 0; b < 4; ++b)
+    {
+        outBlock[4 + b] = static_cast<unsigned char>((indices >> (8 * b)) & 0xFF);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// ETC2 RGBA8 (EAC alpha + ETC1 compatible color). Note that ETC texels are indexed column major.
+///------------------------------------------------------------------------------------------------
+
+static inline int GetETCTexelOffset(const int etcTexelIndex)
+{
+    const auto x = etcTexelIndex / 4;
+    const auto y = etcTexelIndex % 4;
+    return (y * 4 + x) * 4;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void CompressEACAlphaBlock(const unsigned char* blockRGBAPixels, unsigned char* outBlock)
+{
+    auto minAlpha = 255, maxAlpha = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        minAlpha = std::min(minAlpha, static_cast<int>(blockRGBAPixels[i * 4 + 3]));
+        maxAlpha = std::max(maxAlpha, static_cast<int>(blockRGBAPixels[i * 4 + 3]));
+    }
+
+    auto bestBase = minAlpha, bestTable = EAC_ALPHA_ZERO_MODIFIER_TABLE, bestMultiplier = 1;
+    uint64_t bestIndices = 0;
+
+    if (minAlpha == maxAlpha)
+    {
+        // Constant alpha (the vast majority of blocks) is encoded exactly
+        for (int i = 0; i < 16; ++i)
+        {
+            bestIndices = (bestIndices << 3) | EAC_ALPHA_ZERO_MODIFIER_INDEX;
+        }
+    }
+    else
+    {
+        auto bestError = std::numeric_limits<int>::max();
+        const auto midAlpha = (minAlpha + maxAlpha + 1) / 2;
+        for (int base = std::max(0, midAlpha - 2); base <= std::min(255, midAlpha + 2) && bestError > 0; ++base)
+        {
+            for (int table = 0; table < 16; ++table)
+            {
+                for (int multiplier = 1; multiplier < 16; ++multiplier)
+                {
+                    auto error = 0;
+                    uint64_t indices = 0;
+                    for (int i = 0; i < 16 && error < bestError; ++i)
+                    {
+                        const auto alpha = static_cast<int>(blockRGBAPixels[GetETCTexelOffset(i) + 3]);
+                        auto bestIndex = 0;
+                        auto bestIndexError = std::numeric_limits<int>::max();
+                        for (int k = 0; k < 8; ++k)
+                        {
+                            const auto decodedAlpha = ClampToByte(base + EAC_ALPHA_MODIFIER_TABLES[table][k] * multiplier);
+                            const auto indexError = (decodedAlpha - alpha) * (decodedAlpha - alpha);
+                            if (indexError < bestIndexError)
+                            {
+                                bestIndexError = indexError;
+                                bestIndex = k;
+                            }
+                        }
+                        error += bestIndexError;
+                        indices = (indices << 3) | static_cast<uint64_t>(bestIndex);
+                    }
+
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        bestBase = base;
+                        bestTable = table;
+                        bestMultiplier = multiplier;
+                        bestIndices = indices;
+                    }
+                }
+            }
+        }
+    }
+
+    outBlock[0] = static_cast<unsigned char>(bestBase);
+    outBlock[1] = static_cast<unsigned char>((bestMultiplier << 4) | bestTable);
+    for (int b = 0; b < 6; ++b)
+    {
+        outBlock[2 + b] = static_cast<unsigned char>((bestIndices >> (8 * (5 - b))) & 0xFF);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+struct ETCSubblockEncoding
+{
+    int mError = std::numeric_limits<int>::max();
+    int mTable = 0;
+    uint32_t mMSBs = 0;
+    uint32_t mLSBs = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+static ETCSubblockEncoding EncodeETCSubblock(const unsigned char* blockRGBAPixels, const int* subblockTexelIndices, const int baseColor[3])
+{
+    ETCSubblockEncoding bestEncoding;
+    for (int table = 0; table < 8; ++table)
+    {
+        const int modifiers[4] = { ETC_COLOR_MODIFIER_TABLES[table][0], ETC_COLOR_MODIFIER_TABLES[table][1], -ETC_COLOR_MODIFIER_TABLES[table][0], -ETC_COLOR_MODIFIER_TABLES[table][1] };
+
+        ETCSubblockEncoding encoding;
+        encoding.mError = 0;
+        encoding.mTable = table;
+        for (int t = 0; t < 8; ++t)
+        {
+            const auto texelIndex = subblockTexelIndices[t];
+            const auto* texel = &blockRGBAPixels[GetETCTexelOffset(texelIndex)];
+
+            auto bestModifier = 0;
+            auto bestModifierError = std::numeric_limits<int>::max();
+            for (int m = 0; m < 4; ++m)
+            {
+                const auto modifierError = ColorDistanceSquared(ClampToByte(baseColor[0] + modifiers[m]), ClampToByte(baseColor[1] + modifiers[m]), ClampToByte(baseColor[2] + modifiers[m]), texel[0], texel[1], texel[2]);
+                if (modifierError < bestModifierError)
+                {
+                    bestModifierError = modifierError;
+                    bestModifier = m;
+                }
+            }
+
+            // Fully transparent texels can take any color
+            encoding.mError += texel[3] == 0 ? 0 : bestModifierError;
+            encoding.mMSBs |= static_cast<uint32_t>(bestModifier >> 1) << texelIndex;
+            encoding.mLSBs |= static_cast<uint32_t>(bestModifier & 1) << texelIndex;
+        }
+
+        if (encoding.mError < bestEncoding.mError)
+        {
+            bestEncoding = encoding;
+        }
+    }
+    return bestEncoding;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void CompressETCColorBlock(const unsigned char* blockRGBAPixels, unsigned char* outBlock)
+{
+    auto bestError = std::numeric_limits<int>::max();
+    for (int flip = 0; flip < 2; ++flip)
+    {
+        // flip == 0: 2x4 left/right subblocks, flip == 1: 4x2 top/bottom subblocks
+        int subblockTexelIndices[2][8];
+        int subblockTexelCounts[2] = { 0, 0 };
+        for (int i = 0; i < 16; ++i)
+        {
+            const auto x = i / 4;
+            const auto y = i % 4;
+            const auto subblock = flip == 0 ? (x < 2 ? 0 : 1) : (y < 2 ? 0 : 1);
+            subblockTexelIndices[subblock][subblockTexelCounts[subblock]++] = i;
+        }
+
+        int averageColors[2][3];
+        for (int s = 0; s < 2; ++s)
+        {
+            int colorSum[3] = { 0, 0, 0 };
+            auto contributingTexelCount = 0;
+            for (int t = 0; t < 8; ++t)
+            {
+                const auto* texel = &blockRGBAPixels[GetETCTexelOffset(subblockTexelIndices[s][t])];
+                if (texel[3] == 0) continue;
+                for (int c = 0; c < 3; ++c) colorSum[c] += texel[c];
+                contributingTexelCount++;
+            }
+            for (int c = 0; c < 3; ++c) averageColors[s][c] = contributingTexelCount == 0 ? 0 : (colorSum[c] + contributingTexelCount / 2) / contributingTexelCount;
+        }
+
+        for (int differential = 0; differential < 2; ++differential)
+        {
+            int quantizedColors[2][3];
+            int baseColors[2][3];
+            auto isEncodable = true;
+            for (int s = 0; s < 2; ++s)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    quantizedColors[s][c] = QuantizeToBits(averageColors[s][c], differential ? 5 : 4);
+                    baseColors[s][c] = ExpandFromBits(quantizedColors[s][c], differential ? 5 : 4);
+                }
+            }
+
+            // Out of range deltas would be decoded as one of the ETC2-only T/H/planar modes instead
+            if (differential)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    const auto delta = quantizedColors[1][c] - quantizedColors[0][c];
+                    isEncodable &= delta >= -4 && delta <= 3;
+                }
+            }
+            if (!isEncodable)
+            {
+                continue;
+            }
+
+            const auto firstSubblockEncoding = EncodeETCSubblock(blockRGBAPixels, subblockTexelIndices[0], baseColors[0]);
+            const auto secondSubblockEncoding = EncodeETCSubblock(blockRGBAPixels, subblockTexelIndices[1], baseColors[1]);
+            const auto error = firstSubblockEncoding.mError + secondSubblockEncoding.mError;
+            if (error >= bestError)
+            {
+                continue;
+            }
+            bestError = error;
+
+            for (int c = 0; c < 3; ++c)
+            {
+                outBlock[c] = differential ?
+                    static_cast<unsigned char>((quantizedColors[0][c] << 3) | ((quantizedColors[1][c] - quantizedColors[0][c]) & 0x7)) :
+                    static_cast<unsigned char>((quantizedColors[0][c] << 4) | quantizedColors[1][c]);
+            }
+            outBlock[3] = static_cast<unsigned char>((firstSubblockEncoding.mTable << 5) | (secondSubblockEncoding.mTable << 2) | (differential << 1) | flip);
+
+            const auto msbs = firstSubblockEncoding.mMSBs | secondSubblockEncoding.mMSBs;
+            const auto lsbs = firstSubblockEncoding.mLSBs | secondSubblockEncoding.mLSBs;
+            outBlock[4] = static_cast<unsigned char>(msbs >> 8);
+            outBlock[5] = static_cast<unsigned char>(msbs & 0xFF);
+            outBlock[6] = static_cast<unsigned char>(lsbs >> 8);
+            outBlock[7] = static_cast<unsigned char>(lsbs & 0xFF);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::vector<CookedTextureMipLevel> GenerateMipChain(const unsigned char* rgbaPixels, const int width, const int height)
+{
+    std::vector<CookedTextureMipLevel> mipLevels;
+
+    CookedTextureMipLevel baseLevel;
+    baseLevel.mWidth = width;
+    baseLevel.mHeight = height;
+    baseLevel.mData.assign(rgbaPixels, rgbaPixels + static_cast<size_t>(width) * height * 4);
+    mipLevels.emplace_back(std::move(baseLevel));
+
+    while (mipLevels.back().mWidth > 1 || mipLevels.back().mHeight > 1)
+    {
+        const auto& previousLevel = mipLevels.back();
+
+        CookedTextureMipLevel nextLevel;
+        nextLevel.mWidth = std::max(1, previousLevel.mWidth / 2);
+        nextLevel.mHeight = std::max(1, previousLevel.mHeight / 2);
+        nextLevel.mData.resize(static_cast<size_t>(nextLevel.mWidth) * nextLevel.mHeight * 4);
+
+        for (int y = 0; y < nextLevel.mHeight; ++y)
+        {
+            for (int x = 0; x < nextLevel.mWidth; ++x)
+            {
+                int colorSum[3] = { 0, 0, 0 };
+                int alphaWeightedColorSum[3] = { 0, 0, 0 };
+                auto alphaSum = 0;
+                for (int sampleY = 0; sampleY < 2; ++sampleY)
+                {
+                    for (int sampleX = 0; sampleX < 2; ++sampleX)
+                    {
+                        const auto sourceX = std::min(x * 2 + sampleX, previousLevel.mWidth - 1);
+                        const auto sourceY = std::min(y * 2 + sampleY, previousLevel.mHeight - 1);
+                        const auto* texel = &previousLevel.mData[(static_cast<size_t>(sourceY) * previousLevel.mWidth + sourceX) * 4];
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            colorSum[c] += texel[c];
+                            alphaWeightedColorSum[c] += texel[c] * texel[3];
+                        }
+                        alphaSum += texel[3];
+                    }
+                }
+
+                auto* texel = &nextLevel.mData[(static_cast<size_t>(y) * nextLevel.mWidth + x) * 4];
+                for (int c = 0; c < 3; ++c)
+                {
+                    texel[c] = static_cast<unsigned char>(alphaSum == 0 ? (colorSum[c] + 2) / 4 : (alphaWeightedColorSum[c] + alphaSum / 2) / alphaSum);
+                }
+                texel[3] = static_cast<unsigned char>((alphaSum + 2) / 4);
+            }
+        }
+
+        mipLevels.emplace_back(std::move(nextLevel));
+    }
+
+    return mipLevels;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CompressTextureBlock(const unsigned char* blockRGBAPixels, const CookedTextureFormat format, unsigned char* outCompressedBlock)
+{
+    switch (format)
+    {
+        case CookedTextureFormat::BC3:
+        {
+            CompressBC3AlphaBlock(blockRGBAPixels, outCompressedBlock);
+            CompressBC3ColorBlock(blockRGBAPixels, outCompressedBlock + 8);
+        } break;
+
+        case CookedTextureFormat::ETC2_RGBA8:
+        {
+            CompressEACAlphaBlock(blockRGBAPixels, outCompressedBlock);
+            CompressETCColorBlock(blockRGBAPixels, outCompressedBlock + 8);
+        } break;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+CookedTexture CookTexture(const unsigned char* rgbaPixels, const int width, const int height, const CookedTextureFormat format, const bool nnFiltering)
+{
+    CookedTexture cookedTexture;
+    cookedTexture.mFormat = format;
+    cookedTexture.mNNFiltering = nnFiltering;
+
+    for (const auto& mipLevel: GenerateMipChain(rgbaPixels, width, height))
+    {
+        const auto blockCountX = (mipLevel.mWidth + COMPRESSED_TEXTURE_BLOCK_SIZE - 1) / COMPRESSED_TEXTURE_BLOCK_SIZE;
+        const auto blockCountY = (mipLevel.mHeight + COMPRESSED_TEXTURE_BLOCK_SIZE - 1) / COMPRESSED_TEXTURE_BLOCK_SIZE;
+
+        CookedTextureMipLevel cookedMipLevel;
+        cookedMipLevel.mWidth = mipLevel.mWidth;
+        cookedMipLevel.mHeight = mipLevel.mHeight;
+        cookedMipLevel.mData.resize(static_cast<size_t>(blockCountX) * blockCountY * COMPRESSED_TEXTURE_BLOCK_BYTES);
+
+        unsigned char blockRGBAPixels[COMPRESSED_TEXTURE_BLOCK_SIZE * COMPRESSED_TEXTURE_BLOCK_SIZE * 4];
+        for (int blockY = 0; blockY < blockCountY; ++blockY)
+        {
+            for (int blockX = 0; blockX < blockCountX; ++blockX)
+            {
+                // Levels smaller than (or not a multiple of) a block replicate their edge texels
+                for (int y = 0; y < COMPRESSED_TEXTURE_BLOCK_SIZE; ++y)
+                {
+                    for (int x = 0; x < COMPRESSED_TEXTURE_BLOCK_SIZE; ++x)
+                    {
+                        const auto sourceX = std::min(blockX * COMPRESSED_TEXTURE_BLOCK_SIZE + x, mipLevel.mWidth - 1);
+                        const auto sourceY = std::min(blockY * COMPRESSED_TEXTURE_BLOCK_SIZE + y, mipLevel.mHeight - 1);
+                        std::memcpy(&blockRGBAPixels[(y * COMPRESSED_TEXTURE_BLOCK_SIZE + x) * 4], &mipLevel.mData[(static_cast<size_t>(sourceY) * mipLevel.mWidth + sourceX) * 4], 4);
+                    }
+                }
+
+                CompressTextureBlock(blockRGBAPixels, format, &cookedMipLevel.mData[(static_cast<size_t>(blockY) * blockCountX + blockX) * COMPRESSED_TEXTURE_BLOCK_BYTES]);
+            }
+        }
+
+        cookedTexture.mMipLevels.emplace_back(std::move(cookedMipLevel));
+    }
+
+    return cookedTexture;
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t GetCookedTextureMemoryBytes(const CookedTexture& cookedTexture)
+{
+    size_t memoryBytes = 0;
+    for (const auto& mipLevel: cookedTexture.mMipLevels)
+    {
+        memoryBytes += mipLevel.mData.size();
+    }
+    return memoryBytes;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string GetCookedTextureFileSuffix(const CookedTextureFormat format)
+{
+    switch (format)
+    {
+        case CookedTextureFormat::BC3: return ".bc3.tmtex";
+        case CookedTextureFormat::ETC2_RGBA8: return ".etc2.tmtex";
+    }
+    return ".tmtex";
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool WriteCookedTexture(const std::string& filePath, const CookedTexture& cookedTexture)
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.good())
+    {
+        return false;
+    }
+
+    const auto WriteU32 = [&](const uint32_t value){ file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+    file.write(COOKED_TEXTURE_MAGIC, sizeof(COOKED_TEXTURE_MAGIC));
+    WriteU32(COOKED_TEXTURE_VERSION);
+    WriteU32(static_cast<uint32_t>(cookedTexture.mFormat));
+    WriteU32(cookedTexture.mNNFiltering ? COOKED_TEXTURE_FLAG_NN_FILTERING : 0);
+    WriteU32(static_cast<uint32_t>(cookedTexture.mMipLevels.size()));
+    for (const auto& mipLevel: cookedTexture.mMipLevels)
+    {
+        WriteU32(static_cast<uint32_t>(mipLevel.mWidth));
+        WriteU32(static_cast<uint32_t>(mipLevel.mHeight));
+        WriteU32(static_cast<uint32_t>(mipLevel.mData.size()));
+        file.write(reinterpret_cast<const char*>(mipLevel.mData.data()), static_cast<std::streamsize>(mipLevel.mData.size()));
+    }
+
+    return file.good();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ParseCookedTexture(const char* data, const size_t size, CookedTexture& outCookedTexture)
+{
+    size_t cursor = 0;
+    const auto ReadU32 = [&](uint32_t& value)
+    {
+        if (size - cursor < sizeof(value)) return false;
+        std::memcpy(&value, data + cursor, sizeof(value));
+        cursor += sizeof(value);
+        return true;
+    };
+
+    if (!data || size < sizeof(COOKED_TEXTURE_MAGIC) || std::memcmp(data, COOKED_TEXTURE_MAGIC, sizeof(COOKED_TEXTURE_MAGIC)) != 0)
+    {
+        return false;
+    }
+    cursor += sizeof(COOKED_TEXTURE_MAGIC);
+
+    uint32_t version = 0, format = 0, flags = COOKED_TEXTURE_FLAG_NN_FILTERING, mipLevelCount = 0;
+    if (!ReadU32(version) || !ReadU32(format) || (version > 1 && !ReadU32(flags)) || !ReadU32(mipLevelCount))
+    {
+        return false;
+    }
+
+    if (version == 0 || version > COOKED_TEXTURE_VERSION || (format != static_cast<uint32_t>(CookedTextureFormat::BC3) && format != static_cast<uint32_t>(CookedTextureFormat::ETC2_RGBA8)) || mipLevelCount == 0)
+    {
+        return false;
+    }
+
+    CookedTexture cookedTexture;
+    cookedTexture.mFormat = static_cast<CookedTextureFormat>(format);
+    cookedTexture.mNNFiltering = (flags & COOKED_TEXTURE_FLAG_NN_FILTERING) != 0;
+    for (uint32_t i = 0; i < mipLevelCount; ++i)
+    {
+        uint32_t width = 0, height = 0, dataSize = 0;
+        if (!ReadU32(width) || !ReadU32(height) || !ReadU32(dataSize))
+        {
+            return false;
+        }
+
+        const auto expectedDataSize = static_cast<uint64_t>((width + COMPRESSED_TEXTURE_BLOCK_SIZE - 1) / COMPRESSED_TEXTURE_BLOCK_SIZE) * ((height + COMPRESSED_TEXTURE_BLOCK_SIZE - 1) / COMPRESSED_TEXTURE_BLOCK_SIZE) * COMPRESSED_TEXTURE_BLOCK_BYTES;
+        if (width == 0 || height == 0 || dataSize != expectedDataSize || size - cursor < dataSize)
+        {
+            return false;
+        }
+
+        CookedTextureMipLevel mipLevel;
+        mipLevel.mWidth = static_cast<int>(width);
+        mipLevel.mHeight = static_cast<int>(height);
+        mipLevel.mData.assign(data + cursor, data + cursor + dataSize);
+        cursor += dataSize;
+
+        cookedTexture.mMipLevels.emplace_back(std::move(mipLevel));
+    }
+
+    outCookedTexture = std::move(cookedTexture);
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CookAndExportTexture(const std::string& exportedImageFilePath, const unsigned char* rgbaPixels, const int imageSize, const bool nnFiltering)
+{
+    const auto cookedTextureFilePathPrefix = exportedImageFilePath.substr(0, exportedImageFilePath.find_last_of('.'));
+
+    // What CreateGLTextureFromSurface would otherwise upload: uncompressed RGBA8, no mips
+    const auto uncompressedMemoryBytes = static_cast<size_t>(imageSize) * imageSize * 4;
+
+    for (const auto format: ALL_COOKED_TEXTURE_FORMATS)
+    {
+        const auto cookStartTime = std::chrono::steady_clock::now();
+        const auto cookedTexture = CookTexture(rgbaPixels, imageSize, imageSize, format, nnFiltering);
+        const auto cookMillis = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - cookStartTime).count();
+
+        const auto cookedTextureFilePath = cookedTextureFilePathPrefix + GetCookedTextureFileSuffix(format);
+        if (!WriteCookedTexture(cookedTextureFilePath, cookedTexture))
+        {
+            logging::Log(logging::LogType::ERROR, "Could not write cooked texture %s", cookedTextureFilePath.c_str());
+            continue;
+        }
+
+        logging::Log(logging::LogType::INFO, "Cooked %s in %dms (%d mip levels). Texture memory: %.2fKB (RGBA8, no mips) -> %.2fKB", cookedTextureFilePath.c_str(), static_cast<int>(cookMillis), static_cast<int>(cookedTexture.mMipLevels.size()), uncompressedMemoryBytes/1024.0f, GetCookedTextureMemoryBytes(cookedTexture)/1024.0f);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
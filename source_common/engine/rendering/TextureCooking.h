@@ -0,0 +1,120 @@
+///------------------------------------------------------------------------------------------------
+///  TextureCooking.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef TextureCooking_h
+#define TextureCooking_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+/// GPU block compressed formats textures can be cooked to. Both encode 4x4 RGBA texel blocks
+/// in 16 bytes (i.e. 1/4 of the RGBA8 footprint).
+///  - BC3 (a.k.a DXT5) is what desktop drivers sample natively (GL_EXT_texture_compression_s3tc).
+///  - ETC2 RGBA8 (ETC2 color + EAC alpha) is mandatory on every OpenGL ES 3.0 device.
+enum class CookedTextureFormat : uint32_t
+{
+    BC3 = 1,
+    ETC2_RGBA8 = 2
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct CookedTextureMipLevel
+{
+    int mWidth = 0;
+    int mHeight = 0;
+    std::vector<unsigned char> mData;
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct CookedTexture
+{
+    CookedTextureFormat mFormat = CookedTextureFormat::BC3;
+    bool mNNFiltering = true; // Whether the texture is meant to be sampled with nearest neighbour (vs linear) filtering
+    std::vector<CookedTextureMipLevel> mMipLevels;
+};
+
+///------------------------------------------------------------------------------------------------
+
+inline constexpr char COOKED_TEXTURE_MAGIC[4] = { 'T', 'M', 'T', 'X' };
+inline constexpr uint32_t COOKED_TEXTURE_VERSION = 2;
+inline constexpr uint32_t COOKED_TEXTURE_FLAG_NN_FILTERING = 1 << 0;
+inline constexpr int COMPRESSED_TEXTURE_BLOCK_SIZE = 4;
+inline constexpr int COMPRESSED_TEXTURE_BLOCK_BYTES = 16;
+
+///------------------------------------------------------------------------------------------------
+/// Generates the full mip chain (down to 1x1) of an RGBA8 image, with a 2x2 box filter.
+/// Level 0 is a copy of the given pixels. Color channels are weighted by alpha so that
+/// fully transparent texels don't bleed their (meaningless) color into lower levels.
+/// @param[in] rgbaPixels the tightly packed RGBA8 pixels of the source image.
+/// @param[in] width the width of the source image.
+/// @param[in] height the height of the source image.
+/// @returns the RGBA8 pixels of every mip level.
+std::vector<CookedTextureMipLevel> GenerateMipChain(const unsigned char* rgbaPixels, const int width, const int height);
+
+///------------------------------------------------------------------------------------------------
+/// Compresses a single 4x4 block of RGBA8 texels (row major, 64 bytes) into 16 bytes of the given format.
+void CompressTextureBlock(const unsigned char* blockRGBAPixels, const CookedTextureFormat format, unsigned char* outCompressedBlock);
+
+///------------------------------------------------------------------------------------------------
+/// Generates the mip chain of an RGBA8 image and block compresses every level of it.
+/// @param[in] rgbaPixels the tightly packed RGBA8 pixels of the source image.
+/// @param[in] width the width of the source image.
+/// @param[in] height the height of the source image.
+/// @param[in] format the format to compress to.
+/// @param[in] nnFiltering whether the texture should be sampled with nearest neighbour (vs linear) filtering.
+/// @returns the cooked texture.
+CookedTexture CookTexture(const unsigned char* rgbaPixels, const int width, const int height, const CookedTextureFormat format, const bool nnFiltering);
+
+///------------------------------------------------------------------------------------------------
+/// @returns the sum of the data sizes of all mip levels of the cooked texture.
+size_t GetCookedTextureMemoryBytes(const CookedTexture& cookedTexture);
+
+///------------------------------------------------------------------------------------------------
+/// @returns the file suffix cooked textures of the given format are stored with (e.g. ".bc3.tmtex"),
+/// which replaces the extension of the source image.
+std::string GetCookedTextureFileSuffix(const CookedTextureFormat format);
+
+///------------------------------------------------------------------------------------------------
+/// Serializes a cooked texture. The file layout is:
+///   Header:           char[4] magic "TMTX", u32 version, u32 format, u32 flags (\see COOKED_TEXTURE_FLAG_NN_FILTERING), u32 mip level count
+///   Per mip level:    u32 width, u32 height, u32 data size, data
+/// @returns whether or not the file was written successfully.
+bool WriteCookedTexture(const std::string& filePath, const CookedTexture& cookedTexture);
+
+///------------------------------------------------------------------------------------------------
+/// Deserializes a cooked texture from the contents of a file written by WriteCookedTexture.
+/// Version 1 files (which predate the flags) are read as nearest neighbour filtered.
+/// @returns whether or not the contents were a valid cooked texture.
+bool ParseCookedTexture(const char* data, const size_t size, CookedTexture& outCookedTexture);
+
+///------------------------------------------------------------------------------------------------
+/// Cooks an exported RGBA8 image to every CookedTextureFormat and writes the results next to it
+/// (used by the editor's export flow). Logs the texture memory of the image before and after cooking.
+/// @param[in] exportedImageFilePath the path of the exported (png) image the cooked textures will be written next to.
+/// @param[in] rgbaPixels the tightly packed RGBA8 pixels of the exported image.
+/// @param[in] imageSize the width/height of the exported image.
+/// @param[in] nnFiltering whether the texture should be sampled with nearest neighbour (vs linear) filtering.
+void CookAndExportTexture(const std::string& exportedImageFilePath, const unsigned char* rgbaPixels, const int imageSize, const bool nnFiltering);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* TextureCooking_h */
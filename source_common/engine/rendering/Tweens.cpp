@@ -0,0 +1,232 @@
+///------------------------------------------------------------------------------------------------
+///  Tweens.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <cassert>
+#include <engine/rendering/CommonUniforms.h>
+#include <engine/rendering/Tweens.h>
+#include <engine/scene/SceneObject.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+TweenTime::TweenTime(const uint8_t animationFlags, const float secsDuration, const float secsDelay, const math::TweeningFunction tweeningFunc /* = math::LinearFunction */, const math::TweeningMode tweeningMode /* = math::TweeningMode::EASE_IN */)
+    : mTweeningFunc(tweeningFunc)
+    , mSecsDuration(secsDuration)
+    , mSecsDelay(secsDelay)
+    , mSecsAccumulator(0.0f)
+    , mAnimationT(0.0f)
+    , mTweeningMode(tweeningMode)
+    , mAnimationFlags(animationFlags)
+{
+}
+
+AnimationUpdateResult TweenTime::Advance(const float dtMillis)
+{
+    if (mSecsDelay > 0.0f)
+    {
+        mSecsDelay -= dtMillis/1000.0f;
+    }
+    else if (mSecsDuration > 0.0f)
+    {
+        mSecsAccumulator += dtMillis/1000.0f;
+        if (mSecsAccumulator > mSecsDuration)
+        {
+            mSecsAccumulator = mSecsDuration;
+            mAnimationT = 1.0f;
+        }
+        else
+        {
+            mAnimationT = mSecsAccumulator/mSecsDuration;
+        }
+    }
+
+    if (mSecsDuration <= 0.0f && !IsFlagSet(animation_flags::ANIMATE_CONTINUOUSLY))
+    {
+        return AnimationUpdateResult::FINISHED;
+    }
+
+    return mAnimationT < 1.0f ? AnimationUpdateResult::ONGOING : AnimationUpdateResult::FINISHED;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void ApplyIgnoredComponents(const TweenTime& time, const glm::vec3& previousValue, glm::vec3& value)
+{
+    value.x = time.IsFlagSet(animation_flags::IGNORE_X_COMPONENT) ? previousValue.x : value.x;
+    value.y = time.IsFlagSet(animation_flags::IGNORE_Y_COMPONENT) ? previousValue.y : value.y;
+    value.z = time.IsFlagSet(animation_flags::IGNORE_Z_COMPONENT) ? previousValue.z : value.z;
+}
+
+///------------------------------------------------------------------------------------------------
+
+PositionScaleTween::PositionScaleTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const glm::vec3& targetPosition, const glm::vec3& targetScale, const float secsDuration, const uint8_t animationFlags /* = animation_flags::NONE */, const float secsDelay /* = 0.0f */, const math::TweeningFunction tweeningFunc /* = math::LinearFunction */, const math::TweeningMode tweeningMode /* = math::TweeningMode::EASE_IN */)
+    : mSceneObjectTarget(sceneObjectTarget)
+    , mTime(animationFlags, secsDuration, secsDelay, tweeningFunc, tweeningMode)
+    , mInitPosition(sceneObjectTarget->mPosition)
+    , mTargetPosition(targetPosition)
+    , mInitScale(sceneObjectTarget->mScale)
+    , mTargetScale(targetScale)
+{
+    assert(!mTime.IsFlagSet(animation_flags::ANIMATE_CONTINUOUSLY));
+}
+
+AnimationUpdateResult PositionScaleTween::Update(const float dtMillis)
+{
+    const auto animationUpdateResult = mTime.Advance(dtMillis);
+    const auto t = mTime.GetTweenedT();
+
+    const auto previousPosition = mSceneObjectTarget->mPosition;
+    mSceneObjectTarget->mPosition = math::Lerp(mInitPosition, mTargetPosition, t);
+    ApplyIgnoredComponents(mTime, previousPosition, mSceneObjectTarget->mPosition);
+
+    if (!mTime.IsFlagSet(animation_flags::IGNORE_SCALE))
+    {
+        mSceneObjectTarget->mScale = math::Lerp(mInitScale, mTargetScale, t);
+    }
+
+    return animationUpdateResult;
+}
+
+///------------------------------------------------------------------------------------------------
+
+RotationTween::RotationTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const glm::vec3& targetRotation, const float secsDuration, const uint8_t animationFlags /* = animation_flags::NONE */, const float secsDelay /* = 0.0f */, const math::TweeningFunction tweeningFunc /* = math::LinearFunction */, const math::TweeningMode tweeningMode /* = math::TweeningMode::EASE_IN */)
+    : mSceneObjectTarget(sceneObjectTarget)
+    , mTime(animationFlags, secsDuration, secsDelay, tweeningFunc, tweeningMode)
+    , mInitRotation(sceneObjectTarget->mRotation)
+    , mTargetRotation(targetRotation)
+{
+    assert(!mTime.IsFlagSet(animation_flags::ANIMATE_CONTINUOUSLY));
+}
+
+AnimationUpdateResult RotationTween::Update(const float dtMillis)
+{
+    const auto animationUpdateResult = mTime.Advance(dtMillis);
+
+    const auto previousRotation = mSceneObjectTarget->mRotation;
+    mSceneObjectTarget->mRotation = math::Lerp(mInitRotation, mTargetRotation, mTime.GetTweenedT());
+    ApplyIgnoredComponents(mTime, previousRotation, mSceneObjectTarget->mRotation);
+
+    return animationUpdateResult;
+}
+
+///------------------------------------------------------------------------------------------------
+
+AlphaTween::AlphaTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const float targetAlpha, const float secsDuration, const uint8_t animationFlags /* = animation_flags::NONE */, const float secsDelay /* = 0.0f */, const math::TweeningFunction tweeningFunc /* = math::LinearFunction */, const math::TweeningMode tweeningMode /* = math::TweeningMode::EASE_IN */)
+    : mSceneObjectTarget(sceneObjectTarget)
+    , mTime(animationFlags, secsDuration, secsDelay, tweeningFunc, tweeningMode)
+    , mInitAlpha(sceneObjectTarget->mShaderFloatUniformValues.at(CUSTOM_ALPHA_UNIFORM_NAME))
+    , mTargetAlpha(targetAlpha)
+{
+    assert(!mTime.IsFlagSet(animation_flags::ANIMATE_CONTINUOUSLY));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_X_COMPONENT));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_Y_COMPONENT));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_Z_COMPONENT));
+}
+
+AnimationUpdateResult AlphaTween::Update(const float dtMillis)
+{
+    const auto animationUpdateResult = mTime.Advance(dtMillis);
+    mSceneObjectTarget->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = math::Lerp(mInitAlpha, mTargetAlpha, mTime.GetTweenedT());
+    return animationUpdateResult;
+}
+
+///------------------------------------------------------------------------------------------------
+
+ValueTween::ValueTween(float& value, const float targetValue, const float secsDuration, const uint8_t animationFlags /* = animation_flags::NONE */, const float secsDelay /* = 0.0f */, const math::TweeningFunction tweeningFunc /* = math::LinearFunction */, const math::TweeningMode tweeningMode /* = math::TweeningMode::EASE_IN */)
+    : mValue(&value)
+    , mTime(animationFlags, secsDuration, secsDelay, tweeningFunc, tweeningMode)
+    , mInitValue(value)
+    , mTargetValue(targetValue)
+{
+    assert(!mTime.IsFlagSet(animation_flags::ANIMATE_CONTINUOUSLY));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_X_COMPONENT));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_Y_COMPONENT));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_Z_COMPONENT));
+}
+
+AnimationUpdateResult ValueTween::Update(const float dtMillis)
+{
+    const auto animationUpdateResult = mTime.Advance(dtMillis);
+    *mValue = math::Lerp(mInitValue, mTargetValue, mTime.GetTweenedT());
+    return animationUpdateResult;
+}
+
+///------------------------------------------------------------------------------------------------
+
+PulseTween::PulseTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const float scaleFactor, const float secsPulseDuration, const uint8_t animationFlags /* = animation_flags::NONE */, const float secsDelay /* = 0.0f */, const math::TweeningFunction tweeningFunc /* = math::LinearFunction */, const math::TweeningMode tweeningMode /* = math::TweeningMode::EASE_IN */)
+    : mSceneObjectTarget(sceneObjectTarget)
+    , mTime(animationFlags, (animationFlags & animation_flags::ANIMATE_CONTINUOUSLY) != 0 ? -1.0f : secsPulseDuration * 2.0f, secsDelay, tweeningFunc, tweeningMode)
+    , mInitScale(sceneObjectTarget->mScale)
+    , mTargetScale(sceneObjectTarget->mScale * scaleFactor)
+    , mSecsPulseDuration(secsPulseDuration)
+    , mSecsPulseAccum(0.0f)
+    , mScalingUp(true)
+{
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_X_COMPONENT));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_Y_COMPONENT));
+    assert(!mTime.IsFlagSet(animation_flags::IGNORE_Z_COMPONENT));
+}
+
+AnimationUpdateResult PulseTween::Update(const float dtMillis)
+{
+    mSecsPulseAccum += dtMillis/1000.0f;
+    if (mSecsPulseAccum >= mSecsPulseDuration)
+    {
+        mSecsPulseAccum -= mSecsPulseDuration;
+        mScalingUp = !mScalingUp;
+    }
+
+    const auto animationUpdateResult = mTime.Advance(dtMillis);
+    if (animationUpdateResult == AnimationUpdateResult::FINISHED)
+    {
+        mSceneObjectTarget->mScale = mInitScale;
+    }
+    else
+    {
+        const auto t = math::TweenValue(mSecsPulseAccum/mSecsPulseDuration, mTime.mTweeningFunc, mTime.mTweeningMode);
+        mSceneObjectTarget->mScale = mScalingUp ? math::Lerp(mInitScale, mTargetScale, t) : math::Lerp(mTargetScale, mInitScale, t);
+    }
+
+    return animationUpdateResult;
+}
+
+///------------------------------------------------------------------------------------------------
+
+BezierTween::BezierTween(glm::vec3& position, const math::BezierCurve& curve, const float secsDuration, const uint8_t animationFlags /* = animation_flags::NONE */, const float secsDelay /* = 0.0f */)
+    : mPosition(&position)
+    , mTime(animationFlags, secsDuration, secsDelay)
+    , mCurve(curve)
+{
+    assert(!mTime.IsFlagSet(animation_flags::ANIMATE_CONTINUOUSLY));
+}
+
+BezierTween::BezierTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const math::BezierCurve& curve, const float secsDuration, const uint8_t animationFlags /* = animation_flags::NONE */, const float secsDelay /* = 0.0f */)
+    : BezierTween(sceneObjectTarget->mPosition, curve, secsDuration, animationFlags, secsDelay)
+{
+    mSceneObjectTarget = sceneObjectTarget;
+}
+
+AnimationUpdateResult BezierTween::Update(const float dtMillis)
+{
+    const auto animationUpdateResult = mTime.Advance(dtMillis);
+
+    const auto previousPosition = *mPosition;
+    *mPosition = mCurve.ComputePointForT(mTime.mAnimationT);
+    ApplyIgnoredComponents(mTime, previousPosition, *mPosition);
+
+    return animationUpdateResult;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,143 @@
+///------------------------------------------------------------------------------------------------
+///  Tweens.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef Tweens_h
+#define Tweens_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <engine/rendering/Animations.h>
+#include <engine/utils/MathUtils.h>
+#include <memory>
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+/// Plain (non virtual, non allocating) counterparts of the most common animations, which the
+/// AnimationManager keeps densely packed in one pool per kind \see AnimationManager::StartAnimation.
+/// Like the corresponding animations, tweens capture their target's initial state on construction.
+///------------------------------------------------------------------------------------------------
+
+/// Delay & duration bookkeeping shared by all tweens (same semantics as BaseAnimation::VUpdate).
+struct TweenTime
+{
+    TweenTime(const uint8_t animationFlags, const float secsDuration, const float secsDelay, const math::TweeningFunction tweeningFunc = math::LinearFunction, const math::TweeningMode tweeningMode = math::TweeningMode::EASE_IN);
+
+    AnimationUpdateResult Advance(const float dtMillis);
+    float GetTweenedT() const { return math::TweenValue(mAnimationT, mTweeningFunc, mTweeningMode); }
+    bool IsFlagSet(const uint8_t flag) const { return (mAnimationFlags & flag) != 0; }
+
+    math::TweeningFunction mTweeningFunc;
+    float mSecsDuration;
+    float mSecsDelay;
+    float mSecsAccumulator;
+    float mAnimationT;
+    math::TweeningMode mTweeningMode;
+    uint8_t mAnimationFlags;
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct PositionScaleTween
+{
+    PositionScaleTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const glm::vec3& targetPosition, const glm::vec3& targetScale, const float secsDuration, const uint8_t animationFlags = animation_flags::NONE, const float secsDelay = 0.0f, const math::TweeningFunction tweeningFunc = math::LinearFunction, const math::TweeningMode tweeningMode = math::TweeningMode::EASE_IN);
+    AnimationUpdateResult Update(const float dtMillis);
+    scene::SceneObject* GetSceneObject() const { return mSceneObjectTarget.get(); }
+
+    std::shared_ptr<scene::SceneObject> mSceneObjectTarget;
+    TweenTime mTime;
+    glm::vec3 mInitPosition;
+    glm::vec3 mTargetPosition;
+    glm::vec3 mInitScale;
+    glm::vec3 mTargetScale;
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct RotationTween
+{
+    RotationTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const glm::vec3& targetRotation, const float secsDuration, const uint8_t animationFlags = animation_flags::NONE, const float secsDelay = 0.0f, const math::TweeningFunction tweeningFunc = math::LinearFunction, const math::TweeningMode tweeningMode = math::TweeningMode::EASE_IN);
+    AnimationUpdateResult Update(const float dtMillis);
+    scene::SceneObject* GetSceneObject() const { return mSceneObjectTarget.get(); }
+
+    std::shared_ptr<scene::SceneObject> mSceneObjectTarget;
+    TweenTime mTime;
+    glm::vec3 mInitRotation;
+    glm::vec3 mTargetRotation;
+};
+
+///------------------------------------------------------------------------------------------------
+// Expects the custom_alpha float uniform to have been set prior to the creation of this tween type
+struct AlphaTween
+{
+    AlphaTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const float targetAlpha, const float secsDuration, const uint8_t animationFlags = animation_flags::NONE, const float secsDelay = 0.0f, const math::TweeningFunction tweeningFunc = math::LinearFunction, const math::TweeningMode tweeningMode = math::TweeningMode::EASE_IN);
+    AnimationUpdateResult Update(const float dtMillis);
+    scene::SceneObject* GetSceneObject() const { return mSceneObjectTarget.get(); }
+
+    std::shared_ptr<scene::SceneObject> mSceneObjectTarget;
+    TweenTime mTime;
+    float mInitAlpha;
+    float mTargetAlpha;
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct ValueTween
+{
+    ValueTween(float& value, const float targetValue, const float secsDuration, const uint8_t animationFlags = animation_flags::NONE, const float secsDelay = 0.0f, const math::TweeningFunction tweeningFunc = math::LinearFunction, const math::TweeningMode tweeningMode = math::TweeningMode::EASE_IN);
+    AnimationUpdateResult Update(const float dtMillis);
+    scene::SceneObject* GetSceneObject() const { return nullptr; }
+
+    float* mValue;
+    TweenTime mTime;
+    float mInitValue;
+    float mTargetValue;
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct PulseTween
+{
+    PulseTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const float scaleFactor, const float secsPulseDuration, const uint8_t animationFlags = animation_flags::NONE, const float secsDelay = 0.0f, const math::TweeningFunction tweeningFunc = math::LinearFunction, const math::TweeningMode tweeningMode = math::TweeningMode::EASE_IN);
+    AnimationUpdateResult Update(const float dtMillis);
+    scene::SceneObject* GetSceneObject() const { return mSceneObjectTarget.get(); }
+
+    std::shared_ptr<scene::SceneObject> mSceneObjectTarget;
+    TweenTime mTime;
+    glm::vec3 mInitScale;
+    glm::vec3 mTargetScale;
+    float mSecsPulseDuration;
+    float mSecsPulseAccum;
+    bool mScalingUp;
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct BezierTween
+{
+    BezierTween(glm::vec3& position, const math::BezierCurve& curve, const float secsDuration, const uint8_t animationFlags = animation_flags::NONE, const float secsDelay = 0.0f);
+    BezierTween(std::shared_ptr<scene::SceneObject> sceneObjectTarget, const math::BezierCurve& curve, const float secsDuration, const uint8_t animationFlags = animation_flags::NONE, const float secsDelay = 0.0f);
+    AnimationUpdateResult Update(const float dtMillis);
+    scene::SceneObject* GetSceneObject() const { return mSceneObjectTarget.get(); }
+
+    std::shared_ptr<scene::SceneObject> mSceneObjectTarget; // (optional)
+    glm::vec3* mPosition;
+    TweenTime mTime;
+    math::BezierCurve mCurve;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* Tweens_h */
@@ -0,0 +1,221 @@
+///------------------------------------------------------------------------------------------------
+///  AssetArchive.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <cstring>
+#include <engine/resloading/AssetArchive.h>
+#include <engine/utils/Logging.h>
+#include <fstream>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+template<typename T>
+static inline T ReadLittleEndian(const char* data)
+{
+    T result = 0;
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        result |= static_cast<T>(static_cast<unsigned char>(data[i])) << (i * 8);
+    }
+    return result;
+}
+
+template<typename T>
+static inline void WriteLittleEndian(std::ofstream& stream, const T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        stream.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+AssetArchive::~AssetArchive()
+{
+    Close();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AssetArchive::Open(const std::string& archivePath)
+{
+    Close();
+
+    if (!mMappedFile.Open(archivePath))
+    {
+        return false;
+    }
+
+    if (!ParseIndex())
+    {
+        logging::Log(logging::LogType::ERROR, "Invalid asset archive: %s", archivePath.c_str());
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AssetArchive::Close()
+{
+    mEntries.clear();
+    mMappedFile.Close();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AssetArchive::IsOpen() const
+{
+    return mMappedFile.IsOpen();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AssetArchive::HasEntry(const std::string& relativePath) const
+{
+    return mEntries.count(relativePath) != 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const char* AssetArchive::GetEntryData(const std::string& relativePath, size_t& outSize) const
+{
+    auto entryIter = mEntries.find(relativePath);
+    if (entryIter == mEntries.cend())
+    {
+        outSize = 0;
+        return nullptr;
+    }
+
+    outSize = static_cast<size_t>(entryIter->second.mSize);
+    return mMappedFile.GetData() + entryIter->second.mOffset;
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t AssetArchive::GetEntryCount() const
+{
+    return mEntries.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::unordered_map<std::string, AssetArchive::ArchiveEntry>& AssetArchive::GetEntries() const
+{
+    return mEntries;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AssetArchive::WriteArchive(const std::string& archivePath, const std::vector<std::pair<std::string, std::string>>& relativePathsAndContents)
+{
+    std::ofstream archive(archivePath, std::ios::binary | std::ios::trunc);
+    if (!archive.good())
+    {
+        return false;
+    }
+    
+    // Header is patched once the index location is known
+    archive.write(std::string(ARCHIVE_HEADER_SIZE, '\0').data(), ARCHIVE_HEADER_SIZE);
+    
+    std::vector<ArchiveEntry> entries;
+    entries.reserve(relativePathsAndContents.size());
+    for (const auto& [relativePath, contents]: relativePathsAndContents)
+    {
+        const auto padding = (ARCHIVE_DATA_ALIGNMENT - static_cast<size_t>(archive.tellp()) % ARCHIVE_DATA_ALIGNMENT) % ARCHIVE_DATA_ALIGNMENT;
+        archive.write(std::string(padding, '\0').data(), padding);
+        
+        entries.push_back({ static_cast<uint64_t>(archive.tellp()), contents.size() });
+        archive.write(contents.data(), contents.size());
+    }
+    
+    const auto indexOffset = static_cast<uint64_t>(archive.tellp());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const auto& relativePath = relativePathsAndContents[i].first;
+        WriteLittleEndian<uint64_t>(archive, entries[i].mOffset);
+        WriteLittleEndian<uint64_t>(archive, entries[i].mSize);
+        WriteLittleEndian<uint32_t>(archive, static_cast<uint32_t>(relativePath.size()));
+        archive.write(relativePath.data(), relativePath.size());
+    }
+    const auto indexSize = static_cast<uint64_t>(archive.tellp()) - indexOffset;
+    
+    archive.seekp(0);
+    archive.write(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+    WriteLittleEndian<uint32_t>(archive, ARCHIVE_VERSION);
+    WriteLittleEndian<uint32_t>(archive, static_cast<uint32_t>(entries.size()));
+    WriteLittleEndian<uint32_t>(archive, 0);
+    WriteLittleEndian<uint64_t>(archive, indexOffset);
+    WriteLittleEndian<uint64_t>(archive, indexSize);
+    
+    return archive.good();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AssetArchive::ParseIndex()
+{
+    const auto* mappedData = mMappedFile.GetData();
+    const auto mappedSize = mMappedFile.GetSize();
+
+    if (mappedSize < ARCHIVE_HEADER_SIZE || std::memcmp(mappedData, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) != 0)
+    {
+        return false;
+    }
+
+    const auto version = ReadLittleEndian<uint32_t>(mappedData + 4);
+    const auto entryCount = ReadLittleEndian<uint32_t>(mappedData + 8);
+    const auto indexOffset = ReadLittleEndian<uint64_t>(mappedData + 16);
+    const auto indexSize = ReadLittleEndian<uint64_t>(mappedData + 24);
+
+    if (version != ARCHIVE_VERSION || indexOffset > mappedSize || indexSize > mappedSize - indexOffset)
+    {
+        return false;
+    }
+
+    mEntries.reserve(entryCount);
+
+    const char* indexCursor = mappedData + indexOffset;
+    const char* indexEnd = indexCursor + indexSize;
+    for (uint32_t i = 0; i < entryCount; ++i)
+    {
+        // offset + size + path length
+        if (indexEnd - indexCursor < 20)
+        {
+            return false;
+        }
+
+        ArchiveEntry entry;
+        entry.mOffset = ReadLittleEndian<uint64_t>(indexCursor);
+        entry.mSize = ReadLittleEndian<uint64_t>(indexCursor + 8);
+        const auto pathLength = ReadLittleEndian<uint32_t>(indexCursor + 16);
+        indexCursor += 20;
+
+        if (static_cast<uint64_t>(indexEnd - indexCursor) < pathLength || entry.mOffset > indexOffset || entry.mSize > indexOffset - entry.mOffset)
+        {
+            return false;
+        }
+
+        mEntries.emplace(std::string(indexCursor, pathLength), entry);
+        indexCursor += pathLength;
+    }
+
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,104 @@
+///------------------------------------------------------------------------------------------------
+///  AssetArchive.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef AssetArchive_h
+#define AssetArchive_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/resloading/MemoryMappedFile.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+/// Read-only view of a packed asset archive (as produced by scripts/pack_assets.py).
+///
+/// The whole archive is memory-mapped on Open and entries are served as pointers into the
+/// mapping, so no per-file open/read is needed. Layout (all integers little-endian):
+///   Header: char[4] magic "TMAA", u32 version, u32 entry count, u32 reserved, u64 index offset, u64 index size
+///   Data:   entry payloads, each aligned to ARCHIVE_DATA_ALIGNMENT
+///   Index:  per entry u64 offset, u64 size, u32 path length, path bytes (relative to the assets root)
+class AssetArchive final
+{
+public:
+    static constexpr char ARCHIVE_MAGIC[4] = { 'T', 'M', 'A', 'A' };
+    static constexpr uint32_t ARCHIVE_VERSION = 1;
+    static constexpr size_t ARCHIVE_HEADER_SIZE = 32;
+    static constexpr size_t ARCHIVE_DATA_ALIGNMENT = 16;
+
+    struct ArchiveEntry
+    {
+        uint64_t mOffset = 0;
+        uint64_t mSize = 0;
+    };
+
+public:
+    AssetArchive() = default;
+    ~AssetArchive();
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive(AssetArchive&&) = delete;
+    const AssetArchive& operator = (const AssetArchive&) = delete;
+    AssetArchive& operator = (AssetArchive&&) = delete;
+
+    /// Maps the archive at the given path and parses its index.
+    /// @param[in] archivePath the path of the archive file.
+    /// @returns whether the archive was mapped and its header/index were valid.
+    bool Open(const std::string& archivePath);
+
+    /// Unmaps the archive (if any). Previously returned entry pointers become invalid.
+    void Close();
+
+    /// @returns whether an archive is currently mapped.
+    bool IsOpen() const;
+
+    /// @param[in] relativePath the path of the entry relative to the assets root.
+    /// @returns whether the archive contains an entry under the given path.
+    bool HasEntry(const std::string& relativePath) const;
+
+    /// Looks up an entry and returns a pointer to its bytes inside the mapping.
+    /// @param[in] relativePath the path of the entry relative to the assets root.
+    /// @param[out] outSize the size of the entry in bytes (0 if not found).
+    /// @returns a pointer to the entry bytes, or nullptr if the entry does not exist.
+    const char* GetEntryData(const std::string& relativePath, size_t& outSize) const;
+
+    /// @returns the number of entries in the archive index.
+    size_t GetEntryCount() const;
+
+    /// @returns the entry index of the archive, keyed by relative path.
+    const std::unordered_map<std::string, ArchiveEntry>& GetEntries() const;
+    
+    /// Writes an archive in the format above (in-engine counterpart of scripts/pack_assets.py,
+    /// used by tests and benchmarks).
+    /// @param[in] archivePath the path of the archive file to write.
+    /// @param[in] relativePathsAndContents the entries to pack, as (path relative to the assets root, file contents) pairs.
+    /// @returns whether the archive was written successfully.
+    static bool WriteArchive(const std::string& archivePath, const std::vector<std::pair<std::string, std::string>>& relativePathsAndContents);
+
+private:
+    bool ParseIndex();
+
+private:
+    std::unordered_map<std::string, ArchiveEntry> mEntries;
+    MemoryMappedFile mMappedFile;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* AssetArchive_h */
@@ -0,0 +1,43 @@
+///------------------------------------------------------------------------------------------------
+///  CookedMeshResource.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <engine/resloading/CookedMeshResource.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+const rendering::CookedMeshView& CookedMeshResource::GetCookedMeshView() const
+{
+    return mCookedMeshView;
+}
+
+///------------------------------------------------------------------------------------------------
+
+CookedMeshResource::CookedMeshResource(const rendering::CookedMeshView& cookedMeshView, std::unique_ptr<MemoryMappedFile> mappedCookedMeshFile)
+    : mMappedCookedMeshFile(std::move(mappedCookedMeshFile))
+    , mCookedMeshView(cookedMeshView)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+CookedMeshResource::CookedMeshResource(std::string&& serializedCookedMesh)
+    : mSerializedCookedMesh(std::move(serializedCookedMesh))
+{
+    // The view points into the owned (already validated) serialized mesh
+    rendering::ParseCookedMesh(mSerializedCookedMesh.data(), mSerializedCookedMesh.size(), mCookedMeshView);
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
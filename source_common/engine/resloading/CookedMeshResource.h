@@ -0,0 +1,53 @@
+///------------------------------------------------------------------------------------------------
+///  CookedMeshResource.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef CookedMeshResource_h
+#define CookedMeshResource_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/rendering/MeshCooking.h>
+#include <engine/resloading/IResource.h>
+#include <engine/resloading/MemoryMappedFile.h>
+#include <memory>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+/// The CPU side (file I/O) step of loading a mesh. Holds a view into the serialized cooked mesh,
+/// which is either memory mapped (cooked mesh files on disk), points into the mounted asset archive,
+/// or owned (meshes freshly cooked from their OBJ source). The GPU upload happens in the MeshLoader,
+/// after which this resource is unloaded.
+class CookedMeshResource final: public IResource
+{
+    friend class OBJMeshLoader;
+    friend class ResourceLoadingService;
+    
+public:
+    const rendering::CookedMeshView& GetCookedMeshView() const;
+    
+private:
+    CookedMeshResource(const rendering::CookedMeshView& cookedMeshView, std::unique_ptr<MemoryMappedFile> mappedCookedMeshFile);
+    CookedMeshResource(std::string&& serializedCookedMesh);
+    
+private:
+    std::unique_ptr<MemoryMappedFile> mMappedCookedMeshFile;
+    std::string mSerializedCookedMesh;
+    rendering::CookedMeshView mCookedMeshView;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* CookedMeshResource_h */
@@ -0,0 +1,166 @@
+///------------------------------------------------------------------------------------------------
+///  CookedTextureLoader.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/RenderingUtils.h>
+#include <engine/resloading/CookedTextureLoader.h>
+#include <engine/resloading/CookedTextureResource.h>
+#include <engine/resloading/ResourceLoadingService.h>
+#include <engine/resloading/VirtualFileSystem.h>
+#include <engine/utils/Logging.h>
+#include <engine/utils/OSMessageBox.h>
+#include <filesystem>
+#include <unordered_set>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+// In order of preference
+static constexpr rendering::CookedTextureFormat COOKED_TEXTURE_FORMATS[] =
+{
+    rendering::CookedTextureFormat::ETC2_RGBA8,
+    rendering::CookedTextureFormat::BC3
+};
+
+///------------------------------------------------------------------------------------------------
+
+CookedTextureLoader::CookedTextureLoader(const VirtualFileSystem& virtualFileSystem)
+    : mVirtualFileSystem(virtualFileSystem)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CookedTextureLoader::VInitialize()
+{
+    // Headless runs have no GL context to query (nor upload to), so images are always decoded instead
+    if (CoreSystemsEngine::IsHeadless())
+    {
+        return;
+    }
+    
+    // Queried once here (on the GL thread) so that async loads don't need a GL context
+    for (const auto format: COOKED_TEXTURE_FORMATS)
+    {
+        if (rendering::IsCookedTextureFormatSupported(format))
+        {
+            mSupportedFormats.push_back(format);
+            logging::Log(logging::LogType::INFO, "Cooked textures with suffix %s are supported", rendering::GetCookedTextureFileSuffix(format).c_str());
+        }
+    }
+    
+    ResolveCookedTexturePaths();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool CookedTextureLoader::VCanLoadAsync() const
+{
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::shared_ptr<IResource> CookedTextureLoader::VCreateAndLoadResource(const std::string& imagePath) const
+{
+    const auto cookedTexturePath = GetCookedTexturePath(imagePath);
+    const auto fileContents = mVirtualFileSystem.ReadFile(cookedTexturePath);
+    
+    rendering::CookedTexture cookedTexture;
+    if (!fileContents.IsValid() || !rendering::ParseCookedTexture(fileContents.GetData(), fileContents.GetSize(), cookedTexture))
+    {
+        ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "Cooked texture could not be loaded", cookedTexturePath.c_str());
+        return nullptr;
+    }
+    
+    return std::shared_ptr<IResource>(new CookedTextureResource(std::move(cookedTexture)));
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string CookedTextureLoader::GetCookedTexturePath(const std::string& imagePath) const
+{
+    auto findIter = mCookedTexturePaths.find(imagePath.substr(0, imagePath.find_last_of('.')));
+    return findIter != mCookedTexturePaths.end() ? findIter->second : "";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CookedTextureLoader::ResolveCookedTexturePaths()
+{
+    if (mSupportedFormats.empty())
+    {
+        return;
+    }
+    
+    // Every cooked texture shipped in the archive, or lying loose under the textures root
+    std::unordered_set<std::string> archivedCookedTexturePaths;
+    std::unordered_set<std::string> looseCookedTexturePaths;
+    if (mVirtualFileSystem.IsArchiveMounted())
+    {
+        for (const auto& [relativePath, archiveEntry]: mVirtualFileSystem.GetMountedArchive().GetEntries())
+        {
+            archivedCookedTexturePaths.insert(ResourceLoadingService::RES_ROOT + relativePath);
+        }
+    }
+    
+    std::error_code errorCode;
+    for (std::filesystem::recursive_directory_iterator iter(ResourceLoadingService::RES_TEXTURES_ROOT, errorCode), end; !errorCode && iter != end; iter.increment(errorCode))
+    {
+        if (iter->is_regular_file(errorCode))
+        {
+            looseCookedTexturePaths.insert(iter->path().generic_string());
+        }
+    }
+    
+    // Formats in order of preference, so the first up to date cooked texture found for an image wins
+    for (const auto format: mSupportedFormats)
+    {
+        const auto cookedTextureFileSuffix = rendering::GetCookedTextureFileSuffix(format);
+        for (const auto* cookedTexturePaths: { &archivedCookedTexturePaths, &looseCookedTexturePaths })
+        {
+            for (const auto& cookedTexturePath: *cookedTexturePaths)
+            {
+                if (!strutils::StringEndsWith(cookedTexturePath, cookedTextureFileSuffix))
+                {
+                    continue;
+                }
+                
+                const auto imagePathPrefix = cookedTexturePath.substr(0, cookedTexturePath.size() - cookedTextureFileSuffix.size());
+                if (mCookedTexturePaths.count(imagePathPrefix))
+                {
+                    continue;
+                }
+                
+                // A loose source image edited after it was last cooked wins over its stale cooked texture
+                const auto imagePath = imagePathPrefix + ".png";
+                if (cookedTexturePaths == &looseCookedTexturePaths && !mVirtualFileSystem.IsFileArchived(imagePath))
+                {
+                    const auto imageModificationTime = std::filesystem::last_write_time(imagePath, errorCode);
+                    if (!errorCode && imageModificationTime > std::filesystem::last_write_time(cookedTexturePath, errorCode))
+                    {
+                        continue;
+                    }
+                }
+                
+                mCookedTexturePaths[imagePathPrefix] = cookedTexturePath;
+            }
+        }
+    }
+    
+    logging::Log(logging::LogType::INFO, "Resolved %d cooked textures", static_cast<int>(mCookedTexturePaths.size()));
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,64 @@
+///------------------------------------------------------------------------------------------------
+///  CookedTextureLoader.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef CookedTextureLoader_h
+#define CookedTextureLoader_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/rendering/TextureCooking.h>
+#include <engine/resloading/IResourceLoader.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+class VirtualFileSystem;
+
+///------------------------------------------------------------------------------------------------
+/// Loads the offline cooked (mipmapped, GPU block compressed) version of an image,
+/// if one has been cooked in a format the current driver can sample.
+/// Loading is requested with the path of the source image, so that resource ids stay the same.
+class CookedTextureLoader final: public IResourceLoader
+{
+    friend class ResourceLoadingService;
+
+public:
+    void VInitialize() override;
+    bool VCanLoadAsync() const override;
+    std::shared_ptr<IResource> VCreateAndLoadResource(const std::string& imagePath) const override;
+    
+    /// Resolved against the cooked textures found at initialization, so no file system access is involved.
+    /// @param[in] imagePath the path of the source image.
+    /// @returns the path of the most preferred, up to date cooked texture of the source image, or an empty string if none exists.
+    std::string GetCookedTexturePath(const std::string& imagePath) const;
+
+private:
+    CookedTextureLoader(const VirtualFileSystem& virtualFileSystem);
+    
+    void ResolveCookedTexturePaths();
+    
+private:
+    const VirtualFileSystem& mVirtualFileSystem;
+    std::vector<rendering::CookedTextureFormat> mSupportedFormats;
+    std::unordered_map<std::string, std::string> mCookedTexturePaths; // source image path (sans extension) -> cooked texture path
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* CookedTextureLoader_h */
@@ -0,0 +1,33 @@
+///------------------------------------------------------------------------------------------------
+///  CookedTextureResource.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <engine/resloading/CookedTextureResource.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+const rendering::CookedTexture& CookedTextureResource::GetCookedTexture() const
+{
+    return mCookedTexture;
+}
+
+///------------------------------------------------------------------------------------------------
+
+CookedTextureResource::CookedTextureResource(rendering::CookedTexture&& cookedTexture)
+    : mCookedTexture(std::move(cookedTexture))
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,45 @@
+///------------------------------------------------------------------------------------------------
+///  CookedTextureResource.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef CookedTextureResource_h
+#define CookedTextureResource_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/rendering/TextureCooking.h>
+#include <engine/resloading/IResource.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+/// The CPU side (file I/O) step of loading an offline cooked texture. The GPU upload
+/// happens in the TextureLoader, after which this resource is unloaded.
+class CookedTextureResource final: public IResource
+{
+    friend class CookedTextureLoader;
+    friend class ResourceLoadingService;
+    
+public:
+    const rendering::CookedTexture& GetCookedTexture() const;
+    
+private:
+    CookedTextureResource(rendering::CookedTexture&& cookedTexture);
+    
+private:
+    const rendering::CookedTexture mCookedTexture;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* CookedTextureResource_h */
@@ -7,10 +7,9 @@
 
 #include <engine/resloading/DataFileLoader.h>
 #include <engine/resloading/DataFileResource.h>
+#include <engine/resloading/VirtualFileSystem.h>
 #include <engine/utils/OSMessageBox.h>
 #include <engine/utils/StringUtils.h>
-#include <fstream>
-#include <streambuf>
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -18,6 +17,14 @@ namespace resources
 {
 
 ///-----------------------------------------------------------------------------------------------
+
+DataFileLoader::DataFileLoader(const VirtualFileSystem& virtualFileSystem)
+    : mVirtualFileSystem(virtualFileSystem)
+{
+}
+
+///-----------------------------------------------------------------------------------------------
+
 void DataFileLoader::VInitialize()
 { 
 }
@@ -33,24 +40,15 @@ bool DataFileLoader::VCanLoadAsync() const
 
 std::shared_ptr<IResource> DataFileLoader::VCreateAndLoadResource(const std::string& resourcePath) const
 {
-    std::ifstream file(resourcePath);
+    const auto fileContents = mVirtualFileSystem.ReadFile(resourcePath);
     
-    if (!file.good())
+    if (!fileContents.IsValid())
     {
         ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "File could not be found", resourcePath.c_str());
         return nullptr;
     }
     
-    std::string str;
-    
-    file.seekg(0, std::ios::end);
-    str.reserve(static_cast<size_t>(file.tellg()));
-    file.seekg(0, std::ios::beg);
-    
-    str.assign((std::istreambuf_iterator<char>(file)),
-               std::istreambuf_iterator<char>());
-    
-    return std::shared_ptr<IResource>(new DataFileResource(str));
+    return std::shared_ptr<IResource>(new DataFileResource(fileContents.ToString()));
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -19,6 +19,10 @@ namespace resources
 
 ///-----------------------------------------------------------------------------------------------
 
+class VirtualFileSystem;
+
+///-----------------------------------------------------------------------------------------------
+
 class DataFileLoader final: public IResourceLoader
 {
     friend class ResourceLoadingService;
@@ -29,8 +33,10 @@ public:
     std::shared_ptr<IResource> VCreateAndLoadResource(const std::string& path) const override;
     
 private:
-    DataFileLoader() = default;
-
+    DataFileLoader(const VirtualFileSystem& virtualFileSystem);
+    
+private:
+    const VirtualFileSystem& mVirtualFileSystem;
 };
 
 ///-----------------------------------------------------------------------------------------------
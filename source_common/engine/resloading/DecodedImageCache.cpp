@@ -0,0 +1,259 @@
+///------------------------------------------------------------------------------------------------
+///  DecodedImageCache.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <engine/resloading/DecodedImageCache.h>
+#include <engine/utils/FileUtils.h>
+#include <engine/utils/Logging.h>
+#include <engine/utils/PlatformMacros.h>
+#include <engine/utils/StringUtils.h>
+#if defined(MACOS) || defined(MOBILE_FLOW)
+#include <platform_utilities/AppleUtils.h>
+#elif defined(WINDOWS)
+#include <platform_utilities/WindowsUtils.h>
+#elif defined(LINUX)
+#include <platform_utilities/LinuxUtils.h>
+#endif
+#include <filesystem>
+#include <fstream>
+#include <SDL_surface.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string CACHE_DIRECTORY_NAME = "decoded_image_cache/";
+static const std::string CACHE_FILE_EXTENSION = ".tmic";
+
+///------------------------------------------------------------------------------------------------
+
+struct CacheFileHeader
+{
+    char mMagic[4];
+    uint32_t mVersion;
+    uint32_t mWidth;
+    uint32_t mHeight;
+    uint32_t mPitch;
+    uint32_t mPixelFormat;
+    uint32_t mBitsPerPixel;
+    uint32_t mCompression;
+    uint64_t mSourceModificationTime;
+    uint64_t mSourceSize;
+    uint64_t mSourceContentsHash;
+    uint64_t mDecodeMicros;
+    uint64_t mPayloadSize;
+};
+
+///------------------------------------------------------------------------------------------------
+
+DecodedImageCache::DecodedImageCache(const std::string& cacheDirectoryPath)
+    : mCacheDirectoryPath(cacheDirectoryPath)
+{
+    std::error_code errorCode;
+    std::filesystem::create_directories(mCacheDirectoryPath, errorCode);
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string DecodedImageCache::GetDefaultCacheDirectoryPath()
+{
+#if defined(MACOS) || defined(MOBILE_FLOW)
+    return apple_utils::GetPersistentDataDirectoryPath() + CACHE_DIRECTORY_NAME;
+#elif defined(WINDOWS)
+    return windows_utils::GetPersistentDataDirectoryPath() + CACHE_DIRECTORY_NAME;
+#elif defined(LINUX)
+    return linux_utils::GetPersistentDataDirectoryPath() + CACHE_DIRECTORY_NAME;
+#else
+    return (std::filesystem::temp_directory_path() / "TinyMMOClient" / CACHE_DIRECTORY_NAME).string();
+#endif
+}
+
+///------------------------------------------------------------------------------------------------
+
+DecodedImageSourceKey DecodedImageCache::CreateSourceKeyForLooseFile(const std::string& sourcePath)
+{
+    DecodedImageSourceKey sourceKey;
+
+    std::error_code errorCode;
+    const auto modificationTime = std::filesystem::last_write_time(sourcePath, errorCode);
+    if (errorCode)
+    {
+        return sourceKey;
+    }
+
+    const auto size = std::filesystem::file_size(sourcePath, errorCode);
+    if (errorCode)
+    {
+        return sourceKey;
+    }
+
+    sourceKey.mModificationTime = static_cast<uint64_t>(modificationTime.time_since_epoch().count());
+    sourceKey.mSize = static_cast<uint64_t>(size);
+    return sourceKey;
+}
+
+///------------------------------------------------------------------------------------------------
+
+DecodedImageSourceKey DecodedImageCache::CreateSourceKeyForContents(const char* data, const size_t size)
+{
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+
+    DecodedImageSourceKey sourceKey;
+    sourceKey.mSize = static_cast<uint64_t>(size);
+    sourceKey.mContentsHash = hash;
+    return sourceKey;
+}
+
+///------------------------------------------------------------------------------------------------
+
+SDL_Surface* DecodedImageCache::TryLoadSurface(const std::string& sourcePath, const DecodedImageSourceKey& sourceKey)
+{
+    const auto loadStartTime = std::chrono::steady_clock::now();
+
+    std::ifstream cacheFile(GetCacheFilePath(sourcePath), std::ios::binary);
+    if (!cacheFile.good())
+    {
+        mMissCount++;
+        return nullptr;
+    }
+
+    CacheFileHeader header = {};
+    cacheFile.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    const auto isHeaderValid =
+        cacheFile.good() &&
+        std::memcmp(header.mMagic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0 &&
+        header.mVersion == CACHE_VERSION &&
+        header.mCompression == static_cast<uint32_t>(Compression::NONE) &&
+        header.mSourceModificationTime == sourceKey.mModificationTime &&
+        header.mSourceSize == sourceKey.mSize &&
+        header.mSourceContentsHash == sourceKey.mContentsHash &&
+        header.mPayloadSize == static_cast<uint64_t>(header.mPitch) * header.mHeight;
+
+    if (!isHeaderValid)
+    {
+        mMissCount++;
+        return nullptr;
+    }
+
+    auto* surface = SDL_CreateRGBSurfaceWithFormat(0, static_cast<int>(header.mWidth), static_cast<int>(header.mHeight), static_cast<int>(header.mBitsPerPixel), header.mPixelFormat);
+    if (!surface)
+    {
+        mMissCount++;
+        return nullptr;
+    }
+
+    // Pitch of the freshly created surface is not guaranteed to match the cached one
+    SDL_LockSurface(surface);
+    if (static_cast<uint32_t>(surface->pitch) == header.mPitch)
+    {
+        cacheFile.read(static_cast<char*>(surface->pixels), static_cast<std::streamsize>(header.mPayloadSize));
+    }
+    else
+    {
+        const auto rowBytesToCopy = std::min(static_cast<uint32_t>(surface->pitch), header.mPitch);
+        for (uint32_t y = 0; y < header.mHeight && cacheFile.good(); ++y)
+        {
+            cacheFile.read(static_cast<char*>(surface->pixels) + y * surface->pitch, rowBytesToCopy);
+            cacheFile.seekg(header.mPitch - rowBytesToCopy, std::ios::cur);
+        }
+    }
+    SDL_UnlockSurface(surface);
+
+    if (!cacheFile.good())
+    {
+        SDL_FreeSurface(surface);
+        mMissCount++;
+        return nullptr;
+    }
+
+    const auto loadMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStartTime).count();
+    mDecodeMicrosSaved += static_cast<int64_t>(header.mDecodeMicros) - static_cast<int64_t>(loadMicros);
+    mHitCount++;
+
+    return surface;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void DecodedImageCache::StoreSurface(const std::string& sourcePath, const DecodedImageSourceKey& sourceKey, SDL_Surface* surface, const uint64_t decodeMicros)
+{
+    CacheFileHeader header = {};
+    std::memcpy(header.mMagic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.mVersion = CACHE_VERSION;
+    header.mWidth = static_cast<uint32_t>(surface->w);
+    header.mHeight = static_cast<uint32_t>(surface->h);
+    header.mPitch = static_cast<uint32_t>(surface->pitch);
+    header.mPixelFormat = surface->format->format;
+    header.mBitsPerPixel = surface->format->BitsPerPixel;
+    header.mCompression = static_cast<uint32_t>(Compression::NONE);
+    header.mSourceModificationTime = sourceKey.mModificationTime;
+    header.mSourceSize = sourceKey.mSize;
+    header.mSourceContentsHash = sourceKey.mContentsHash;
+    header.mDecodeMicros = decodeMicros;
+    header.mPayloadSize = static_cast<uint64_t>(header.mPitch) * header.mHeight;
+
+    // Write to a temporary file first so that a concurrent/interrupted write never leaves a torn entry behind
+    const auto cacheFilePath = GetCacheFilePath(sourcePath);
+    const auto temporaryCacheFilePath = cacheFilePath + ".tmp";
+    {
+        std::ofstream cacheFile(temporaryCacheFilePath, std::ios::binary | std::ios::trunc);
+        if (!cacheFile.good())
+        {
+            return;
+        }
+
+        SDL_LockSurface(surface);
+        cacheFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        cacheFile.write(static_cast<const char*>(surface->pixels), static_cast<std::streamsize>(header.mPayloadSize));
+        SDL_UnlockSurface(surface);
+
+        if (!cacheFile.good())
+        {
+            logging::Log(logging::LogType::WARNING, "Could not write decoded image cache entry for %s", sourcePath.c_str());
+            return;
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryCacheFilePath, cacheFilePath, errorCode);
+}
+
+///------------------------------------------------------------------------------------------------
+
+DecodedImageCache::Statistics DecodedImageCache::GetStatistics() const
+{
+    Statistics statistics;
+    statistics.mHitCount = mHitCount;
+    statistics.mMissCount = mMissCount;
+    statistics.mDecodeMillisSaved = static_cast<float>(mDecodeMicrosSaved.load())/1000.0f;
+    return statistics;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string DecodedImageCache::GetCacheFilePath(const std::string& sourcePath) const
+{
+    return mCacheDirectoryPath + fileutils::GetFileNameWithoutExtension(sourcePath) + "_" + std::to_string(strutils::GetStringHash(sourcePath)) + CACHE_FILE_EXTENSION;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
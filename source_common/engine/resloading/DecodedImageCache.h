@@ -0,0 +1,120 @@
+///------------------------------------------------------------------------------------------------
+///  DecodedImageCache.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef DecodedImageCache_h
+#define DecodedImageCache_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+struct SDL_Surface;
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+/// Identifies the exact version of a source image a cache entry was decoded from.
+/// Loose files are identified by their modification time and size, archived
+/// files (which have no mtime) by a hash of their contents.
+struct DecodedImageSourceKey
+{
+    uint64_t mModificationTime = 0;
+    uint64_t mSize = 0;
+    uint64_t mContentsHash = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// On-disk cache of decoded image pixels, so that PNGs only pay the inflate/unfilter
+/// cost the first time they are loaded after they change.
+///
+/// Each cached image is a single file named after the hash of its source path:
+///   Header:  char[4] magic "TMIC", u32 version, u32 width, u32 height, u32 pitch, u32 SDL pixel format,
+///            u32 bits per pixel, u32 compression, u64 source mtime, u64 source size, u64 source contents hash,
+///            u64 original decode time (micros), u64 payload size
+///   Payload: the surface pixel rows as decoded by SDL_image (pitch * height bytes)
+class DecodedImageCache final
+{
+public:
+    static constexpr char CACHE_MAGIC[4] = { 'T', 'M', 'I', 'C' };
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+    // LZ4 is not part of the vendored libs yet, so payloads are always stored raw.
+    // The field is kept in the header so that compressed payloads can be added without a version bump.
+    enum class Compression : uint32_t
+    {
+        NONE = 0
+    };
+
+    struct Statistics
+    {
+        int mHitCount = 0;
+        int mMissCount = 0;
+        float mDecodeMillisSaved = 0.0f;
+    };
+
+public:
+    /// @param[in] cacheDirectoryPath the directory the cache files will be written to/read from (created if missing).
+    DecodedImageCache(const std::string& cacheDirectoryPath);
+    DecodedImageCache(const DecodedImageCache&) = delete;
+    DecodedImageCache(DecodedImageCache&&) = delete;
+    const DecodedImageCache& operator = (const DecodedImageCache&) = delete;
+    DecodedImageCache& operator = (DecodedImageCache&&) = delete;
+
+    /// @returns the default, per-platform, writable directory for the cache.
+    static std::string GetDefaultCacheDirectoryPath();
+
+    /// Computes the key identifying the current version of a loose source image.
+    /// @param[in] sourcePath the path of the source image file.
+    /// @returns the key of the source image (zeroed if the file could not be stat'ed).
+    static DecodedImageSourceKey CreateSourceKeyForLooseFile(const std::string& sourcePath);
+
+    /// Computes the key identifying the current version of an in-memory (e.g. archived) source image.
+    /// @param[in] data the source image bytes.
+    /// @param[in] size the size of the source image in bytes.
+    /// @returns the key of the source image.
+    static DecodedImageSourceKey CreateSourceKeyForContents(const char* data, const size_t size);
+
+    /// Tries to create a surface from the cache entry of the given source image.
+    /// @param[in] sourcePath the path of the source image (used to locate the cache entry).
+    /// @param[in] sourceKey the key of the current version of the source image.
+    /// @returns a newly created surface, or nullptr if there is no valid cache entry.
+    SDL_Surface* TryLoadSurface(const std::string& sourcePath, const DecodedImageSourceKey& sourceKey);
+
+    /// Writes (or overwrites) the cache entry for the given source image.
+    /// @param[in] sourcePath the path of the source image (used to locate the cache entry).
+    /// @param[in] sourceKey the key of the current version of the source image.
+    /// @param[in] surface the freshly decoded surface.
+    /// @param[in] decodeMicros how long decoding the source image took (used for statistics on later hits).
+    void StoreSurface(const std::string& sourcePath, const DecodedImageSourceKey& sourceKey, SDL_Surface* surface, const uint64_t decodeMicros);
+
+    /// @returns the accumulated hit/miss counts and decode time saved so far.
+    Statistics GetStatistics() const;
+
+private:
+    std::string GetCacheFilePath(const std::string& sourcePath) const;
+
+private:
+    const std::string mCacheDirectoryPath;
+    std::atomic<int> mHitCount = 0;
+    std::atomic<int> mMissCount = 0;
+    std::atomic<int64_t> mDecodeMicrosSaved = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* DecodedImageCache_h */
@@ -6,14 +6,16 @@
 ///------------------------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <chrono>
+#include <engine/resloading/DecodedImageCache.h>
 #include <engine/resloading/ImageSurfaceLoader.h>
 #include <engine/resloading/ImageSurfaceResource.h>
+#include <engine/resloading/VirtualFileSystem.h>
 #include <engine/utils/FileUtils.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/OSMessageBox.h>
 #include <engine/utils/PlatformMacros.h>
 #include <engine/utils/StringUtils.h>
-#include <fstream>
 #include <iostream>
 #include <SDL.h>
 #include <SDL_image.h>
@@ -22,11 +24,28 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#define USE_DECODED_IMAGE_CACHE
+
+///------------------------------------------------------------------------------------------------
+
 namespace resources
 {
 
 ///------------------------------------------------------------------------------------------------
 
+ImageSurfaceLoader::ImageSurfaceLoader(const VirtualFileSystem& virtualFileSystem)
+    : mVirtualFileSystem(virtualFileSystem)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+ImageSurfaceLoader::~ImageSurfaceLoader()
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
 void ImageSurfaceLoader::VInitialize()
 {
     SDL_version imgCompiledVersion;
@@ -45,6 +64,10 @@ void ImageSurfaceLoader::VInitialize()
     }
     
     logging::Log(logging::LogType::INFO, "Successfully initialized SDL_image version %d.%d.%d", imgCompiledVersion.major, imgCompiledVersion.minor, imgCompiledVersion.patch);
+    
+#if defined(USE_DECODED_IMAGE_CACHE)
+    mDecodedImageCache = std::make_unique<DecodedImageCache>(DecodedImageCache::GetDefaultCacheDirectoryPath());
+#endif
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -58,20 +81,59 @@ bool ImageSurfaceLoader::VCanLoadAsync() const
 
 std::shared_ptr<IResource> ImageSurfaceLoader::VCreateAndLoadResource(const std::string& resourcePath) const
 {
-    std::ifstream file(resourcePath);
-        
-    if (!file.good())
+    SDL_Surface* sdlSurface = nullptr;
+    DecodedImageSourceKey sourceKey;
+    FileContents archivedFileContents;
+    
+    const auto isFileArchived = mVirtualFileSystem.IsFileArchived(resourcePath);
+    if (isFileArchived)
+    {
+        archivedFileContents = mVirtualFileSystem.ReadFile(resourcePath);
+        if (mDecodedImageCache)
+        {
+            sourceKey = DecodedImageCache::CreateSourceKeyForContents(archivedFileContents.GetData(), archivedFileContents.GetSize());
+        }
+    }
+    else
     {
-        ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "File could not be found", resourcePath.c_str());
-        return nullptr;
+        if (!mVirtualFileSystem.DoesFileExist(resourcePath))
+        {
+            ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "File could not be found", resourcePath.c_str());
+            return nullptr;
+        }
+        
+        if (mDecodedImageCache)
+        {
+            sourceKey = DecodedImageCache::CreateSourceKeyForLooseFile(resourcePath);
+        }
     }
     
-    auto* sdlSurface = IMG_Load(resourcePath.c_str());
+    // Prefer the already decoded pixels if the source hasn't changed since they were cached
+    if (mDecodedImageCache)
+    {
+        sdlSurface = mDecodedImageCache->TryLoadSurface(resourcePath, sourceKey);
+    }
     
     if (!sdlSurface)
     {
-        ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "SDL_image could not load texture", IMG_GetError());
-        return nullptr;
+        const auto decodeStartTime = std::chrono::steady_clock::now();
+        
+        // Archived files are decoded straight from the archive mapping
+        sdlSurface = isFileArchived ?
+            IMG_Load_RW(SDL_RWFromConstMem(archivedFileContents.GetData(), static_cast<int>(archivedFileContents.GetSize())), 1) :
+            IMG_Load(resourcePath.c_str());
+        
+        if (!sdlSurface)
+        {
+            ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "SDL_image could not load texture", IMG_GetError());
+            return nullptr;
+        }
+        
+        if (mDecodedImageCache)
+        {
+            const auto decodeMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - decodeStartTime).count();
+            mDecodedImageCache->StoreSurface(resourcePath, sourceKey, sdlSurface, static_cast<uint64_t>(decodeMicros));
+        }
     }
     
 #if defined(MACOS) || defined(MOBILE_FLOW)
@@ -91,7 +153,12 @@ std::shared_ptr<IResource> ImageSurfaceLoader::VCreateAndLoadResource(const std:
     return std::shared_ptr<IResource>(new ImageSurfaceResource(sdlSurface));
 }
 
+///------------------------------------------------------------------------------------------------
 
+const DecodedImageCache* ImageSurfaceLoader::GetDecodedImageCache() const
+{
+    return mDecodedImageCache.get();
+}
 
 ///------------------------------------------------------------------------------------------------
 
@@ -26,18 +26,30 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+class DecodedImageCache;
+class VirtualFileSystem;
+
+///------------------------------------------------------------------------------------------------
+
 class ImageSurfaceLoader final: public IResourceLoader
 {
     friend class ResourceLoadingService;
 
 public:
+    ~ImageSurfaceLoader();
+    
     void VInitialize() override;
     bool VCanLoadAsync() const override;
     std::shared_ptr<IResource> VCreateAndLoadResource(const std::string& path) const override;
+    
+    const DecodedImageCache* GetDecodedImageCache() const;
 
 private:
-    ImageSurfaceLoader() = default;
+    ImageSurfaceLoader(const VirtualFileSystem& virtualFileSystem);
     
+private:
+    const VirtualFileSystem& mVirtualFileSystem;
+    std::unique_ptr<DecodedImageCache> mDecodedImageCache;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -0,0 +1,151 @@
+///------------------------------------------------------------------------------------------------
+///  MemoryMappedFile.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <engine/resloading/MemoryMappedFile.h>
+
+#if defined(WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool MemoryMappedFile::Open(const std::string& filePath)
+{
+    Close();
+
+#if defined(WINDOWS)
+    auto fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    auto mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    auto* mappedData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!mappedData)
+    {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    mFileHandle = fileHandle;
+    mMappingHandle = mappingHandle;
+    mMappedData = static_cast<const char*>(mappedData);
+    mMappedSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const auto fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStats;
+    if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size == 0)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    auto* mappedData = mmap(nullptr, static_cast<size_t>(fileStats.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mappedData == MAP_FAILED)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    mFileDescriptor = fileDescriptor;
+    mMappedData = static_cast<const char*>(mappedData);
+    mMappedSize = static_cast<size_t>(fileStats.st_size);
+#endif
+
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void MemoryMappedFile::Close()
+{
+    if (!mMappedData)
+    {
+        return;
+    }
+
+#if defined(WINDOWS)
+    UnmapViewOfFile(mMappedData);
+    CloseHandle(mMappingHandle);
+    CloseHandle(mFileHandle);
+    mMappingHandle = nullptr;
+    mFileHandle = nullptr;
+#else
+    munmap(const_cast<char*>(mMappedData), mMappedSize);
+    close(mFileDescriptor);
+    mFileDescriptor = -1;
+#endif
+
+    mMappedData = nullptr;
+    mMappedSize = 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool MemoryMappedFile::IsOpen() const
+{
+    return mMappedData != nullptr;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const char* MemoryMappedFile::GetData() const
+{
+    return mMappedData;
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t MemoryMappedFile::GetSize() const
+{
+    return mMappedSize;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,69 @@
+///------------------------------------------------------------------------------------------------
+///  MemoryMappedFile.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef MemoryMappedFile_h
+#define MemoryMappedFile_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/utils/PlatformMacros.h>
+#include <cstddef>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+/// A read-only memory mapping of a whole file. The contents are paged in lazily by the OS
+/// as they get touched, and stay valid until the file is closed (or the object destroyed).
+class MemoryMappedFile final
+{
+public:
+    MemoryMappedFile() = default;
+    ~MemoryMappedFile();
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&&) = delete;
+    const MemoryMappedFile& operator = (const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator = (MemoryMappedFile&&) = delete;
+
+    /// Maps the file at the given path (unmapping any previously mapped one).
+    /// @param[in] filePath the path of the file.
+    /// @returns whether the (non empty) file was mapped successfully.
+    bool Open(const std::string& filePath);
+
+    /// Unmaps the file (if any). Previously returned data pointers become invalid.
+    void Close();
+
+    /// @returns whether a file is currently mapped.
+    bool IsOpen() const;
+
+    /// @returns a pointer to the start of the mapping (page aligned), or nullptr if no file is mapped.
+    const char* GetData() const;
+
+    /// @returns the size of the mapping in bytes.
+    size_t GetSize() const;
+
+private:
+    const char* mMappedData = nullptr;
+    size_t mMappedSize = 0;
+#if defined(WINDOWS)
+    void* mFileHandle = nullptr;
+    void* mMappingHandle = nullptr;
+#else
+    int mFileDescriptor = -1;
+#endif
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* MemoryMappedFile_h */
@@ -0,0 +1,127 @@
+///------------------------------------------------------------------------------------------------
+///  MeshLoader.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <cstring>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/OpenGL.h>
+#include <engine/resloading/CookedMeshResource.h>
+#include <engine/resloading/MeshLoader.h>
+#include <engine/resloading/MeshResource.h>
+#include <engine/resloading/ResourceLoadingService.h>
+#include <engine/utils/FileUtils.h>
+#include <engine/utils/StringUtils.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+void MeshLoader::VInitialize()
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool MeshLoader::VCanLoadAsync() const
+{
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::shared_ptr<IResource> MeshLoader::VCreateAndLoadResource(const std::string& path) const
+{
+    auto& resourceLoadingService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+    const auto& cookedMeshView = resourceLoadingService.GetResource<CookedMeshResource>(path).GetCookedMeshView();
+    
+    const auto fileNameWithoutExtension = fileutils::GetFileNameWithoutExtension(path);
+    bool dynamicMesh = strutils::StringContains(fileNameWithoutExtension, "dynamic");
+    
+    GLuint vertexArrayObject = 0;
+    GLuint vertexBufferObject = 0;
+    GLuint uvCoordsBufferObject = 0;
+    GLuint normalsBufferObject = 0;
+    GLuint indexBufferObject = 0;
+    
+    GLenum usage = dynamicMesh ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+    GLenum elementType = cookedMeshView.mIndexSize == sizeof(unsigned short) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    
+    // Headless meshes keep their metadata (and dynamic data), but have no GL buffers behind them
+    if (!CoreSystemsEngine::IsHeadless())
+    {
+        // Create Buffers
+        GL_CALL(glGenVertexArrays(1, &vertexArrayObject));
+        GL_CALL(glGenBuffers(1, &vertexBufferObject));
+        GL_CALL(glGenBuffers(1, &uvCoordsBufferObject));
+        GL_CALL(glGenBuffers(1, &normalsBufferObject));
+        GL_CALL(glGenBuffers(1, &indexBufferObject));
+        
+        // Prepare VAO to record buffer state
+        GL_CALL(glBindVertexArray(vertexArrayObject));
+        
+        // Bind and Buffer VBO (straight from the cooked mesh view, no intermediate copies)
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, cookedMeshView.mVertexCount * sizeof(glm::vec3), cookedMeshView.mPositions, usage));
+        
+        // 1st attribute buffer : vertices
+        GL_CALL(glEnableVertexAttribArray(0));
+        GL_CALL(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0));
+        
+        // Bind and buffer TBO
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, uvCoordsBufferObject));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, cookedMeshView.mVertexCount * sizeof(glm::vec2), cookedMeshView.mTexCoords, usage));
+        
+        // 2nd attribute buffer: tex coords
+        GL_CALL(glEnableVertexAttribArray(1));
+        GL_CALL(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0));
+        
+        // Bind and Buffer NBO
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, normalsBufferObject));
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, cookedMeshView.mVertexCount * sizeof(glm::vec3), cookedMeshView.mNormals, usage));
+        
+        // 3rd attribute buffer: normals
+        GL_CALL(glEnableVertexAttribArray(2));
+        GL_CALL(glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, (void*)0));
+        
+        // Bind and Buffer IBO
+        GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject));
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<size_t>(cookedMeshView.mIndexCount) * cookedMeshView.mIndexSize, cookedMeshView.mIndices, usage));
+        
+        GL_CALL(glBindVertexArray(0));
+    }
+    
+    // Decide whether to forward all mesh data as well
+    std::unique_ptr<MeshResource::MeshData> meshData = nullptr;
+    
+    if (dynamicMesh)
+    {
+        std::vector<glm::vec3> vertices(cookedMeshView.mVertexCount);
+        std::vector<glm::vec2> uvs(cookedMeshView.mVertexCount);
+        std::vector<glm::vec3> normals(cookedMeshView.mVertexCount);
+        std::memcpy(vertices.data(), cookedMeshView.mPositions, vertices.size() * sizeof(glm::vec3));
+        std::memcpy(uvs.data(), cookedMeshView.mTexCoords, uvs.size() * sizeof(glm::vec2));
+        std::memcpy(normals.data(), cookedMeshView.mNormals, normals.size() * sizeof(glm::vec3));
+        
+        meshData = std::make_unique<MeshResource::MeshData>(vertexBufferObject, uvCoordsBufferObject, normalsBufferObject, vertices, uvs, normals);
+    }
+    
+    const auto elementCount = static_cast<GLuint>(cookedMeshView.mIndexCount);
+    const auto meshDimensions = cookedMeshView.mDimensions;
+    
+    resourceLoadingService.UnloadResource(path);
+    
+    return std::shared_ptr<MeshResource>(new MeshResource(vertexArrayObject, elementCount, elementType, meshDimensions, std::move(meshData)));
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,43 @@
+///------------------------------------------------------------------------------------------------
+///  MeshLoader.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef MeshLoader_h
+#define MeshLoader_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/resloading/IResourceLoader.h>
+#include <memory>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+/// The GL step of loading a mesh. Uploads the cooked mesh produced by the OBJMeshLoader
+/// into GL buffers, after which the cooked mesh resource is unloaded.
+class MeshLoader final: public IResourceLoader
+{
+    friend class ResourceLoadingService;
+
+public:
+    void VInitialize() override;
+    bool VCanLoadAsync() const override;
+    std::shared_ptr<IResource> VCreateAndLoadResource(const std::string& path) const override;
+
+private:
+    MeshLoader() = default;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* MeshLoader_h */
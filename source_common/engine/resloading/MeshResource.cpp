@@ -21,6 +21,12 @@ void MeshResource::ApplyDirectTransformToData(std::function<void(MeshData&)> tra
     {
         transform(*mMeshData);
         
+        // Headless meshes have no GL buffers behind them
+        if (mVertexArrayObject == 0)
+        {
+            return;
+        }
+        
         GL_CALL(glBindVertexArray(mVertexArrayObject));
         
         // Bind and Buffer VBO
@@ -53,6 +59,13 @@ const GLuint& MeshResource::GetElementCount() const
 
 ///------------------------------------------------------------------------------------------------
 
+const GLuint& MeshResource::GetElementType() const
+{
+    return mElementType;
+}
+
+///------------------------------------------------------------------------------------------------
+
 const glm::vec3& MeshResource::GetDimensions() const
 {
     return mDimensions;
@@ -86,9 +99,10 @@ const std::vector<glm::vec3>& MeshResource::GetMeshNormals() const
 
 ///------------------------------------------------------------------------------------------------
 
-MeshResource::MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const glm::vec3& meshDimensions, std::unique_ptr<MeshData> meshData /* = nullptr */)
+MeshResource::MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const GLuint elementType, const glm::vec3& meshDimensions, std::unique_ptr<MeshData> meshData /* = nullptr */)
     : mVertexArrayObject(vertexArrayObject)
     , mElementCount(elementCount)
+    , mElementType(elementType)
     , mDimensions(meshDimensions)
     , mMeshData(std::move(meshData))
 {
@@ -25,7 +25,7 @@ using GLuint = unsigned int;
 
 class MeshResource final: public IResource
 {
-    friend class OBJMeshLoader;
+    friend class MeshLoader;
     
 public:
     struct MeshData
@@ -53,16 +53,18 @@ public:
     
     const GLuint& GetVertexArrayObject() const;
     const GLuint& GetElementCount() const;
+    const GLuint& GetElementType() const;
     const glm::vec3& GetDimensions() const;
     const std::vector<glm::vec3>& GetMeshVertices() const;
     const std::vector<glm::vec3>& GetMeshNormals() const;
     
 private:
-    MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const glm::vec3& meshDimensions, std::unique_ptr<MeshData> meshData = nullptr);
+    MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const GLuint elementType, const glm::vec3& meshDimensions, std::unique_ptr<MeshData> meshData = nullptr);
     
 private:
     const GLuint mVertexArrayObject;
     const GLuint mElementCount;
+    const GLuint mElementType;
     const glm::vec3 mDimensions;
     std::unique_ptr<MeshData> mMeshData;
 };
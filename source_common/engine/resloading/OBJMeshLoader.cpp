@@ -5,21 +5,22 @@
 ///  Created by Alex Koukoulas on 20/09/2023.
 ///------------------------------------------------------------------------------------------------
 
-// Disable CRT_SECURE warnings for fopen, fscanf etc..
-#ifdef _WIN32
-#pragma warning(disable: 4996)
-#endif
-
-#include <cassert>
-#include <cstdio>
-#include <engine/rendering/OpenGL.h>
+#include <engine/rendering/MeshCooking.h>
+#include <engine/resloading/CookedMeshResource.h>
+#include <engine/resloading/MemoryMappedFile.h>
 #include <engine/resloading/OBJMeshLoader.h>
-#include <engine/resloading/MeshResource.h>
-#include <engine/utils/FileUtils.h>
-#include <engine/utils/MathUtils.h>
+#include <engine/resloading/VirtualFileSystem.h>
+#include <engine/utils/Logging.h>
 #include <engine/utils/OSMessageBox.h>
-#include <engine/utils/StringUtils.h>
-#include <vector>
+#include <engine/utils/PlatformMacros.h>
+#if defined(MACOS) || defined(MOBILE_FLOW)
+#include <platform_utilities/AppleUtils.h>
+#elif defined(WINDOWS)
+#include <platform_utilities/WindowsUtils.h>
+#elif defined(LINUX)
+#include <platform_utilities/LinuxUtils.h>
+#endif
+#include <filesystem>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -28,6 +29,20 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+static const std::string COOKED_MESH_CACHE_DIRECTORY_NAME = "cooked_mesh_cache/";
+
+///------------------------------------------------------------------------------------------------
+
+OBJMeshLoader::OBJMeshLoader(const VirtualFileSystem& virtualFileSystem, const std::string& cookedMeshCacheDirectoryPath)
+    : mVirtualFileSystem(virtualFileSystem)
+    , mCookedMeshCacheDirectoryPath(cookedMeshCacheDirectoryPath)
+{
+    std::error_code errorCode;
+    std::filesystem::create_directories(mCookedMeshCacheDirectoryPath, errorCode);
+}
+
+///------------------------------------------------------------------------------------------------
+
 void OBJMeshLoader::VInitialize()
 {
 }
@@ -36,185 +51,103 @@ void OBJMeshLoader::VInitialize()
 
 bool OBJMeshLoader::VCanLoadAsync() const
 {
-    return false;
+    return true;
 }
 
 ///------------------------------------------------------------------------------------------------
 
 std::shared_ptr<IResource> OBJMeshLoader::VCreateAndLoadResource(const std::string& path) const
 {
-    auto trimmedPath = path;
-    std::vector<unsigned int> vertexIndices, uvIndices, normalIndices;
-    
-    std::vector<glm::vec3> tempVertices;
-    std::vector<glm::vec2> tempUvs;
-    std::vector<glm::vec3> tempNormals;
-    
-    std::vector<glm::vec3> finalVertices;
-    std::vector<glm::vec2> finalUvs;
-    std::vector<glm::vec3> finalNormals;
+    rendering::CookedMeshView cookedMeshView;
     
-    std::vector<unsigned short> finalIndices;
-    
-    float minX = 100.0f, maxX = -100.0f, minY = 100.0f, maxY = -100.0f, minZ = 100.0f, maxZ = -100.0f;
+    // Meshes cooked at build time are viewed straight from the archive mapping
+    const auto shippedCookedMeshPath = rendering::GetCookedMeshFilePath(path);
+    if (mVirtualFileSystem.IsFileArchived(shippedCookedMeshPath))
+    {
+        const auto fileContents = mVirtualFileSystem.ReadFile(shippedCookedMeshPath);
+        if (fileContents.IsValid() && rendering::ParseCookedMesh(fileContents.GetData(), fileContents.GetSize(), cookedMeshView))
+        {
+            return std::shared_ptr<IResource>(new CookedMeshResource(cookedMeshView, nullptr));
+        }
+        
+        logging::Log(logging::LogType::WARNING, "Invalid cooked mesh %s, cooking again from source", shippedCookedMeshPath.c_str());
+    }
     
-    FILE * file = std::fopen(trimmedPath.c_str(), "r");
+    // Otherwise meshes cooked by a previous run are mapped from the cache directory
+    const auto cachedCookedMeshPath = rendering::GetCookedMeshCacheFilePath(mCookedMeshCacheDirectoryPath, path);
+    if (!mVirtualFileSystem.IsFileArchived(path) && IsCachedCookedMeshUpToDate(path, cachedCookedMeshPath))
+    {
+        auto mappedCookedMeshFile = std::make_unique<MemoryMappedFile>();
+        if (mappedCookedMeshFile->Open(cachedCookedMeshPath) && rendering::ParseCookedMesh(mappedCookedMeshFile->GetData(), mappedCookedMeshFile->GetSize(), cookedMeshView))
+        {
+            return std::shared_ptr<IResource>(new CookedMeshResource(cookedMeshView, std::move(mappedCookedMeshFile)));
+        }
+        
+        logging::Log(logging::LogType::WARNING, "Invalid cooked mesh %s, cooking again from source", cachedCookedMeshPath.c_str());
+    }
     
-    if (!file)
+    const auto fileContents = mVirtualFileSystem.ReadFile(path);
+    if (!fileContents.IsValid())
     {
         ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "File could not be found", path.c_str());
         return nullptr;
     }
     
-    const auto fileNameWithoutExtension = fileutils::GetFileNameWithoutExtension(path);
-    bool dynamicMesh = strutils::StringContains(fileNameWithoutExtension, "dynamic");
+    rendering::CookedMesh cookedMesh;
+    if (!rendering::ImportOBJMesh(fileContents.GetData(), fileContents.GetSize(), cookedMesh))
+    {
+        ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "File can't be read by the OBJ parser", path.c_str());
+        return nullptr;
+    }
+    
+    rendering::OptimizeVertexCache(cookedMesh);
     
-    while(1)
+    // Cache the cooked mesh of loose sources (the source directory may well be read only, e.g. an app bundle),
+    // so that subsequent runs skip parsing
+    if (!fileContents.IsArchived())
     {
-        char lineHeader[128];
-        // read the first word of the line
-        int res = fscanf(file, "%s", lineHeader);
-        if (res == EOF)
-            break; // EOF = End Of File. Quit the loop.
-        
-        if (strcmp(lineHeader, "v") == 0)
-        {
-            glm::vec3 vertex;
-            fscanf(file, "%f %f %f\n", &vertex.x, &vertex.y, &vertex.z );
-            //vertex.z = -vertex.z;
-            tempVertices.push_back(vertex);
-            
-            if (vertex.x < minX) minX = vertex.x;
-            if (vertex.x > maxX) maxX = vertex.x;
-            if (vertex.y < minY) minY = vertex.y;
-            if (vertex.y > maxY) maxY = vertex.y;
-            if (vertex.z < minZ) minZ = vertex.z;
-            if (vertex.z > maxZ) maxZ = vertex.z;
-        }
-        else if (strcmp(lineHeader, "vt") == 0)
-        {
-            glm::vec2 uv;
-            fscanf(file, "%f %f\n", &uv.x, &uv.y );
-            tempUvs.push_back(uv);
-        }
-        else if (strcmp(lineHeader, "vn") == 0)
+        if (rendering::WriteCookedMesh(cachedCookedMeshPath, cookedMesh))
         {
-            glm::vec3 normal;
-            fscanf(file, "%f %f %f\n", &normal.x, &normal.y, &normal.z );
-            tempNormals.push_back(normal);
-        }
-        else if (strcmp(lineHeader, "f") == 0)
-        {
-            std::string vertex1, vertex2, vertex3;
-            unsigned int vertexIndex[3], uvIndex[3], normalIndex[3];
-            int matches = fscanf(file, "%d/%d/%d %d/%d/%d %d/%d/%d\n", &vertexIndex[0], &uvIndex[0], &normalIndex[0], &vertexIndex[1], &uvIndex[1], &normalIndex[1], &vertexIndex[2], &uvIndex[2], &normalIndex[2] );
-            if (matches != 9)
-            {
-                assert(false && "File can't be read by this simple parser");
-                fclose(file);
-            }
-            
-            vertexIndices.push_back(vertexIndex[0]);
-            vertexIndices.push_back(vertexIndex[1]);
-            vertexIndices.push_back(vertexIndex[2]);
-            
-            uvIndices.push_back(uvIndex[0]);
-            uvIndices.push_back(uvIndex[1]);
-            uvIndices.push_back(uvIndex[2]);
-            
-            normalIndices.push_back(normalIndex[0]);
-            normalIndices.push_back(normalIndex[1]);
-            normalIndices.push_back(normalIndex[2]);
+            logging::Log(logging::LogType::INFO, "Cooked mesh %s (%d vertices, %d indices)", cachedCookedMeshPath.c_str(), static_cast<int>(cookedMesh.mPositions.size()), static_cast<int>(cookedMesh.mIndices.size()));
         }
         else
         {
-            // Probably a comment, eat up the rest of the line
-            char stupidBuffer[1000];
-            fgets(stupidBuffer, 1000, file);
+            logging::Log(logging::LogType::WARNING, "Could not write cooked mesh %s", cachedCookedMeshPath.c_str());
         }
     }
     
-    // For each vertex of each triangle
-    for(unsigned int i=0; i<vertexIndices.size(); i++)
-    {
-        // Get the indices of its attributes
-        unsigned int vertexIndex = vertexIndices[i];
-        unsigned int uvIndex = uvIndices[i];
-        unsigned int normalIndex = normalIndices[i];
-        
-        // Get the attributes thanks to the index
-        glm::vec3 vertex = tempVertices[ vertexIndex-1 ];
-        glm::vec2 uv = tempUvs[ uvIndex-1 ];
-        glm::vec3 normal = tempNormals[ normalIndex-1 ];
-        
-        // Put the attributes in buffers
-        finalVertices.push_back(vertex);
-        finalUvs.push_back(uv);
-        finalNormals.push_back(normal);
-        finalIndices.push_back(static_cast<unsigned short>(i));
-    }
-    
-    std::fclose(file);
-    
-    GLuint vertexArrayObject;
-    GLuint vertexBufferObject;
-    GLuint uvCoordsBufferObject;
-    GLuint normalsBufferObject;
-    GLuint indexBufferObject;
-    
-    GLenum usage = dynamicMesh ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
-    
-    // Create Buffers
-    GL_CALL(glGenVertexArrays(1, &vertexArrayObject));
-    GL_CALL(glGenBuffers(1, &vertexBufferObject));
-    GL_CALL(glGenBuffers(1, &uvCoordsBufferObject));
-    GL_CALL(glGenBuffers(1, &normalsBufferObject));
-    GL_CALL(glGenBuffers(1, &indexBufferObject));
-    
-    // Prepare VAO to record buffer state
-    GL_CALL(glBindVertexArray(vertexArrayObject));
-    
-    // Bind and Buffer VBO
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, finalVertices.size() * sizeof(glm::vec3), &finalVertices[0], usage));
-    
-    // 1st attribute buffer : vertices
-    GL_CALL(glEnableVertexAttribArray(0));
-    GL_CALL(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0));
-    
-    // Bind and buffer TBO
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, uvCoordsBufferObject));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, finalUvs.size() * sizeof(glm::vec2), &finalUvs[0], usage));
-    
-    // 2nd attribute buffer: tex coords
-    GL_CALL(glEnableVertexAttribArray(1));
-    GL_CALL(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0));
-    
-    // Bind and Buffer NBO
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, normalsBufferObject));
-    GL_CALL(glBufferData(GL_ARRAY_BUFFER, finalNormals.size() * sizeof(glm::vec3), &finalNormals[0], usage));
-    
-    // 3rd attribute buffer: normals
-    GL_CALL(glEnableVertexAttribArray(2));
-    GL_CALL(glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, (void*)0));
-    
-    // Bind and Buffer IBO
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject));
-    GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, finalIndices.size() * sizeof(unsigned short), &finalIndices[0], usage));
-    
-    GL_CALL(glBindVertexArray(0));
-    
-    // Decide whether to forward all mesh data as well
-    std::unique_ptr<MeshResource::MeshData> meshData = nullptr;
-    
-    if (dynamicMesh)
+    return std::shared_ptr<IResource>(new CookedMeshResource(rendering::SerializeCookedMesh(cookedMesh)));
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string OBJMeshLoader::GetDefaultCookedMeshCacheDirectoryPath()
+{
+#if defined(MACOS) || defined(MOBILE_FLOW)
+    return apple_utils::GetPersistentDataDirectoryPath() + COOKED_MESH_CACHE_DIRECTORY_NAME;
+#elif defined(WINDOWS)
+    return windows_utils::GetPersistentDataDirectoryPath() + COOKED_MESH_CACHE_DIRECTORY_NAME;
+#elif defined(LINUX)
+    return linux_utils::GetPersistentDataDirectoryPath() + COOKED_MESH_CACHE_DIRECTORY_NAME;
+#else
+    return (std::filesystem::temp_directory_path() / "TinyMMOClient" / COOKED_MESH_CACHE_DIRECTORY_NAME).string();
+#endif
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool OBJMeshLoader::IsCachedCookedMeshUpToDate(const std::string& path, const std::string& cookedMeshPath) const
+{
+    std::error_code errorCode;
+    const auto cookedMeshModificationTime = std::filesystem::last_write_time(cookedMeshPath, errorCode);
+    if (errorCode)
     {
-        meshData = std::make_unique<MeshResource::MeshData>(vertexBufferObject, uvCoordsBufferObject, normalsBufferObject, finalVertices, finalUvs, finalNormals);
+        return false;
     }
     
-    // Calculate dimensions
-    glm::vec3 meshDimensions(math::Abs(minX - maxX), math::Abs(minY - maxY), math::Abs(minZ - maxZ));
-    return std::shared_ptr<MeshResource>(new MeshResource(vertexArrayObject, (GLuint)finalIndices.size(), meshDimensions, std::move(meshData)));
+    // A source mesh edited after it was last cooked wins over its stale cooked mesh
+    const auto sourceModificationTime = std::filesystem::last_write_time(path, errorCode);
+    return errorCode || sourceModificationTime <= cookedMeshModificationTime;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 ///------------------------------------------------------------------------------------------------
 
 #include <engine/resloading/IResourceLoader.h>
+#include <string>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -19,6 +20,14 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+class VirtualFileSystem;
+
+///------------------------------------------------------------------------------------------------
+/// The CPU side step of loading a mesh. Prefers a cooked (deduplicated, vertex cache optimized)
+/// version of the OBJ mesh, either shipped in the asset archive or an up to date one cached by a
+/// previous run, otherwise cooks it from the OBJ source (and, for loose source files, saves the
+/// cooked mesh in the writable cache directory for subsequent runs).
+/// Loading is requested with the path of the OBJ mesh, so that resource ids stay the same.
 class OBJMeshLoader final: public IResourceLoader
 {
     friend class ResourceLoadingService;
@@ -28,8 +37,18 @@ public:
     bool VCanLoadAsync() const override;
     std::shared_ptr<IResource> VCreateAndLoadResource(const std::string& path) const override;
     
+    /// @returns the default, per-platform, writable directory for cooked meshes cached at runtime.
+    static std::string GetDefaultCookedMeshCacheDirectoryPath();
+    
+private:
+    OBJMeshLoader(const VirtualFileSystem& virtualFileSystem, const std::string& cookedMeshCacheDirectoryPath);
+    
+    // Returns whether a cached cooked mesh exists for the given loose OBJ mesh, and is newer than it
+    bool IsCachedCookedMeshUpToDate(const std::string& path, const std::string& cookedMeshPath) const;
+    
 private:
-    OBJMeshLoader() = default;
+    const VirtualFileSystem& mVirtualFileSystem;
+    const std::string mCookedMeshCacheDirectoryPath;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -6,24 +6,36 @@
 ///------------------------------------------------------------------------------------------------
 
 #include <cassert>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/rendering/OpenGL.h>
+#include <engine/rendering/RenderingUtils.h>
+#include <engine/rendering/TextureAtlas.h>
+#include <engine/resloading/CookedTextureLoader.h>
 #include <engine/resloading/DataFileLoader.h>
+#include <engine/resloading/DataFileResource.h>
 #include <engine/resloading/IResource.h>
 #include <engine/resloading/ImageSurfaceLoader.h>
+#include <engine/resloading/ImageSurfaceResource.h>
+#include <engine/resloading/MeshLoader.h>
 #include <engine/resloading/OBJMeshLoader.h>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/resloading/ShaderLoader.h>
 #include <engine/resloading/TextureLoader.h>
 #include <engine/resloading/TextureResource.h>
+#include <engine/resloading/VirtualFileSystem.h>
+#include <engine/utils/BlockingQueue.h>
 #include <engine/utils/FileUtils.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/OSMessageBox.h>
+#include <engine/utils/Profiler.h>
+#include <engine/utils/SPSCRingBuffer.h>
 #include <engine/utils/StringUtils.h>
-#include <engine/utils/ThreadSafeQueue.h>
 #include <engine/utils/TypeTraits.h>
-#include <fstream>
+#include <nlohmann/json.hpp>
 #include <thread>
 
 //#define UNZIP_FLOW
+#define USE_TEXTURE_ATLASES
 bool ARTIFICIAL_ASYNC_LOADING_DELAY = false;
 
 ///------------------------------------------------------------------------------------------------
@@ -45,7 +57,7 @@ std::string ResourceLoadingService::RES_ROOT = "assets/";
 std::string ResourceLoadingService::RES_ROOT = "";
 #endif
 #else
-std::string ResourceLoadingService::RES_ROOT = "";
+std::string ResourceLoadingService::RES_ROOT = "../../assets/";
 #endif
 
 std::string ResourceLoadingService::RES_DATA_ROOT          = RES_ROOT + "data/";
@@ -59,69 +71,89 @@ std::string ResourceLoadingService::RES_ATLASES_ROOT       = RES_TEXTURES_ROOT +
 std::string ResourceLoadingService::RES_FONT_MAP_DATA_ROOT = RES_DATA_ROOT + "font_maps/";
 
 //static const std::string ZIPPED_ASSETS_FILE_NAME = "assets.zip";
+static const std::string TEXTURE_ATLAS_DEFINITIONS_FILE_NAME = "texture_atlases.json";
 
 ///------------------------------------------------------------------------------------------------
 
-class LoadingJob
+struct LoadingJob
 {
-public:
-    LoadingJob(const IResourceLoader* loader, const std::string& resourcePath, const ResourceId targetResourceId)
-    : mLoader(loader)
-    , mResourcePath(resourcePath)
-    , mTargetResourceId(targetResourceId)
-    {
-    }
-    
-    const IResourceLoader* mLoader;
-    const std::string mResourcePath;
-    const ResourceId mTargetResourceId;
+    const IResourceLoader* mLoader = nullptr;
+    std::string mResourcePath;
+    ResourceId mTargetResourceId = 0;
 };
 
-class JobResult
+struct JobResult
 {
-public:
-    JobResult(std::shared_ptr<IResource> resource, const IResourceLoader* loader, const std::string& resourcePath, const ResourceId targetResourceId)
-    : mResource(std::move(resource))
-    , mLoader(loader)
-    , mResourcePath(resourcePath)
-    , mTargetResourceId(targetResourceId)
-    {
-    }
-    
     std::shared_ptr<IResource> mResource;
-    const IResourceLoader* mLoader;
-    const std::string mResourcePath;
-    const ResourceId mTargetResourceId;
+    const IResourceLoader* mLoader = nullptr;
+    std::string mResourcePath;
+    ResourceId mTargetResourceId = 0;
 };
 
+///------------------------------------------------------------------------------------------------
+
+static constexpr size_t ASYNC_LOADING_RESULTS_CAPACITY = 256;
 
+///------------------------------------------------------------------------------------------------
+/// Jobs are handed over through a blocking queue (the worker sleeps while there are none), whereas
+/// results come back through a lock-free ring buffer drained by the main thread once per Update().
 class ResourceLoadingService::AsyncLoaderWorker
 {
 public:
+    AsyncLoaderWorker()
+        : mResults(ASYNC_LOADING_RESULTS_CAPACITY)
+    {
+    }
+    
+    ~AsyncLoaderWorker()
+    {
+        mJobs.Close();
+        if (mThread.joinable())
+        {
+            mThread.join();
+        }
+    }
+    
     void StartWorker()
     {
         mThread = std::thread([&]
         {
-            while(true)
+            LoadingJob job;
+            while (mJobs.Pop(job))
             {
                 using namespace std::chrono_literals;
-                auto job = mJobs.dequeue();
-                auto resource = job.mLoader->VCreateAndLoadResource(job.mResourcePath);
+                
+                JobResult result;
+                {
+                    PROFILE_SCOPE("AsyncResourceLoad");
+                    result.mResource = job.mLoader->VCreateAndLoadResource(job.mResourcePath);
+                }
                 
                 if (ARTIFICIAL_ASYNC_LOADING_DELAY)
                 {
                     std::this_thread::sleep_for(100ms);
                 }
                 
-                mResults.enqueue({resource, job.mLoader, job.mResourcePath, job.mTargetResourceId});
+                result.mLoader = job.mLoader;
+                result.mResourcePath = std::move(job.mResourcePath);
+                result.mTargetResourceId = job.mTargetResourceId;
+                
+                // Only full if the main thread stopped updating for a while
+                while (!mResults.TryPushInPlace([&](JobResult& slotResult){ slotResult = std::move(result); }))
+                {
+                    if (mJobs.IsClosed())
+                    {
+                        return;
+                    }
+                    std::this_thread::sleep_for(1ms);
+                }
             }
         });
-        mThread.detach();
     }
     
 public:
-    ThreadSafeQueue<LoadingJob> mJobs;
-    ThreadSafeQueue<JobResult> mResults;
+    BlockingQueue<LoadingJob> mJobs;
+    SPSCRingBuffer<JobResult> mResults;
     
 private:
     std::thread mThread;
@@ -131,6 +163,7 @@ private:
 ///------------------------------------------------------------------------------------------------
 
 ResourceLoadingService::ResourceLoadingService()
+    : mVirtualFileSystem(std::make_unique<VirtualFileSystem>())
 {
     
 }
@@ -161,31 +194,55 @@ void ResourceLoadingService::Initialize()
     objectiveC_utils::UnzipAssets((RES_ROOT + ZIPPED_ASSETS_FILE_NAME).c_str(), RES_ROOT.c_str());
 #endif
     
+    // Prefer the packed asset archive when one has been shipped, otherwise
+    // every asset is read as a loose file (development flow)
+    if (mVirtualFileSystem->MountArchive(RES_ROOT + VirtualFileSystem::ASSET_ARCHIVE_FILE_NAME, RES_ROOT))
+    {
+        logging::Log(logging::LogType::INFO, "Mounted asset archive %s with %d entries", (RES_ROOT + VirtualFileSystem::ASSET_ARCHIVE_FILE_NAME).c_str(), static_cast<int>(mVirtualFileSystem->GetMountedArchive().GetEntryCount()));
+    }
+    
     // No make unique due to constructing the loaders with their private constructors
     // via friendship
-    mResourceLoaders.push_back(std::unique_ptr<ImageSurfaceLoader>(new ImageSurfaceLoader));
-    mResourceLoaders.push_back(std::unique_ptr<DataFileLoader>(new DataFileLoader));
-    mResourceLoaders.push_back(std::unique_ptr<ShaderLoader>(new ShaderLoader));
-    mResourceLoaders.push_back(std::unique_ptr<OBJMeshLoader>(new OBJMeshLoader));
-    mResourceLoaders.push_back(std::unique_ptr<TextureLoader>(new TextureLoader));
+    mImageSurfaceLoader = new ImageSurfaceLoader(*mVirtualFileSystem);
+    mDataFileLoader = new DataFileLoader(*mVirtualFileSystem);
+    mShaderLoader = new ShaderLoader(*mVirtualFileSystem);
+    mOBJMeshLoader = new OBJMeshLoader(*mVirtualFileSystem, OBJMeshLoader::GetDefaultCookedMeshCacheDirectoryPath());
+    mCookedTextureLoader = new CookedTextureLoader(*mVirtualFileSystem);
+    mMeshLoader = new MeshLoader;
+    mTextureLoader = new TextureLoader;
+    
+    mResourceLoaders.push_back(std::unique_ptr<ImageSurfaceLoader>(mImageSurfaceLoader));
+    mResourceLoaders.push_back(std::unique_ptr<DataFileLoader>(mDataFileLoader));
+    mResourceLoaders.push_back(std::unique_ptr<ShaderLoader>(mShaderLoader));
+    mResourceLoaders.push_back(std::unique_ptr<OBJMeshLoader>(mOBJMeshLoader));
+    mResourceLoaders.push_back(std::unique_ptr<CookedTextureLoader>(mCookedTextureLoader));
+    mResourceLoaders.push_back(std::unique_ptr<MeshLoader>(mMeshLoader));
+    mResourceLoaders.push_back(std::unique_ptr<TextureLoader>(mTextureLoader));
     
     // Map resource extensions to loaders
-    mResourceExtensionsToLoadersMap[StringId("png")]  = mResourceLoaders[0].get();
-    mResourceExtensionsToLoadersMap[StringId("json")] = mResourceLoaders[1].get();
-    mResourceExtensionsToLoadersMap[StringId("dat")]  = mResourceLoaders[1].get();
-    mResourceExtensionsToLoadersMap[StringId("fnt")]  = mResourceLoaders[1].get();
-    mResourceExtensionsToLoadersMap[StringId("txt")]  = mResourceLoaders[1].get();
-    mResourceExtensionsToLoadersMap[StringId("lua")]  = mResourceLoaders[1].get();
-    mResourceExtensionsToLoadersMap[StringId("xml")]  = mResourceLoaders[1].get();
-    mResourceExtensionsToLoadersMap[StringId("vs")]   = mResourceLoaders[2].get();
-    mResourceExtensionsToLoadersMap[StringId("fs")]   = mResourceLoaders[2].get();
-    mResourceExtensionsToLoadersMap[StringId("obj")]  = mResourceLoaders[3].get();
+    mResourceExtensionsToLoadersMap[StringId("png")]  = mImageSurfaceLoader;
+    mResourceExtensionsToLoadersMap[StringId("json")] = mDataFileLoader;
+    mResourceExtensionsToLoadersMap[StringId("dat")]  = mDataFileLoader;
+    mResourceExtensionsToLoadersMap[StringId("fnt")]  = mDataFileLoader;
+    mResourceExtensionsToLoadersMap[StringId("txt")]  = mDataFileLoader;
+    mResourceExtensionsToLoadersMap[StringId("lua")]  = mDataFileLoader;
+    mResourceExtensionsToLoadersMap[StringId("xml")]  = mDataFileLoader;
+    mResourceExtensionsToLoadersMap[StringId("vs")]   = mShaderLoader;
+    mResourceExtensionsToLoadersMap[StringId("fs")]   = mShaderLoader;
+    mResourceExtensionsToLoadersMap[StringId("obj")]  = mOBJMeshLoader;
     
     for (auto& resourceLoader: mResourceLoaders)
     {
         resourceLoader->VInitialize();
     }
     
+#if defined(USE_TEXTURE_ATLASES)
+    if (!CoreSystemsEngine::IsHeadless())
+    {
+        LoadTextureAtlases();
+    }
+#endif
+    
     mInitialized = true;
     mAsyncLoaderWorker = std::make_unique<AsyncLoaderWorker>();
     mAsyncLoaderWorker->StartWorker();
@@ -195,20 +252,23 @@ void ResourceLoadingService::Initialize()
 
 void ResourceLoadingService::Update()
 {
-    while (mAsyncLoaderWorker->mResults.size())
+    PROFILE_SCOPE("ResourceLoadingService::Update");
+    mAsyncLoaderWorker->mResults.Drain([&](JobResult& finishedJob)
     {
-        auto finishedJob = mAsyncLoaderWorker->mResults.dequeue();
-        mResourceMap[finishedJob.mTargetResourceId] = finishedJob.mResource;
+        mResourceMap[finishedJob.mTargetResourceId] = std::move(finishedJob.mResource);
         
-        if (dynamic_cast<const ImageSurfaceLoader*>(finishedJob.mLoader) && !IsNavmapImage(finishedJob.mResourcePath))
+        if (auto* uploadLoader = GetUploadLoader(finishedJob.mLoader); uploadLoader && !IsNavmapImage(finishedJob.mResourcePath))
         {
-            mResourceMap[finishedJob.mTargetResourceId] = mResourceLoaders.back()->VCreateAndLoadResource(finishedJob.mResourcePath);
+            mResourceMap[finishedJob.mTargetResourceId] = uploadLoader->VCreateAndLoadResource(finishedJob.mResourcePath);
         }
         
         mResourceIdToPaths[finishedJob.mTargetResourceId] = finishedJob.mResourcePath;
         mOutandingAsyncResourceIdsCurrentlyLoading.erase(finishedJob.mTargetResourceId);
         mOutstandingLoadingJobCount--;
-    }
+        
+        // Slots are reused, so don't keep the resource alive from the ring buffer
+        finishedJob = JobResult();
+    });
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -271,7 +331,7 @@ ResourceId ResourceLoadingService::AddDynamicallyCreatedTextureResourceId(const
     if (!mResourceMap.count(resourceId))
     {
         mResourceIdToPaths[resourceId] = resourceName;
-        mResourceMap[resourceId] = std::unique_ptr<TextureResource>(new TextureResource(width, height, 0, 0, textureId));
+        mResourceMap[resourceId] = std::unique_ptr<TextureResource>(new TextureResource(width, height, 0, 0, textureId, static_cast<size_t>(width) * height * 4));
         mDynamicallyCreatedTextureResourceIds.insert(resourceId);
     }
     return resourceId;
@@ -282,8 +342,68 @@ ResourceId ResourceLoadingService::AddDynamicallyCreatedTextureResourceId(const
 bool ResourceLoadingService::DoesResourceExist(const std::string& resourcePath, const ResourceLoadingPathType resourceLoadingPathType /* = ResourceLoadingPathType::RELATIVE */) const
 {
     const auto adjustedPath = AdjustResourcePath(resourcePath, resourceLoadingPathType);
-    std::fstream resourceFileCheck(resourcePath);
-    return resourceFileCheck.operator bool();
+    return mVirtualFileSystem->DoesFileExist(resourceLoadingPathType == ResourceLoadingPathType::RELATIVE ? RES_ROOT + adjustedPath : adjustedPath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+const VirtualFileSystem& ResourceLoadingService::GetVirtualFileSystem() const
+{
+    return *mVirtualFileSystem;
+}
+
+///------------------------------------------------------------------------------------------------
+
+DecodedImageCache::Statistics ResourceLoadingService::GetDecodedImageCacheStatistics() const
+{
+    const auto* decodedImageCache = mImageSurfaceLoader->GetDecodedImageCache();
+    return decodedImageCache ? decodedImageCache->GetStatistics() : DecodedImageCache::Statistics();
+}
+
+///------------------------------------------------------------------------------------------------
+
+const TextureAtlasEntry* ResourceLoadingService::GetTextureAtlasEntry(const ResourceId textureResourceId) const
+{
+    auto atlasEntryIter = mTextureAtlasEntries.find(textureResourceId);
+    return atlasEntryIter != mTextureAtlasEntries.cend() ? &atlasEntryIter->second : nullptr;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const TextureAtlasEntry* ResourceLoadingService::GetTextureAtlasEntry(const std::string& texturePath) const
+{
+    return GetTextureAtlasEntry(strutils::GetStringHash(AdjustResourcePath(texturePath, ResourceLoadingPathType::RELATIVE)));
+}
+
+///------------------------------------------------------------------------------------------------
+
+const TextureResource& ResourceLoadingService::GetStandaloneTexture(const ResourceId textureResourceId)
+{
+    auto& texture = GetResource<TextureResource>(textureResourceId);
+    if (texture.GetGLTextureId() != 0 || CoreSystemsEngine::IsHeadless() || !GetTextureAtlasEntry(textureResourceId))
+    {
+        return texture;
+    }
+    
+    const auto resourcePathIter = mResourceIdToPaths.find(textureResourceId);
+    if (resourcePathIter == mResourceIdToPaths.cend())
+    {
+        return texture;
+    }
+    
+    auto imageSurfaceResource = mImageSurfaceLoader->VCreateAndLoadResource(RES_ROOT + resourcePathIter->second);
+    if (!imageSurfaceResource)
+    {
+        return texture;
+    }
+    
+    auto* surface = static_cast<ImageSurfaceResource&>(*imageSurfaceResource).GetSurface();
+    GLuint glTextureId = 0; int mode = surface->format->BytesPerPixel == 4 ? GL_RGBA : GL_RGB;
+    rendering::CreateGLTextureFromSurface(surface, glTextureId, mode, true);
+    texture.AttachStandaloneGLTexture(glTextureId, static_cast<size_t>(surface->w) * surface->h * surface->format->BytesPerPixel);
+    
+    logging::Log(logging::LogType::INFO, "Uploaded atlased texture %s standalone (sampled outside of its atlas page)", resourcePathIter->second.c_str());
+    return texture;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -316,7 +436,7 @@ void ResourceLoadingService::UnloadResource(const std::string& resourcePath, con
 
 void ResourceLoadingService::UnloadResource(const ResourceId resourceId)
 {
-    logging::Log(logging::LogType::INFO, "Unloading asset: %s", std::to_string(resourceId).c_str());
+    logging::Log(logging::LogCategory::RESOURCES, logging::LogType::INFO, "Unloading asset: %s", std::to_string(resourceId).c_str());
     mResourceMap.erase(resourceId);
 }
 
@@ -394,6 +514,8 @@ void ResourceLoadingService::AddArtificialLoadingJobCount(const int artificialLo
 
 void ResourceLoadingService::LoadResourceInternal(const std::string& resourcePath, const ResourceId resourceId, const ResourceLoadingPathType resourceLoadingPathType)
 {
+    PROFILE_SCOPE("ResourceLoadingService::LoadResource");
+    
     // Get resource extension
     const auto resourceFileExtension = fileutils::GetFileExtension(resourcePath);
     const auto resourceFileName = fileutils::GetFileName(resourcePath);
@@ -405,15 +527,24 @@ void ResourceLoadingService::LoadResourceInternal(const std::string& resourcePat
     {
         auto* selectedLoader = mResourceExtensionsToLoadersMap.at(strutils::StringId(fileutils::GetFileExtension(resourcePath)));
         
+        // Prefer the offline cooked (mipmapped, GPU compressed) version of images the driver can sample
+        if (dynamic_cast<ImageSurfaceLoader*>(selectedLoader) && !IsNavmapImage(resourceFileName))
+        {
+            if (!mCookedTextureLoader->GetCookedTexturePath(resourceLoadingPathType == ResourceLoadingPathType::RELATIVE ? RES_ROOT + resourcePath : resourcePath).empty())
+            {
+                selectedLoader = mCookedTextureLoader;
+            }
+        }
+        
         if (mAsyncLoading && selectedLoader->VCanLoadAsync() && !mOutandingAsyncResourceIdsCurrentlyLoading.count(resourceId))
         {
             if (resourceLoadingPathType == ResourceLoadingPathType::RELATIVE)
             {
-                mAsyncLoaderWorker->mJobs.enqueue(LoadingJob(selectedLoader, RES_ROOT + resourcePath, resourceId));
+                mAsyncLoaderWorker->mJobs.Push(LoadingJob{selectedLoader, RES_ROOT + resourcePath, resourceId});
             }
             else
             {
-                mAsyncLoaderWorker->mJobs.enqueue(LoadingJob(selectedLoader, resourcePath, resourceId));
+                mAsyncLoaderWorker->mJobs.Push(LoadingJob{selectedLoader, resourcePath, resourceId});
             }
             
             mOutstandingLoadingJobCount++;
@@ -424,23 +555,23 @@ void ResourceLoadingService::LoadResourceInternal(const std::string& resourcePat
             auto loadedResource = resourceLoadingPathType == ResourceLoadingPathType::RELATIVE ? selectedLoader->VCreateAndLoadResource(RES_ROOT + resourcePath) : selectedLoader->VCreateAndLoadResource(resourcePath);
             mResourceMap[resourceId] = std::move(loadedResource);
             
-            // Images are loaded in 2 steps so that we can separate the file I/O and GL part
+            // Images and meshes are loaded in 2 steps so that we can separate the file I/O and GL part
             // for async loading
-            if (dynamic_cast<ImageSurfaceLoader*>(selectedLoader) && !IsNavmapImage(resourceFileName))
+            if (auto* uploadLoader = GetUploadLoader(selectedLoader); uploadLoader && !IsNavmapImage(resourceFileName))
             {
                 if (resourceLoadingPathType == ResourceLoadingPathType::RELATIVE)
                 {
-                    loadedResource = mResourceLoaders.back()->VCreateAndLoadResource(RES_ROOT + resourcePath);
+                    loadedResource = uploadLoader->VCreateAndLoadResource(RES_ROOT + resourcePath);
                 }
                 else
                 {
-                    loadedResource = mResourceLoaders.back()->VCreateAndLoadResource(resourcePath);
+                    loadedResource = uploadLoader->VCreateAndLoadResource(resourcePath);
                 }
                 
                 mResourceMap[resourceId] = std::move(loadedResource);
             }
             
-            logging::Log(logging::LogType::INFO, "Finished loading asset: %s in %s", resourcePath.c_str(), std::to_string(resourceId).c_str());
+            logging::Log(logging::LogCategory::RESOURCES, logging::LogType::INFO, "Finished loading asset: %s in %s", resourcePath.c_str(), std::to_string(resourceId).c_str());
             mResourceIdToPaths[resourceId] = resourcePath;
         }
     }
@@ -452,6 +583,89 @@ void ResourceLoadingService::LoadResourceInternal(const std::string& resourcePat
 
 ///------------------------------------------------------------------------------------------------
 
+void ResourceLoadingService::LoadTextureAtlases()
+{
+    const auto atlasDefinitionsPath = RES_DATA_ROOT + TEXTURE_ATLAS_DEFINITIONS_FILE_NAME;
+    if (!mVirtualFileSystem->DoesFileExist(atlasDefinitionsPath))
+    {
+        return;
+    }
+    
+    auto atlasDefinitionsResource = mDataFileLoader->VCreateAndLoadResource(atlasDefinitionsPath);
+    const auto atlasDefinitionsJson = nlohmann::json::parse(static_cast<DataFileResource&>(*atlasDefinitionsResource).GetContents());
+    
+    for (const auto& atlasJson: atlasDefinitionsJson["atlases"])
+    {
+        const auto atlasName = atlasJson["name"].get<std::string>();
+        rendering::TextureAtlasBuilder atlasBuilder(atlasJson["page_size"].get<int>(), atlasJson["padding"].get<int>());
+        
+        std::vector<unsigned char> rgbaPixels;
+        for (const auto& texturePathJson: atlasJson["textures"])
+        {
+            const auto texturePath = AdjustResourcePath(texturePathJson.get<std::string>(), ResourceLoadingPathType::RELATIVE);
+            auto imageSurfaceResource = mImageSurfaceLoader->VCreateAndLoadResource(RES_ROOT + texturePath);
+            if (!imageSurfaceResource)
+            {
+                continue;
+            }
+            
+            // Surfaces come out of the image loader already in the RGB(A) byte order textures are uploaded with
+            auto* surface = static_cast<ImageSurfaceResource&>(*imageSurfaceResource).GetSurface();
+            const auto bytesPerPixel = surface->format->BytesPerPixel;
+            if (bytesPerPixel != 3 && bytesPerPixel != 4)
+            {
+                logging::Log(logging::LogType::WARNING, "Skipping texture %s from atlas %s (unsupported channel profile)", texturePath.c_str(), atlasName.c_str());
+                continue;
+            }
+            
+            rgbaPixels.resize(static_cast<size_t>(surface->w) * surface->h * 4);
+            for (int y = 0; y < surface->h; ++y)
+            {
+                const auto* sourceRow = static_cast<const unsigned char*>(surface->pixels) + static_cast<size_t>(y) * surface->pitch;
+                for (int x = 0; x < surface->w; ++x)
+                {
+                    auto* targetTexel = &rgbaPixels[(static_cast<size_t>(y) * surface->w + x) * 4];
+                    targetTexel[0] = sourceRow[x * bytesPerPixel + 0];
+                    targetTexel[1] = sourceRow[x * bytesPerPixel + 1];
+                    targetTexel[2] = sourceRow[x * bytesPerPixel + 2];
+                    targetTexel[3] = bytesPerPixel == 4 ? sourceRow[x * bytesPerPixel + 3] : 255;
+                }
+            }
+            
+            if (!atlasBuilder.AddImage(texturePath, rgbaPixels.data(), surface->w, surface->h))
+            {
+                logging::Log(logging::LogType::WARNING, "Skipping texture %s from atlas %s (does not fit in a page)", texturePath.c_str(), atlasName.c_str());
+            }
+        }
+        
+        atlasBuilder.Build();
+        
+        const auto pageSize = atlasBuilder.GetPageSize();
+        std::vector<ResourceId> pageResourceIds;
+        for (size_t i = 0; i < atlasBuilder.GetPages().size(); ++i)
+        {
+            const auto pagePath = AdjustResourcePath(RES_ATLASES_ROOT + atlasName + "_" + std::to_string(i) + ".png", ResourceLoadingPathType::RELATIVE);
+            const auto pageResourceId = strutils::GetStringHash(pagePath);
+            
+            GLuint glTextureId;
+            rendering::CreateGLTextureFromRGBAPixels(atlasBuilder.GetPages()[i].data(), pageSize, pageSize, glTextureId, true);
+            
+            mResourceMap[pageResourceId] = std::shared_ptr<IResource>(new TextureResource(pageSize, pageSize, GL_RGBA, GL_RGBA, glTextureId, static_cast<size_t>(pageSize) * pageSize * 4));
+            mResourceIdToPaths[pageResourceId] = pagePath;
+            pageResourceIds.push_back(pageResourceId);
+        }
+        
+        for (const auto& [texturePath, region]: atlasBuilder.GetManifest())
+        {
+            mTextureAtlasEntries[strutils::GetStringHash(texturePath)] = { pageResourceIds[region.mPageIndex], region.mUVRect };
+        }
+        
+        logging::Log(logging::LogType::INFO, "Built texture atlas %s: %d textures in %d %dx%d pages (%.1f%% packing efficiency)", atlasName.c_str(), static_cast<int>(atlasBuilder.GetManifest().size()), static_cast<int>(pageResourceIds.size()), pageSize, pageSize, atlasBuilder.GetPackingEfficiency() * 100.0f);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
 std::string ResourceLoadingService::AdjustResourcePath(const std::string& resourcePath, const ResourceLoadingPathType resourceLoadingPathType) const
 {
     if (resourceLoadingPathType == ResourceLoadingPathType::ABSOLUTE)
@@ -471,6 +685,23 @@ bool ResourceLoadingService::IsNavmapImage(const std::string& fileName) const
 
 ///------------------------------------------------------------------------------------------------
 
+IResourceLoader* ResourceLoadingService::GetUploadLoader(const IResourceLoader* loader) const
+{
+    if (dynamic_cast<const ImageSurfaceLoader*>(loader) || dynamic_cast<const CookedTextureLoader*>(loader))
+    {
+        return mTextureLoader;
+    }
+    
+    if (dynamic_cast<const OBJMeshLoader*>(loader))
+    {
+        return mMeshLoader;
+    }
+    
+    return nullptr;
+}
+
+///------------------------------------------------------------------------------------------------
+
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -11,6 +11,8 @@
 ///------------------------------------------------------------------------------------------------
 
 #include <engine/CoreSystemsEngine.h>
+#include <engine/resloading/DecodedImageCache.h>
+#include <engine/utils/MathUtils.h>
 #include <engine/utils/StringUtils.h>
 #include <memory>
 #include <string>        
@@ -26,8 +28,17 @@ namespace resources
 ///------------------------------------------------------------------------------------------------
 
 using ResourceId = size_t;
+class CookedTextureLoader;
+class DataFileLoader;
+class ImageSurfaceLoader;
 class IResource;
 class IResourceLoader;
+class MeshLoader;
+class OBJMeshLoader;
+class ShaderLoader;
+class TextureLoader;
+class TextureResource;
+class VirtualFileSystem;
 
 ///------------------------------------------------------------------------------------------------
 
@@ -55,6 +66,14 @@ enum class ResourceLoadingPathType
     ABSOLUTE
 };
 
+///------------------------------------------------------------------------------------------------
+/// Where a texture has been packed in a texture atlas page.
+struct TextureAtlasEntry
+{
+    ResourceId mAtlasPageTextureResourceId;
+    glm::vec4 mUVRect; // min u, min v, u extent, v extent (i.e. atlasUv = mUVRect.xy + localUv * mUVRect.zw)
+};
+
 ///------------------------------------------------------------------------------------------------
 /// A service class aimed at providing resource loading, simple file IO, etc.
 class ResourceLoadingService final
@@ -131,9 +150,45 @@ public:
     /// paths excluding the Resource Root are supported.
     /// @param[in] resourcePath the path of the resource file.
     /// @param[in] resourceLoadingPathType whether or not the resource path is relative (to the local assets folder) or absolute
-    /// @returns whether or not a physical file exists in the specified path.
+    /// @returns whether or not a file exists in the specified path (either packed in the mounted asset archive, or on disk).
     bool DoesResourceExist(const std::string& resourcePath, const ResourceLoadingPathType resourceLoadingPathType = ResourceLoadingPathType::RELATIVE) const;
     
+    /// Gets the virtual file system all asset reads go through (mounted archive first, loose files otherwise).
+    ///
+    /// @returns the virtual file system used by the resource loaders.
+    const VirtualFileSystem& GetVirtualFileSystem() const;
+    
+    /// Gets the hit/miss counts and the decode time saved so far by the decoded image cache.
+    ///
+    /// @returns the decoded image cache statistics (zeroed if the cache is disabled).
+    DecodedImageCache::Statistics GetDecodedImageCacheStatistics() const;
+    
+    /// Gets the atlas page (and the UV rect within it) a texture has been packed in at initialization.
+    ///
+    /// The texture's resource is still loadable as before (for its dimensions), but it has no standalone
+    /// GL texture behind it. The atlas entry is what renderers bind, sharing texture binds between draws
+    /// (see GetStandaloneTexture for draws that can't sample atlas pages).
+    /// @param[in] textureResourceId the resource id of the original texture.
+    /// @returns a pointer to the atlas entry of the texture, or nullptr if the texture is not part of any atlas.
+    const TextureAtlasEntry* GetTextureAtlasEntry(const ResourceId textureResourceId) const;
+    
+    /// Gets the atlas page (and the UV rect within it) a texture has been packed in at initialization.
+    ///
+    /// Both full paths, relative paths including the Resource Root, and relative
+    /// paths excluding the Resource Root are supported.
+    /// @param[in] texturePath the path of the original texture.
+    /// @returns a pointer to the atlas entry of the texture, or nullptr if the texture is not part of any atlas.
+    const TextureAtlasEntry* GetTextureAtlasEntry(const std::string& texturePath) const;
+    
+    /// Gets a texture to be sampled on its own, rather than through the atlas page it may have been packed in.
+    ///
+    /// Atlased textures get no standalone GL texture at load time. The first time one of them is needed
+    /// on its own (drawn with a shader that does not sample atlas pages, or bound to an effect texture slot)
+    /// it is uploaded standalone, and kept from then on.
+    /// @param[in] textureResourceId the resource id of the texture.
+    /// @returns a reference to the texture resource, with a GL texture behind it (outside of headless runs).
+    const TextureResource& GetStandaloneTexture(const ResourceId textureResourceId);
+    
     /// Checks whether a resource has been loaded based on a resourceId (to check when async loading is enabled).
     ///
     /// @param[in] resourceId the resourceId to check.
@@ -186,7 +241,7 @@ public:
     template<class ResourceType>
     inline ResourceType& GetResource(const std::string& resourcePath, const ResourceLoadingPathType resourceLoadingPathType = ResourceLoadingPathType::RELATIVE)
     {
-        return static_cast<ResourceType&>(GetResource(resourcePath));
+        return static_cast<ResourceType&>(GetResource(resourcePath, resourceLoadingPathType));
     }
 
     /// Gets the concrete type of the resource based on a given resource id.
@@ -224,9 +279,16 @@ private:
     // Strips the leading RES_ROOT from the resourcePath given, if present
     std::string AdjustResourcePath(const std::string& resourcePath, const ResourceLoadingPathType resourceLoadingPathType) const;
     
+    // Packs the textures listed in the atlas definitions data file into atlas pages and uploads them.
+    void LoadTextureAtlases();
+    
     // Returns whether the file name implies a navmap image that doesn't need to be GL Texture-Loaded.
     bool IsNavmapImage(const std::string& fileName) const;
     
+    // Returns the loader that uploads the CPU side step produced by the given loader (TextureLoader for images,
+    // MeshLoader for meshes), or nullptr if the given loader's resources are complete in a single step.
+    IResourceLoader* GetUploadLoader(const IResourceLoader* loader) const;
+    
 private:
     class AsyncLoaderWorker;
     
@@ -235,10 +297,19 @@ private:
     std::unordered_map<strutils::StringId, IResourceLoader*, strutils::StringIdHasher> mResourceExtensionsToLoadersMap;
     std::unordered_map<ResourceId, std::string, ResourceIdHasher> mResourceIdMapToAutoReload;
     std::unordered_map<ResourceId, std::string, ResourceIdHasher> mResourceIdToPaths;
+    std::unordered_map<ResourceId, TextureAtlasEntry, ResourceIdHasher> mTextureAtlasEntries;
     std::unordered_set<ResourceId, ResourceIdHasher> mDynamicallyCreatedTextureResourceIds;
     std::unordered_set<ResourceId> mOutandingAsyncResourceIdsCurrentlyLoading;
     std::vector<std::unique_ptr<IResourceLoader>> mResourceLoaders;
-    std::unique_ptr<AsyncLoaderWorker> mAsyncLoaderWorker;
+    ImageSurfaceLoader* mImageSurfaceLoader = nullptr;
+    DataFileLoader* mDataFileLoader = nullptr;
+    ShaderLoader* mShaderLoader = nullptr;
+    OBJMeshLoader* mOBJMeshLoader = nullptr;
+    CookedTextureLoader* mCookedTextureLoader = nullptr;
+    MeshLoader* mMeshLoader = nullptr;
+    TextureLoader* mTextureLoader = nullptr;
+    std::unique_ptr<VirtualFileSystem> mVirtualFileSystem;
+    std::unique_ptr<AsyncLoaderWorker> mAsyncLoaderWorker; // after the loaders & file system, so that it is stopped before they go away
     std::atomic<int> mOutstandingLoadingJobCount = 0;
     bool mInitialized = false;
     bool mAsyncLoading = false;
@@ -5,15 +5,16 @@
 ///  Created by Alex Koukoulas on 20/09/2023.
 ///------------------------------------------------------------------------------------------------
 
+#include <engine/CoreSystemsEngine.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/resloading/ShaderResource.h>
 #include <engine/resloading/ShaderLoader.h>
 #include <engine/resloading/ResourceLoadingService.h>
+#include <engine/resloading/VirtualFileSystem.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/OSMessageBox.h>
 #include <engine/utils/StringUtils.h>
-#include <fstream>  
-#include <streambuf>
+#include <sstream>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -35,8 +36,20 @@ static void ExtractUniformFromLine(const std::string& line, const std::string& s
 
 ///------------------------------------------------------------------------------------------------
 
+ShaderLoader::ShaderLoader(const VirtualFileSystem& virtualFileSystem)
+    : mVirtualFileSystem(virtualFileSystem)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
 void ShaderLoader::VInitialize()
 {
+    if (CoreSystemsEngine::IsHeadless())
+    {
+        return;
+    }
+    
     mGlslVersion = reinterpret_cast<const char*>(GL_NO_CHECK_CALL(glGetString(GL_SHADING_LANGUAGE_VERSION)));
     strutils::StringReplaceAllOccurences("\\.", "", mGlslVersion);
 }
@@ -56,6 +69,12 @@ std::shared_ptr<IResource> ShaderLoader::VCreateAndLoadResource(const std::strin
     // being added by the ResourceLoadingService prior to this call
     const auto resourcePath = resourcePathWithExtension.substr(0, resourcePathWithExtension.size() - 3);
     
+    // Nothing to compile without a GL context, an empty shader has no uniforms to set
+    if (CoreSystemsEngine::IsHeadless())
+    {
+        return std::make_shared<ShaderResource>();
+    }
+    
     // Generate vertex shader id
     const auto vertexShaderId = GL_NO_CHECK_CALL(glCreateShader(GL_VERTEX_SHADER));
     
@@ -148,24 +167,15 @@ std::shared_ptr<IResource> ShaderLoader::VCreateAndLoadResource(const std::strin
 
 std::string ShaderLoader::ReadFileContents(const std::string& filePath) const
 {
-    std::ifstream file(filePath);
+    const auto fileContents = mVirtualFileSystem.ReadFile(filePath);
     
-    if (!file.good())
+    if (!fileContents.IsValid())
     {
         ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "File could not be found", filePath.c_str());
         return "";
     }
     
-    std::string contents;
-    
-    file.seekg(0, std::ios::end);
-    contents.reserve(static_cast<size_t>(file.tellg()));
-    file.seekg(0, std::ios::beg);
-    
-    contents.assign((std::istreambuf_iterator<char>(file)),
-                    std::istreambuf_iterator<char>());
-    
-    return contents;
+    return fileContents.ToString();
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -187,6 +197,9 @@ void ShaderLoader::PrependPreprocessorVars(std::string& shaderSource) const
     std::string platform = "#define MAC\n";
     std::string version = "#version " + mGlslVersion + " core\n";
 #endif
+#else //LINUX
+    std::string platform = "#define LINUX\n";
+    std::string version = "#version " + mGlslVersion + " core\n";
 #endif
     
     shaderSource = version + platform + shaderSource;
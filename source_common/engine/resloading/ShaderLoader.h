@@ -24,6 +24,10 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+class VirtualFileSystem;
+
+///------------------------------------------------------------------------------------------------
+
 using GLuint = unsigned int;
 
 ///------------------------------------------------------------------------------------------------
@@ -42,7 +46,7 @@ private:
     static const std::string FRAGMENT_SHADER_FILE_EXTENSION;
     static const std::string GEOMETRY_SHADER_FILE_EXTENSION;
     
-    ShaderLoader() = default;
+    ShaderLoader(const VirtualFileSystem& virtualFileSystem);
     
     std::string ReadFileContents(const std::string& filePath) const;
     void PrependPreprocessorVars(std::string& shaderSource) const;
@@ -60,6 +64,7 @@ private:
     void DumpFinalShaderContents(const std::string& vertexShaderContents, const std::string& fragmentShaderContents, const std::string& resourcePath) const;
     
 private:
+    const VirtualFileSystem& mVirtualFileSystem;
     std::string mGlslVersion;
 };
 
@@ -6,6 +6,7 @@
 ///------------------------------------------------------------------------------------------------
 
 #include <engine/resloading/ShaderResource.h>
+#include <engine/rendering/CommonUniforms.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/utils/Logging.h>
 
@@ -210,6 +211,20 @@ bool ShaderResource::SetBool(const strutils::StringId& uniformName, const bool v
 
 ///------------------------------------------------------------------------------------------------
 
+void ShaderResource::SetCameraMatrices(const glm::mat4& viewMatrix, const glm::mat4& projMatrix, const uint64_t cameraVersion) const
+{
+    if (cameraVersion == mUploadedCameraVersion)
+    {
+        return;
+    }
+    
+    SetMatrix4fv(VIEW_MATRIX_UNIFORM_NAME, viewMatrix);
+    SetMatrix4fv(PROJ_MATRIX_UNIFORM_NAME, projMatrix);
+    mUploadedCameraVersion = cameraVersion;
+}
+
+///------------------------------------------------------------------------------------------------
+
 GLuint ShaderResource::GetProgramId() const
 {
     return mProgramId;
@@ -236,6 +251,7 @@ void ShaderResource::CopyConstruction(const ShaderResource& rhs)
     mProgramId = rhs.GetProgramId();
     mShaderUniformNamesToLocations = rhs.GetUniformNamesToLocations();
     mUniformSamplerNamesInOrder = rhs.GetUniformSamplerNames();
+    mUploadedCameraVersion = 0;
 }
 
 ///------------------------------------------------------------------------------------------------
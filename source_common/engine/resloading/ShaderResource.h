@@ -10,6 +10,7 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include <cstdint>
 #include <engine/resloading/IResource.h>
 #include <engine/utils/MathUtils.h>
 #include <engine/utils/StringUtils.h>
@@ -53,6 +54,11 @@ public:
     bool SetFloatArray(const strutils::StringId& uniformName, const std::vector<float>& values) const;
     bool SetInt(const strutils::StringId& uniformName, const int value) const;
     bool SetBool(const strutils::StringId& uniformName, const bool value) const;
+    
+    ///-----------------------------------------------------------------------------------------------
+    /// Uploads the view & projection matrices of the camera with the given version (\see rendering::Camera::GetVersion),
+    /// unless that camera version's matrices were the last ones uploaded to this shader.
+    void SetCameraMatrices(const glm::mat4& viewMatrix, const glm::mat4& projMatrix, const uint64_t cameraVersion) const;
 
     GLuint GetProgramId() const;    
 
@@ -66,6 +72,7 @@ private:
     std::vector<strutils::StringId> mUniformSamplerNamesInOrder;
     std::unordered_map<strutils::StringId, int, strutils::StringIdHasher> mUniformArrayElementCounts;
     GLuint mProgramId;    
+    mutable uint64_t mUploadedCameraVersion = 0;
 };
 
 ///------------------------------------------------------------------------------------------------
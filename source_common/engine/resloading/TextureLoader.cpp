@@ -9,6 +9,7 @@
 #include <engine/CoreSystemsEngine.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/rendering/RenderingUtils.h>
+#include <engine/resloading/CookedTextureResource.h>
 #include <engine/resloading/ImageSurfaceResource.h>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/resloading/TextureLoader.h>
@@ -47,18 +48,49 @@ bool TextureLoader::VCanLoadAsync() const
 
 std::shared_ptr<IResource> TextureLoader::VCreateAndLoadResource(const std::string& resourcePath) const
 {
-    auto& surfaceResource = CoreSystemsEngine::GetInstance().GetResourceLoadingService().GetResource<ImageSurfaceResource>(resourcePath);
+    auto& resourceLoadingService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+    
+    // Textures packed in an atlas page are only ever sampled through that page, so they keep
+    // their dimensions but get no standalone GL texture (and take up no texture memory) of their own
+    const auto isAtlased = resourceLoadingService.GetTextureAtlasEntry(resourcePath) != nullptr;
+    
+    // Offline cooked textures come with their mip chain, already GPU compressed
+    if (auto* cookedTextureResource = dynamic_cast<CookedTextureResource*>(&resourceLoadingService.GetResource<IResource>(resourcePath)))
+    {
+        const auto& cookedTexture = cookedTextureResource->GetCookedTexture();
+        
+        GLuint glTextureId = 0;
+        if (!isAtlased)
+        {
+            rendering::CreateGLTextureFromCookedTexture(cookedTexture, glTextureId, cookedTexture.mNNFiltering);
+        }
+        
+        const auto textureWidth = cookedTexture.mMipLevels.front().mWidth;
+        const auto textureHeight = cookedTexture.mMipLevels.front().mHeight;
+        const auto textureMemoryBytes = isAtlased ? 0 : rendering::GetCookedTextureMemoryBytes(cookedTexture);
+        
+        resourceLoadingService.UnloadResource(resourcePath);
+        
+        return std::shared_ptr<IResource>(new TextureResource(textureWidth, textureHeight, GL_RGBA, GL_RGBA, glTextureId, textureMemoryBytes));
+    }
+    
+    auto& surfaceResource = resourceLoadingService.GetResource<ImageSurfaceResource>(resourcePath);
     auto* sdlSurface = surfaceResource.GetSurface();
     
-    GLuint glTextureId; int mode;
-    rendering::CreateGLTextureFromSurface(sdlSurface, glTextureId, mode, true);
+    // Headless textures keep their dimensions (for layout/font metrics), but have no GL texture behind them
+    GLuint glTextureId = 0; int mode = sdlSurface->format->BytesPerPixel == 4 ? GL_RGBA : GL_RGB;
+    if (!CoreSystemsEngine::IsHeadless() && !isAtlased)
+    {
+        rendering::CreateGLTextureFromSurface(sdlSurface, glTextureId, mode, true);
+    }
     
     const auto surfaceWidth = sdlSurface->w;
     const auto surfaceHeight = sdlSurface->h;
+    const auto textureMemoryBytes = isAtlased ? 0 : static_cast<size_t>(surfaceWidth) * surfaceHeight * sdlSurface->format->BytesPerPixel;
     
-    CoreSystemsEngine::GetInstance().GetResourceLoadingService().UnloadResource(resourcePath);
+    resourceLoadingService.UnloadResource(resourcePath);
     
-    return std::shared_ptr<IResource>(new TextureResource(surfaceWidth, surfaceHeight, mode, mode, glTextureId));
+    return std::shared_ptr<IResource>(new TextureResource(surfaceWidth, surfaceHeight, mode, mode, glTextureId, textureMemoryBytes));
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -17,9 +17,18 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+static size_t sTotalTextureMemoryBytes = 0;
+
+///------------------------------------------------------------------------------------------------
+
 TextureResource::~TextureResource()
 {
-    GL_CALL(glDeleteTextures(1, &mGLTextureId));
+    // Headless textures have no GL texture behind them
+    if (mGLTextureId != 0)
+    {
+        GL_CALL(glDeleteTextures(1, &mGLTextureId));
+    }
+    sTotalTextureMemoryBytes -= mMemoryBytes;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -38,19 +47,46 @@ glm::vec2 TextureResource::GetDimensions() const
 
 ///------------------------------------------------------------------------------------------------
 
+size_t TextureResource::GetMemoryBytes() const
+{
+    return mMemoryBytes;
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t TextureResource::GetTotalTextureMemoryBytes()
+{
+    return sTotalTextureMemoryBytes;
+}
+
+///------------------------------------------------------------------------------------------------
+
 TextureResource::TextureResource
 (
     const int width,
     const int height,
     const int mode,
     const int format,
-    GLuint glTextureId
+    GLuint glTextureId,
+    const size_t memoryBytes
 )
     : mDimensions(width, height)
     , mMode(mode)
     , mFormat(format)
     , mGLTextureId(glTextureId)
+    , mMemoryBytes(memoryBytes)
+{
+    sTotalTextureMemoryBytes += mMemoryBytes;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TextureResource::AttachStandaloneGLTexture(const GLuint glTextureId, const size_t memoryBytes)
 {
+    sTotalTextureMemoryBytes -= mMemoryBytes;
+    mGLTextureId = glTextureId;
+    mMemoryBytes = memoryBytes;
+    sTotalTextureMemoryBytes += mMemoryBytes;
 }
 
 ///------------------------------------------------------------------------------------------------
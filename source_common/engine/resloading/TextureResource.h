@@ -37,6 +37,10 @@ public:
     
     GLuint GetGLTextureId() const;
     glm::vec2 GetDimensions() const;
+    size_t GetMemoryBytes() const;
+    
+    /// @returns the (estimated) GPU memory taken up by all currently loaded textures.
+    static size_t GetTotalTextureMemoryBytes();
     
 private:
     TextureResource
@@ -45,14 +49,19 @@ private:
         const int height,
         const int mode,
         const int format,
-        GLuint glTextureId
+        GLuint glTextureId,
+        const size_t memoryBytes
     );
     
+    // Gives an atlased texture (loaded without a GL texture of its own) a standalone one
+    void AttachStandaloneGLTexture(const GLuint glTextureId, const size_t memoryBytes);
+    
 private:
     glm::vec2 mDimensions;
     int mMode;
     int mFormat;
     GLuint mGLTextureId;
+    size_t mMemoryBytes;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -0,0 +1,129 @@
+///------------------------------------------------------------------------------------------------
+///  VirtualFileSystem.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <engine/resloading/VirtualFileSystem.h>
+#include <engine/utils/StringUtils.h>
+#include <filesystem>
+#include <fstream>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+
+const std::string VirtualFileSystem::ASSET_ARCHIVE_FILE_NAME = "assets.tmaa";
+
+///------------------------------------------------------------------------------------------------
+
+bool VirtualFileSystem::MountArchive(const std::string& archivePath, const std::string& resourceRoot)
+{
+    mResourceRoot = resourceRoot;
+    return mArchive.Open(archivePath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void VirtualFileSystem::UnmountArchive()
+{
+    mArchive.Close();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool VirtualFileSystem::IsArchiveMounted() const
+{
+    return mArchive.IsOpen();
+}
+
+///------------------------------------------------------------------------------------------------
+
+const AssetArchive& VirtualFileSystem::GetMountedArchive() const
+{
+    return mArchive;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool VirtualFileSystem::IsFileArchived(const std::string& filePath) const
+{
+    if (!mArchive.IsOpen())
+    {
+        return false;
+    }
+
+    const auto archiveRelativePath = GetArchiveRelativePath(filePath);
+    return !archiveRelativePath.empty() && mArchive.HasEntry(archiveRelativePath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool VirtualFileSystem::DoesFileExist(const std::string& filePath) const
+{
+    if (IsFileArchived(filePath))
+    {
+        return true;
+    }
+
+    std::error_code errorCode;
+    return std::filesystem::is_regular_file(filePath, errorCode);
+}
+
+///------------------------------------------------------------------------------------------------
+
+FileContents VirtualFileSystem::ReadFile(const std::string& filePath) const
+{
+    FileContents fileContents;
+
+    if (mArchive.IsOpen())
+    {
+        const auto archiveRelativePath = GetArchiveRelativePath(filePath);
+        if (!archiveRelativePath.empty())
+        {
+            fileContents.mArchivedData = mArchive.GetEntryData(archiveRelativePath, fileContents.mArchivedSize);
+            if (fileContents.mArchivedData)
+            {
+                fileContents.mValid = true;
+                return fileContents;
+            }
+        }
+    }
+
+    // Loose file fallback
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.good())
+    {
+        return fileContents;
+    }
+
+    const auto fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+    fileContents.mLooseFileContents.resize(static_cast<size_t>(fileSize));
+    file.read(fileContents.mLooseFileContents.data(), fileSize);
+    fileContents.mValid = true;
+
+    return fileContents;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string VirtualFileSystem::GetArchiveRelativePath(const std::string& filePath) const
+{
+    if (!strutils::StringStartsWith(filePath, mResourceRoot))
+    {
+        return "";
+    }
+
+    return filePath.substr(mResourceRoot.size());
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,101 @@
+///------------------------------------------------------------------------------------------------
+///  VirtualFileSystem.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef VirtualFileSystem_h
+#define VirtualFileSystem_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <engine/resloading/AssetArchive.h>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace resources
+{
+
+///------------------------------------------------------------------------------------------------
+/// Contents of a file read through the VirtualFileSystem. Archived files point straight
+/// into the archive mapping (no copy), loose files own their bytes.
+class FileContents final
+{
+    friend class VirtualFileSystem;
+
+public:
+    bool IsValid() const { return mValid; }
+    bool IsArchived() const { return mArchivedData != nullptr; }
+    const char* GetData() const { return mArchivedData ? mArchivedData : mLooseFileContents.data(); }
+    size_t GetSize() const { return mArchivedData ? mArchivedSize : mLooseFileContents.size(); }
+    std::string ToString() const { return std::string(GetData(), GetSize()); }
+
+private:
+    const char* mArchivedData = nullptr;
+    size_t mArchivedSize = 0;
+    std::string mLooseFileContents;
+    bool mValid = false;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Resolves asset file reads against a mounted packed archive first, and falls back
+/// to loose files on disk (development flow, or files missing from the archive).
+class VirtualFileSystem final
+{
+public:
+    static const std::string ASSET_ARCHIVE_FILE_NAME;
+
+public:
+    VirtualFileSystem() = default;
+    VirtualFileSystem(const VirtualFileSystem&) = delete;
+    VirtualFileSystem(VirtualFileSystem&&) = delete;
+    const VirtualFileSystem& operator = (const VirtualFileSystem&) = delete;
+    VirtualFileSystem& operator = (VirtualFileSystem&&) = delete;
+
+    /// Mounts a packed asset archive. Paths given to the rest of the API that start with
+    /// the resource root are looked up in the archive relative to it.
+    /// @param[in] archivePath the path of the archive file.
+    /// @param[in] resourceRoot the root under which the archive entries live (e.g. RES_ROOT).
+    /// @returns whether the archive was successfully mounted.
+    bool MountArchive(const std::string& archivePath, const std::string& resourceRoot);
+
+    /// Unmounts the currently mounted archive (if any).
+    void UnmountArchive();
+
+    /// @returns whether an archive is currently mounted.
+    bool IsArchiveMounted() const;
+
+    /// @returns the currently mounted archive.
+    const AssetArchive& GetMountedArchive() const;
+
+    /// @param[in] filePath the path of the file (including the resource root for relative assets).
+    /// @returns whether the file is served from the mounted archive.
+    bool IsFileArchived(const std::string& filePath) const;
+
+    /// @param[in] filePath the path of the file (including the resource root for relative assets).
+    /// @returns whether the file exists either in the mounted archive or on disk.
+    bool DoesFileExist(const std::string& filePath) const;
+
+    /// Reads the contents of a file, preferring the mounted archive.
+    /// @param[in] filePath the path of the file (including the resource root for relative assets).
+    /// @returns the file contents (check IsValid() for failure).
+    FileContents ReadFile(const std::string& filePath) const;
+
+private:
+    // Returns the archive entry path for the given file path, or an empty string if the path is outside the resource root
+    std::string GetArchiveRelativePath(const std::string& filePath) const;
+
+private:
+    AssetArchive mArchive;
+    std::string mResourceRoot;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* VirtualFileSystem_h */
@@ -175,7 +175,7 @@ void Scene::RecalculatePositionOfEdgeSnappingSceneObject(std::shared_ptr<SceneOb
 
 void Scene::RecalculatePositionOfEdgeSnappingSceneObjects()
 {
-    const auto& frustum = mCamera.CalculateFrustum();
+    const auto& frustum = mCamera.GetFrustum();
     
     for (auto& sceneObject: mSceneObjects)
     {
@@ -327,7 +327,7 @@ bool Scene::HasLoadedPredefinedObjects() const { return mHasLoadedPredefinedObje
 
 ///------------------------------------------------------------------------------------------------
 
-void Scene::SetLoaded(const bool loaded) { mLoaded = loaded;  if (mLoaded) SDL_RaiseWindow(&CoreSystemsEngine::GetInstance().GetContextWindow()); }
+void Scene::SetLoaded(const bool loaded) { mLoaded = loaded;  if (mLoaded && !CoreSystemsEngine::IsHeadless()) SDL_RaiseWindow(&CoreSystemsEngine::GetInstance().GetContextWindow()); }
 
 ///------------------------------------------------------------------------------------------------
 
@@ -5,10 +5,12 @@
 ///  Created by Alex Koukoulas on 03/10/2023                                                       
 ///------------------------------------------------------------------------------------------------
 
+#include <cassert>
 #include <engine/rendering/AnimationManager.h>
 #include <engine/resloading/DataFileResource.h>
 #include <engine/scene/Scene.h>
 #include <engine/scene/SceneManager.h>
+#include <engine/scene/SceneObjectUtils.h>
 #include <engine/utils/BaseDataFileDeserializer.h>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -227,8 +229,8 @@ void SceneManager::SortSceneObjects(std::shared_ptr<Scene> scene)
     auto& sceneObjects = scene->GetSceneObjects();
     std::sort(sceneObjects.begin(), sceneObjects.end(), [&](const std::shared_ptr<scene::SceneObject>& lhs, const std::shared_ptr<scene::SceneObject>& rhs)
     {
-        const float lz = lhs->mPosition.z;
-        const float rz = rhs->mPosition.z;
+        const float lz = scene_object_utils::GetWorldPosition(*lhs).z;
+        const float rz = scene_object_utils::GetWorldPosition(*rhs).z;
 
         if (std::isnan(lz)) return false;
         if (std::isnan(rz)) return true;
@@ -285,6 +287,91 @@ const std::vector<std::shared_ptr<Scene>>& SceneManager::GetScenes() const { ret
 
 ///------------------------------------------------------------------------------------------------
 
+void SceneManager::CaptureInterpolationStates()
+{
+    assert(!mInterpolatedStatesApplied);
+    
+    mCameraInterpolationStates.clear();
+    for (auto& scene: mScenes)
+    {
+        for (auto& sceneObject: scene->GetSceneObjects())
+        {
+            sceneObject->mPreviousPosition = sceneObject->mPosition;
+        }
+        
+        mCameraInterpolationStates.push_back({ scene, scene->GetCamera().GetPosition(), scene->GetCamera().GetPosition() });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void SceneManager::ApplyInterpolatedStates(const float alpha)
+{
+    assert(!mInterpolatedStatesApplied);
+    mInterpolatedStatesApplied = true;
+    
+    mSimulatedObjectPositions.clear();
+    for (auto& scene: mScenes)
+    {
+        for (auto& sceneObject: scene->GetSceneObjects())
+        {
+            mSimulatedObjectPositions.push_back(sceneObject->mPosition);
+            // Objects that didn't move keep their exact position (and hence their cached matrices)
+            if (sceneObject->mPreviousPosition && *sceneObject->mPreviousPosition != sceneObject->mPosition)
+            {
+                sceneObject->mPosition = glm::mix(*sceneObject->mPreviousPosition, sceneObject->mPosition, alpha);
+            }
+        }
+    }
+    
+    // Scenes removed since the capture are dropped here too
+    for (auto iter = mCameraInterpolationStates.begin(); iter != mCameraInterpolationStates.end();)
+    {
+        if (std::find(mScenes.begin(), mScenes.end(), iter->mScene) == mScenes.end())
+        {
+            iter = mCameraInterpolationStates.erase(iter);
+            continue;
+        }
+        
+        auto& camera = iter->mScene->GetCamera();
+        iter->mSimulatedPosition = camera.GetPosition();
+        if (iter->mSimulatedPosition != iter->mPreviousPosition)
+        {
+            camera.SetPosition(glm::mix(iter->mPreviousPosition, iter->mSimulatedPosition, alpha));
+        }
+        ++iter;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void SceneManager::RestoreSimulatedStates()
+{
+    assert(mInterpolatedStatesApplied);
+    mInterpolatedStatesApplied = false;
+    
+    size_t objectIndex = 0;
+    for (auto& scene: mScenes)
+    {
+        for (auto& sceneObject: scene->GetSceneObjects())
+        {
+            sceneObject->mPosition = mSimulatedObjectPositions[objectIndex++];
+        }
+    }
+    assert(objectIndex == mSimulatedObjectPositions.size());
+    
+    for (auto& cameraInterpolationState: mCameraInterpolationStates)
+    {
+        auto& camera = cameraInterpolationState.mScene->GetCamera();
+        if (camera.GetPosition() != cameraInterpolationState.mSimulatedPosition)
+        {
+            camera.SetPosition(cameraInterpolationState.mSimulatedPosition);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
 void SceneManager::CollectTextureResourceIdCandidates(std::shared_ptr<Scene> sceneToRemove)
 {
     mTextureResourceCandidatesToRemove.clear();
@@ -10,6 +10,7 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include <engine/utils/MathUtils.h>
 #include <engine/utils/StringUtils.h>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <memory>
@@ -38,13 +39,36 @@ public:
     [[nodiscard]] std::size_t GetSceneCount() const;
     [[nodiscard]] const std::vector<std::shared_ptr<Scene>>& GetScenes() const;
     
+    ///-----------------------------------------------------------------------------------------------
+    /// Render interpolation across fixed simulation steps \see FixedTimestep.
+    /// To be called right before the last simulation step of a frame, so as to record the state it starts from.
+    void CaptureInterpolationStates();
+    
+    ///-----------------------------------------------------------------------------------------------
+    /// Temporarily moves scene objects & cameras (for rendering) to the given point between their captured
+    /// and current simulated states. Objects created after the capture are left at their simulated position.
+    /// Every call needs to be matched by a RestoreSimulatedStates() call, before any further simulation.
+    /// @param[in] alpha the interpolation factor (0: captured state, 1: current simulated state)
+    void ApplyInterpolatedStates(const float alpha);
+    void RestoreSimulatedStates();
+    
 private:
     void CollectTextureResourceIdCandidates(std::shared_ptr<Scene> sceneToRemove);
     void UnloadUnusedTextures();
     
 private:
+    struct CameraInterpolationState
+    {
+        std::shared_ptr<Scene> mScene;
+        glm::vec3 mPreviousPosition;
+        glm::vec3 mSimulatedPosition;
+    };
+    
     std::vector<std::shared_ptr<Scene>> mScenes;
     std::unordered_set<resources::ResourceId> mTextureResourceCandidatesToRemove;
+    std::vector<CameraInterpolationState> mCameraInterpolationStates;
+    std::vector<glm::vec3> mSimulatedObjectPositions;
+    bool mInterpolatedStatesApplied = false;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -15,7 +15,9 @@
 #include <engine/utils/MathUtils.h>
 #include <engine/utils/StringUtils.h>
 #include <functional>
+#include <memory>
 #include <game/GameConstants.h>
+#include <optional>
 #include <unordered_map>
 #include <variant>
 
@@ -100,6 +102,29 @@ enum class SnapToEdgeBehavior
 
 inline constexpr int EFFECT_TEXTURES_COUNT = 3;
 
+///------------------------------------------------------------------------------------------------
+/// Matrices derived from a scene object's position/rotation/scale (composed with its parent's, if any).
+/// Only recomputed when either of those changed since they were last computed \see scene_object_utils::GetWorldMatrix.
+struct SceneObject;
+struct SceneObjectTransformCache
+{
+    glm::mat4 mLocalMatrix = glm::mat4(1.0f);
+    glm::mat4 mLocalRotationMatrix = glm::mat4(1.0f);
+    glm::mat4 mWorldMatrix = glm::mat4(1.0f);
+    glm::mat4 mWorldRotationMatrix = glm::mat4(1.0f);
+    glm::vec3 mWorldScale = glm::vec3(1.0f);
+    
+    // The local transform & parent the above were computed from
+    glm::vec3 mPosition = glm::vec3(0.0f);
+    glm::vec3 mRotation = glm::vec3(0.0f);
+    glm::vec3 mScale = glm::vec3(0.0f);
+    const SceneObject* mParent = nullptr;
+    uint32_t mParentWorldVersion = 0;
+    
+    uint32_t mWorldVersion = 0; // Bumped on every world matrix change, so that children can tell theirs is stale
+    bool mValid = false;
+};
+
 ///------------------------------------------------------------------------------------------------
 
 class Scene;
@@ -122,9 +147,12 @@ struct SceneObject
     std::unordered_map<strutils::StringId, int, strutils::StringIdHasher> mShaderIntUniformValues;
     std::unordered_map<strutils::StringId, bool, strutils::StringIdHasher> mShaderBoolUniformValues;
     glm::vec3 mPosition = glm::vec3(0.0f, 0.0f, 0.0f);
+    std::optional<glm::vec3> mPreviousPosition; // Position before the last simulation step (if it existed by then), for render interpolation
     glm::vec3 mRotation = glm::vec3(0.0f, 0.0f, 0.0f);
     glm::vec3 mScale = glm::vec3(1.0f, 1.0f, 1.0f);
     glm::vec3 mBoundingRectMultiplier = glm::vec3(1.0f, 1.0f, 1.0f);
+    std::weak_ptr<SceneObject> mParent; // Optional. When set, position/rotation/scale above are relative to the parent's
+    mutable SceneObjectTransformCache mTransformCache;
     resources::ResourceId mMeshResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_MESHES_ROOT + game_constants::DEFAULT_MESH_NAME);
     resources::ResourceId mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + game_constants::DEFAULT_TEXTURE_NAME);
     resources::ResourceId mShaderResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_SHADERS_ROOT + game_constants::DEFAULT_SHADER_NAME);
@@ -18,12 +18,100 @@ namespace scene_object_utils
 
 ///------------------------------------------------------------------------------------------------
 
+static void UpdateTransformCache(const scene::SceneObject& sceneObject)
+{
+    auto& transformCache = sceneObject.mTransformCache;
+    auto parent = sceneObject.mParent.lock();
+    
+    if (parent)
+    {
+        // Parents first, so that their world version is current
+        UpdateTransformCache(*parent);
+    }
+    
+    const bool localTransformChanged = !transformCache.mValid || transformCache.mPosition != sceneObject.mPosition || transformCache.mRotation != sceneObject.mRotation || transformCache.mScale != sceneObject.mScale;
+    const bool parentChanged = transformCache.mParent != parent.get() || (parent && transformCache.mParentWorldVersion != parent->mTransformCache.mWorldVersion);
+    
+    if (localTransformChanged)
+    {
+        transformCache.mLocalRotationMatrix = glm::mat4(1.0f);
+        transformCache.mLocalRotationMatrix = glm::rotate(transformCache.mLocalRotationMatrix, sceneObject.mRotation.x, math::X_AXIS);
+        transformCache.mLocalRotationMatrix = glm::rotate(transformCache.mLocalRotationMatrix, sceneObject.mRotation.y, math::Y_AXIS);
+        transformCache.mLocalRotationMatrix = glm::rotate(transformCache.mLocalRotationMatrix, sceneObject.mRotation.z, math::Z_AXIS);
+        
+        transformCache.mLocalMatrix = glm::translate(glm::mat4(1.0f), sceneObject.mPosition) * transformCache.mLocalRotationMatrix;
+        transformCache.mLocalMatrix = glm::scale(transformCache.mLocalMatrix, sceneObject.mScale);
+        
+        transformCache.mPosition = sceneObject.mPosition;
+        transformCache.mRotation = sceneObject.mRotation;
+        transformCache.mScale = sceneObject.mScale;
+        transformCache.mValid = true;
+    }
+    
+    if (localTransformChanged || parentChanged)
+    {
+        if (parent)
+        {
+            const auto& parentTransformCache = parent->mTransformCache;
+            transformCache.mWorldMatrix = parentTransformCache.mWorldMatrix * transformCache.mLocalMatrix;
+            transformCache.mWorldRotationMatrix = parentTransformCache.mWorldRotationMatrix * transformCache.mLocalRotationMatrix;
+            transformCache.mWorldScale = parentTransformCache.mWorldScale * sceneObject.mScale;
+            transformCache.mParentWorldVersion = parentTransformCache.mWorldVersion;
+        }
+        else
+        {
+            transformCache.mWorldMatrix = transformCache.mLocalMatrix;
+            transformCache.mWorldRotationMatrix = transformCache.mLocalRotationMatrix;
+            transformCache.mWorldScale = sceneObject.mScale;
+        }
+        
+        transformCache.mParent = parent.get();
+        transformCache.mWorldVersion++;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+const glm::mat4& GetWorldMatrix(const scene::SceneObject& sceneObject)
+{
+    UpdateTransformCache(sceneObject);
+    return sceneObject.mTransformCache.mWorldMatrix;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const glm::mat4& GetWorldRotationMatrix(const scene::SceneObject& sceneObject)
+{
+    UpdateTransformCache(sceneObject);
+    return sceneObject.mTransformCache.mWorldRotationMatrix;
+}
+
+///------------------------------------------------------------------------------------------------
+
+glm::vec3 GetWorldPosition(const scene::SceneObject& sceneObject)
+{
+    return glm::vec3(GetWorldMatrix(sceneObject)[3]);
+}
+
+///------------------------------------------------------------------------------------------------
+
+const glm::vec3& GetWorldScale(const scene::SceneObject& sceneObject)
+{
+    UpdateTransformCache(sceneObject);
+    return sceneObject.mTransformCache.mWorldScale;
+}
+
+///------------------------------------------------------------------------------------------------
+
 math::Rectangle GetSceneObjectBoundingRect(const scene::SceneObject& sceneObject)
 {
     math::Rectangle boundingRect;
     boundingRect.bottomLeft = glm::vec2(0.0f);
     boundingRect.topRight = glm::vec2(0.0f);
     
+    const auto position = GetWorldPosition(sceneObject);
+    const auto& scale = GetWorldScale(sceneObject);
+    
     if (std::holds_alternative<scene::TextSceneObjectData>(sceneObject.mSceneObjectTypeData))
     {
         const auto& textData = std::get<scene::TextSceneObjectData>(sceneObject.mSceneObjectTypeData);
@@ -32,8 +120,8 @@ math::Rectangle GetSceneObjectBoundingRect(const scene::SceneObject& sceneObject
         
         const auto& font = fontOpt->get();
         
-        float xCursor = sceneObject.mPosition.x;
-        float yCursor = sceneObject.mPosition.y;
+        float xCursor = position.x;
+        float yCursor = position.y;
         
         float minX = xCursor;
         float minY = yCursor;
@@ -45,24 +133,24 @@ math::Rectangle GetSceneObjectBoundingRect(const scene::SceneObject& sceneObject
         {
             const auto& glyph = stringFontGlyphs[i];
             
-            yCursor = sceneObject.mPosition.y - glyph.mHeightPixels * sceneObject.mScale.y;
+            yCursor = position.y - glyph.mHeightPixels * scale.y;
             
-            float targetX = xCursor + glyph.mXOffsetPixels * sceneObject.mScale.x;
-            float targetY = yCursor - glyph.mYOffsetPixels * sceneObject.mScale.y;
+            float targetX = xCursor + glyph.mXOffsetPixels * scale.x;
+            float targetY = yCursor - glyph.mYOffsetPixels * scale.y;
             
-            if (targetX + glyph.mWidthPixels * sceneObject.mScale.x/2 > maxX) maxX = targetX + glyph.mWidthPixels * sceneObject.mScale.x/2;
-            if (targetX - glyph.mWidthPixels * sceneObject.mScale.x/2 < minX) minX = targetX - glyph.mWidthPixels * sceneObject.mScale.x/2;
-            if (targetY + glyph.mHeightPixels * sceneObject.mScale.y/2 > maxY) maxY = targetY + glyph.mHeightPixels * sceneObject.mScale.y/2;
-            if (targetY - glyph.mHeightPixels * sceneObject.mScale.y/2 < minY) minY = targetY - glyph.mHeightPixels * sceneObject.mScale.y/2;
+            if (targetX + glyph.mWidthPixels * scale.x/2 > maxX) maxX = targetX + glyph.mWidthPixels * scale.x/2;
+            if (targetX - glyph.mWidthPixels * scale.x/2 < minX) minX = targetX - glyph.mWidthPixels * scale.x/2;
+            if (targetY + glyph.mHeightPixels * scale.y/2 > maxY) maxY = targetY + glyph.mHeightPixels * scale.y/2;
+            if (targetY - glyph.mHeightPixels * scale.y/2 < minY) minY = targetY - glyph.mHeightPixels * scale.y/2;
             
             if (i != stringFontGlyphs.size() - 1)
             {
-                xCursor += glyph.mAdvancePixels * sceneObject.mScale.x;
+                xCursor += glyph.mAdvancePixels * scale.x;
                 
-                if (targetX + glyph.mWidthPixels * sceneObject.mScale.x/2 > maxX) maxX = targetX + glyph.mWidthPixels * sceneObject.mScale.x/2;
-                if (targetX - glyph.mWidthPixels * sceneObject.mScale.x/2 < minX) minX = targetX - glyph.mWidthPixels * sceneObject.mScale.x/2;
-                if (targetY + glyph.mHeightPixels * sceneObject.mScale.y/2 > maxY) maxY = targetY + glyph.mHeightPixels * sceneObject.mScale.y/2;
-                if (targetY - glyph.mHeightPixels * sceneObject.mScale.y/2 < minY) minY = targetY - glyph.mHeightPixels * sceneObject.mScale.y/2;
+                if (targetX + glyph.mWidthPixels * scale.x/2 > maxX) maxX = targetX + glyph.mWidthPixels * scale.x/2;
+                if (targetX - glyph.mWidthPixels * scale.x/2 < minX) minX = targetX - glyph.mWidthPixels * scale.x/2;
+                if (targetY + glyph.mHeightPixels * scale.y/2 > maxY) maxY = targetY + glyph.mHeightPixels * scale.y/2;
+                if (targetY - glyph.mHeightPixels * scale.y/2 < minY) minY = targetY - glyph.mHeightPixels * scale.y/2;
             }
         }
         
@@ -78,8 +166,8 @@ math::Rectangle GetSceneObjectBoundingRect(const scene::SceneObject& sceneObject
     }
     else if (std::holds_alternative<scene::DefaultSceneObjectData>(sceneObject.mSceneObjectTypeData))
     {                                                                                                
-        boundingRect.bottomLeft = glm::vec2(sceneObject.mPosition.x - math::Abs((sceneObject.mScale.x * sceneObject.mBoundingRectMultiplier.x)/2), sceneObject.mPosition.y - math::Abs((sceneObject.mScale.y * sceneObject.mBoundingRectMultiplier.y)/2));
-        boundingRect.topRight = glm::vec2(sceneObject.mPosition.x + math::Abs((sceneObject.mScale.x * sceneObject.mBoundingRectMultiplier.x)/2), sceneObject.mPosition.y + math::Abs((sceneObject.mScale.y * sceneObject.mBoundingRectMultiplier.y)/2));
+        boundingRect.bottomLeft = glm::vec2(position.x - math::Abs((scale.x * sceneObject.mBoundingRectMultiplier.x)/2), position.y - math::Abs((scale.y * sceneObject.mBoundingRectMultiplier.y)/2));
+        boundingRect.topRight = glm::vec2(position.x + math::Abs((scale.x * sceneObject.mBoundingRectMultiplier.x)/2), position.y + math::Abs((scale.y * sceneObject.mBoundingRectMultiplier.y)/2));
     }
     
     return boundingRect;
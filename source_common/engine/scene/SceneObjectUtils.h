@@ -24,8 +24,26 @@ namespace scene_object_utils
 
 ///------------------------------------------------------------------------------------------------
 
+/// Bounding rect of the scene object in world space.
 math::Rectangle GetSceneObjectBoundingRect(const scene::SceneObject& sceneObject);
 
+///------------------------------------------------------------------------------------------------
+/// Returns the (cached) world matrix of the scene object, i.e. its position/rotation/scale composed with
+/// its parent's world matrix (if any). Recomputed only if the object's transform or its parent's world matrix changed.
+const glm::mat4& GetWorldMatrix(const scene::SceneObject& sceneObject);
+
+///------------------------------------------------------------------------------------------------
+/// Returns the (cached) rotation part of the world matrix.
+const glm::mat4& GetWorldRotationMatrix(const scene::SceneObject& sceneObject);
+
+///------------------------------------------------------------------------------------------------
+/// Returns the scene object's world position.
+glm::vec3 GetWorldPosition(const scene::SceneObject& sceneObject);
+
+///------------------------------------------------------------------------------------------------
+/// Returns the (cached) world scale of the scene object (exact as long as no ancestor is rotated).
+const glm::vec3& GetWorldScale(const scene::SceneObject& sceneObject);
+
 ///------------------------------------------------------------------------------------------------
 
 }
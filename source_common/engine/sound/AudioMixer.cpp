@@ -0,0 +1,785 @@
+///------------------------------------------------------------------------------------------------
+///  AudioMixer.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <engine/sound/AudioMixer.h>
+#include <engine/utils/Logging.h>
+#include <fstream>
+#include <SDL.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace sound
+{
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr size_t MUSIC_STREAM_CHUNK_FRAMES = 4096;
+static constexpr int DEVICE_QUEUED_BLOCK_COUNT = 3; // ~32ms of latency at 48KHz
+static constexpr uint16_t WAV_FORMAT_PCM = 1;
+static constexpr uint16_t WAV_FORMAT_FLOAT = 3;
+static constexpr uint16_t WAV_FORMAT_EXTENSIBLE = 0xFFFE;
+
+///------------------------------------------------------------------------------------------------
+
+struct WavFormat
+{
+    std::streamoff mDataOffset = 0;
+    uint32_t mDataSize = 0;
+    int mChannelCount = 0;
+    int mSampleRate = 0;
+    int mBitsPerSample = 0;
+    bool mFloat = false;
+
+    int GetFrameBytes() const { return mChannelCount * mBitsPerSample/8; }
+};
+
+///------------------------------------------------------------------------------------------------
+
+static uint16_t ReadU16(const unsigned char* bytes)
+{
+    return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static uint32_t ReadU32(const unsigned char* bytes)
+{
+    return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) | (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+///------------------------------------------------------------------------------------------------
+/// Leaves the file at the start of the sample data.
+static bool ReadWavFormat(std::ifstream& file, WavFormat& format)
+{
+    unsigned char riffHeader[12];
+    if (!file.read(reinterpret_cast<char*>(riffHeader), sizeof(riffHeader)) || std::memcmp(riffHeader, "RIFF", 4) != 0 || std::memcmp(riffHeader + 8, "WAVE", 4) != 0)
+    {
+        return false;
+    }
+
+    bool foundFormat = false;
+    unsigned char chunkHeader[8];
+    while (file.read(reinterpret_cast<char*>(chunkHeader), sizeof(chunkHeader)))
+    {
+        const auto chunkSize = ReadU32(chunkHeader + 4);
+        if (std::memcmp(chunkHeader, "fmt ", 4) == 0)
+        {
+            std::vector<unsigned char> formatChunk(chunkSize);
+            if (chunkSize < 16 || !file.read(reinterpret_cast<char*>(formatChunk.data()), chunkSize))
+            {
+                return false;
+            }
+
+            auto formatTag = ReadU16(formatChunk.data());
+            if (formatTag == WAV_FORMAT_EXTENSIBLE && chunkSize >= 26)
+            {
+                // The actual format is at the start of the sub format GUID
+                formatTag = ReadU16(formatChunk.data() + 24);
+            }
+
+            format.mChannelCount = ReadU16(formatChunk.data() + 2);
+            format.mSampleRate = static_cast<int>(ReadU32(formatChunk.data() + 4));
+            format.mBitsPerSample = ReadU16(formatChunk.data() + 14);
+            format.mFloat = formatTag == WAV_FORMAT_FLOAT;
+
+            const auto supportedPCM = formatTag == WAV_FORMAT_PCM && (format.mBitsPerSample == 8 || format.mBitsPerSample == 16 || format.mBitsPerSample == 24 || format.mBitsPerSample == 32);
+            const auto supportedFloat = formatTag == WAV_FORMAT_FLOAT && format.mBitsPerSample == 32;
+            if ((!supportedPCM && !supportedFloat) || format.mChannelCount < 1 || format.mChannelCount > 2 || format.mSampleRate <= 0)
+            {
+                return false;
+            }
+
+            foundFormat = true;
+            file.seekg(chunkSize & 1, std::ios::cur);
+        }
+        else if (std::memcmp(chunkHeader, "data", 4) == 0)
+        {
+            format.mDataOffset = file.tellg();
+            format.mDataSize = chunkSize;
+            return foundFormat;
+        }
+        else
+        {
+            file.seekg(chunkSize + (chunkSize & 1), std::ios::cur);
+        }
+    }
+
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static float DecodeSample(const unsigned char* sample, const WavFormat& format)
+{
+    if (format.mFloat)
+    {
+        const auto bits = ReadU32(sample);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    switch (format.mBitsPerSample)
+    {
+        case 8: return (static_cast<int>(sample[0]) - 128)/128.0f;
+        case 16: return static_cast<int16_t>(ReadU16(sample))/32768.0f;
+        case 24: return static_cast<int32_t>((static_cast<uint32_t>(sample[0]) << 8) | (static_cast<uint32_t>(sample[1]) << 16) | (static_cast<uint32_t>(sample[2]) << 24))/2147483648.0f;
+        case 32: return static_cast<int32_t>(ReadU32(sample))/2147483648.0f;
+    }
+    return 0.0f;
+}
+
+///------------------------------------------------------------------------------------------------
+/// Appends the given frames as interleaved stereo floats (mono being duplicated to both channels).
+static void DecodeFrames(const unsigned char* data, const size_t frameCount, const WavFormat& format, std::vector<float>& stereoSamples)
+{
+    const auto sampleBytes = format.mBitsPerSample/8;
+    const auto frameBytes = format.GetFrameBytes();
+
+    stereoSamples.reserve(stereoSamples.size() + frameCount * AudioMixer::CHANNEL_COUNT);
+    for (size_t i = 0; i < frameCount; ++i)
+    {
+        const auto* frame = data + i * frameBytes;
+        const auto left = DecodeSample(frame, format);
+        const auto right = format.mChannelCount == 2 ? DecodeSample(frame + sampleBytes, format) : left;
+        stereoSamples.push_back(left);
+        stereoSamples.push_back(right);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// Linear interpolation between interleaved stereo frames.
+static void SampleStereoFrame(const float* stereoSamples, const size_t frameCount, const double position, const bool wrapAround, float& left, float& right)
+{
+    const auto index = static_cast<size_t>(position);
+    const auto nextIndex = index + 1 < frameCount ? index + 1 : (wrapAround ? 0 : index);
+    const auto fraction = static_cast<float>(position - static_cast<double>(index));
+
+    left = stereoSamples[index * 2] + (stereoSamples[nextIndex * 2] - stereoSamples[index * 2]) * fraction;
+    right = stereoSamples[index * 2 + 1] + (stereoSamples[nextIndex * 2 + 1] - stereoSamples[index * 2 + 1]) * fraction;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<float> ResampleToMixerRate(const std::vector<float>& stereoSamples, const int sampleRate)
+{
+    const auto sourceFrameCount = stereoSamples.size()/2;
+    if (sampleRate == AudioMixer::SAMPLE_RATE || sourceFrameCount == 0)
+    {
+        return stereoSamples;
+    }
+
+    const auto step = static_cast<double>(sampleRate)/AudioMixer::SAMPLE_RATE;
+    const auto targetFrameCount = static_cast<size_t>(sourceFrameCount/step);
+
+    std::vector<float> resampledSamples(targetFrameCount * 2);
+    for (size_t i = 0; i < targetFrameCount; ++i)
+    {
+        SampleStereoFrame(stereoSamples.data(), sourceFrameCount, i * step, false, resampledSamples[i * 2], resampledSamples[i * 2 + 1]);
+    }
+    return resampledSamples;
+}
+
+///------------------------------------------------------------------------------------------------
+/// Decodes a music file incrementally (a chunk at a time), resampling it on the fly.
+class AudioMixer::MusicStream
+{
+public:
+    static std::unique_ptr<MusicStream> Open(const std::string& filePath, const bool looped)
+    {
+        auto musicStream = std::unique_ptr<MusicStream>(new MusicStream());
+        musicStream->mFile.open(filePath, std::ios::binary);
+        if (!musicStream->mFile || !ReadWavFormat(musicStream->mFile, musicStream->mFormat) || musicStream->mFormat.mDataSize < static_cast<uint32_t>(musicStream->mFormat.GetFrameBytes()))
+        {
+            logging::Log(logging::LogCategory::SOUND, logging::LogType::WARNING, "Could not stream music %s (only WAV files are supported)", filePath.c_str());
+            return nullptr;
+        }
+
+        musicStream->mFilePath = filePath;
+        musicStream->mLooped = looped;
+        musicStream->mSourceStep = static_cast<double>(musicStream->mFormat.mSampleRate)/AudioMixer::SAMPLE_RATE;
+        return musicStream;
+    }
+
+    const std::string& GetFilePath() const { return mFilePath; }
+
+    /// @returns the number of frames read, fewer than requested only once an unlooped stream has ended.
+    int Read(float* interleavedOutput, const int frameCount)
+    {
+        int readFrameCount = 0;
+        for (; readFrameCount < frameCount; ++readFrameCount)
+        {
+            // The next source frame is needed too, to interpolate towards
+            const auto requiredFrameCount = static_cast<size_t>(mSourcePosition) + 2;
+            while (mSourceSamples.size()/2 < requiredFrameCount && ReadNextChunk());
+
+            const auto bufferedFrameCount = mSourceSamples.size()/2;
+            if (static_cast<size_t>(mSourcePosition) >= bufferedFrameCount)
+            {
+                break;
+            }
+
+            SampleStereoFrame(mSourceSamples.data(), bufferedFrameCount, mSourcePosition, false, interleavedOutput[readFrameCount * 2], interleavedOutput[readFrameCount * 2 + 1]);
+            mSourcePosition += mSourceStep;
+        }
+
+        // Drop the consumed source frames
+        const auto consumedFrameCount = std::min(static_cast<size_t>(mSourcePosition), mSourceSamples.size()/2);
+        mSourceSamples.erase(mSourceSamples.begin(), mSourceSamples.begin() + consumedFrameCount * 2);
+        mSourcePosition -= static_cast<double>(consumedFrameCount);
+
+        return readFrameCount;
+    }
+
+private:
+    MusicStream() = default;
+
+    bool ReadNextChunk()
+    {
+        const auto frameBytes = static_cast<uint32_t>(mFormat.GetFrameBytes());
+        if (mDataBytesRead + frameBytes > mFormat.mDataSize)
+        {
+            if (!mLooped)
+            {
+                return false;
+            }
+
+            mFile.clear();
+            mFile.seekg(mFormat.mDataOffset);
+            mDataBytesRead = 0;
+        }
+
+        const auto chunkBytes = std::min(static_cast<uint32_t>(MUSIC_STREAM_CHUNK_FRAMES) * frameBytes, (mFormat.mDataSize - mDataBytesRead)/frameBytes * frameBytes);
+        mReadBuffer.resize(chunkBytes);
+        mFile.read(reinterpret_cast<char*>(mReadBuffer.data()), chunkBytes);
+
+        const auto readFrameCount = static_cast<size_t>(mFile.gcount())/frameBytes;
+        if (readFrameCount == 0)
+        {
+            // Truncated file
+            mDataBytesRead = mFormat.mDataSize;
+            return false;
+        }
+
+        DecodeFrames(mReadBuffer.data(), readFrameCount, mFormat, mSourceSamples);
+        mDataBytesRead += static_cast<uint32_t>(readFrameCount) * frameBytes;
+        return true;
+    }
+
+private:
+    std::ifstream mFile;
+    std::string mFilePath;
+    WavFormat mFormat;
+    std::vector<unsigned char> mReadBuffer;
+    std::vector<float> mSourceSamples; // interleaved stereo, at the file's sample rate
+    double mSourcePosition = 0.0;
+    double mSourceStep = 1.0;
+    uint32_t mDataBytesRead = 0;
+    bool mLooped = false;
+};
+
+///------------------------------------------------------------------------------------------------
+
+AudioMixer::AudioMixer()
+    : mCommandQueue(COMMAND_QUEUE_CAPACITY)
+{
+    mVoices.reserve(MAX_VOICES);
+}
+
+///------------------------------------------------------------------------------------------------
+
+AudioMixer::~AudioMixer()
+{
+    StopDevice();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AudioMixer::StartDevice()
+{
+    if (mDeviceRunning)
+    {
+        return true;
+    }
+
+    if (SDL_WasInit(SDL_INIT_AUDIO) == 0)
+    {
+        if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0)
+        {
+            logging::Log(logging::LogCategory::SOUND, logging::LogType::WARNING, "Could not initialize SDL audio (%s), running without audio", SDL_GetError());
+            return false;
+        }
+        mInitializedAudioSubsystem = true;
+    }
+
+    SDL_AudioSpec desiredSpec = {};
+    desiredSpec.freq = SAMPLE_RATE;
+    desiredSpec.format = AUDIO_F32SYS;
+    desiredSpec.channels = CHANNEL_COUNT;
+    desiredSpec.samples = MIX_BLOCK_FRAMES;
+    desiredSpec.callback = nullptr; // pushed to via SDL_QueueAudio from the mixing thread
+
+    // No allowed changes, i.e. SDL converts to the device's actual format if need be
+    SDL_AudioSpec obtainedSpec = {};
+    mDeviceId = SDL_OpenAudioDevice(nullptr, 0, &desiredSpec, &obtainedSpec, 0);
+    if (mDeviceId == 0)
+    {
+        logging::Log(logging::LogCategory::SOUND, logging::LogType::WARNING, "Could not open an audio device (%s), running without audio", SDL_GetError());
+        if (mInitializedAudioSubsystem)
+        {
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            mInitializedAudioSubsystem = false;
+        }
+        return false;
+    }
+
+    logging::Log(logging::LogCategory::SOUND, logging::LogType::INFO, "Opened audio device (%s driver)", SDL_GetCurrentAudioDriver());
+
+    SDL_PauseAudioDevice(mDeviceId, 0);
+    mDeviceRunning = true;
+    mDeviceThread = std::thread([this](){ RunDeviceThread(); });
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::StopDevice()
+{
+    if (!mDeviceRunning)
+    {
+        return;
+    }
+
+    mDeviceRunning = false;
+    if (mDeviceThread.joinable())
+    {
+        mDeviceThread.join();
+    }
+
+    SDL_CloseAudioDevice(mDeviceId);
+    mDeviceId = 0;
+
+    if (mInitializedAudioSubsystem)
+    {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        mInitializedAudioSubsystem = false;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AudioMixer::IsDeviceRunning() const
+{
+    return mDeviceRunning;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::PreloadSfx(const std::string& sfxFilePath)
+{
+    PushCommand(CommandType::PRELOAD_SFX, sfxFilePath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::PlaySfx(const std::string& sfxFilePath, const bool looped, const float gain, const float pitch)
+{
+    PushCommand(CommandType::PLAY_SFX, sfxFilePath, gain, pitch, looped);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::PlayMusic(const std::string& musicFilePath, const bool looped)
+{
+    PushCommand(CommandType::PLAY_MUSIC, musicFilePath, 1.0f, 1.0f, looped);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::SetSfxPaused(const bool paused)
+{
+    PushCommand(CommandType::SET_SFX_PAUSED, std::string(), 1.0f, 1.0f, paused);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::SetMusicPaused(const bool paused)
+{
+    PushCommand(CommandType::SET_MUSIC_PAUSED, std::string(), 1.0f, 1.0f, paused);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::SetEnabled(const bool enabled)
+{
+    PushCommand(CommandType::SET_ENABLED, std::string(), 1.0f, 1.0f, enabled);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::MixBlock(float* interleavedOutput, const int frameCount)
+{
+    ProcessCommands();
+
+    std::fill(interleavedOutput, interleavedOutput + frameCount * CHANNEL_COUNT, 0.0f);
+    if (mEnabled)
+    {
+        if (!mSfxPaused)
+        {
+            MixVoices(interleavedOutput, frameCount);
+        }
+
+        if (!mMusicPaused)
+        {
+            MixMusic(interleavedOutput, frameCount);
+        }
+
+        for (int i = 0; i < frameCount * CHANNEL_COUNT; ++i)
+        {
+            interleavedOutput[i] = std::clamp(interleavedOutput[i], -1.0f, 1.0f);
+        }
+    }
+
+    mActiveVoiceCount = static_cast<int>(mVoices.size());
+    mMusicPlaying = mMusicStream != nullptr;
+    mMixedFrameCount += static_cast<uint64_t>(frameCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+int AudioMixer::GetActiveVoiceCount() const
+{
+    return mActiveVoiceCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+int AudioMixer::GetLoadedSfxCount() const
+{
+    return mLoadedSfxCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool AudioMixer::IsMusicPlaying() const
+{
+    return mMusicPlaying;
+}
+
+///------------------------------------------------------------------------------------------------
+
+uint64_t AudioMixer::GetMixedFrameCount() const
+{
+    return mMixedFrameCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+uint64_t AudioMixer::GetStolenVoiceCount() const
+{
+    return mStolenVoiceCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+uint64_t AudioMixer::GetDroppedCommandCount() const
+{
+    return mDroppedCommandCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::PushCommand(const CommandType type, const std::string& path, const float gain /* = 1.0f */, const float pitch /* = 1.0f */, const bool flag /* = false */)
+{
+    if (path.size() >= MAX_SOUND_PATH_LENGTH)
+    {
+        logging::Log(logging::LogCategory::SOUND, logging::LogType::WARNING, "Sound path %s too long, ignoring", path.c_str());
+        mDroppedCommandCount++;
+        return;
+    }
+
+    // Never wait on the mixing thread from the game thread
+    const auto pushed = mCommandQueue.TryPushInPlace([&](Command& command)
+    {
+        command.mType = type;
+        std::memcpy(command.mPath, path.c_str(), path.size() + 1);
+        command.mGain = gain;
+        command.mPitch = pitch;
+        command.mFlag = flag;
+    });
+
+    if (!pushed)
+    {
+        mDroppedCommandCount++;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::ProcessCommands()
+{
+    while (mCommandQueue.TryPopInPlace([&](const Command& command){ ProcessCommand(command); }));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::ProcessCommand(const Command& command)
+{
+    switch (command.mType)
+    {
+        case CommandType::PRELOAD_SFX:
+        {
+            GetOrLoadSfx(command.mPath);
+        } break;
+
+        case CommandType::PLAY_SFX:
+        {
+            if (!mEnabled)
+            {
+                break;
+            }
+
+            if (auto buffer = GetOrLoadSfx(command.mPath))
+            {
+                StartVoice(buffer, command.mFlag, command.mGain, command.mPitch);
+            }
+        } break;
+
+        case CommandType::PLAY_MUSIC:
+        {
+            if (!mEnabled)
+            {
+                break;
+            }
+
+            const auto& currentMusicStream = mNextMusicStream ? mNextMusicStream : mMusicStream;
+            if (currentMusicStream && currentMusicStream->GetFilePath() == command.mPath)
+            {
+                break;
+            }
+
+            auto musicStream = MusicStream::Open(command.mPath, command.mFlag);
+            if (!musicStream)
+            {
+                break;
+            }
+
+            // Fade out the current track first, if any
+            if (mMusicStream)
+            {
+                mNextMusicStream = std::move(musicStream);
+            }
+            else
+            {
+                mMusicStream = std::move(musicStream);
+                mMusicFadeGain = 0.0f;
+            }
+        } break;
+
+        case CommandType::SET_SFX_PAUSED:
+        {
+            mSfxPaused = command.mFlag;
+        } break;
+
+        case CommandType::SET_MUSIC_PAUSED:
+        {
+            mMusicPaused = command.mFlag;
+        } break;
+
+        case CommandType::SET_ENABLED:
+        {
+            mEnabled = command.mFlag;
+            if (!mEnabled)
+            {
+                mVoices.clear();
+                mMusicStream = nullptr;
+                mNextMusicStream = nullptr;
+            }
+        } break;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const AudioMixer::SoundBuffer> AudioMixer::GetOrLoadSfx(const std::string& sfxFilePath)
+{
+    auto findIter = mSfxCache.find(sfxFilePath);
+    if (findIter != mSfxCache.end())
+    {
+        return findIter->second;
+    }
+
+    std::ifstream file(sfxFilePath, std::ios::binary);
+    WavFormat format;
+    if (!file || !ReadWavFormat(file, format))
+    {
+        logging::Log(logging::LogCategory::SOUND, logging::LogType::WARNING, "Could not load sfx %s (only WAV files are supported)", sfxFilePath.c_str());
+
+        // Cached regardless, so that failed loads aren't retried on every play
+        mSfxCache[sfxFilePath] = nullptr;
+        return nullptr;
+    }
+
+    std::vector<unsigned char> data(format.mDataSize);
+    file.read(reinterpret_cast<char*>(data.data()), format.mDataSize);
+
+    std::vector<float> stereoSamples;
+    DecodeFrames(data.data(), static_cast<size_t>(file.gcount())/format.GetFrameBytes(), format, stereoSamples);
+
+    auto buffer = std::make_shared<SoundBuffer>();
+    buffer->mSamples = ResampleToMixerRate(stereoSamples, format.mSampleRate);
+    buffer->mFrameCount = buffer->mSamples.size()/CHANNEL_COUNT;
+
+    mSfxCache[sfxFilePath] = buffer;
+    mLoadedSfxCount++;
+    return buffer;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::StartVoice(std::shared_ptr<const SoundBuffer> buffer, const bool looped, const float gain, const float pitch)
+{
+    if (buffer->mFrameCount == 0 || pitch <= 0.0f)
+    {
+        return;
+    }
+
+    if (mVoices.size() == MAX_VOICES)
+    {
+        // Steal the oldest unlooped voice (looped ones are usually ambience that shouldn't cut out)
+        auto oldestVoiceIter = mVoices.end();
+        for (auto iter = mVoices.begin(); iter != mVoices.end(); ++iter)
+        {
+            if (!iter->mLooped && (oldestVoiceIter == mVoices.end() || iter->mStartOrder < oldestVoiceIter->mStartOrder))
+            {
+                oldestVoiceIter = iter;
+            }
+        }
+
+        if (oldestVoiceIter == mVoices.end())
+        {
+            return;
+        }
+
+        *oldestVoiceIter = mVoices.back();
+        mVoices.pop_back();
+        mStolenVoiceCount++;
+    }
+
+    Voice voice;
+    voice.mBuffer = std::move(buffer);
+    voice.mStartOrder = mNextVoiceStartOrder++;
+    voice.mGain = gain;
+    voice.mPitch = pitch;
+    voice.mLooped = looped;
+    mVoices.push_back(std::move(voice));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::MixVoices(float* interleavedOutput, const int frameCount)
+{
+    for (size_t voiceIndex = 0; voiceIndex < mVoices.size();)
+    {
+        auto& voice = mVoices[voiceIndex];
+        const auto* samples = voice.mBuffer->mSamples.data();
+        const auto bufferFrameCount = static_cast<double>(voice.mBuffer->mFrameCount);
+
+        bool finished = false;
+        for (int i = 0; i < frameCount; ++i)
+        {
+            if (voice.mPosition >= bufferFrameCount)
+            {
+                if (!voice.mLooped)
+                {
+                    finished = true;
+                    break;
+                }
+                voice.mPosition -= bufferFrameCount * static_cast<int>(voice.mPosition/bufferFrameCount);
+            }
+
+            float left, right;
+            SampleStereoFrame(samples, voice.mBuffer->mFrameCount, voice.mPosition, voice.mLooped, left, right);
+            interleavedOutput[i * 2] += left * voice.mGain;
+            interleavedOutput[i * 2 + 1] += right * voice.mGain;
+            voice.mPosition += voice.mPitch;
+        }
+
+        if (finished || (!voice.mLooped && voice.mPosition >= bufferFrameCount))
+        {
+            mVoices[voiceIndex] = std::move(mVoices.back());
+            mVoices.pop_back();
+            continue;
+        }
+
+        voiceIndex++;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::MixMusic(float* interleavedOutput, const int frameCount)
+{
+    const auto fadeStep = 1000.0f/(MUSIC_FADE_MILLIS * SAMPLE_RATE);
+    mMusicScratchBuffer.resize(static_cast<size_t>(frameCount) * CHANNEL_COUNT);
+
+    int mixedFrameCount = 0;
+    while (mMusicStream && mixedFrameCount < frameCount)
+    {
+        const auto requestedFrameCount = frameCount - mixedFrameCount;
+        const auto readFrameCount = mMusicStream->Read(mMusicScratchBuffer.data(), requestedFrameCount);
+
+        bool fadedOut = false;
+        int i = 0;
+        for (; i < readFrameCount && !fadedOut; ++i)
+        {
+            mMusicFadeGain = mNextMusicStream ? std::max(0.0f, mMusicFadeGain - fadeStep) : std::min(1.0f, mMusicFadeGain + fadeStep);
+            interleavedOutput[(mixedFrameCount + i) * 2] += mMusicScratchBuffer[i * 2] * mMusicFadeGain;
+            interleavedOutput[(mixedFrameCount + i) * 2 + 1] += mMusicScratchBuffer[i * 2 + 1] * mMusicFadeGain;
+            fadedOut = mNextMusicStream && mMusicFadeGain <= 0.0f;
+        }
+        mixedFrameCount += i;
+
+        // Either cross fade into the next track, or the current (unlooped) one has ended
+        if (fadedOut || readFrameCount < requestedFrameCount)
+        {
+            mMusicStream = std::move(mNextMusicStream);
+            mMusicFadeGain = 0.0f;
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void AudioMixer::RunDeviceThread()
+{
+    std::vector<float> block(static_cast<size_t>(MIX_BLOCK_FRAMES) * CHANNEL_COUNT);
+    const auto blockBytes = static_cast<Uint32>(block.size() * sizeof(float));
+
+    while (mDeviceRunning)
+    {
+        // Stay a few blocks ahead of the device, so that neither latency builds up nor the device starves
+        while (mDeviceRunning && SDL_GetQueuedAudioSize(mDeviceId) < DEVICE_QUEUED_BLOCK_COUNT * blockBytes)
+        {
+            MixBlock(block.data(), MIX_BLOCK_FRAMES);
+            SDL_QueueAudio(mDeviceId, block.data(), blockBytes);
+        }
+
+        // Picks up preloads etc. promptly even while the device is saturated
+        ProcessCommands();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,163 @@
+///------------------------------------------------------------------------------------------------
+///  AudioMixer.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef AudioMixer_h
+#define AudioMixer_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <engine/utils/MPSCRingBuffer.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace sound
+{
+
+///------------------------------------------------------------------------------------------------
+/// Portable software mixer, outputting through an SDL audio device. The game thread only ever queues
+/// (lock-free, never blocking) commands, whereas decoding (WAV: 8/16/24/32 bit PCM & 32 bit float),
+/// resampling, mixing and music streaming all happen on a dedicated mixing thread. Sfx are decoded
+/// whole and cached (preloaded via PreloadSfx, or on first play) and played on a limited number of
+/// voices, stealing the oldest unlooped one when all are busy. Music is streamed from disk, and cross
+/// faded when changed. Can be run against SDL's dummy audio driver (SDL_AUDIODRIVER=dummy), or be
+/// driven without a device altogether through MixBlock().
+class AudioMixer final
+{
+public:
+    static constexpr int SAMPLE_RATE = 48000;
+    static constexpr int CHANNEL_COUNT = 2;
+    static constexpr int MIX_BLOCK_FRAMES = 512;
+    static constexpr int MAX_VOICES = 32;
+    static constexpr size_t COMMAND_QUEUE_CAPACITY = 256;
+    static constexpr size_t MAX_SOUND_PATH_LENGTH = 256;
+    static constexpr float MUSIC_FADE_MILLIS = 500.0f;
+
+    AudioMixer();
+    ~AudioMixer();
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer(AudioMixer&&) = delete;
+    const AudioMixer& operator = (const AudioMixer&) = delete;
+    AudioMixer& operator = (AudioMixer&&) = delete;
+
+    /// Opens the (default) SDL audio device and starts the mixing thread.
+    /// @returns false if no audio device could be opened (in which case all requests are dropped).
+    bool StartDevice();
+    void StopDevice();
+    bool IsDeviceRunning() const;
+
+    /// Game thread requests, paths being full file paths.
+    void PreloadSfx(const std::string& sfxFilePath);
+    void PlaySfx(const std::string& sfxFilePath, const bool looped, const float gain, const float pitch);
+    void PlayMusic(const std::string& musicFilePath, const bool looped);
+    void SetSfxPaused(const bool paused);
+    void SetMusicPaused(const bool paused);
+    void SetEnabled(const bool enabled);
+
+    /// Mixing thread side. Applies all queued requests, and mixes the next frameCount (stereo) frames.
+    /// Only to be called directly when no device is running.
+    void MixBlock(float* interleavedOutput, const int frameCount);
+
+    /// Stats, safe to query from any thread.
+    int GetActiveVoiceCount() const;
+    int GetLoadedSfxCount() const;
+    bool IsMusicPlaying() const;
+    uint64_t GetMixedFrameCount() const;
+    uint64_t GetStolenVoiceCount() const;
+    uint64_t GetDroppedCommandCount() const;
+
+private:
+    struct SoundBuffer
+    {
+        std::vector<float> mSamples; // interleaved stereo, at SAMPLE_RATE
+        size_t mFrameCount = 0;
+    };
+
+    class MusicStream;
+
+    enum class CommandType
+    {
+        PRELOAD_SFX,
+        PLAY_SFX,
+        PLAY_MUSIC,
+        SET_SFX_PAUSED,
+        SET_MUSIC_PAUSED,
+        SET_ENABLED
+    };
+
+    struct Command
+    {
+        CommandType mType = CommandType::PRELOAD_SFX;
+        char mPath[MAX_SOUND_PATH_LENGTH] = {};
+        float mGain = 1.0f;
+        float mPitch = 1.0f;
+        bool mFlag = false; // looped/paused/enabled depending on the type
+    };
+
+    struct Voice
+    {
+        std::shared_ptr<const SoundBuffer> mBuffer;
+        double mPosition = 0.0; // in (fractional) frames
+        uint64_t mStartOrder = 0;
+        float mGain = 1.0f;
+        float mPitch = 1.0f;
+        bool mLooped = false;
+    };
+
+    void PushCommand(const CommandType type, const std::string& path, const float gain = 1.0f, const float pitch = 1.0f, const bool flag = false);
+    void ProcessCommands();
+    void ProcessCommand(const Command& command);
+    std::shared_ptr<const SoundBuffer> GetOrLoadSfx(const std::string& sfxFilePath);
+    void StartVoice(std::shared_ptr<const SoundBuffer> buffer, const bool looped, const float gain, const float pitch);
+    void MixVoices(float* interleavedOutput, const int frameCount);
+    void MixMusic(float* interleavedOutput, const int frameCount);
+    void RunDeviceThread();
+
+private:
+    MPSCRingBuffer<Command> mCommandQueue;
+
+    // Mixing thread state
+    std::unordered_map<std::string, std::shared_ptr<const SoundBuffer>> mSfxCache;
+    std::vector<Voice> mVoices;
+    std::vector<float> mMusicScratchBuffer;
+    std::unique_ptr<MusicStream> mMusicStream;
+    std::unique_ptr<MusicStream> mNextMusicStream; // faded in once the current one has faded out
+    uint64_t mNextVoiceStartOrder = 0;
+    float mMusicFadeGain = 0.0f;
+    bool mSfxPaused = false;
+    bool mMusicPaused = false;
+    bool mEnabled = true;
+
+    // Device
+    std::thread mDeviceThread;
+    std::atomic<bool> mDeviceRunning = false;
+    uint32_t mDeviceId = 0;
+    bool mInitializedAudioSubsystem = false;
+
+    // Stats
+    std::atomic<int> mActiveVoiceCount = 0;
+    std::atomic<int> mLoadedSfxCount = 0;
+    std::atomic<bool> mMusicPlaying = false;
+    std::atomic<uint64_t> mMixedFrameCount = 0;
+    std::atomic<uint64_t> mStolenVoiceCount = 0;
+    std::atomic<uint64_t> mDroppedCommandCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* AudioMixer_h */
@@ -0,0 +1,148 @@
+///------------------------------------------------------------------------------------------------
+///  MixerSoundUtils.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///-----------------------------------------------------------------------------------------------
+
+#include <engine/resloading/ResourceLoadingService.h>
+#include <engine/sound/AudioMixer.h>
+#include <engine/sound/MixerSoundUtils.h>
+#include <engine/utils/PlatformMacros.h>
+#include <engine/utils/StringUtils.h>
+#include <memory>
+
+///-----------------------------------------------------------------------------------------------
+
+// Apple platforms define sound_utils in AppleSoundUtils
+#if defined(WINDOWS) || defined(LINUX)
+
+///-----------------------------------------------------------------------------------------------
+
+namespace sound_utils
+{
+
+///-----------------------------------------------------------------------------------------------
+/// Mixed in software on the AudioMixer's own thread. When no audio device is available (e.g. on
+/// CI/load test machines) every call is accepted and dropped.
+
+static std::unique_ptr<sound::AudioMixer> sAudioMixer;
+
+///-----------------------------------------------------------------------------------------------
+
+static std::string GetSoundFilePath(const std::string& soundResPath)
+{
+    // Sounds are referred to without an extension, and only WAVs can be decoded here
+    const auto hasExtension = soundResPath.find('.') != std::string::npos;
+    return resources::ResourceLoadingService::RES_MUSIC_ROOT + soundResPath + (hasExtension ? "" : ".wav");
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void Vibrate()
+{
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void PreloadSfx(const std::string& sfxResPath)
+{
+    if (sAudioMixer)
+    {
+        sAudioMixer->PreloadSfx(GetSoundFilePath(sfxResPath));
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void PlaySound(const std::string& soundResPath, const bool loopedSfxOrUnloopedMusic /* = false */, const float gain /* = 1.0f */, const float pitch /* = 1.0f */)
+{
+    if (!sAudioMixer)
+    {
+        return;
+    }
+
+    if (strutils::StringStartsWith(soundResPath, "sfx_"))
+    {
+        sAudioMixer->PlaySfx(GetSoundFilePath(soundResPath), loopedSfxOrUnloopedMusic, gain, pitch);
+    }
+    else
+    {
+        sAudioMixer->PlayMusic(GetSoundFilePath(soundResPath), !loopedSfxOrUnloopedMusic);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void InitAudio()
+{
+    auto audioMixer = std::make_unique<sound::AudioMixer>();
+    if (audioMixer->StartDevice())
+    {
+        sAudioMixer = std::move(audioMixer);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ResumeAudio()
+{
+    if (sAudioMixer)
+    {
+        sAudioMixer->SetMusicPaused(false);
+        sAudioMixer->SetSfxPaused(false);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void PauseMusicOnly()
+{
+    if (sAudioMixer)
+    {
+        sAudioMixer->SetMusicPaused(true);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void PauseSfxOnly()
+{
+    if (sAudioMixer)
+    {
+        sAudioMixer->SetSfxPaused(true);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void PauseAudio()
+{
+    PauseMusicOnly();
+    PauseSfxOnly();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void UpdateAudio(const float)
+{
+    // Fades etc. are advanced by the mixing thread
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void SetAudioEnabled(const bool audioEnabled)
+{
+    if (sAudioMixer)
+    {
+        sAudioMixer->SetEnabled(audioEnabled);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif
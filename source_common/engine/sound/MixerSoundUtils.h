@@ -0,0 +1,40 @@
+///------------------------------------------------------------------------------------------------
+///  MixerSoundUtils.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///-----------------------------------------------------------------------------------------------
+
+#ifndef MixerSoundUtils_h
+#define MixerSoundUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include <string>
+
+///-----------------------------------------------------------------------------------------------
+/// The sound_utils backend of the desktop platforms without a native one (Windows & Linux),
+/// playing through the software AudioMixer (Apple platforms use AppleSoundUtils instead).
+namespace sound_utils
+{
+
+///-----------------------------------------------------------------------------------------------
+
+void Vibrate();
+void PreloadSfx(const std::string& sfxResPath);
+void PlaySound(const std::string& soundResPath, const bool loopedSfxOrUnloopedMusic = false, const float gain = 1.0f, const float pitch = 1.0f);
+void InitAudio();
+void ResumeAudio();
+void PauseMusicOnly();
+void PauseSfxOnly();
+void PauseAudio();
+void UpdateAudio(const float dtMillis);
+void SetAudioEnabled(const bool audioEnabled);
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* MixerSoundUtils_h */
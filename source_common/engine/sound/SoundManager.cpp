@@ -10,9 +10,9 @@
 #if defined(MACOS) || defined(MOBILE_FLOW)
 #include <platform_utilities/AppleSoundUtils.h>
 #define PLATFORM_CALL(func) (sound_utils::func)
-#elif defined(WINDOWS)
-#include <platform_utilities/WindowsUtils.h>
-#define PLATFORM_CALL(func)
+#elif defined(WINDOWS) || defined(LINUX)
+#include <engine/sound/MixerSoundUtils.h>
+#define PLATFORM_CALL(func) (sound_utils::func)
 #endif
 
 ///------------------------------------------------------------------------------------------------
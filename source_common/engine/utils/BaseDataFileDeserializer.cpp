@@ -7,18 +7,20 @@
 
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/utils/BaseDataFileDeserializer.h>
+#include <engine/utils/DataFileCodec.h>
 #include <engine/utils/OSMessageBox.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/PlatformMacros.h>
-#include <engine/utils/StringUtils.h>
 #if defined(MACOS) || defined(MOBILE_FLOW)
 #include <platform_utilities/AppleUtils.h>
 #elif defined(WINDOWS)
 #include <platform_utilities/WindowsUtils.h>
+#elif defined(LINUX)
+#include <platform_utilities/LinuxUtils.h>
 #endif
 #include <fstream>
 #include <nlohmann/json.hpp>
-#include <vector>
+#include <sstream>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -27,78 +29,47 @@ namespace serial
 
 ///------------------------------------------------------------------------------------------------
 
-template<class T>
-bool ValidateChecksum(T& contentsContainer)
+BaseDataFileDeserializer::BaseDataFileDeserializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const WarnOnFileNotFoundBehavior warnOnFnFBehavior, const CheckSumValidationBehavior checkSumValidationBehavior, const DataFileEncoding dataFileEncoding)
 {
-    std::string checkSumString;
+#if defined(MACOS) || defined(MOBILE_FLOW)
+    auto filePathWithoutExtension = (dataFileType == DataFileType::PERSISTENCE_FILE_TYPE ? apple_utils::GetPersistentDataDirectoryPath() : resources::ResourceLoadingService::RES_DATA_ROOT) + fileNameWithoutExtension;
+#elif defined(WINDOWS)
+    auto filePathWithoutExtension = (dataFileType == DataFileType::PERSISTENCE_FILE_TYPE ? windows_utils::GetPersistentDataDirectoryPath() : resources::ResourceLoadingService::RES_DATA_ROOT) + fileNameWithoutExtension;
+#elif defined(LINUX)
+    auto filePathWithoutExtension = (dataFileType == DataFileType::PERSISTENCE_FILE_TYPE ? linux_utils::GetPersistentDataDirectoryPath() : resources::ResourceLoadingService::RES_DATA_ROOT) + fileNameWithoutExtension;
+#endif
     
-    if (!contentsContainer.empty() && contentsContainer.back() == '\n')
-    {
-        contentsContainer.pop_back();
-    }
+    auto filePath = filePathWithoutExtension + GetDataFileExtension(dataFileEncoding);
+    std::ifstream dataFile(filePath, std::ios::binary);
     
-    while (!contentsContainer.empty())
+    // Binary data files that haven't been written yet are migrated from their json counterparts (if any)
+    if (!dataFile.is_open() && dataFileEncoding == DataFileEncoding::BINARY)
     {
-        if (contentsContainer.back() == '&')
+        auto jsonFilePath = filePathWithoutExtension + GetDataFileExtension(DataFileEncoding::JSON);
+        dataFile.open(jsonFilePath, std::ios::binary);
+        if (dataFile.is_open())
         {
-            break;
+            logging::Log(logging::LogType::INFO, "Migrating data file %s to binary", jsonFilePath.c_str());
+            filePath = jsonFilePath;
         }
-        checkSumString = char(contentsContainer.back()) + checkSumString;
-        contentsContainer.pop_back();
-    }
-    
-    if (contentsContainer.empty())
-    {
-        return false;
     }
     
-    contentsContainer.pop_back();
-    
-    if (contentsContainer.empty())
-    {
-        return false;
-    }
-    
-    if (checkSumString == std::to_string(strutils::StringId(nlohmann::json::parse(contentsContainer).dump(4)).GetStringId()))
-    {
-        return true;
-    }
-    
-    return false;
-}
-
-///------------------------------------------------------------------------------------------------
-
-BaseDataFileDeserializer::BaseDataFileDeserializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const WarnOnFileNotFoundBehavior warnOnFnFBehavior, const CheckSumValidationBehavior checkSumValidationBehavior)
-{
-    std::string dataFileExtension = ".json";
-    
-#if defined(MACOS) || defined(MOBILE_FLOW)
-    auto filePath = (dataFileType == DataFileType::PERSISTENCE_FILE_TYPE ? apple_utils::GetPersistentDataDirectoryPath() : resources::ResourceLoadingService::RES_DATA_ROOT) + fileNameWithoutExtension + dataFileExtension;
-#elif defined(WINDOWS)
-    auto filePath = (dataFileType == DataFileType::PERSISTENCE_FILE_TYPE ? windows_utils::GetPersistentDataDirectoryPath() : resources::ResourceLoadingService::RES_DATA_ROOT) + fileNameWithoutExtension + dataFileExtension;
-#endif
-    
-    std::ifstream dataFile(filePath);
     if (dataFile.is_open())
     {
         std::stringstream buffer;
         buffer << dataFile.rdbuf();
-        auto contents = buffer.str();
         
-        if (checkSumValidationBehavior == CheckSumValidationBehavior::VALIDATE_CHECKSUM && !ValidateChecksum(contents))
+        const auto decodeResult = DecodeDataFile(buffer.str(), checkSumValidationBehavior, mState);
+        if (decodeResult != DataFileDecodeResult::SUCCESS && warnOnFnFBehavior == WarnOnFileNotFoundBehavior::WARN)
         {
-            if (warnOnFnFBehavior == WarnOnFileNotFoundBehavior::WARN)
+            if (decodeResult == DataFileDecodeResult::UNSUPPORTED_VERSION)
+            {
+                ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "Unsupported file", ("Data File " + filePath + " was written by a newer version.").c_str());
+            }
+            else
             {
                 ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "Corrupted file", ("Data File " + filePath + " is corrupted.").c_str());
             }
-            
-            return;
-        }
-        
-        if (contents.size() > 1)
-        {
-            mState = nlohmann::json::parse(contents);
         }
     }
     else if (warnOnFnFBehavior == WarnOnFileNotFoundBehavior::WARN)
@@ -11,7 +11,6 @@
 ///------------------------------------------------------------------------------------------------
 
 #include <engine/utils/SerializationDefinitions.h>
-#include <engine/utils/StringUtils.h>
 #include <nlohmann/json.hpp>
 
 ///------------------------------------------------------------------------------------------------
@@ -29,18 +28,10 @@ enum class WarnOnFileNotFoundBehavior
 
 ///------------------------------------------------------------------------------------------------
 
-enum class CheckSumValidationBehavior
-{
-    VALIDATE_CHECKSUM,
-    SKIP_CHECKSUM_VALIDATION
-};
-
-///------------------------------------------------------------------------------------------------
-
 class BaseDataFileDeserializer
 {
 public:
-    BaseDataFileDeserializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const WarnOnFileNotFoundBehavior warnOnFnFBehavior, const CheckSumValidationBehavior checkSumValidationBehavior);
+    BaseDataFileDeserializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const WarnOnFileNotFoundBehavior warnOnFnFBehavior, const CheckSumValidationBehavior checkSumValidationBehavior, const DataFileEncoding dataFileEncoding = DataFileEncoding::JSON);
     virtual ~BaseDataFileDeserializer() = default;
     
     const nlohmann::json& GetState() const;
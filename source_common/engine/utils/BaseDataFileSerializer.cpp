@@ -8,13 +8,15 @@
 #include <chrono>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/utils/BaseDataFileSerializer.h>
+#include <engine/utils/DataFileCodec.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/PlatformMacros.h>
-#include <engine/utils/StringUtils.h>
 #if defined(MACOS) || defined(MOBILE_FLOW)
 #include <platform_utilities/AppleUtils.h>
 #elif defined(WINDOWS)
 #include <platform_utilities/WindowsUtils.h>
+#elif defined(LINUX)
+#include <platform_utilities/LinuxUtils.h>
 #endif
 #include <filesystem>
 
@@ -25,11 +27,11 @@ namespace serial
 
 ///------------------------------------------------------------------------------------------------
 
-BaseDataFileSerializer::BaseDataFileSerializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const DataFileOpeningBehavior fileOpeningBehavior)
+BaseDataFileSerializer::BaseDataFileSerializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const DataFileOpeningBehavior fileOpeningBehavior, const DataFileEncoding dataFileEncoding)
     : mDataFileType(dataFileType)
+    , mDataFileEncoding(dataFileEncoding)
 {    
-    std::string dataFileExtension = ".json";
-    mFilename = fileNameWithoutExtension + dataFileExtension;
+    mFilename = fileNameWithoutExtension + GetDataFileExtension(dataFileEncoding);
     
     if (fileOpeningBehavior == DataFileOpeningBehavior::OPEN_DATA_FILE_ON_CONSTRUCTION)
     {
@@ -56,10 +58,8 @@ void BaseDataFileSerializer::FlushStateToFile()
     
     if (mFile.is_open())
     {
-        auto checksumString = "&" + std::to_string(strutils::StringId(mState.dump(4)).GetStringId());
-        
-        mFile << mState.dump(4);
-        mFile << checksumString;
+        const auto contents = EncodeDataFile(mState, mDataFileEncoding);
+        mFile.write(contents.data(), static_cast<std::streamsize>(contents.size()));
         
         mFile.close();
     }
@@ -84,16 +84,18 @@ void BaseDataFileSerializer::OpenDataFile()
             auto directoryPath = apple_utils::GetPersistentDataDirectoryPath();
     #elif defined(WINDOWS)
             auto directoryPath = windows_utils::GetPersistentDataDirectoryPath();
+    #elif defined(LINUX)
+            auto directoryPath = linux_utils::GetPersistentDataDirectoryPath();
     #endif
             
     #if defined(DESKTOP_FLOW)
             std::filesystem::create_directory(directoryPath);
     #endif
-            mFile.open(directoryPath + mFilename);
+            mFile.open(directoryPath + mFilename, std::ios::binary);
         }
         else if (mDataFileType == DataFileType::ASSET_FILE_TYPE)
         {
-            mFile.open(resources::ResourceLoadingService::RES_DATA_ROOT + mFilename);
+            mFile.open(resources::ResourceLoadingService::RES_DATA_ROOT + mFilename, std::ios::binary);
         }
     }
 }
@@ -33,7 +33,7 @@ enum class DataFileOpeningBehavior
 class BaseDataFileSerializer
 {
 public:
-    BaseDataFileSerializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const DataFileOpeningBehavior fileOpeningBehavior);
+    BaseDataFileSerializer(const std::string& fileNameWithoutExtension, const DataFileType& dataFileType, const DataFileOpeningBehavior fileOpeningBehavior, const DataFileEncoding dataFileEncoding = DataFileEncoding::JSON);
     virtual ~BaseDataFileSerializer() = default;
     
     void FlushStateToFile();
@@ -48,6 +48,7 @@ private:
     
 private:
     const DataFileType mDataFileType;
+    const DataFileEncoding mDataFileEncoding;
     std::string mFilename;
     std::ofstream mFile;
 };
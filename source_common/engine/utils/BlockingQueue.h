@@ -0,0 +1,142 @@
+///------------------------------------------------------------------------------------------------
+///  BlockingQueue.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef BlockingQueue_h
+#define BlockingQueue_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+///------------------------------------------------------------------------------------------------
+/// Unbounded, multi-producer multi-consumer queue for consumers that should sleep while there is no
+/// work (e.g. worker threads). Elements are moved in and out. Closing the queue wakes up all blocked
+/// consumers: elements already queued are still handed out, after which Pop() returns false, which
+/// lets worker threads exit their loop and be joined cleanly.
+template<typename T>
+class BlockingQueue final
+{
+public:
+    BlockingQueue() = default;
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue(BlockingQueue&&) = delete;
+    const BlockingQueue& operator = (const BlockingQueue&) = delete;
+    BlockingQueue& operator = (BlockingQueue&&) = delete;
+
+    /// @returns false if the queue has been closed (in which case the element is dropped)
+    bool Push(T value)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mClosed)
+            {
+                return false;
+            }
+            mElements.push_back(std::move(value));
+        }
+        mConditionVariable.notify_one();
+        return true;
+    }
+
+    /// Blocks until an element is available, or the queue is closed and empty.
+    /// @returns false once the queue is closed and empty
+    bool Pop(T& value)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mConditionVariable.wait(lock, [this](){ return !mElements.empty() || mClosed; });
+        if (mElements.empty())
+        {
+            return false;
+        }
+
+        value = std::move(mElements.front());
+        mElements.pop_front();
+        return true;
+    }
+
+    /// @returns false if the queue is empty
+    bool TryPop(T& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mElements.empty())
+        {
+            return false;
+        }
+
+        value = std::move(mElements.front());
+        mElements.pop_front();
+        return true;
+    }
+
+    /// Takes up to maxCount queued elements under a single lock, calling readFunction with each
+    /// outside of it. Never blocks.
+    /// @returns the number of elements drained
+    template<typename ReadFunction>
+    size_t Drain(ReadFunction&& readFunction, const size_t maxCount = std::numeric_limits<size_t>::max())
+    {
+        std::deque<T> drainedElements;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (maxCount >= mElements.size())
+            {
+                drainedElements.swap(mElements);
+            }
+            else
+            {
+                for (size_t i = 0; i < maxCount; ++i)
+                {
+                    drainedElements.push_back(std::move(mElements.front()));
+                    mElements.pop_front();
+                }
+            }
+        }
+
+        for (auto& element: drainedElements)
+        {
+            readFunction(element);
+        }
+        return drainedElements.size();
+    }
+
+    /// Rejects further pushes and wakes up all blocked consumers.
+    void Close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mClosed = true;
+        }
+        mConditionVariable.notify_all();
+    }
+
+    bool IsClosed() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mClosed;
+    }
+
+    size_t GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mElements.size();
+    }
+
+private:
+    mutable std::mutex mMutex;
+    std::condition_variable mConditionVariable;
+    std::deque<T> mElements;
+    bool mClosed = false;
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* BlockingQueue_h */
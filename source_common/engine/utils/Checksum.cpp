@@ -0,0 +1,80 @@
+///------------------------------------------------------------------------------------------------
+///  Checksum.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <engine/utils/Checksum.h>
+
+///------------------------------------------------------------------------------------------------
+
+namespace serial
+{
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr uint32_t CRC32C_REFLECTED_POLYNOMIAL = 0x82F63B78;
+
+using CRC32CTables = std::array<std::array<uint32_t, 256>, 8>;
+
+///------------------------------------------------------------------------------------------------
+/// Table k holds the contribution of a byte followed by k zero bytes, so 8 lookups consume 8 bytes.
+static constexpr CRC32CTables CreateCRC32CTables()
+{
+    CRC32CTables tables = {};
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ CRC32C_REFLECTED_POLYNOMIAL : crc >> 1;
+        }
+        tables[0][i] = crc;
+    }
+    
+    for (size_t table = 1; table < tables.size(); ++table)
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            tables[table][i] = (tables[table - 1][i] >> 8) ^ tables[0][tables[table - 1][i] & 0xFF];
+        }
+    }
+    
+    return tables;
+}
+
+static constexpr CRC32CTables CRC32C_TABLES = CreateCRC32CTables();
+
+///------------------------------------------------------------------------------------------------
+
+uint32_t ComputeCRC32C(const void* data, const size_t size, const uint32_t previousChecksum)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    const auto* bytesEnd = bytes + size;
+    uint32_t crc = ~previousChecksum;
+    
+    while (bytesEnd - bytes >= 8)
+    {
+        const uint32_t low = crc ^ (static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 | static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24);
+        const uint32_t high = static_cast<uint32_t>(bytes[4]) | static_cast<uint32_t>(bytes[5]) << 8 | static_cast<uint32_t>(bytes[6]) << 16 | static_cast<uint32_t>(bytes[7]) << 24;
+        
+        crc = CRC32C_TABLES[7][low & 0xFF] ^ CRC32C_TABLES[6][(low >> 8) & 0xFF] ^ CRC32C_TABLES[5][(low >> 16) & 0xFF] ^ CRC32C_TABLES[4][low >> 24] ^
+              CRC32C_TABLES[3][high & 0xFF] ^ CRC32C_TABLES[2][(high >> 8) & 0xFF] ^ CRC32C_TABLES[1][(high >> 16) & 0xFF] ^ CRC32C_TABLES[0][high >> 24];
+        bytes += 8;
+    }
+    
+    while (bytes != bytesEnd)
+    {
+        crc = (crc >> 8) ^ CRC32C_TABLES[0][(crc ^ *bytes++) & 0xFF];
+    }
+    
+    return ~crc;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
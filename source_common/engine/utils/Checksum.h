@@ -0,0 +1,36 @@
+///------------------------------------------------------------------------------------------------
+///  Checksum.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef Checksum_h
+#define Checksum_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+
+///------------------------------------------------------------------------------------------------
+
+namespace serial
+{
+
+///------------------------------------------------------------------------------------------------
+/// Computes the CRC32C (Castagnoli) checksum of the given bytes, 8 bytes at a time.
+/// Can be streamed over consecutive chunks by passing in the result of the previous chunk.
+/// @param[in] data the bytes to checksum.
+/// @param[in] size the number of bytes.
+/// @param[in] previousChecksum the checksum of all preceding chunks (0 for the first one).
+/// @returns the checksum of all bytes so far.
+uint32_t ComputeCRC32C(const void* data, const size_t size, const uint32_t previousChecksum = 0);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* Checksum_h */
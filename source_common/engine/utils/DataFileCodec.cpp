@@ -0,0 +1,230 @@
+///------------------------------------------------------------------------------------------------
+///  DataFileCodec.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <engine/utils/Checksum.h>
+#include <engine/utils/DataFileCodec.h>
+#include <engine/utils/StringUtils.h>
+#include <string_view>
+
+///------------------------------------------------------------------------------------------------
+
+namespace serial
+{
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string_view CRC32C_CHECKSUM_PREFIX = "crc32c:";
+static constexpr size_t CRC32C_CHECKSUM_HEX_DIGITS = 8;
+
+///------------------------------------------------------------------------------------------------
+
+template<typename T>
+static inline T ReadLittleEndian(const char* data)
+{
+    T result = 0;
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        result |= static_cast<T>(static_cast<unsigned char>(data[i])) << (i * 8);
+    }
+    return result;
+}
+
+template<typename T>
+static inline void WriteLittleEndian(std::string& contents, const T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        contents.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool IsCRC32CChecksumString(const std::string_view checksumString)
+{
+    if (checksumString.size() != CRC32C_CHECKSUM_PREFIX.size() + CRC32C_CHECKSUM_HEX_DIGITS || checksumString.substr(0, CRC32C_CHECKSUM_PREFIX.size()) != CRC32C_CHECKSUM_PREFIX)
+    {
+        return false;
+    }
+    
+    return std::all_of(checksumString.begin() + CRC32C_CHECKSUM_PREFIX.size(), checksumString.end(), [](const char c){ return std::isxdigit(static_cast<unsigned char>(c)) != 0; });
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool IsLegacyChecksumString(const std::string_view checksumString)
+{
+    return !checksumString.empty() && std::all_of(checksumString.begin(), checksumString.end(), [](const char c){ return std::isdigit(static_cast<unsigned char>(c)) != 0; });
+}
+
+///------------------------------------------------------------------------------------------------
+
+static DataFileDecodeResult DecodeJsonDataFile(const std::string& contents, const CheckSumValidationBehavior checkSumValidationBehavior, nlohmann::json& outState)
+{
+    std::string_view json(contents);
+    if (!json.empty() && json.back() == '\n')
+    {
+        json.remove_suffix(1);
+    }
+    
+    // Hand written (e.g. asset) files may not have a checksum at all
+    std::string_view checksumString;
+    const auto checksumSeparatorIndex = json.rfind('&');
+    if (checksumSeparatorIndex != std::string_view::npos)
+    {
+        const auto candidateChecksumString = json.substr(checksumSeparatorIndex + 1);
+        if (IsCRC32CChecksumString(candidateChecksumString) || IsLegacyChecksumString(candidateChecksumString))
+        {
+            checksumString = candidateChecksumString;
+            json = json.substr(0, checksumSeparatorIndex);
+        }
+    }
+    
+    if (checkSumValidationBehavior == CheckSumValidationBehavior::VALIDATE_CHECKSUM)
+    {
+        if (checksumString.empty() || json.empty())
+        {
+            return DataFileDecodeResult::CHECKSUM_MISMATCH;
+        }
+        
+        if (IsCRC32CChecksumString(checksumString))
+        {
+            const auto expectedChecksum = static_cast<uint32_t>(std::stoul(std::string(checksumString.substr(CRC32C_CHECKSUM_PREFIX.size())), nullptr, 16));
+            if (ComputeCRC32C(json.data(), json.size()) != expectedChecksum)
+            {
+                return DataFileDecodeResult::CHECKSUM_MISMATCH;
+            }
+        }
+        else
+        {
+            // Legacy checksums are over the re-serialized json, so the contents need parsing first
+            auto legacyState = nlohmann::json::parse(json.begin(), json.end(), nullptr, false);
+            if (legacyState.is_discarded())
+            {
+                return DataFileDecodeResult::MALFORMED;
+            }
+            
+            if (checksumString != std::to_string(strutils::GetLegacyStringHash(legacyState.dump(4))))
+            {
+                return DataFileDecodeResult::CHECKSUM_MISMATCH;
+            }
+            
+            outState = std::move(legacyState);
+            return DataFileDecodeResult::SUCCESS;
+        }
+    }
+    
+    if (json.size() <= 1)
+    {
+        return DataFileDecodeResult::SUCCESS;
+    }
+    
+    auto state = nlohmann::json::parse(json.begin(), json.end(), nullptr, false);
+    if (state.is_discarded())
+    {
+        return DataFileDecodeResult::MALFORMED;
+    }
+    
+    outState = std::move(state);
+    return DataFileDecodeResult::SUCCESS;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static DataFileDecodeResult DecodeBinaryDataFile(const std::string& contents, const CheckSumValidationBehavior checkSumValidationBehavior, nlohmann::json& outState)
+{
+    if (contents.size() < BINARY_DATA_FILE_HEADER_SIZE)
+    {
+        return DataFileDecodeResult::MALFORMED;
+    }
+    
+    const auto version = ReadLittleEndian<uint32_t>(contents.data() + 4);
+    const auto checksum = ReadLittleEndian<uint32_t>(contents.data() + 8);
+    const auto payloadSize = ReadLittleEndian<uint64_t>(contents.data() + 12);
+    
+    if (version > BINARY_DATA_FILE_VERSION)
+    {
+        return DataFileDecodeResult::UNSUPPORTED_VERSION;
+    }
+    
+    if (version == 0 || payloadSize != contents.size() - BINARY_DATA_FILE_HEADER_SIZE)
+    {
+        return DataFileDecodeResult::MALFORMED;
+    }
+    
+    const auto* payload = reinterpret_cast<const uint8_t*>(contents.data() + BINARY_DATA_FILE_HEADER_SIZE);
+    if (checkSumValidationBehavior == CheckSumValidationBehavior::VALIDATE_CHECKSUM && ComputeCRC32C(payload, payloadSize) != checksum)
+    {
+        return DataFileDecodeResult::CHECKSUM_MISMATCH;
+    }
+    
+    auto state = nlohmann::json::from_msgpack(payload, payload + payloadSize, true, false);
+    if (state.is_discarded())
+    {
+        return DataFileDecodeResult::MALFORMED;
+    }
+    
+    outState = std::move(state);
+    return DataFileDecodeResult::SUCCESS;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const char* GetDataFileExtension(const DataFileEncoding dataFileEncoding)
+{
+    return dataFileEncoding == DataFileEncoding::BINARY ? ".bin" : ".json";
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string EncodeDataFile(const nlohmann::json& state, const DataFileEncoding dataFileEncoding)
+{
+    if (dataFileEncoding == DataFileEncoding::BINARY)
+    {
+        const auto payload = nlohmann::json::to_msgpack(state);
+        
+        std::string contents(BINARY_DATA_FILE_MAGIC, sizeof(BINARY_DATA_FILE_MAGIC));
+        contents.reserve(BINARY_DATA_FILE_HEADER_SIZE + payload.size());
+        WriteLittleEndian<uint32_t>(contents, BINARY_DATA_FILE_VERSION);
+        WriteLittleEndian<uint32_t>(contents, ComputeCRC32C(payload.data(), payload.size()));
+        WriteLittleEndian<uint64_t>(contents, static_cast<uint64_t>(payload.size()));
+        contents.append(reinterpret_cast<const char*>(payload.data()), payload.size());
+        return contents;
+    }
+    
+    auto contents = state.dump(4);
+    
+    char checksumHexDigits[CRC32C_CHECKSUM_HEX_DIGITS + 1];
+    std::snprintf(checksumHexDigits, sizeof(checksumHexDigits), "%08x", ComputeCRC32C(contents.data(), contents.size()));
+    
+    contents += "&";
+    contents += CRC32C_CHECKSUM_PREFIX;
+    contents += checksumHexDigits;
+    return contents;
+}
+
+///------------------------------------------------------------------------------------------------
+
+DataFileDecodeResult DecodeDataFile(const std::string& contents, const CheckSumValidationBehavior checkSumValidationBehavior, nlohmann::json& outState)
+{
+    if (contents.size() >= sizeof(BINARY_DATA_FILE_MAGIC) && std::memcmp(contents.data(), BINARY_DATA_FILE_MAGIC, sizeof(BINARY_DATA_FILE_MAGIC)) == 0)
+    {
+        return DecodeBinaryDataFile(contents, checkSumValidationBehavior, outState);
+    }
+    
+    return DecodeJsonDataFile(contents, checkSumValidationBehavior, outState);
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
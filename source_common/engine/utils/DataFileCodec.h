@@ -0,0 +1,71 @@
+///------------------------------------------------------------------------------------------------
+///  DataFileCodec.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef DataFileCodec_h
+#define DataFileCodec_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <engine/utils/SerializationDefinitions.h>
+#include <nlohmann/json.hpp>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace serial
+{
+
+///------------------------------------------------------------------------------------------------
+/// On disk layouts of data file states:
+///   JSON:   the pretty printed json, followed by "&crc32c:" and the CRC32C of the json bytes as 8 hex digits.
+///           Files written prior to CRC32C checksums end in "&" and the decimal strutils::GetLegacyStringHash
+///           of the re-serialized json instead, and are still accepted (if slower to validate).
+///   BINARY: Header: char[4] magic "TMDF", u32 version, u32 CRC32C of the payload, u64 payload size (little-endian)
+///           Payload: the state encoded as MessagePack
+inline constexpr char BINARY_DATA_FILE_MAGIC[4] = { 'T', 'M', 'D', 'F' };
+inline constexpr uint32_t BINARY_DATA_FILE_VERSION = 1;
+inline constexpr size_t BINARY_DATA_FILE_HEADER_SIZE = 20;
+
+///------------------------------------------------------------------------------------------------
+
+enum class DataFileDecodeResult
+{
+    SUCCESS,
+    CHECKSUM_MISMATCH,
+    MALFORMED,
+    UNSUPPORTED_VERSION
+};
+
+///------------------------------------------------------------------------------------------------
+/// @param[in] dataFileEncoding the encoding of the data file.
+/// @returns the file extension (including the dot) data files of the given encoding are stored with.
+const char* GetDataFileExtension(const DataFileEncoding dataFileEncoding);
+
+///------------------------------------------------------------------------------------------------
+/// Encodes the given state, checksum included, in the given encoding.
+/// @param[in] state the state to encode.
+/// @param[in] dataFileEncoding the encoding to use.
+/// @returns the data file contents.
+std::string EncodeDataFile(const nlohmann::json& state, const DataFileEncoding dataFileEncoding);
+
+///------------------------------------------------------------------------------------------------
+/// Decodes data file contents of any encoding (detected from the contents themselves).
+/// @param[in] contents the raw data file contents.
+/// @param[in] checkSumValidationBehavior whether the checksum needs to match the contents.
+/// @param[out] outState receives the decoded state on success (and is left untouched for empty files).
+/// @returns the result of the decoding.
+DataFileDecodeResult DecodeDataFile(const std::string& contents, const CheckSumValidationBehavior checkSumValidationBehavior, nlohmann::json& outState);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* DataFileCodec_h */
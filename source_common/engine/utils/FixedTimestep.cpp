@@ -0,0 +1,88 @@
+///------------------------------------------------------------------------------------------------
+///  FixedTimestep.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <cassert>
+#include <engine/utils/FixedTimestep.h>
+
+///------------------------------------------------------------------------------------------------
+
+FixedTimestep::FixedTimestep(const float stepsPerSecond /* = DEFAULT_STEPS_PER_SECOND */)
+{
+    SetStepsPerSecond(stepsPerSecond);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FixedTimestep::SetStepsPerSecond(const float stepsPerSecond)
+{
+    assert(stepsPerSecond > 0.0f);
+    mStepMillis = 1000.0/stepsPerSecond;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float FixedTimestep::GetStepsPerSecond() const
+{
+    return static_cast<float>(1000.0/mStepMillis);
+}
+
+///------------------------------------------------------------------------------------------------
+
+float FixedTimestep::GetStepMillis() const
+{
+    return static_cast<float>(mStepMillis);
+}
+
+///------------------------------------------------------------------------------------------------
+
+int FixedTimestep::Advance(const float frameMillis)
+{
+    if (frameMillis > 0.0f)
+    {
+        mAccumulatedMillis += frameMillis;
+    }
+    
+    int stepCount = 0;
+    while (mAccumulatedMillis >= mStepMillis && stepCount < MAX_STEPS_PER_FRAME)
+    {
+        mAccumulatedMillis -= mStepMillis;
+        stepCount++;
+    }
+    
+    if (mAccumulatedMillis >= mStepMillis)
+    {
+        const auto keptMillis = mAccumulatedMillis - static_cast<int>(mAccumulatedMillis/mStepMillis) * mStepMillis;
+        mDroppedMillis += mAccumulatedMillis - keptMillis;
+        mAccumulatedMillis = keptMillis;
+    }
+    
+    mStepCount += stepCount;
+    return stepCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float FixedTimestep::GetInterpolationAlpha() const
+{
+    return static_cast<float>(mAccumulatedMillis/mStepMillis);
+}
+
+///------------------------------------------------------------------------------------------------
+
+uint64_t FixedTimestep::GetStepCount() const
+{
+    return mStepCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+double FixedTimestep::GetDroppedMillis() const
+{
+    return mDroppedMillis;
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,60 @@
+///------------------------------------------------------------------------------------------------
+///  FixedTimestep.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef FixedTimestep_h
+#define FixedTimestep_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+
+///------------------------------------------------------------------------------------------------
+/// Decouples the simulation rate from the render rate: frame times are accumulated and paid out
+/// in whole, constant simulation steps, so that movement, collision & animation timings come out
+/// the same regardless of display refresh rate or frame hitches. The leftover time (less than a
+/// step) is exposed as an interpolation factor between the last two simulated states for display.
+class FixedTimestep final
+{
+public:
+    static constexpr float DEFAULT_STEPS_PER_SECOND = 60.0f;
+    
+    // Past this many steps in a frame the rest of the accumulated time is dropped (i.e. the
+    // simulation slows down) rather than spiraling into ever longer frames
+    static constexpr int MAX_STEPS_PER_FRAME = 8;
+    
+    explicit FixedTimestep(const float stepsPerSecond = DEFAULT_STEPS_PER_SECOND);
+    
+    /// Keeps the accumulated time, so can be changed at any point.
+    void SetStepsPerSecond(const float stepsPerSecond);
+    float GetStepsPerSecond() const;
+    float GetStepMillis() const;
+    
+    /// Accumulates the given frame time.
+    /// @returns the number of whole simulation steps (of GetStepMillis() each) to run this frame.
+    int Advance(const float frameMillis);
+    
+    /// @returns how far [0, 1) the leftover accumulated time is into the next step, i.e. the factor to
+    /// interpolate between the state before and after the last simulation step with.
+    float GetInterpolationAlpha() const;
+    
+    /// @returns the total number of steps paid out so far.
+    uint64_t GetStepCount() const;
+    
+    /// @returns the accumulated time dropped so far, due to frames exceeding MAX_STEPS_PER_FRAME steps.
+    double GetDroppedMillis() const;
+    
+private:
+    // Doubles, so that long sessions don't drift step boundaries
+    double mStepMillis;
+    double mAccumulatedMillis = 0.0;
+    double mDroppedMillis = 0.0;
+    uint64_t mStepCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* FixedTimestep_h */
@@ -0,0 +1,111 @@
+///------------------------------------------------------------------------------------------------
+///  FrameLimiter.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <cassert>
+#include <engine/utils/FrameLimiter.h>
+
+///------------------------------------------------------------------------------------------------
+
+FrameLimiter::FrameLimiter()
+    : mIdleTimeoutMillis(TINYMMO_IDLE_TIMEOUT_SECS * 1000.0f)
+    , mIdleFrameMillis(1000.0f/TINYMMO_IDLE_FPS)
+    , mBackgroundFrameMillis(1000.0f/TINYMMO_BACKGROUND_FPS)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FrameLimiter::SetEnabled(const bool enabled)
+{
+    mEnabled = enabled;
+    if (!mEnabled)
+    {
+        mMode = Mode::ACTIVE;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool FrameLimiter::IsEnabled() const
+{
+    return mEnabled;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FrameLimiter::SetIdleTimeoutMillis(const float idleTimeoutMillis)
+{
+    mIdleTimeoutMillis = idleTimeoutMillis;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FrameLimiter::SetFrameRates(const float idleFps, const float backgroundFps)
+{
+    assert(idleFps > 0.0f && backgroundFps > 0.0f);
+    mIdleFrameMillis = 1000.0f/idleFps;
+    mBackgroundFrameMillis = 1000.0f/backgroundFps;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FrameLimiter::OnInput(const float currentMillis)
+{
+    mLastInputMillis = currentMillis;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FrameLimiter::Update(const float currentMillis, const bool windowFocused, const bool windowVisible)
+{
+    if (!mEnabled)
+    {
+        mMode = Mode::ACTIVE;
+    }
+    else if (!windowVisible)
+    {
+        mMode = Mode::BACKGROUND;
+    }
+    else if (!windowFocused || currentMillis - mLastInputMillis > mIdleTimeoutMillis)
+    {
+        mMode = Mode::IDLE;
+    }
+    else
+    {
+        mMode = Mode::ACTIVE;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+FrameLimiter::Mode FrameLimiter::GetMode() const
+{
+    return mMode;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float FrameLimiter::GetTargetFrameMillis() const
+{
+    switch (mMode)
+    {
+        case Mode::ACTIVE: return 0.0f;
+        case Mode::IDLE: return mIdleFrameMillis;
+        case Mode::BACKGROUND: return mBackgroundFrameMillis;
+    }
+    return 0.0f;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float FrameLimiter::GetRemainingFrameMillis(const float frameStartMillis, const float currentMillis) const
+{
+    const auto remainingMillis = GetTargetFrameMillis() - (currentMillis - frameStartMillis);
+    return remainingMillis > 0.0f ? remainingMillis : 0.0f;
+}
+
+///------------------------------------------------------------------------------------------------
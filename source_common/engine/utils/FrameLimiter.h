@@ -0,0 +1,79 @@
+///------------------------------------------------------------------------------------------------
+///  FrameLimiter.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef FrameLimiter_h
+#define FrameLimiter_h
+
+///------------------------------------------------------------------------------------------------
+
+/// Per build frame rate caps (e.g. -DTINYMMO_BACKGROUND_FPS=5, see the top level CMakeLists.txt)
+#if !defined(TINYMMO_IDLE_FPS)
+#define TINYMMO_IDLE_FPS 30
+#endif
+
+#if !defined(TINYMMO_BACKGROUND_FPS)
+#define TINYMMO_BACKGROUND_FPS 10
+#endif
+
+#if !defined(TINYMMO_IDLE_TIMEOUT_SECS)
+#define TINYMMO_IDLE_TIMEOUT_SECS 60
+#endif
+
+///------------------------------------------------------------------------------------------------
+/// Adaptive frame limiter, so that idle or backgrounded clients don't keep burning CPU & GPU at full
+/// (vsync) rate. Active clients are left uncapped, unfocused or input idle ones (for longer than the
+/// idle timeout) drop to the idle rate, and minimized/hidden ones to the background rate. Any input
+/// brings the client straight back to the active state. Time is passed in (rather than queried) so
+/// that the transitions can be driven deterministically.
+class FrameLimiter final
+{
+public:
+    enum class Mode
+    {
+        ACTIVE,
+        IDLE,
+        BACKGROUND
+    };
+    
+    // Throttled frames are slept off in slices no longer than this, with the slice function invoked in between
+    // (e.g. to keep servicing the network at its usual cadence, regardless of the frame rate)
+    static constexpr float MAX_SLEEP_SLICE_MILLIS = 16.0f;
+    
+    FrameLimiter();
+    
+    void SetEnabled(const bool enabled);
+    bool IsEnabled() const;
+    
+    void SetIdleTimeoutMillis(const float idleTimeoutMillis);
+    
+    /// @param[in] idleFps the cap once unfocused or idle
+    /// @param[in] backgroundFps the cap once minimized or hidden
+    void SetFrameRates(const float idleFps, const float backgroundFps);
+    
+    void OnInput(const float currentMillis);
+    void Update(const float currentMillis, const bool windowFocused, const bool windowVisible);
+    
+    Mode GetMode() const;
+    
+    /// @returns the minimum frame duration of the current mode (0 if uncapped).
+    float GetTargetFrameMillis() const;
+    
+    /// @returns how long to sleep for to honour the current mode's frame rate, given when the frame started.
+    float GetRemainingFrameMillis(const float frameStartMillis, const float currentMillis) const;
+    
+private:
+    float mIdleTimeoutMillis;
+    float mIdleFrameMillis;
+    float mBackgroundFrameMillis;
+    float mLastInputMillis = 0.0f;
+    Mode mMode = Mode::ACTIVE;
+    bool mEnabled = true;
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* FrameLimiter_h */
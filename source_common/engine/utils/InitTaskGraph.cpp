@@ -0,0 +1,381 @@
+///------------------------------------------------------------------------------------------------
+///  InitTaskGraph.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <engine/utils/InitTaskGraph.h>
+#include <engine/utils/Logging.h>
+#include <engine/utils/Profiler.h>
+#include <limits>
+
+///------------------------------------------------------------------------------------------------
+
+InitTaskGraph::~InitTaskGraph()
+{
+    for (auto& task: mTasks)
+    {
+        if (task->mWorkerThread.joinable())
+        {
+            task->mWorkerThread.join();
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::AddTask(const char* name, const TaskAffinity affinity, const std::vector<const char*>& dependencies, TaskFunction taskFunction)
+{
+    assert(!mStarted);
+
+    auto task = std::make_unique<Task>();
+    task->mName = name;
+    task->mAffinity = affinity;
+    task->mTaskFunction = std::move(taskFunction);
+    task->mDependencyNames = dependencies;
+    task->mTiming.mName = name;
+    task->mTiming.mAffinity = affinity;
+    mTasks.push_back(std::move(task));
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool InitTaskGraph::Start()
+{
+    assert(!mStarted);
+
+    // Resolve dependency names
+    for (auto& task: mTasks)
+    {
+        for (const auto* dependencyName: task->mDependencyNames)
+        {
+            auto dependencyIndex = mTasks.size();
+            for (size_t i = 0; i < mTasks.size(); ++i)
+            {
+                if (std::strcmp(mTasks[i]->mName, dependencyName) == 0)
+                {
+                    dependencyIndex = i;
+                    break;
+                }
+            }
+
+            if (dependencyIndex == mTasks.size())
+            {
+                logging::Log(logging::LogType::ERROR, "Init task %s depends on unknown task %s", task->mName, dependencyName);
+                return false;
+            }
+            task->mDependencyIndices.push_back(dependencyIndex);
+        }
+    }
+
+    // Cycle check (Kahn's algorithm)
+    std::vector<int> remainingDependencyCounts(mTasks.size());
+    std::vector<size_t> sortedTaskIndices;
+    for (size_t i = 0; i < mTasks.size(); ++i)
+    {
+        remainingDependencyCounts[i] = static_cast<int>(mTasks[i]->mDependencyIndices.size());
+        if (remainingDependencyCounts[i] == 0)
+        {
+            sortedTaskIndices.push_back(i);
+        }
+    }
+
+    for (size_t sortedIndex = 0; sortedIndex < sortedTaskIndices.size(); ++sortedIndex)
+    {
+        for (size_t i = 0; i < mTasks.size(); ++i)
+        {
+            for (const auto dependencyIndex: mTasks[i]->mDependencyIndices)
+            {
+                if (dependencyIndex == sortedTaskIndices[sortedIndex] && --remainingDependencyCounts[i] == 0)
+                {
+                    sortedTaskIndices.push_back(i);
+                }
+            }
+        }
+    }
+
+    if (sortedTaskIndices.size() != mTasks.size())
+    {
+        logging::Log(logging::LogType::ERROR, "Init task graph has a dependency cycle");
+        return false;
+    }
+
+    mStarted = true;
+    mStartTime = std::chrono::steady_clock::now();
+    mTaskTimings.reserve(mTasks.size());
+    DispatchReadyWorkerTasks();
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::Update(const float budgetMillis)
+{
+    assert(mStarted);
+
+    CollectFinishedWorkerTasks();
+    DispatchReadyWorkerTasks();
+    if (HasFailed())
+    {
+        return;
+    }
+
+    const auto updateStartMillis = GetMillisSinceStart();
+    std::vector<bool> polledThisUpdate(mTasks.size(), false);
+
+    // Finishing a task can make earlier added ones ready, hence the repeated passes
+    auto ranAnyTask = false;
+    auto finishedAnyTask = true;
+    while (finishedAnyTask)
+    {
+        finishedAnyTask = false;
+        for (size_t i = 0; i < mTasks.size(); ++i)
+        {
+            auto& task = *mTasks[i];
+            if (task.mAffinity != TaskAffinity::MAIN_THREAD || task.mDone || polledThisUpdate[i] || !IsReady(task))
+            {
+                continue;
+            }
+
+            if (ranAnyTask && GetMillisSinceStart() - updateStartMillis >= budgetMillis)
+            {
+                return;
+            }
+
+            if (!task.mStarted)
+            {
+                task.mStarted = true;
+                task.mTiming.mStartMillis = GetMillisSinceStart();
+            }
+
+            const auto executionStartMillis = GetMillisSinceStart();
+            TaskStatus taskStatus;
+            {
+                profiling::ScopedTimer taskTimer(task.mName);
+                taskStatus = task.mTaskFunction();
+            }
+            task.mTiming.mBusyMillis += GetMillisSinceStart() - executionStartMillis;
+            task.mTiming.mExecutionCount++;
+            ranAnyTask = true;
+
+            if (taskStatus == TaskStatus::FAILED)
+            {
+                FailTask(task);
+                return;
+            }
+            else if (taskStatus == TaskStatus::DONE)
+            {
+                FinishTask(task);
+                DispatchReadyWorkerTasks();
+                finishedAnyTask = true;
+            }
+            else
+            {
+                polledThisUpdate[i] = true;
+            }
+        }
+
+        if (!finishedAnyTask)
+        {
+            // Picks up workers that finished while main thread tasks were running
+            const auto doneTaskCount = mDoneTaskCount;
+            CollectFinishedWorkerTasks();
+            DispatchReadyWorkerTasks();
+            finishedAnyTask = !HasFailed() && mDoneTaskCount != doneTaskCount;
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::RunToCompletion()
+{
+    if (!mStarted && !Start())
+    {
+        return;
+    }
+
+    while (!IsComplete() && !HasFailed())
+    {
+        Update(std::numeric_limits<float>::max());
+        if (!IsComplete() && !HasFailed())
+        {
+            // Waiting on workers or polled tasks
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool InitTaskGraph::IsComplete() const
+{
+    return mStarted && mDoneTaskCount == mTasks.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool InitTaskGraph::HasFailed() const
+{
+    return mFailedTaskName != nullptr;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const char* InitTaskGraph::GetFailedTaskName() const
+{
+    return mFailedTaskName;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float InitTaskGraph::GetProgress() const
+{
+    return mTasks.empty() ? 1.0f : static_cast<float>(mDoneTaskCount)/mTasks.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::vector<InitTaskGraph::TaskTiming>& InitTaskGraph::GetTaskTimings() const
+{
+    return mTaskTimings;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float InitTaskGraph::GetTotalMillis() const
+{
+    auto totalMillis = 0.0f;
+    for (const auto& taskTiming: mTaskTimings)
+    {
+        totalMillis = std::max(totalMillis, taskTiming.mEndMillis);
+    }
+    return totalMillis;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::LogTimingReport() const
+{
+    auto busyMillisSum = 0.0f;
+    for (const auto& taskTiming: mTaskTimings)
+    {
+        busyMillisSum += taskTiming.mBusyMillis;
+    }
+
+    logging::Log(logging::LogType::INFO, "Startup took %.2fms (%.2fms of task work across %d tasks)", GetTotalMillis(), busyMillisSum, static_cast<int>(mTaskTimings.size()));
+    for (const auto& taskTiming: mTaskTimings)
+    {
+        logging::Log(logging::LogType::INFO, "  %-24s %-6s %8.2fms -> %8.2fms  busy %8.2fms (%d runs)", taskTiming.mName, taskTiming.mAffinity == TaskAffinity::MAIN_THREAD ? "main" : "worker", taskTiming.mStartMillis, taskTiming.mEndMillis, taskTiming.mBusyMillis, taskTiming.mExecutionCount);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool InitTaskGraph::IsReady(const Task& task) const
+{
+    for (const auto dependencyIndex: task.mDependencyIndices)
+    {
+        if (!mTasks[dependencyIndex]->mDone)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::DispatchReadyWorkerTasks()
+{
+    for (auto& taskPtr: mTasks)
+    {
+        auto& task = *taskPtr;
+        if (HasFailed())
+        {
+            return;
+        }
+
+        if (task.mAffinity != TaskAffinity::WORKER_THREAD || task.mStarted || !IsReady(task))
+        {
+            continue;
+        }
+
+        task.mStarted = true;
+        task.mTiming.mStartMillis = GetMillisSinceStart();
+        task.mWorkerThread = std::thread([this, &task]()
+        {
+            {
+                profiling::ScopedTimer taskTimer(task.mName);
+                task.mWorkerStatus = task.mTaskFunction();
+                assert(task.mWorkerStatus != TaskStatus::PENDING && "Worker tasks can't be polled");
+            }
+            task.mTiming.mEndMillis = GetMillisSinceStart();
+            task.mWorkerFinished.store(true, std::memory_order_release);
+        });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::CollectFinishedWorkerTasks()
+{
+    for (auto& taskPtr: mTasks)
+    {
+        auto& task = *taskPtr;
+        if (task.mAffinity == TaskAffinity::WORKER_THREAD && !task.mDone && task.mWorkerFinished.load(std::memory_order_acquire))
+        {
+            task.mWorkerThread.join();
+            task.mTiming.mBusyMillis = task.mTiming.mEndMillis - task.mTiming.mStartMillis;
+            task.mTiming.mExecutionCount = 1;
+
+            if (task.mWorkerStatus == TaskStatus::FAILED)
+            {
+                task.mDone = true; // so that it is not collected again
+                FailTask(task);
+            }
+            else
+            {
+                FinishTask(task);
+            }
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::FinishTask(Task& task)
+{
+    if (task.mAffinity == TaskAffinity::MAIN_THREAD)
+    {
+        task.mTiming.mEndMillis = GetMillisSinceStart();
+    }
+
+    task.mDone = true;
+    mDoneTaskCount++;
+    mTaskTimings.push_back(task.mTiming);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void InitTaskGraph::FailTask(const Task& task)
+{
+    if (!mFailedTaskName)
+    {
+        logging::Log(logging::LogType::ERROR, "Init task %s failed", task.mName);
+        mFailedTaskName = task.mName;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+float InitTaskGraph::GetMillisSinceStart() const
+{
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - mStartTime).count();
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,130 @@
+///------------------------------------------------------------------------------------------------
+///  InitTaskGraph.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef InitTaskGraph_h
+#define InitTaskGraph_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+/// Dependency graph of startup tasks. A task becomes ready once all of its dependencies are done.
+/// Ready worker tasks are each run on their own thread straight away, whereas main thread tasks run
+/// from Update() (a frame's worth at a time, so that a loading screen can keep rendering). Main thread
+/// tasks may also be polled, i.e. report PENDING to be called again on the next Update() (e.g. for
+/// non-blocking handshakes). Any task may report FAILED, after which nothing else is run and the
+/// graph is never complete. Every task is timed (and shows up in the profiler under its name).
+class InitTaskGraph final
+{
+public:
+    enum class TaskAffinity
+    {
+        MAIN_THREAD,
+        WORKER_THREAD  // must not touch GL, or any non thread-safe engine system
+    };
+
+    enum class TaskStatus
+    {
+        DONE,
+        PENDING,       // main thread tasks only
+        FAILED
+    };
+
+    using TaskFunction = std::function<TaskStatus()>;
+
+    struct TaskTiming
+    {
+        const char* mName = nullptr;
+        TaskAffinity mAffinity = TaskAffinity::MAIN_THREAD;
+        float mStartMillis = 0.0f;  // since Start()
+        float mEndMillis = 0.0f;    // since Start()
+        float mBusyMillis = 0.0f;   // actually spent executing (less than the span for polled tasks)
+        int mExecutionCount = 0;
+    };
+
+    InitTaskGraph() = default;
+    ~InitTaskGraph();
+
+    InitTaskGraph(const InitTaskGraph&) = delete;
+    InitTaskGraph(InitTaskGraph&&) = delete;
+    const InitTaskGraph& operator = (const InitTaskGraph&) = delete;
+    InitTaskGraph& operator = (InitTaskGraph&&) = delete;
+
+    /// Only before Start().
+    /// @param[in] name needs to be a string literal (used as the task's profiler scope name)
+    /// @param[in] dependencies names of the (previously or later added) tasks that need to be done first
+    void AddTask(const char* name, const TaskAffinity affinity, const std::vector<const char*>& dependencies, TaskFunction taskFunction);
+
+    /// Validates the graph (unknown dependencies, cycles) and dispatches all initially ready worker tasks.
+    /// @returns false if the graph is invalid (in which case nothing is run).
+    bool Start();
+
+    /// Runs ready main thread tasks until the budget is exceeded, and dispatches newly ready worker tasks.
+    void Update(const float budgetMillis);
+
+    /// Blocks until all tasks are done.
+    void RunToCompletion();
+
+    bool IsComplete() const;
+
+    /// @returns whether any task has failed (in which case the graph will never complete).
+    bool HasFailed() const;
+
+    /// @returns the name of the (first) failed task, or nullptr if none has failed.
+    const char* GetFailedTaskName() const;
+
+    float GetProgress() const;
+
+    /// @returns the timings of all finished tasks, in the order they were seen finishing.
+    const std::vector<TaskTiming>& GetTaskTimings() const;
+    float GetTotalMillis() const;
+
+    /// Logs the per task startup time breakdown.
+    void LogTimingReport() const;
+
+private:
+    struct Task
+    {
+        const char* mName = nullptr;
+        TaskAffinity mAffinity = TaskAffinity::MAIN_THREAD;
+        TaskFunction mTaskFunction;
+        std::vector<size_t> mDependencyIndices;
+        std::vector<const char*> mDependencyNames;
+        std::thread mWorkerThread;
+        std::atomic<bool> mWorkerFinished = false;
+        TaskStatus mWorkerStatus = TaskStatus::DONE; // published by mWorkerFinished
+        TaskTiming mTiming;
+        bool mStarted = false;
+        bool mDone = false;
+    };
+
+    bool IsReady(const Task& task) const;
+    void DispatchReadyWorkerTasks();
+    void CollectFinishedWorkerTasks();
+    void FinishTask(Task& task);
+    void FailTask(const Task& task);
+    float GetMillisSinceStart() const;
+
+private:
+    std::vector<std::unique_ptr<Task>> mTasks;
+    std::vector<TaskTiming> mTaskTimings;
+    std::chrono::steady_clock::time_point mStartTime;
+    size_t mDoneTaskCount = 0;
+    const char* mFailedTaskName = nullptr;
+    bool mStarted = false;
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* InitTaskGraph_h */
@@ -0,0 +1,345 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystem.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <engine/utils/JobSystem.h>
+#include <engine/utils/MathUtils.h>
+
+///------------------------------------------------------------------------------------------------
+
+struct JobSystem::Job
+{
+    JobFunction mJobFunction;
+    Job* mParent = nullptr;
+    std::atomic<int> mUnfinishedJobCount = 0; // itself + unfinished children
+};
+
+///------------------------------------------------------------------------------------------------
+/// Bounded Chase-Lev deque. The owning thread pushes & pops at the bottom, other threads steal from
+/// the top, and only the last remaining job is contended for (through the CAS on the top index).
+class JobDeque final
+{
+public:
+    static constexpr size_t CAPACITY = JobSystem::MAX_JOBS_PER_THREAD;
+
+    /// Owner only. @returns false if full
+    bool Push(JobSystem::Job* job)
+    {
+        const auto bottom = mBottom.load(std::memory_order_relaxed);
+        const auto top = mTop.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(CAPACITY))
+        {
+            return false;
+        }
+
+        mJobs[bottom & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+        mBottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Owner only.
+    JobSystem::Job* Pop()
+    {
+        const auto bottom = mBottom.load(std::memory_order_relaxed) - 1;
+        mBottom.store(bottom, std::memory_order_seq_cst);
+        auto top = mTop.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            // Empty
+            mBottom.store(bottom + 1, std::memory_order_release);
+            return nullptr;
+        }
+
+        auto* job = mJobs[bottom & (CAPACITY - 1)].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            // Last job, race the thieves for it
+            if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                job = nullptr;
+            }
+            mBottom.store(bottom + 1, std::memory_order_release);
+        }
+        return job;
+    }
+
+    /// Any thread.
+    JobSystem::Job* Steal()
+    {
+        auto top = mTop.load(std::memory_order_seq_cst);
+        const auto bottom = mBottom.load(std::memory_order_seq_cst);
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        auto* job = mJobs[top & (CAPACITY - 1)].load(std::memory_order_relaxed);
+        if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return job;
+    }
+
+private:
+    alignas(64) std::atomic<int64_t> mTop = 0;
+    alignas(64) std::atomic<int64_t> mBottom = 0;
+    std::atomic<JobSystem::Job*> mJobs[CAPACITY] = {};
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct JobSystem::ThreadContext
+{
+    JobDeque mJobDeque;
+    std::unique_ptr<Job[]> mJobPool = std::make_unique<Job[]>(MAX_JOBS_PER_THREAD);
+    size_t mNextJobPoolIndex = 0;
+    size_t mNextStealIndex = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+// Worker threads know their context index through this (the creating thread's is always 0)
+struct WorkerThreadJobSystemContext
+{
+    const JobSystem* mJobSystem = nullptr;
+    size_t mThreadIndex = 0;
+};
+static thread_local WorkerThreadJobSystemContext sWorkerThreadContext;
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::JobSystem(const int workerThreadCount /* = -1 */)
+    : mCreatingThreadId(std::this_thread::get_id())
+{
+    const auto finalWorkerThreadCount = workerThreadCount >= 0 ? workerThreadCount : std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+    for (int i = 0; i < finalWorkerThreadCount + 1; ++i)
+    {
+        mThreadContexts.push_back(std::make_unique<ThreadContext>());
+    }
+
+    for (int i = 0; i < finalWorkerThreadCount; ++i)
+    {
+        mWorkerThreads.emplace_back([this, i](){ WorkerThreadLoop(static_cast<size_t>(i + 1)); });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(mWakeUpMutex);
+        mShuttingDown = true;
+    }
+    mWakeUpCondition.notify_all();
+
+    for (auto& workerThread: mWorkerThreads)
+    {
+        workerThread.join();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::Job* JobSystem::CreateJob(JobFunction jobFunction, Job* parent /* = nullptr */)
+{
+    auto& threadContext = GetCurrentThreadContext();
+
+    auto* job = &threadContext.mJobPool[threadContext.mNextJobPoolIndex++ & (MAX_JOBS_PER_THREAD - 1)];
+
+    // Also orders the reuse after the previous execution (on whichever thread that happened)
+    [[maybe_unused]] const auto previousUnfinishedJobCount = job->mUnfinishedJobCount.load(std::memory_order_acquire);
+    assert(previousUnfinishedJobCount == 0 && "Job pool exhausted, too many jobs in flight");
+
+    if (parent)
+    {
+        assert(!IsFinished(parent));
+        parent->mUnfinishedJobCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    job->mJobFunction = std::move(jobFunction);
+    job->mParent = parent;
+    job->mUnfinishedJobCount.store(1, std::memory_order_relaxed);
+    return job;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::Run(Job* job)
+{
+    auto& threadContext = GetCurrentThreadContext();
+    if (!threadContext.mJobDeque.Push(job))
+    {
+        Execute(job);
+        return;
+    }
+
+    mQueuedJobCount.fetch_add(1, std::memory_order_seq_cst);
+    if (mSleepingWorkerCount.load(std::memory_order_seq_cst) > 0)
+    {
+        // Taking the lock guarantees that a worker about to sleep either sees the new job or gets notified
+        {
+            std::lock_guard<std::mutex> lock(mWakeUpMutex);
+        }
+        mWakeUpCondition.notify_one();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::Wait(const Job* job)
+{
+    auto& threadContext = GetCurrentThreadContext();
+    while (!IsFinished(job))
+    {
+        if (auto* nextJob = GetJob(threadContext))
+        {
+            Execute(nextJob);
+        }
+        else
+        {
+            // Remaining jobs are in flight on other threads
+            std::this_thread::yield();
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool JobSystem::IsFinished(const Job* job) const
+{
+    return job->mUnfinishedJobCount.load(std::memory_order_acquire) == 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::ParallelFor(const size_t count, const size_t minBatchSize, const std::function<void(const size_t, const size_t)>& rangeFunction)
+{
+    // A few batches per thread, so that threads finishing early can steal the remaining ones
+    const auto threadCount = mThreadContexts.size();
+    const auto batchSize = std::max(std::max(minBatchSize, static_cast<size_t>(1)), (count + threadCount * 4 - 1)/(threadCount * 4));
+
+    if (count <= batchSize || threadCount == 1)
+    {
+        if (count > 0)
+        {
+            rangeFunction(0, count);
+        }
+        return;
+    }
+
+    auto* rootJob = CreateJob(nullptr);
+    for (size_t begin = batchSize; begin < count; begin += batchSize)
+    {
+        const auto end = std::min(begin + batchSize, count);
+        Run(CreateJob([&rangeFunction, begin, end](){ rangeFunction(begin, end); }, rootJob));
+    }
+
+    // The first batch is executed right here, rather than queued
+    rangeFunction(0, batchSize);
+    Finish(rootJob);
+    Wait(rootJob);
+}
+
+///------------------------------------------------------------------------------------------------
+
+int JobSystem::GetWorkerThreadCount() const
+{
+    return static_cast<int>(mWorkerThreads.size());
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::ThreadContext& JobSystem::GetCurrentThreadContext()
+{
+    if (sWorkerThreadContext.mJobSystem == this)
+    {
+        return *mThreadContexts[sWorkerThreadContext.mThreadIndex];
+    }
+
+    assert(std::this_thread::get_id() == mCreatingThreadId && "Jobs can only be used from the thread that created the job system, or from within jobs");
+    return *mThreadContexts[0];
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::Job* JobSystem::GetJob(ThreadContext& threadContext)
+{
+    auto* job = threadContext.mJobDeque.Pop();
+
+    if (!job)
+    {
+        // Steal from the others, starting where the last search left off
+        const auto threadCount = mThreadContexts.size();
+        for (size_t i = 0; i < threadCount && !job; ++i)
+        {
+            auto& victimContext = *mThreadContexts[threadContext.mNextStealIndex++ % threadCount];
+            if (&victimContext != &threadContext)
+            {
+                job = victimContext.mJobDeque.Steal();
+            }
+        }
+    }
+
+    if (job)
+    {
+        mQueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::Execute(Job* job)
+{
+    if (job->mJobFunction)
+    {
+        job->mJobFunction();
+    }
+    Finish(job);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::Finish(Job* job)
+{
+    // Read before finishing, as the job can be recycled as soon as it is seen as finished
+    auto* parent = job->mParent;
+    if (job->mUnfinishedJobCount.fetch_sub(1, std::memory_order_acq_rel) == 1 && parent)
+    {
+        Finish(parent);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::WorkerThreadLoop(const size_t threadIndex)
+{
+    sWorkerThreadContext = { this, threadIndex };
+    math::SetRandomEngineThreadIndex(threadIndex);
+    auto& threadContext = *mThreadContexts[threadIndex];
+
+    while (!mShuttingDown.load(std::memory_order_relaxed))
+    {
+        if (auto* job = GetJob(threadContext))
+        {
+            Execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mWakeUpMutex);
+        mSleepingWorkerCount.fetch_add(1, std::memory_order_seq_cst);
+        mWakeUpCondition.wait(lock, [this](){ return mQueuedJobCount.load(std::memory_order_seq_cst) > 0 || mShuttingDown.load(std::memory_order_relaxed); });
+        mSleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,92 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystem.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef JobSystem_h
+#define JobSystem_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+/// Fork/join job system for spreading a frame's work across cores. Every participating thread (the
+/// thread that created the system plus the worker threads) owns a lock-free deque of jobs: it pushes
+/// and pops its own jobs LIFO from the bottom, whereas idle threads steal FIFO from the top of the
+/// others'. Jobs can be children of a parent job, which then only counts as finished once all of its
+/// children have, so waiting on a single root job waits on a whole tree of them. Waiting threads
+/// keep executing jobs rather than blocking.
+///
+/// Jobs may only be created, run and waited on from the creating thread or from within other jobs.
+/// Job handles are recycled (from a per thread ring of MAX_JOBS_PER_THREAD), so they should not be
+/// held on to after having been waited on.
+class JobSystem final
+{
+public:
+    struct Job;
+    using JobFunction = std::function<void()>;
+
+    /// @param[in] workerThreadCount -1 for one per core other than the creating thread's. With no
+    /// worker threads, all jobs are executed by the creating thread while waiting on them.
+    explicit JobSystem(const int workerThreadCount = -1);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    const JobSystem& operator = (const JobSystem&) = delete;
+    JobSystem& operator = (JobSystem&&) = delete;
+
+    /// @param[in] parent (optional) job that will only finish once this one has. Must not have finished yet.
+    Job* CreateJob(JobFunction jobFunction, Job* parent = nullptr);
+
+    /// Queues the job on the calling thread's deque (or executes it right away if the deque is full).
+    void Run(Job* job);
+
+    /// Executes queued jobs (of any thread) until the given one, and all of its children, have finished.
+    void Wait(const Job* job);
+
+    bool IsFinished(const Job* job) const;
+
+    /// Splits [0, count) into batches of at least minBatchSize elements, executes rangeFunction(begin, end)
+    /// for each of them across the participating threads, and returns once all of them are done.
+    void ParallelFor(const size_t count, const size_t minBatchSize, const std::function<void(const size_t, const size_t)>& rangeFunction);
+
+    /// Worker threads only (excludes the creating thread).
+    int GetWorkerThreadCount() const;
+
+public:
+    static constexpr size_t MAX_JOBS_PER_THREAD = 4096;
+
+private:
+    struct ThreadContext;
+
+    ThreadContext& GetCurrentThreadContext();
+    Job* GetJob(ThreadContext& threadContext);
+    void Execute(Job* job);
+    void Finish(Job* job);
+    void WorkerThreadLoop(const size_t threadIndex);
+
+private:
+    std::vector<std::unique_ptr<ThreadContext>> mThreadContexts; // creating thread's at index 0
+    std::vector<std::thread> mWorkerThreads;
+    const std::thread::id mCreatingThreadId;
+    std::mutex mWakeUpMutex;
+    std::condition_variable mWakeUpCondition;
+    std::atomic<int> mQueuedJobCount = 0;
+    std::atomic<int> mSleepingWorkerCount = 0;
+    std::atomic<bool> mShuttingDown = false;
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* JobSystem_h */
@@ -5,57 +5,329 @@
 ///  Created by Alex Koukoulas on 25/04/2024
 ///------------------------------------------------------------------------------------------------
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 
 #include <engine/utils/Logging.h>
 #include <engine/utils/Date.h>
+#include <engine/utils/MPSCRingBuffer.h>
 
 ///------------------------------------------------------------------------------------------------
 
-static std::mutex sLoggingMutex;
+namespace logging
+{
 
 ///------------------------------------------------------------------------------------------------
 
-namespace logging
+static constexpr size_t LOG_QUEUE_CAPACITY = 4096;
+static constexpr size_t LOG_RECORD_TEXT_CAPACITY = 512;
+
+struct LogRecord
 {
+    LogType mLogType = LogType::INFO;
+    char mText[LOG_RECORD_TEXT_CAPACITY];
+};
 
 ///------------------------------------------------------------------------------------------------
 
-void Log(const LogType logType, const char* message, ...)
+static std::mutex sLoggingMutex; // guards the sinks
+static FILE* sFileSink = nullptr;
+static std::atomic<bool> sConsoleSinkEnabled = true;
+static std::atomic<LoggingMode> sLoggingMode = LoggingMode::ASYNCHRONOUS;
+static std::atomic<bool> sCategoriesEnabled[static_cast<int>(LogCategory::COUNT)] = { true, true, true, true, true };
+
+///------------------------------------------------------------------------------------------------
+
+static const char* GetLogTypeTag(const LogType logType)
 {
-    std::lock_guard<std::mutex> loggingGuard(sLoggingMutex);
     switch(logType)
     {
-        case LogType::INFO: printf("[INFO] "); break;
-        case LogType::WARNING: printf("[WARNING] "); break;
-        case LogType::ERROR: printf("[ERROR] "); break;
+        case LogType::INFO: return "[INFO] ";
+        case LogType::WARNING: return "[WARNING] ";
+        case LogType::ERROR: return "[ERROR] ";
     }
-    
-    va_list args;
-    va_start (args, message);
-    vprintf (message, args);
-    va_end (args);
-    
-    printf("\n");
-    
-    fflush(stdout);
+    return "";
+}
+
+///------------------------------------------------------------------------------------------------
+/// To be called with sLoggingMutex held.
+static void WriteToSinks(const LogType logType, const char* text)
+{
+    if (sConsoleSinkEnabled)
+    {
+        printf("%s%s\n", GetLogTypeTag(logType), text);
+    }
+
+    if (sFileSink)
+    {
+        fprintf(sFileSink, "%s%s\n", GetLogTypeTag(logType), text);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// To be called with sLoggingMutex held.
+static void FlushSinks()
+{
+    if (sConsoleSinkEnabled)
+    {
+        fflush(stdout);
+    }
+
+    if (sFileSink)
+    {
+        fflush(sFileSink);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void LogSynchronously(const LogType logType, const char* message, va_list args)
+{
+    std::lock_guard<std::mutex> loggingGuard(sLoggingMutex);
+
+    char text[LOG_RECORD_TEXT_CAPACITY];
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    const auto textLength = vsnprintf(text, sizeof(text), message, argsCopy);
+    va_end(argsCopy);
+
+    if (textLength >= 0 && static_cast<size_t>(textLength) < sizeof(text))
+    {
+        WriteToSinks(logType, text);
+    }
+    else
+    {
+        // Long messages (e.g. shader compilation errors) are printed straight through
+        std::string longText(static_cast<size_t>(textLength > 0 ? textLength : 0) + 1, '\0');
+        vsnprintf(longText.data(), longText.size(), message, args);
+        WriteToSinks(logType, longText.c_str());
+    }
+
+    FlushSinks();
+}
+
+///------------------------------------------------------------------------------------------------
+/// Producers format straight into a claimed queue slot, and a background thread writes out whole
+/// batches with a single flush per batch.
+class AsyncLogWriter final
+{
+public:
+    static AsyncLogWriter& GetInstance()
+    {
+        static AsyncLogWriter instance;
+        return instance;
+    }
+
+    ~AsyncLogWriter()
+    {
+        mRunning = false;
+        if (mWriterThread.joinable())
+        {
+            mWriterThread.join();
+        }
+        sShutDown = true;
+    }
+
+    /// @returns false if the formatted message did not fit a record (to be logged synchronously instead)
+    bool Enqueue(const LogType logType, const char* message, va_list args)
+    {
+        bool fitsRecord = true;
+        const auto pushRecord = [&](LogRecord& record)
+        {
+            record.mLogType = logType;
+
+            va_list argsCopy;
+            va_copy(argsCopy, args);
+            const auto textLength = vsnprintf(record.mText, sizeof(record.mText), message, argsCopy);
+            va_end(argsCopy);
+
+            if (textLength < 0 || static_cast<size_t>(textLength) >= sizeof(record.mText))
+            {
+                // Still published (as an empty record), so that the queue stays ordered
+                record.mText[0] = '\0';
+                fitsRecord = false;
+            }
+        };
+
+        // Full queue: wait for the writer to catch up rather than drop messages
+        while (!mQueue.TryPushInPlace(pushRecord))
+        {
+            std::this_thread::yield();
+        }
+        mEnqueuedCount.fetch_add(1, std::memory_order_release);
+
+        return fitsRecord;
+    }
+
+    void Flush()
+    {
+        const auto enqueuedCount = mEnqueuedCount.load(std::memory_order_acquire);
+        while (mWrittenCount.load(std::memory_order_acquire) < enqueuedCount)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    static bool IsShutDown() { return sShutDown; }
+
+private:
+    AsyncLogWriter()
+        : mQueue(LOG_QUEUE_CAPACITY)
+    {
+        mWriterThread = std::thread([this]()
+        {
+            while (true)
+            {
+                // Read before draining, so that everything enqueued before shutdown gets written
+                const auto running = mRunning.load();
+
+                size_t writtenRecordCount = 0;
+                {
+                    std::lock_guard<std::mutex> loggingGuard(sLoggingMutex);
+                    while (mQueue.TryPopInPlace([](const LogRecord& record)
+                    {
+                        if (record.mText[0] != '\0')
+                        {
+                            WriteToSinks(record.mLogType, record.mText);
+                        }
+                    }))
+                    {
+                        writtenRecordCount++;
+                    }
+
+                    if (writtenRecordCount > 0)
+                    {
+                        FlushSinks();
+                    }
+                }
+
+                if (writtenRecordCount > 0)
+                {
+                    mWrittenCount.fetch_add(writtenRecordCount, std::memory_order_release);
+                    continue;
+                }
+
+                if (!running)
+                {
+                    break;
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    }
+
+private:
+    static inline std::atomic<bool> sShutDown = false;
+
+    MPSCRingBuffer<LogRecord> mQueue;
+    std::thread mWriterThread;
+    std::atomic<bool> mRunning = true;
+    std::atomic<size_t> mEnqueuedCount = 0;
+    std::atomic<size_t> mWrittenCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+void SetLoggingMode(const LoggingMode loggingMode)
+{
+    if (loggingMode == LoggingMode::SYNCHRONOUS && !AsyncLogWriter::IsShutDown())
+    {
+        // Keep ordering with what is still in flight
+        AsyncLogWriter::GetInstance().Flush();
+    }
+    sLoggingMode = loggingMode;
+}
+
+///------------------------------------------------------------------------------------------------
+
+LoggingMode GetLoggingMode()
+{
+    return sLoggingMode;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void SetCategoryEnabled(const LogCategory logCategory, const bool enabled)
+{
+    sCategoriesEnabled[static_cast<int>(logCategory)] = enabled;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool IsCategoryEnabled(const LogCategory logCategory)
+{
+    return sCategoriesEnabled[static_cast<int>(logCategory)].load(std::memory_order_relaxed);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void SetConsoleSinkEnabled(const bool enabled)
+{
+    Flush();
+    sConsoleSinkEnabled = enabled;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void LogInfo(const char* message, ...)
+bool SetFileSink(const std::string& filePath)
 {
+    Flush();
+
     std::lock_guard<std::mutex> loggingGuard(sLoggingMutex);
+    if (sFileSink)
+    {
+        fclose(sFileSink);
+        sFileSink = nullptr;
+    }
+
+    if (filePath.empty())
+    {
+        return true;
+    }
+
+    sFileSink = fopen(filePath.c_str(), "a");
+    return sFileSink != nullptr;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Flush()
+{
+    if (!AsyncLogWriter::IsShutDown())
+    {
+        AsyncLogWriter::GetInstance().Flush();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
 
-    printf("[INFO] ");
+void LogMessage(const LogCategory, const LogType logType, const char* message, ...)
+{
     va_list args;
-    va_start (args, message);
-    vprintf (message, args);
-    va_end (args);
-    
-    printf("\n");
-    
-    fflush(stdout);
+    va_start(args, message);
+
+    // Statics logging on their way out (after the writer is gone) are written synchronously
+    if (sLoggingMode == LoggingMode::SYNCHRONOUS || AsyncLogWriter::IsShutDown())
+    {
+        LogSynchronously(logType, message, args);
+    }
+    else
+    {
+        auto& asyncLogWriter = AsyncLogWriter::GetInstance();
+        if (!asyncLogWriter.Enqueue(logType, message, args))
+        {
+            asyncLogWriter.Flush();
+            LogSynchronously(logType, message, args);
+        }
+        else if (logType == LogType::ERROR)
+        {
+            asyncLogWriter.Flush();
+        }
+    }
+
+    va_end(args);
 }
 
 ///------------------------------------------------------------------------------------------------
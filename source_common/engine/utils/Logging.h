@@ -26,6 +26,11 @@ namespace logging
 
 #define LOG_IN_RELEASE
 
+/// Messages of a lower type than this (0: INFO, 1: WARNING, 2: ERROR) are compiled out
+#if !defined(LOG_MIN_TYPE)
+#define LOG_MIN_TYPE 0
+#endif
+
 ///-----------------------------------------------------------------------------------------------
 /// Different types of logging available
 enum class LogType
@@ -34,16 +39,76 @@ enum class LogType
 };
 
 ///-----------------------------------------------------------------------------------------------
-/// Logs a message to the std out, with a custom log type tag \see LogType
+/// Subsystems that can be (runtime) muted individually \see SetCategoryEnabled
+enum class LogCategory
+{
+    GENERAL, RESOURCES, RENDERING, SOUND, NETWORK, COUNT
+};
+
+///-----------------------------------------------------------------------------------------------
+/// How messages reach the sinks.
+enum class LoggingMode
+{
+    SYNCHRONOUS,  // formatted & flushed by the calling thread, under a global lock
+    ASYNCHRONOUS  // formatted by the calling thread into a lock-free queue, written & flushed in batches by a background thread
+};
+
+///-----------------------------------------------------------------------------------------------
+
+void SetLoggingMode(const LoggingMode loggingMode);
+LoggingMode GetLoggingMode();
+
+void SetCategoryEnabled(const LogCategory logCategory, const bool enabled);
+bool IsCategoryEnabled(const LogCategory logCategory);
+
+void SetConsoleSinkEnabled(const bool enabled);
+
+///-----------------------------------------------------------------------------------------------
+/// Additionally writes all messages to the given file (appending to it). An empty path closes the file sink.
+/// @returns whether the file could be opened.
+bool SetFileSink(const std::string& filePath);
+
+///-----------------------------------------------------------------------------------------------
+/// Blocks until all messages logged so far have been written to the sinks.
+void Flush();
+
+///-----------------------------------------------------------------------------------------------
+/// Formats and dispatches the message to the sinks (no type/category filtering). Prefer Log().
+void LogMessage(const LogCategory logCategory, const LogType logType, const char* message, ...);
+
+///-----------------------------------------------------------------------------------------------
+/// Logs a message to the std out (and the file sink if any), with a custom log type tag \see LogType
+/// Errors are flushed before returning (so that they precede e.g. a failed assert's output).
+/// @param[in] logCategory the subsystem logging the message
 /// @param[in] logType the category of logging message
 /// @param[in] message the message itself as a c-string
+template<typename... Args>
+inline void Log(const LogCategory logCategory, const LogType logType, const char* message, Args... args)
+{
 #if !defined(NDEBUG) || defined(LOG_IN_RELEASE)
-void Log(const LogType logType, const char* message, ...);
-void LogInfo(const char* message, ...);
+    // Call sites pass constant log types, so filtered out messages are optimized away entirely
+    if (static_cast<int>(logType) < LOG_MIN_TYPE || !IsCategoryEnabled(logCategory))
+    {
+        return;
+    }
+
+    LogMessage(logCategory, logType, message, args...);
 #else
-void Log(const LogType, const char*, ...) {}
-void LogInfo(const char* message, ...) {}
+    (void)logCategory; (void)logType; (void)message; ((void)args, ...);
 #endif /* not NDEBUG */
+}
+
+template<typename... Args>
+inline void Log(const LogType logType, const char* message, Args... args)
+{
+    Log(LogCategory::GENERAL, logType, message, args...);
+}
+
+template<typename... Args>
+inline void LogInfo(const char* message, Args... args)
+{
+    Log(LogCategory::GENERAL, LogType::INFO, message, args...);
+}
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -0,0 +1,143 @@
+///------------------------------------------------------------------------------------------------
+///  MPSCRingBuffer.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef MPSCRingBuffer_h
+#define MPSCRingBuffer_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+///------------------------------------------------------------------------------------------------
+/// Bounded, lock-free, multi-producer single-consumer queue (after Dmitry Vyukov's bounded queue).
+/// Every slot carries a sequence number, so producers only contend on a single CAS to claim a slot
+/// and then fill it in place, while the consumer never blocks them. Elements are constructed up front
+/// and reused, hence the in place write/read overloads for large elements.
+template<typename T>
+class MPSCRingBuffer final
+{
+public:
+    /// @param[in] capacity rounded up to the next power of 2
+    explicit MPSCRingBuffer(const size_t capacity)
+    {
+        size_t roundedCapacity = 2;
+        while (roundedCapacity < capacity) roundedCapacity <<= 1;
+
+        mMask = roundedCapacity - 1;
+        mSlots = std::make_unique<Slot[]>(roundedCapacity);
+        for (size_t i = 0; i < roundedCapacity; ++i)
+        {
+            mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCRingBuffer(const MPSCRingBuffer&) = delete;
+    MPSCRingBuffer(MPSCRingBuffer&&) = delete;
+    const MPSCRingBuffer& operator = (const MPSCRingBuffer&) = delete;
+    MPSCRingBuffer& operator = (MPSCRingBuffer&&) = delete;
+
+    size_t GetCapacity() const { return mMask + 1; }
+
+    /// Safe to call from any number of threads.
+    /// @param[in] writeFunction called with the claimed (reused) element to fill in
+    /// @returns false if the buffer is full
+    template<typename WriteFunction>
+    bool TryPushInPlace(WriteFunction&& writeFunction)
+    {
+        auto position = mEnqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true)
+        {
+            slot = &mSlots[position & mMask];
+            const auto sequence = slot->mSequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0)
+            {
+                if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        writeFunction(slot->mValue);
+        slot->mSequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPush(T value)
+    {
+        return TryPushInPlace([&](T& slotValue){ slotValue = std::move(value); });
+    }
+
+    /// Only to be called from the (single) consumer thread.
+    /// @param[in] readFunction called with the oldest element, which is recycled right after
+    /// @returns false if the buffer is empty
+    template<typename ReadFunction>
+    bool TryPopInPlace(ReadFunction&& readFunction)
+    {
+        auto& slot = mSlots[mDequeuePosition & mMask];
+        const auto sequence = slot.mSequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(mDequeuePosition + 1) < 0)
+        {
+            return false;
+        }
+
+        readFunction(slot.mValue);
+        slot.mSequence.store(mDequeuePosition + mMask + 1, std::memory_order_release);
+        mDequeuePosition++;
+        return true;
+    }
+
+    bool TryPop(T& value)
+    {
+        return TryPopInPlace([&](T& slotValue){ value = std::move(slotValue); });
+    }
+
+    /// Only to be called from the (single) consumer thread. Pops up to maxCount elements, stopping
+    /// early at the first slot that hasn't been published yet.
+    /// @returns the number of elements popped
+    template<typename ReadFunction>
+    size_t Drain(ReadFunction&& readFunction, const size_t maxCount = std::numeric_limits<size_t>::max())
+    {
+        size_t count = 0;
+        while (count < maxCount && TryPopInPlace(readFunction))
+        {
+            count++;
+        }
+        return count;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        T mValue;
+    };
+
+    std::unique_ptr<Slot[]> mSlots;
+    size_t mMask = 0;
+    alignas(64) std::atomic<size_t> mEnqueuePosition = 0;
+    alignas(64) size_t mDequeuePosition = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* MPSCRingBuffer_h */
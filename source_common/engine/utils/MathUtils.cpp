@@ -5,6 +5,7 @@
 ///  Created by Alex Koukoulas on 19/09/2023.
 ///-----------------------------------------------------------------------------------------------
 
+#include <atomic>
 #include <engine/utils/MathUtils.h>
 #include <SDL_mouse.h>
 
@@ -18,6 +19,20 @@ namespace math
 static int controlledRandomSeed = 0;
 static int internalRand();
 
+// Bumped by every SeedRandomEngines() call, so that each thread notices it needs to reseed its engine
+static std::atomic<unsigned int> sRandomEnginesSeed = 0;
+static std::atomic<uint64_t> sRandomEnginesSeedGeneration = 0;
+
+struct ThreadRandomEngine
+{
+    ThreadRandomEngine() : mEngine(std::random_device()()) {}
+    
+    std::mt19937 mEngine;
+    uint64_t mSeedGeneration = 0;
+    size_t mThreadIndex = 0;
+};
+static thread_local ThreadRandomEngine sThreadRandomEngine;
+
 ///-----------------------------------------------------------------------------------------------
 
 int GetControlSeed()
@@ -70,9 +85,31 @@ int ControlledIndexSelectionFromDistribution(const ProbabilityDistribution& prob
 
 std::mt19937& GetRandomEngine()
 {
-    static std::random_device rd;
-    static std::mt19937 eng(rd());
-    return eng;
+    // Per thread, as particles (and other job system work) spawn randomly from multiple threads
+    auto& threadRandomEngine = sThreadRandomEngine;
+    const auto seedGeneration = sRandomEnginesSeedGeneration.load(std::memory_order_acquire);
+    if (threadRandomEngine.mSeedGeneration != seedGeneration)
+    {
+        std::seed_seq seedSequence{ sRandomEnginesSeed.load(std::memory_order_relaxed), static_cast<unsigned int>(threadRandomEngine.mThreadIndex) };
+        threadRandomEngine.mEngine.seed(seedSequence);
+        threadRandomEngine.mSeedGeneration = seedGeneration;
+    }
+    return threadRandomEngine.mEngine;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void SeedRandomEngines(const unsigned int seed)
+{
+    sRandomEnginesSeed.store(seed, std::memory_order_relaxed);
+    sRandomEnginesSeedGeneration.fetch_add(1, std::memory_order_release);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void SetRandomEngineThreadIndex(const size_t threadIndex)
+{
+    sThreadRandomEngine.mThreadIndex = threadIndex;
 }
 
 ///-----------------------------------------------------------------------------------------------
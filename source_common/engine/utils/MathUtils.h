@@ -111,7 +111,7 @@ inline float Sinf(const float val)
 /// @returns the cosine of the value.
 inline float Cosf(const float val)
 {
-    return std::cosf(val);
+    return std::cos(val);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -157,7 +157,7 @@ inline T Slerp(const T x, const T y, const float theta, const float t)
 /// @returns the square root of the value.
 inline float Sqrt(const float val)
 {
-    return std::sqrtf(val);
+    return std::sqrt(val);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -241,6 +241,10 @@ enum class TweeningMode
     EASE_IN, EASE_OUT, EASE_IN_OUT
 };
 
+///-----------------------------------------------------------------------------------------------
+/// Plain tweening function (e.g. LinearFunction), for code storing many of them \see rendering::TweenTime
+using TweeningFunction = float(*)(const float);
+
 ///-----------------------------------------------------------------------------------------------
 /// Linear Tweening function to be used by clients of the TweenValue function. \see TweenValue()
 /// @param[in] t the input value to the tween function.
@@ -256,7 +260,7 @@ inline float LinearFunction(const float t)
 /// @returns the transformed t value quadratically.
 inline float QuadFunction(const float t)
 {
-    return std::powf(t, 2.0f);
+    return std::pow(t, 2.0f);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -265,7 +269,7 @@ inline float QuadFunction(const float t)
 /// @returns the transformed t value cubically.
 inline float CubicFunction(const float t)
 {
-    return std::powf(t, 3.0f);
+    return std::pow(t, 3.0f);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -274,7 +278,7 @@ inline float CubicFunction(const float t)
 /// @returns the transformed t value quartically.
 inline float QuartFunction(const float t)
 {
-    return std::powf(t, 4.0f);
+    return std::pow(t, 4.0f);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -283,7 +287,7 @@ inline float QuartFunction(const float t)
 /// @returns the transformed t value quintically.
 inline float QuintFunction(const float t)
 {
-    return std::powf(t, 5.0f);
+    return std::pow(t, 5.0f);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -292,7 +296,7 @@ inline float QuintFunction(const float t)
 /// @returns the transformed t value based on the back function.
 inline float BackFunction(const float t)
 {
-    return std::powf(t, 2.0f) * (2.70158f * t - 1.70158f);
+    return std::pow(t, 2.0f) * (2.70158f * t - 1.70158f);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -329,7 +333,7 @@ inline float ElasticFunction(const float t)
 
     if (t <= 0.0f) return 0.0f;
     else if (t >= 1.0f) return 1.0f;
-    else return std::powf(2.0f, -10.0f * t) * std::sinf((t * 10.0f -0.75f) * c4) + 1.0f;
+    else return std::pow(2.0f, -10.0f * t) * std::sin((t * 10.0f -0.75f) * c4) + 1.0f;
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -350,6 +354,24 @@ inline float TweenValue(const float val, const std::function<float(const float)>
     return 0.0f;
 }
 
+///-----------------------------------------------------------------------------------------------
+/// TweenValue() overload for plain tweening functions, sparing the std::function wrapping.
+/// @param[in] val the value to be tweened in [0..1] range.
+/// @param[in] tweeningFunc the tweening function to be used.
+/// @param[in] tweeningMode the tweening mode (defaults to ease in).
+/// @returns the tweened value.
+inline float TweenValue(const float val, const TweeningFunction tweeningFunc, const TweeningMode tweeningMode = TweeningMode::EASE_IN)
+{
+    switch (tweeningMode)
+    {
+        case TweeningMode::EASE_IN: return tweeningFunc(val);
+        case TweeningMode::EASE_OUT: return 1.0f - tweeningFunc(1.0f - val);
+        case TweeningMode::EASE_IN_OUT: return (val < 0.5f) ? tweeningFunc(val * 2.0f)/2.0f : 0.5f + (1.0f - tweeningFunc(1.0f - (val - 0.5f) * 2.0f))/2.0f;
+    }
+    
+    return 0.0f;
+}
+
 ///-----------------------------------------------------------------------------------------------
 /// Gets the custom  seed for a controlled sequence of generated random numbers.
 /// @returns the control seed that the random generation sequence will continue with/
@@ -382,10 +404,23 @@ float ControlledRandomFloat(const float min = 0.0f, const float max = 1.0f);
 int ControlledIndexSelectionFromDistribution(const ProbabilityDistribution& probDist);
 
 ///-----------------------------------------------------------------------------------------------
-/// Returns a mersenne_twister_engine
+/// Returns the calling thread's mersenne_twister_engine
 /// @returns the rng engine
 std::mt19937& GetRandomEngine();
 
+///-----------------------------------------------------------------------------------------------
+/// Reseeds the random engines of all threads (each one lazily, on its next GetRandomEngine() call)
+/// with a seed derived from the given one and the thread's index, so that every thread draws the
+/// same sequence run to run (e.g. for reproducible benchmark inputs).
+/// @param[in] seed the seed the per thread seeds are derived from
+void SeedRandomEngines(const unsigned int seed);
+
+///-----------------------------------------------------------------------------------------------
+/// Sets the calling thread's index in the derivation of its seed by SeedRandomEngines(). Threads
+/// default to 0 (the main thread's), so pooled threads need to set theirs (e.g. JobSystem workers).
+/// @param[in] threadIndex the stable index of the calling thread
+void SetRandomEngineThreadIndex(const size_t threadIndex);
+
 ///-----------------------------------------------------------------------------------------------
 /// Computes a random int based on the min and max inclusive values provided.
 /// @param[in] min the minimum value (inclusive) that the function can return (defaults to 0).
@@ -11,6 +11,7 @@
 ///-----------------------------------------------------------------------------------------------
 
 #include <engine/CoreSystemsEngine.h>
+#include <engine/utils/Logging.h>
 #include <SDL_messagebox.h>
 #include <string>
 
@@ -41,6 +42,13 @@ inline void ShowInfoMessageBox
     const std::string description = ""
 )
 {
+    // No display to show it on, so just log it
+    if (CoreSystemsEngine::IsHeadless())
+    {
+        logging::Log(messageBoxType == MessageBoxType::INFO ? logging::LogType::INFO : messageBoxType == MessageBoxType::WARNING ? logging::LogType::WARNING : logging::LogType::ERROR, "%s: %s", title.c_str(), description.c_str());
+        return;
+    }
+    
     SDL_ShowSimpleMessageBox
     (
         static_cast<SDL_MessageBoxFlags>(messageBoxType),
@@ -65,6 +73,14 @@ inline int ShowOkayCancelMessageBox
 )
 {
     int selectedButtonId = 0;
+    
+    // No one to click Okay, so treat it as cancelled
+    if (CoreSystemsEngine::IsHeadless())
+    {
+        logging::Log(logging::LogType::WARNING, "%s: %s (cancelled, headless)", title.c_str(), description.c_str());
+        return selectedButtonId;
+    }
+    
     SDL_MessageBoxData messageBoxData = {};
     messageBoxData.flags = static_cast<SDL_MessageBoxFlags>(messageBoxType);
     messageBoxData.window = &CoreSystemsEngine::GetInstance().GetContextWindow();
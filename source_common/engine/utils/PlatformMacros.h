@@ -21,6 +21,9 @@
         #define DESKTOP_FLOW
         #define MACOS
     #endif
+#elif defined(__linux__)
+    #define DESKTOP_FLOW
+    #define LINUX
 #endif
 
 #if defined(_MSC_VER)
@@ -0,0 +1,241 @@
+///------------------------------------------------------------------------------------------------
+///  Profiler.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <engine/utils/Logging.h>
+#include <engine/utils/Profiler.h>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+///------------------------------------------------------------------------------------------------
+
+namespace profiling
+{
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr uint32_t UNASSIGNED_THREAD_INDEX = static_cast<uint32_t>(-1);
+
+struct OpenScope
+{
+    const char* mName;
+    int64_t mStartMicros;
+};
+
+// Scopes nest per thread, so the open ones don't need any locking
+static thread_local std::vector<OpenScope> sOpenScopes;
+static thread_local uint32_t sThreadIndex = UNASSIGNED_THREAD_INDEX;
+
+///------------------------------------------------------------------------------------------------
+
+Profiler& Profiler::GetInstance()
+{
+    static Profiler instance;
+    return instance;
+}
+
+///------------------------------------------------------------------------------------------------
+
+Profiler::Profiler()
+    : mCreationTime(std::chrono::steady_clock::now())
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::SetEnabled(const bool enabled)
+{
+    mEnabled = enabled;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool Profiler::IsEnabled() const
+{
+    return mEnabled;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::BeginFrame()
+{
+    // Whichever thread drives the frames is always shown first
+    sThreadIndex = 0;
+
+    std::lock_guard<std::mutex> lock(mCurrentFrameMutex);
+    mCurrentFrame.mFrameIndex = mNextFrameIndex++;
+    mCurrentFrame.mStartMicros = GetMicrosSinceCreation();
+    mInFrame = true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(mCurrentFrameMutex);
+    if (!mInFrame)
+    {
+        return;
+    }
+
+    mInFrame = false;
+    mCurrentFrame.mDurationMicros = GetMicrosSinceCreation() - mCurrentFrame.mStartMicros;
+
+    if (!mEnabled)
+    {
+        // Paused captures keep the frames of interest around
+        mCurrentFrame.mSamples.clear();
+        mCurrentFrame.mDroppedSampleCount = 0;
+        return;
+    }
+
+    // Recycle the oldest frame's sample storage, so that steady state capturing doesn't allocate
+    std::vector<ScopeSample> recycledSamples;
+    if (mCapturedFrames.size() >= MAX_CAPTURED_FRAMES)
+    {
+        recycledSamples = std::move(mCapturedFrames.front().mSamples);
+        recycledSamples.clear();
+        mCapturedFrames.pop_front();
+    }
+
+    mCapturedFrames.push_back(std::move(mCurrentFrame));
+    mCurrentFrame = FrameProfile();
+    mCurrentFrame.mSamples = std::move(recycledSamples);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::BeginScope(const char* name)
+{
+    sOpenScopes.push_back({ name, GetMicrosSinceCreation() });
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::EndScope()
+{
+    if (sOpenScopes.empty())
+    {
+        return;
+    }
+
+    const auto endMicros = GetMicrosSinceCreation();
+    const auto openScope = sOpenScopes.back();
+    sOpenScopes.pop_back();
+
+    ScopeSample sample;
+    sample.mName = openScope.mName;
+    sample.mStartMicros = openScope.mStartMicros;
+    sample.mDurationMicros = endMicros - openScope.mStartMicros;
+    sample.mDepth = static_cast<uint32_t>(sOpenScopes.size());
+
+    std::lock_guard<std::mutex> lock(mCurrentFrameMutex);
+    sample.mThreadIndex = GetCurrentThreadIndex();
+
+    if (mCurrentFrame.mSamples.size() >= MAX_SAMPLES_PER_FRAME)
+    {
+        // Scopes recorded outside of frames (e.g. benchmarks, tests) would otherwise grow unbounded
+        mCurrentFrame.mDroppedSampleCount++;
+        return;
+    }
+
+    mCurrentFrame.mSamples.push_back(sample);
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::deque<FrameProfile>& Profiler::GetCapturedFrames() const
+{
+    return mCapturedFrames;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::ClearCapturedFrames()
+{
+    mCapturedFrames.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool Profiler::ExportChromeTrace(const std::string& filePath) const
+{
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        logging::Log(logging::LogType::ERROR, "Could not open %s for the chrome trace export", filePath.c_str());
+        return false;
+    }
+
+    file << CreateChromeTraceJson();
+    logging::Log(logging::LogType::INFO, "Exported %d profiled frames to %s", static_cast<int>(mCapturedFrames.size()), filePath.c_str());
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string Profiler::CreateChromeTraceJson() const
+{
+    // Complete ("X") events, see the Trace Event Format spec. Frames are emitted as their own events
+    // on the frame driving thread, so that the viewer nests every top level scope under its frame.
+    nlohmann::json traceEvents = nlohmann::json::array();
+    for (const auto& frame: mCapturedFrames)
+    {
+        traceEvents.push_back(
+        {
+            { "name", "Frame " + std::to_string(frame.mFrameIndex) },
+            { "cat", "frame" },
+            { "ph", "X" },
+            { "ts", frame.mStartMicros },
+            { "dur", frame.mDurationMicros },
+            { "pid", 0 },
+            { "tid", 0 }
+        });
+
+        for (const auto& sample: frame.mSamples)
+        {
+            traceEvents.push_back(
+            {
+                { "name", sample.mName },
+                { "cat", "engine" },
+                { "ph", "X" },
+                { "ts", sample.mStartMicros },
+                { "dur", sample.mDurationMicros },
+                { "pid", 0 },
+                { "tid", sample.mThreadIndex }
+            });
+        }
+    }
+
+    nlohmann::json trace;
+    trace["traceEvents"] = std::move(traceEvents);
+    trace["displayTimeUnit"] = "ms";
+    return trace.dump();
+}
+
+///------------------------------------------------------------------------------------------------
+
+int64_t Profiler::GetMicrosSinceCreation() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mCreationTime).count();
+}
+
+///------------------------------------------------------------------------------------------------
+
+uint32_t Profiler::GetCurrentThreadIndex()
+{
+    if (sThreadIndex == UNASSIGNED_THREAD_INDEX)
+    {
+        sThreadIndex = mNextThreadIndex++;
+    }
+    return sThreadIndex;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
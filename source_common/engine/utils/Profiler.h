@@ -0,0 +1,146 @@
+///------------------------------------------------------------------------------------------------
+///  Profiler.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef Profiler_h
+#define Profiler_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+#define PROFILE_SCOPE_CONCAT_INNER(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_INNER(a, b)
+
+/// Times the rest of the enclosing C++ scope under the given name (needs to be a string literal,
+/// or otherwise outlive the profiler's captured frames).
+#define PROFILE_SCOPE(name) profiling::ScopedTimer PROFILE_SCOPE_CONCAT(profileScope, __LINE__)(name)
+
+///------------------------------------------------------------------------------------------------
+
+namespace profiling
+{
+
+///------------------------------------------------------------------------------------------------
+/// A completed (named) scope. Times are in micros since the profiler was created.
+struct ScopeSample
+{
+    const char* mName = nullptr;
+    int64_t mStartMicros = 0;
+    int64_t mDurationMicros = 0;
+    uint32_t mDepth = 0;       // nesting level within its thread (0 for outermost scopes)
+    uint32_t mThreadIndex = 0; // 0 for the thread driving the frames, then in order of first recorded scope
+};
+
+///------------------------------------------------------------------------------------------------
+/// All scopes that completed (on any thread) between a BeginFrame/EndFrame pair.
+struct FrameProfile
+{
+    uint64_t mFrameIndex = 0;
+    int64_t mStartMicros = 0;
+    int64_t mDurationMicros = 0;
+    size_t mDroppedSampleCount = 0;
+    std::vector<ScopeSample> mSamples;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Hierarchical CPU scope profiler on a monotonic (steady) clock. Scopes (see PROFILE_SCOPE) can be
+/// opened on any thread and are attributed to the frame in which they complete. The last
+/// MAX_CAPTURED_FRAMES frames are kept around for the debug flame view, and can be exported to the
+/// Chrome trace event format (chrome://tracing, ui.perfetto.dev) so that individual spikes can be attributed.
+class Profiler final
+{
+public:
+    static constexpr size_t MAX_CAPTURED_FRAMES = 300;
+    static constexpr size_t MAX_SAMPLES_PER_FRAME = 4096;
+
+    static Profiler& GetInstance();
+
+    ~Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    const Profiler& operator = (const Profiler&) = delete;
+    Profiler& operator = (Profiler&&) = delete;
+
+    void SetEnabled(const bool enabled);
+    bool IsEnabled() const;
+
+    void BeginFrame();
+    void EndFrame();
+
+    void BeginScope(const char* name);
+    void EndScope();
+
+    /// Captured (completed) frames, oldest first. Only to be accessed from the thread driving the frames.
+    const std::deque<FrameProfile>& GetCapturedFrames() const;
+
+    void ClearCapturedFrames();
+
+    /// Writes all captured frames as Chrome trace event JSON.
+    /// @returns whether the file could be written.
+    bool ExportChromeTrace(const std::string& filePath) const;
+
+    /// @returns the Chrome trace event JSON of all captured frames.
+    std::string CreateChromeTraceJson() const;
+
+private:
+    Profiler();
+
+    int64_t GetMicrosSinceCreation() const;
+    uint32_t GetCurrentThreadIndex();
+
+private:
+    const std::chrono::steady_clock::time_point mCreationTime;
+    std::mutex mCurrentFrameMutex;
+    FrameProfile mCurrentFrame;
+    std::deque<FrameProfile> mCapturedFrames;
+    uint64_t mNextFrameIndex = 0;
+    uint32_t mNextThreadIndex = 1;
+    std::atomic<bool> mEnabled = true;
+    bool mInFrame = false;
+};
+
+///------------------------------------------------------------------------------------------------
+/// RAII helper timing the scope it lives in. Prefer the PROFILE_SCOPE macro.
+class ScopedTimer final
+{
+public:
+    explicit ScopedTimer(const char* name)
+        : mActive(Profiler::GetInstance().IsEnabled())
+    {
+        if (mActive) Profiler::GetInstance().BeginScope(name);
+    }
+
+    ~ScopedTimer()
+    {
+        if (mActive) Profiler::GetInstance().EndScope();
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer(ScopedTimer&&) = delete;
+    const ScopedTimer& operator = (const ScopedTimer&) = delete;
+    ScopedTimer& operator = (ScopedTimer&&) = delete;
+
+private:
+    const bool mActive;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* Profiler_h */
@@ -0,0 +1,127 @@
+///------------------------------------------------------------------------------------------------
+///  SPSCRingBuffer.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef SPSCRingBuffer_h
+#define SPSCRingBuffer_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+
+///------------------------------------------------------------------------------------------------
+/// Bounded, lock-free, single-producer single-consumer queue. Each side owns one index and only
+/// reads the other's (caching it, so that the shared cache line is only touched when the cached
+/// value runs out). Elements are constructed up front and reused (moved in and out).
+template<typename T>
+class SPSCRingBuffer final
+{
+public:
+    /// @param[in] capacity rounded up to the next power of 2
+    explicit SPSCRingBuffer(const size_t capacity)
+    {
+        size_t roundedCapacity = 2;
+        while (roundedCapacity < capacity) roundedCapacity <<= 1;
+
+        mMask = roundedCapacity - 1;
+        mSlots = std::make_unique<T[]>(roundedCapacity);
+    }
+
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer(SPSCRingBuffer&&) = delete;
+    const SPSCRingBuffer& operator = (const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator = (SPSCRingBuffer&&) = delete;
+
+    size_t GetCapacity() const { return mMask + 1; }
+
+    /// Only to be called from the (single) producer thread.
+    /// @param[in] writeFunction called with the claimed (reused) element to fill in
+    /// @returns false if the buffer is full
+    template<typename WriteFunction>
+    bool TryPushInPlace(WriteFunction&& writeFunction)
+    {
+        const auto position = mEnqueuePosition.load(std::memory_order_relaxed);
+        if (position - mCachedDequeuePosition > mMask)
+        {
+            mCachedDequeuePosition = mDequeuePosition.load(std::memory_order_acquire);
+            if (position - mCachedDequeuePosition > mMask)
+            {
+                return false;
+            }
+        }
+
+        writeFunction(mSlots[position & mMask]);
+        mEnqueuePosition.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPush(T value)
+    {
+        return TryPushInPlace([&](T& slotValue){ slotValue = std::move(value); });
+    }
+
+    /// Only to be called from the (single) consumer thread.
+    /// @param[in] readFunction called with the oldest element, which is recycled right after
+    /// @returns false if the buffer is empty
+    template<typename ReadFunction>
+    bool TryPopInPlace(ReadFunction&& readFunction)
+    {
+        const auto position = mDequeuePosition.load(std::memory_order_relaxed);
+        if (position == mCachedEnqueuePosition)
+        {
+            mCachedEnqueuePosition = mEnqueuePosition.load(std::memory_order_acquire);
+            if (position == mCachedEnqueuePosition)
+            {
+                return false;
+            }
+        }
+
+        readFunction(mSlots[position & mMask]);
+        mDequeuePosition.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& value)
+    {
+        return TryPopInPlace([&](T& slotValue){ value = std::move(slotValue); });
+    }
+
+    /// Only to be called from the (single) consumer thread. Pops up to maxCount elements in one go.
+    /// @returns the number of elements popped
+    template<typename ReadFunction>
+    size_t Drain(ReadFunction&& readFunction, const size_t maxCount = std::numeric_limits<size_t>::max())
+    {
+        const auto position = mDequeuePosition.load(std::memory_order_relaxed);
+        mCachedEnqueuePosition = mEnqueuePosition.load(std::memory_order_acquire);
+
+        const auto count = std::min(mCachedEnqueuePosition - position, maxCount);
+        for (size_t i = 0; i < count; ++i)
+        {
+            readFunction(mSlots[(position + i) & mMask]);
+        }
+
+        // Slots are only handed back to the producer once the whole batch has been read
+        mDequeuePosition.store(position + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    std::unique_ptr<T[]> mSlots;
+    size_t mMask = 0;
+    alignas(64) std::atomic<size_t> mEnqueuePosition = 0;
+    size_t mCachedDequeuePosition = 0; // producer side
+    alignas(64) std::atomic<size_t> mDequeuePosition = 0;
+    size_t mCachedEnqueuePosition = 0; // consumer side
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* SPSCRingBuffer_h */
@@ -23,6 +23,22 @@ enum class DataFileType
 
 ///------------------------------------------------------------------------------------------------
 
+enum class DataFileEncoding
+{
+    JSON,
+    BINARY
+};
+
+///------------------------------------------------------------------------------------------------
+
+enum class CheckSumValidationBehavior
+{
+    VALIDATE_CHECKSUM,
+    SKIP_CHECKSUM_VALIDATION
+};
+
+///------------------------------------------------------------------------------------------------
+
 }
 
 ///------------------------------------------------------------------------------------------------
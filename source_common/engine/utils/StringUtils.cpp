@@ -0,0 +1,130 @@
+///------------------------------------------------------------------------------------------------
+///  StringUtils.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <engine/utils/Logging.h>
+#include <engine/utils/StringUtils.h>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+///------------------------------------------------------------------------------------------------
+
+namespace strutils
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace string_id_table
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    struct IdentityHasher
+    {
+        std::size_t operator()(const uint64_t id) const { return static_cast<std::size_t>(id); }
+    };
+
+    struct StringIdTable
+    {
+        StringIdTable()
+        {
+            mStrings.emplace(0, std::string());
+        }
+
+        // Node based, so references to registered strings stay valid across rehashes
+        std::unordered_map<uint64_t, std::string, IdentityHasher> mStrings;
+        std::shared_mutex mMutex;
+        std::atomic<size_t> mCollisionCount = 0;
+    };
+
+    // Function local so that StringIds created during static initialization (e.g. namespace scope constants) are safe
+    StringIdTable& GetTable()
+    {
+        static StringIdTable table;
+        return table;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void RegisterString(const uint64_t id, const std::string_view str)
+{
+    auto& table = GetTable();
+
+    {
+        std::shared_lock<std::shared_mutex> readLock(table.mMutex);
+        auto findIter = table.mStrings.find(id);
+        if (findIter != table.mStrings.end())
+        {
+#if !defined(NDEBUG)
+            if (findIter->second != str)
+            {
+                table.mCollisionCount++;
+                logging::Log(logging::LogType::ERROR, "StringId collision: \"%s\" and \"%s\" both map to %llu", findIter->second.c_str(), std::string(str).c_str(), static_cast<unsigned long long>(id));
+            }
+#endif
+            return;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> writeLock(table.mMutex);
+    table.mStrings.emplace(id, std::string(str));
+}
+
+///------------------------------------------------------------------------------------------------
+
+uint64_t InternString(const std::string_view str)
+{
+    if (str.empty())
+    {
+        return 0;
+    }
+
+    const auto id = GetStringHash(str);
+    RegisterString(id, str);
+    return id;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::string& LookupString(const uint64_t id)
+{
+    auto& table = GetTable();
+    std::shared_lock<std::shared_mutex> readLock(table.mMutex);
+
+    auto findIter = table.mStrings.find(id);
+    return findIter != table.mStrings.end() ? findIter->second : table.mStrings.at(0);
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t GetRegisteredStringCount()
+{
+    auto& table = GetTable();
+    std::shared_lock<std::shared_mutex> readLock(table.mMutex);
+    return table.mStrings.size() - 1; // the empty string is always present
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t GetCollisionCount()
+{
+    return GetTable().mCollisionCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -13,10 +13,12 @@
 #include <cassert>
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <iomanip>
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -26,14 +28,33 @@ namespace strutils
 {
 
 ///-----------------------------------------------------------------------------------------------
-
-static std::hash<std::string> hashFunction;
+/// Compute a 64-bit hash for a given string (FNV-1a, followed by a final avalanche mix so that strings
+/// differing in a single character differ in all bits). Usable at compile time.
+/// @param[in] s the input string.
+/// @returns the hashed input string.
+constexpr uint64_t GetStringHash(const std::string_view s)
+{
+    uint64_t result = 0xcbf29ce484222325ULL;
+    for (auto c: s)
+    {
+        result ^= static_cast<uint8_t>(c);
+        result *= 0x100000001b3ULL;
+    }
+    
+    result ^= result >> 33;
+    result *= 0xff51afd7ed558ccdULL;
+    result ^= result >> 33;
+    result *= 0xc4ceb9fe1a85ec53ULL;
+    result ^= result >> 33;
+    return result;
+}
 
 ///-----------------------------------------------------------------------------------------------
-/// Compute a unique hash for a given string.
+/// The 32-bit hash StringIds were keyed on prior to GetStringHash. Only kept to validate
+/// the checksums of data files written with it.
 /// @param[in] s the input string.
 /// @returns the hashed input string.
-inline uint32_t GetStringHash(const std::string& s)
+inline uint32_t GetLegacyStringHash(const std::string& s)
 {
     uint32_t result = 0;
     for (auto c: s)
@@ -245,46 +266,83 @@ inline std::string FloatToString(const float val, const int decimalPlaces)
 }
 
 ///-----------------------------------------------------------------------------------------------
-/// Provides a unique identifier for a string, aimed at optimizing string comparisons
+/// Global table of all strings StringIds were created from, keyed on their 64-bit hash,
+/// so that the ids themselves don't need to carry their strings around.
+namespace string_id_table
+{
+    ///-------------------------------------------------------------------------------------------
+    /// Registers the given string under the given id (if not already present). In debug builds
+    /// a different string already registered under the same id is reported as a collision.
+    /// @param[in] id the id to register the string under.
+    /// @param[in] str the string to register.
+    void RegisterString(const uint64_t id, const std::string_view str);
+    
+    ///-------------------------------------------------------------------------------------------
+    /// Hashes & registers the given string.
+    /// @param[in] str the string to intern.
+    /// @returns the id of the string (0 for the empty string).
+    uint64_t InternString(const std::string_view str);
+    
+    ///-------------------------------------------------------------------------------------------
+    /// Reverse lookup of the string registered under the given id.
+    /// @param[in] id the id to look up.
+    /// @returns the registered string, or an empty string if no string has been registered under the id.
+    const std::string& LookupString(const uint64_t id);
+    
+    ///-------------------------------------------------------------------------------------------
+    /// @returns the number of strings registered.
+    size_t GetRegisteredStringCount();
+    
+    ///-------------------------------------------------------------------------------------------
+    /// @returns the number of collisions detected (always 0 in release builds, where they're not checked for).
+    size_t GetCollisionCount();
+}
+
+///-----------------------------------------------------------------------------------------------
+/// Provides a unique identifier for a string, aimed at optimizing string comparisons.
+/// The string itself lives in the global string_id_table.
 class StringId final
 {
 public:
-    StringId()
-    : mString("")
-    , mStringId(0)
+    constexpr StringId()
+    : mStringId(0)
     {
     }
     
     explicit StringId(const std::string& str)
-    : mString(str)
-    , mStringId(GetStringHash(str))
+    : mStringId(string_id_table::InternString(str))
     {
     }
     
     explicit StringId(const long long l)
-    : mString(std::to_string(l))
-    , mStringId(static_cast<uint32_t>(l))
+    : StringId(std::to_string(l))
     {
     }
     
-    operator uint32_t () { return mStringId; }
-    bool operator < (const StringId& rhs) { return mStringId < rhs.GetStringId(); }
-    
-    bool isEmpty() const { return mStringId == 0; }
-    const std::string& GetString() const { return mString; }
-    uint32_t GetStringId() const { return mStringId; }
+    constexpr bool isEmpty() const { return mStringId == 0; }
+    const std::string& GetString() const { return string_id_table::LookupString(mStringId); }
+    constexpr uint64_t GetStringId() const { return mStringId; }
     
     void fromAddress(const void* address)
     {
         std::stringstream ss;
         ss << address;
-        mString = ss.str();
-        mStringId = GetStringHash(mString);
+        *this = StringId(ss.str());
+    }
+    
+    ///-------------------------------------------------------------------------------------------
+    /// Compile time path for literals, e.g. constexpr auto WORLD = strutils::StringId::FromLiteral("world");
+    /// The string is not registered in the string_id_table, so GetString() only resolves it once
+    /// the same string has been interned at runtime.
+    static constexpr StringId FromLiteral(const std::string_view str)
+    {
+        StringId result;
+        result.mStringId = str.empty() ? 0 : GetStringHash(str);
+        return result;
     }
     
 private:
-    std::string mString;
-    uint32_t    mStringId;
+    uint64_t mStringId;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -306,9 +364,9 @@ inline bool operator != (const StringId& lhs, const StringId& rhs) { return lhs.
 /// Custom StringId hasher to be used in stl containers
 struct StringIdHasher
 {
-    std::uint32_t operator()(const StringId& key) const
+    std::size_t operator()(const StringId& key) const
     {
-        return key.GetStringId();
+        return static_cast<std::size_t>(key.GetStringId());
     }
 };
 
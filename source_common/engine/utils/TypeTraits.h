@@ -16,10 +16,6 @@
 
 ///-----------------------------------------------------------------------------------------------
 
-static std::hash<std::string> hashFunction;
-
-///-----------------------------------------------------------------------------------------------
-
 class TypeID
 {
     static size_t counter;
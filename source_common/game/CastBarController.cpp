@@ -51,8 +51,8 @@ void CastBarController::ShowCastBar(const float revealSecs)
     auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
     for (auto sceneObject: mCastBar->GetSceneObjects())
     {
-        animationManager.StopAllAnimationsPlayingForSceneObject(sceneObject->mName);
-        animationManager.StartAnimation(std::make_unique<rendering::TweenAlphaAnimation>(sceneObject, 1.0f, revealSecs), [](){});
+        animationManager.StopAllAnimationsPlayingForSceneObject(*sceneObject);
+        animationManager.StartAnimation(rendering::AlphaTween(sceneObject, 1.0f, revealSecs), [](){});
     }
 }
 
@@ -63,8 +63,8 @@ void CastBarController::HideCastBar(const float hideSecs)
     auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
     for (auto sceneObject: mCastBar->GetSceneObjects())
     {
-        animationManager.StopAllAnimationsPlayingForSceneObject(sceneObject->mName);
-        animationManager.StartAnimation(std::make_unique<rendering::TweenAlphaAnimation>(sceneObject, 0.0f, hideSecs), [this]()
+        animationManager.StopAllAnimationsPlayingForSceneObject(*sceneObject);
+        animationManager.StartAnimation(rendering::AlphaTween(sceneObject, 0.0f, hideSecs), [this]()
         {
             mCastBar->SetFillProgress(0.0f);
         });
@@ -79,14 +79,14 @@ void CastBarController::BeginCast(const float duration, std::function<void()> on
     auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
     for (auto sceneObject: mCastBar->GetSceneObjects())
     {
-        animationManager.StopAllAnimationsPlayingForSceneObject(sceneObject->mName);
+        animationManager.StopAllAnimationsPlayingForSceneObject(*sceneObject);
     }
 
     mCastBar->SetFillProgress(0.0f);
     mCastBar->SetColorFactor(glm::vec4(1.0f, 0.66f, 0.0f, 0.9f));
     std::get<scene::TextSceneObjectData>(mScene->FindSceneObject(CAST_BAR_MID_TEXT_NAME)->mSceneObjectTypeData).mText = "Attacking";
     ShowCastBar(CAST_BAR_SHOW_HIDE_DURATION_SECS);
-    animationManager.StartAnimation(std::make_unique<rendering::TweenValueAnimation>(mCastBar->GetFillProgress(), 1.0f, duration), [this]()
+    animationManager.StartAnimation(rendering::ValueTween(mCastBar->GetFillProgress(), 1.0f, duration), [this]()
     {
         assert(mOnCompleteCallback);
         mOnCompleteCallback();
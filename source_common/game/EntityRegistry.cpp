@@ -0,0 +1,124 @@
+///------------------------------------------------------------------------------------------------
+///  EntityRegistry.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <engine/utils/Logging.h>
+#include <game/EntityRegistry.h>
+
+///------------------------------------------------------------------------------------------------
+
+void EntityInterpolationBuffer::Push(const glm::vec3& position)
+{
+    mPositions[mNextIndex] = position;
+    mNextIndex = (mNextIndex + 1) % CAPACITY;
+    mCount = std::min(mCount + 1, CAPACITY);
+}
+
+///------------------------------------------------------------------------------------------------
+
+const glm::vec3& EntityInterpolationBuffer::GetLatest() const
+{
+    assert(mCount > 0);
+    return mPositions[(mNextIndex + CAPACITY - 1) % CAPACITY];
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityHandle EntityRegistry::CreateEntity(const network::ObjectData& objectData)
+{
+    if (mObjectIdHandles.count(objectData.objectId))
+    {
+        logging::Log(logging::LogType::WARNING, "Attempted to re-create pre-existing entity for object %llu", static_cast<unsigned long long>(objectData.objectId));
+        return mObjectIdHandles.at(objectData.objectId);
+    }
+
+    EntityHandle handle;
+    if (mFreeSlotIndices.empty())
+    {
+        handle.mSlotIndex = static_cast<uint32_t>(mSlots.size());
+        mSlots.emplace_back();
+    }
+    else
+    {
+        handle.mSlotIndex = mFreeSlotIndices.back();
+        mFreeSlotIndices.pop_back();
+    }
+
+    auto& slot = mSlots[handle.mSlotIndex];
+    slot.mEntityIndex = static_cast<uint32_t>(mObjectIds.size());
+    handle.mGeneration = slot.mGeneration;
+
+    mObjectIds.push_back(objectData.objectId);
+    mSlotIndices.push_back(handle.mSlotIndex);
+    mNetworkStates.push_back(objectData);
+    mInterpolationBuffers.emplace_back();
+    mInterpolationBuffers.back().Push(objectData.position);
+    mRenderLinks.emplace_back();
+    mAnimationHandles.emplace_back();
+
+    mObjectIdHandles[objectData.objectId] = handle;
+    return handle;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityRegistry::DestroyEntity(const EntityHandle& handle)
+{
+    if (!IsEntityAlive(handle))
+    {
+        return;
+    }
+
+    auto& slot = mSlots[handle.mSlotIndex];
+    const auto entityIndex = slot.mEntityIndex;
+    mObjectIdHandles.erase(mObjectIds[entityIndex]);
+
+    // The last entity moves into the vacated index, across all component arrays
+    mSlots[mSlotIndices.back()].mEntityIndex = entityIndex;
+    SwapRemove(mObjectIds, entityIndex);
+    SwapRemove(mSlotIndices, entityIndex);
+    SwapRemove(mNetworkStates, entityIndex);
+    SwapRemove(mInterpolationBuffers, entityIndex);
+    SwapRemove(mRenderLinks, entityIndex);
+    SwapRemove(mAnimationHandles, entityIndex);
+
+    slot.mGeneration++;
+    mFreeSlotIndices.push_back(handle.mSlotIndex);
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityHandle EntityRegistry::FindEntity(const network::objectId_t objectId) const
+{
+    auto findIter = mObjectIdHandles.find(objectId);
+    return findIter != mObjectIdHandles.end() ? findIter->second : EntityHandle();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool EntityRegistry::IsEntityAlive(const EntityHandle& handle) const
+{
+    return handle.mSlotIndex < mSlots.size() && mSlots[handle.mSlotIndex].mGeneration == handle.mGeneration;
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t EntityRegistry::GetEntityCount() const
+{
+    return mObjectIds.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t EntityRegistry::GetEntityIndex(const EntityHandle& handle) const
+{
+    assert(IsEntityAlive(handle));
+    return mSlots[handle.mSlotIndex].mEntityIndex;
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,122 @@
+///------------------------------------------------------------------------------------------------
+///  EntityRegistry.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#ifndef EntityRegistry_h
+#define EntityRegistry_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <cstdint>
+#include <engine/utils/MathUtils.h>
+#include <game/ObjectAnimationController.h>
+#include <memory>
+#include <net_common/NetworkCommon.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace scene { struct SceneObject; }
+
+///------------------------------------------------------------------------------------------------
+
+struct EntityHandle
+{
+    static constexpr uint32_t INVALID_SLOT_INDEX = 0xFFFFFFFF;
+
+    bool IsValid() const { return mSlotIndex != INVALID_SLOT_INDEX; }
+
+    uint32_t mSlotIndex = INVALID_SLOT_INDEX;
+    uint32_t mGeneration = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// The most recent authoritative positions received for an entity, in a small ring.
+struct EntityInterpolationBuffer
+{
+    static constexpr int CAPACITY = 4;
+
+    void Push(const glm::vec3& position);
+    const glm::vec3& GetLatest() const;
+
+    std::array<glm::vec3, CAPACITY> mPositions = {};
+    int mNextIndex = 0;
+    int mCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct EntityRenderLink
+{
+    // Root scene object first, followed by any anim(equipment) layers & debug colliders
+    std::vector<std::shared_ptr<scene::SceneObject>> mSceneObjects;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Network objects known to the client, with each of their components densely packed in its own array
+/// (all indexed by the same entity index) so that per frame passes walk contiguous memory. Entities
+/// are addressed by generational handles which, unlike entity indices, survive other entities' destruction.
+class EntityRegistry final
+{
+public:
+    [[nodiscard]] EntityHandle CreateEntity(const network::ObjectData& objectData);
+    void DestroyEntity(const EntityHandle& handle);
+
+    EntityHandle FindEntity(const network::objectId_t objectId) const;
+    bool IsEntityAlive(const EntityHandle& handle) const;
+    size_t GetEntityCount() const;
+
+    // Only valid until the next entity destruction
+    size_t GetEntityIndex(const EntityHandle& handle) const;
+
+    network::ObjectData& GetNetworkState(const EntityHandle& handle) { return mNetworkStates[GetEntityIndex(handle)]; }
+    EntityInterpolationBuffer& GetInterpolationBuffer(const EntityHandle& handle) { return mInterpolationBuffers[GetEntityIndex(handle)]; }
+    EntityRenderLink& GetRenderLink(const EntityHandle& handle) { return mRenderLinks[GetEntityIndex(handle)]; }
+    ObjectAnimationHandle& GetAnimationHandle(const EntityHandle& handle) { return mAnimationHandles[GetEntityIndex(handle)]; }
+
+    // Component arrays, indexed by entity index in [0, GetEntityCount())
+    const std::vector<network::objectId_t>& GetObjectIds() const { return mObjectIds; }
+    std::vector<network::ObjectData>& GetNetworkStates() { return mNetworkStates; }
+    std::vector<EntityInterpolationBuffer>& GetInterpolationBuffers() { return mInterpolationBuffers; }
+    std::vector<EntityRenderLink>& GetRenderLinks() { return mRenderLinks; }
+    std::vector<ObjectAnimationHandle>& GetAnimationHandles() { return mAnimationHandles; }
+
+private:
+    struct EntitySlot
+    {
+        uint32_t mEntityIndex = 0;
+        uint32_t mGeneration = 0;
+    };
+
+    template<typename ComponentType>
+    static void SwapRemove(std::vector<ComponentType>& components, const size_t index)
+    {
+        if (index != components.size() - 1)
+        {
+            components[index] = std::move(components.back());
+        }
+        components.pop_back();
+    }
+
+private:
+    std::vector<network::objectId_t> mObjectIds;
+    std::vector<uint32_t> mSlotIndices;
+    std::vector<network::ObjectData> mNetworkStates;
+    std::vector<EntityInterpolationBuffer> mInterpolationBuffers;
+    std::vector<EntityRenderLink> mRenderLinks;
+    std::vector<ObjectAnimationHandle> mAnimationHandles;
+
+    std::vector<EntitySlot> mSlots;
+    std::vector<uint32_t> mFreeSlotIndices;
+    std::unordered_map<network::objectId_t, EntityHandle> mObjectIdHandles;
+};
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* EntityRegistry_h */
@@ -6,6 +6,8 @@
 ///------------------------------------------------------------------------------------------------
 
 #include <bitset>
+#include <chrono>
+#include <cstdlib>
 #include <engine/CoreSystemsEngine.h>
 #include <engine/input/IInputStateManager.h>
 #include <engine/rendering/AnimationManager.h>
@@ -27,9 +29,11 @@
 #include <engine/utils/FileUtils.h>
 #include <engine/utils/OSMessageBox.h>
 #include <engine/utils/PlatformMacros.h>
+#include <engine/utils/Profiler.h>
 #include <enet/enet.h>
 #include <fstream>
 #include <game/ui/AnimatedButton.h>
+#include <game/ui/FillableBar.h>
 #include <game/CastBarController.h>
 #include <game/Game.h>
 #include <game/GameCommon.h>
@@ -54,6 +58,8 @@
 #include <platform_utilities/AppleUtils.h>
 #elif defined(WINDOWS)
 #include <platform_utilities/WindowsUtils.h>
+#elif defined(LINUX)
+#include <platform_utilities/LinuxUtils.h>
 #endif
 #include <iostream>
 
@@ -63,7 +69,11 @@ static const strutils::StringId NAVMAP_DEBUG_SCENE_OBJECT_NAME = strutils::Strin
 static const strutils::StringId MAP_DEBUG_GRID_UNIFORM_NAME = strutils::StringId("debug_grid");
 static const std::string QUADTREE_DEBUG_SCENE_OBJECT_NAME_PREFIX = "debug_quadtree_";
 static const std::string PATH_DEBUG_SCENE_OBJECT_NAME_PREFIX = "debug_path_";
+static const strutils::StringId LOADING_BAR_NAME = strutils::StringId("loading_bar");
+static const strutils::StringId LOADING_TEXT_NAME = strutils::StringId("loading_text");
 static const float DESTROYED_OBJECT_FADE_OUT_TIME_SECS = 0.1f;
+static const float SERVER_CONNECTION_TIMEOUT_SECS = 5.0f;
+static const float STARTUP_TASKS_FRAME_BUDGET_MILLIS = 8.0f;
 
 ///------------------------------------------------------------------------------------------------
 
@@ -74,11 +84,29 @@ Game::Game(const int argc, char** argv)
         logging::Log(logging::LogType::INFO, "Initializing from CWD : %s", argv[0]);
     }
     
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--headless")
+        {
+            CoreSystemsEngine::SetHeadless(true);
+        }
+    }
+    
 #if defined(MACOS) || defined(MOBILE_FLOW)
     apple_utils::SetAssetFolder();
+#elif defined(LINUX)
+    linux_utils::SetAssetFolder();
 #endif
     
-    CoreSystemsEngine::GetInstance().Start([&](){ Init(); }, [&](const float dtMillis){ Update(dtMillis); }, [&](){ ApplicationMovedToBackground(); }, [&](){ WindowResize(); }, [&](){ CreateDebugWidgets(); }, [&](){ OnOneSecondElapsed(); });
+    // Throttled (idle/background) frames keep servicing the connection at the usual cadence while they sleep
+    CoreSystemsEngine::GetInstance().SetThrottledFrameTickFunction([&](){ ServiceNetwork(); });
+    CoreSystemsEngine::GetInstance().Start([&](){ BeginInit(true); }, [&](const float dtMillis){ Update(dtMillis); }, [&](){ ApplicationMovedToBackground(); }, [&](){ WindowResize(); }, [&](){ CreateDebugWidgets(); }, [&](){ OnOneSecondElapsed(); });
+}
+
+///------------------------------------------------------------------------------------------------
+
+Game::Game()
+{
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -88,6 +116,7 @@ Game::~Game(){}
 ///------------------------------------------------------------------------------------------------
 static ENetHost* sClient;
 static ENetPeer* sServer;
+static std::chrono::steady_clock::time_point sServerConnectionStartTime;
 static enet_uint32 sRTTAccum = 0;
 static enet_uint32 sRTTSampleCount = 0;
 static enet_uint32 sCurrentRTT = 0;
@@ -102,37 +131,95 @@ static float sSeparatorWeight = 0.5f;
 
 void Game::Init()
 {
-    auto& systemsEngine = CoreSystemsEngine::GetInstance();
-    systemsEngine.GetFontRepository().LoadFont(game_constants::DEFAULT_FONT_NAME.GetString(), resources::ResourceReloadMode::DONT_RELOAD);
-    systemsEngine.GetSoundManager().SetAudioEnabled(false);
-    GlobalMapDataRepository::GetInstance().LoadMapDefinitions();
+    CreateStartupTasks(false);
+    mInitTaskGraph->RunToCompletion();
     
-    auto scene = systemsEngine.GetSceneManager().CreateScene(game_constants::WORLD_SCENE_NAME);
-    scene->GetCamera().SetZoomFactor(50.0f);
-    scene->SetLoaded(true);
+    if (!mInitTaskGraph->IsComplete())
+    {
+        AbortInit(mInitTaskGraph->HasFailed() ? std::string("Startup task ") + mInitTaskGraph->GetFailedTaskName() + " failed" : "Invalid startup task graph");
+    }
     
-    auto& eventSystem = events::EventSystem::GetInstance();
-    mMapChangeEventListener = eventSystem.RegisterForEvent<events::MapChangeEvent>([this](const events::MapChangeEvent& event)
+    FinishInit();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Game::BeginInit(const bool connectToServer)
+{
+    CreateLoadingScreen();
+    CreateStartupTasks(connectToServer);
+    
+    if (!mInitTaskGraph->Start())
     {
-        const auto& mapResources = mMapResourceController->GetMapResources(event.mNewMapName);
-        mCurrentNavmap = mapResources.mNavmap;
+        AbortInit("Invalid startup task graph");
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Game::CreateStartupTasks(const bool connectToServer)
+{
+    using TaskAffinity = InitTaskGraph::TaskAffinity;
+    using TaskStatus = InitTaskGraph::TaskStatus;
+    
+    mInitTaskGraph = std::make_unique<InitTaskGraph>();
+    
+    mInitTaskGraph->AddTask("Init::Fonts", TaskAffinity::MAIN_THREAD, {}, [this]()
+    {
+        CoreSystemsEngine::GetInstance().GetFontRepository().LoadFont(game_constants::DEFAULT_FONT_NAME.GetString(), resources::ResourceReloadMode::DONT_RELOAD);
+        if (mLoadingBar)
+        {
+            mLoadingBar->AddTextElement("Loading", glm::vec3(0.0f, 0.021f, 0.1f), glm::vec3(0.0001f), LOADING_TEXT_NAME);
+        }
+        return TaskStatus::DONE;
     });
-  
-    mMapSupersessionEventListener = eventSystem.RegisterForEvent<events::MapSupersessionEvent>([=](const events::MapSupersessionEvent& event)
+    
+    mInitTaskGraph->AddTask("Init::Audio", TaskAffinity::MAIN_THREAD, {}, []()
     {
-        scene->RemoveSceneObject(strutils::StringId(event.mSupersededMapName.GetString() + "_top"));
-        scene->RemoveSceneObject(strutils::StringId(event.mSupersededMapName.GetString() + "_bottom"));
+        CoreSystemsEngine::GetInstance().GetSoundManager().SetAudioEnabled(false);
+        return TaskStatus::DONE;
     });
-  
-    mMapResourcesReadyEventListener = eventSystem.RegisterForEvent<events::MapResourcesReadyEvent>([this](const events::MapResourcesReadyEvent& event)
+    
+    mInitTaskGraph->AddTask("Init::MapDefinitions", TaskAffinity::WORKER_THREAD, {}, []()
     {
-        CreateMapSceneObjects(event.mMapName);
+        return GlobalMapDataRepository::GetInstance().LoadMapDefinitionsFromVirtualFileSystem() ? TaskStatus::DONE : TaskStatus::FAILED;
     });
     
-    scene = systemsEngine.GetSceneManager().CreateScene(game_constants::GUI_SCENE_NAME);
-    scene->GetCamera().SetZoomFactor(50.0f);
-    scene->SetLoaded(true);
+    mInitTaskGraph->AddTask("Init::WorldScene", TaskAffinity::MAIN_THREAD, {}, [this]()
+    {
+        auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().CreateScene(game_constants::WORLD_SCENE_NAME);
+        scene->GetCamera().SetZoomFactor(50.0f);
+        scene->SetLoaded(true);
+        
+        auto& eventSystem = events::EventSystem::GetInstance();
+        mMapChangeEventListener = eventSystem.RegisterForEvent<events::MapChangeEvent>([this](const events::MapChangeEvent& event)
+        {
+            const auto& mapResources = mMapResourceController->GetMapResources(event.mNewMapName);
+            mCurrentNavmap = mapResources.mNavmap;
+        });
+      
+        mMapSupersessionEventListener = eventSystem.RegisterForEvent<events::MapSupersessionEvent>([=](const events::MapSupersessionEvent& event)
+        {
+            scene->RemoveSceneObject(strutils::StringId(event.mSupersededMapName.GetString() + "_top"));
+            scene->RemoveSceneObject(strutils::StringId(event.mSupersededMapName.GetString() + "_bottom"));
+        });
+      
+        mMapResourcesReadyEventListener = eventSystem.RegisterForEvent<events::MapResourcesReadyEvent>([this](const events::MapResourcesReadyEvent& event)
+        {
+            CreateMapSceneObjects(event.mMapName);
+        });
+        
+        mObjectAnimationController = std::make_unique<ObjectAnimationController>();
+        mLocalPlayerId = 0;
+        return TaskStatus::DONE;
+    });
     
+    mInitTaskGraph->AddTask("Init::GuiScene", TaskAffinity::MAIN_THREAD, { "Init::Fonts" }, [this]()
+    {
+        auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().CreateScene(game_constants::GUI_SCENE_NAME);
+        scene->GetCamera().SetZoomFactor(50.0f);
+        scene->SetLoaded(true);
+        
 //    scene::TextSceneObjectData textData;
 //    textData.mFontName = game_constants::DEFAULT_FONT_NAME;
 //    textData.mText = "Health Points: 100";
@@ -142,15 +229,101 @@ void Game::Init()
 //    guiSceneObject->mPosition = glm::vec3(0.0f, -0.155f, 1.0f);
 //    guiSceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 1.0f;
 //    guiSceneObject->mScale = glm::vec3(0.0004f);
-    
+        
 //    mTestButton = std::make_unique<AnimatedButton>(glm::vec3(-0.3f, 0.0f, 1.0f), glm::vec3(0.0001f), game_constants::DEFAULT_FONT_NAME, "Test my limits, left and right :)", strutils::StringId("test_button"), [](){}, *scene);
+        
+        mCastBarController = std::make_unique<CastBarController>(scene);
+        //mCastBarController->ShowCastBar(1.0f);
+        return TaskStatus::DONE;
+    });
+    
+    if (connectToServer)
+    {
+        // The handshake is polled (rather than waited on) so that everything else loads meanwhile
+        mInitTaskGraph->AddTask("Init::ServerConnect", TaskAffinity::MAIN_THREAD, {}, [this]()
+        {
+            ConnectToServer();
+            return TaskStatus::DONE;
+        });
+        
+        mInitTaskGraph->AddTask("Init::ServerHandshake", TaskAffinity::MAIN_THREAD, { "Init::ServerConnect" }, [this]()
+        {
+            return UpdateServerHandshake();
+        });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Game::CreateLoadingScreen()
+{
+    auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().CreateScene(game_constants::LOADING_SCENE_NAME);
+    scene->GetCamera().SetZoomFactor(50.0f);
+    scene->SetLoaded(true);
     
-    mCastBarController = std::make_unique<CastBarController>(scene);
-    //mCastBarController->ShowCastBar(1.0f);
+    mLoadingBar = std::make_unique<FillableBar>(glm::vec3(0.0f, 0.0f, 25.0f), glm::vec3(0.25f), LOADING_BAR_NAME, scene, glm::vec4(0.0f, 0.66f, 1.0f, 0.9f), 0.0f);
+}
+
+///------------------------------------------------------------------------------------------------
 
-    mObjectAnimationController = std::make_unique<ObjectAnimationController>();
-    mLocalPlayerId = 0;
+void Game::UpdateLoadingScreen()
+{
+    mInitTaskGraph->Update(STARTUP_TASKS_FRAME_BUDGET_MILLIS);
+    
+    if (mInitTaskGraph->HasFailed())
+    {
+        AbortInit(std::string("Startup task ") + mInitTaskGraph->GetFailedTaskName() + " failed");
+    }
+    
+    const auto progress = mInitTaskGraph->GetProgress();
+    if (mLoadingBar)
+    {
+        mLoadingBar->SetFillProgress(progress);
+        
+        auto loadingScene = CoreSystemsEngine::GetInstance().GetSceneManager().FindScene(game_constants::LOADING_SCENE_NAME);
+        if (auto loadingTextSceneObject = loadingScene->FindSceneObject(LOADING_TEXT_NAME))
+        {
+            std::get<scene::TextSceneObjectData>(loadingTextSceneObject->mSceneObjectTypeData).mText = "Loading " + std::to_string(static_cast<int>(progress * 100.0f)) + "%";
+        }
+    }
+    
+    if (mInitTaskGraph->IsComplete())
+    {
+        FinishInit();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Game::FinishInit()
+{
+    mInitTaskGraph->LogTimingReport();
+    mInitTaskGraph = nullptr;
+    
+    if (mLoadingBar)
+    {
+        mLoadingBar = nullptr;
+        CoreSystemsEngine::GetInstance().GetSceneManager().RemoveScene(game_constants::LOADING_SCENE_NAME);
+    }
+}
 
+///------------------------------------------------------------------------------------------------
+
+void Game::AbortInit(const std::string& reason)
+{
+    // The game can't run without any of its startup tasks, so rather than sit on the loading screen forever
+    logging::Log(logging::LogType::ERROR, "Startup aborted: %s", reason.c_str());
+    ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "Startup failed", reason);
+    
+    // Joins any worker tasks still running, before exiting tears down what they might be using
+    mInitTaskGraph = nullptr;
+    std::exit(EXIT_FAILURE);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Game::ConnectToServer()
+{
     enet_initialize();
     atexit(enet_deinitialize);
     
@@ -166,17 +339,36 @@ void Game::Init()
         logging::Log(logging::LogType::ERROR, "Failed to connect");
         return;
     }
+    
+    sServerConnectionStartTime = std::chrono::steady_clock::now();
+}
 
+///------------------------------------------------------------------------------------------------
+
+InitTaskGraph::TaskStatus Game::UpdateServerHandshake()
+{
+    if (!sServer)
+    {
+        return InitTaskGraph::TaskStatus::DONE;
+    }
+    
     ENetEvent event;
-    if (enet_host_service(sClient, &event, 5000) <= 0 ||
-        event.type != ENET_EVENT_TYPE_CONNECT)
+    while (enet_host_service(sClient, &event, 0) > 0)
     {
-        logging::Log(logging::LogType::ERROR, "Connection failed");
+        if (event.type == ENET_EVENT_TYPE_CONNECT)
+        {
+            logging::Log(logging::LogType::INFO, "Connected to server");
+            return InitTaskGraph::TaskStatus::DONE;
+        }
     }
-    else
+    
+    if (std::chrono::duration<float>(std::chrono::steady_clock::now() - sServerConnectionStartTime).count() > SERVER_CONNECTION_TIMEOUT_SECS)
     {
-        logging::Log(logging::LogType::INFO, "Connected to server");
+        logging::Log(logging::LogType::ERROR, "Connection failed");
+        return InitTaskGraph::TaskStatus::DONE;
     }
+    
+    return InitTaskGraph::TaskStatus::PENDING;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -184,8 +376,15 @@ void Game::Init()
 float sDebugPlayerVelocityMultiplier = 1.0f;
 
 
-void Game::Update(const float dtMillis)
+void Game::ServiceNetwork()
 {
+    // Still loading (the handshake itself is serviced by its startup task)
+    if (!sClient || mInitTaskGraph)
+    {
+        return;
+    }
+    
+    PROFILE_SCOPE("Network");
     ENetEvent event;
     while (enet_host_service(sClient, &event, 0) > 0)
     {
@@ -194,151 +393,62 @@ void Game::Update(const float dtMillis)
 
         if (event.type == ENET_EVENT_TYPE_RECEIVE)
         {
-            auto messageType = static_cast<network::MessageType>(event.packet->data[0]);
-            switch (messageType)
-            {
-                case network::MessageType::ObjectStateUpdateMessage:
-                {
-                    auto* message = reinterpret_cast<network::ObjectStateUpdateMessage*>(event.packet->data);
-                    
-                    // Pre-existing object
-                    if (!mLocalObjectWrappers.contains(message->objectData.objectId))
-                    {
-                        CreateObject(message->objectData);
-                    }
-                    
-                    // Update everything but local player's data (for now)
-                    if (message->objectData.objectId != mLocalPlayerId)
-                    {
-                        mLocalObjectWrappers[message->objectData.objectId].mObjectData = message->objectData;
-                    }
-                    
-                    assert(math::Abs(mLocalObjectWrappers[message->objectData.objectId].mSceneObjects.front()->mScale.x - message->objectData.objectScale) < 0.0001f);
-                } break;
-                
-                case network::MessageType::DebugGetQuadtreeResponseMessage:
-                {
-                    auto* message = reinterpret_cast<network::DebugGetQuadtreeResponseMessage*>(event.packet->data);
-                    
-                    auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME);
-                    
-                    scene->RemoveAllSceneObjectsWithNameStartingWith(QUADTREE_DEBUG_SCENE_OBJECT_NAME_PREFIX);
-                    for (int i = 0; i < message->quadtreeData.debugRectCount; ++i)
-                    {
-                        auto quadtreeSceneObject = scene->CreateSceneObject(strutils::StringId(QUADTREE_DEBUG_SCENE_OBJECT_NAME_PREFIX + std::to_string(i)));
-                        quadtreeSceneObject->mPosition = message->quadtreeData.debugRectPositions[i];
-                        quadtreeSceneObject->mScale = message->quadtreeData.debugRectDimensions[i];
-                        quadtreeSceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "debug/debug_quadtree.png");
-                        quadtreeSceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 1.0f;
-                        quadtreeSceneObject->mInvisible = !sShowQuadtree;
-                    }
-                } break;
-                    
-                case network::MessageType::DebugGetObjectPathResponseMessage:
-                {
-                    auto* message = reinterpret_cast<network::DebugGetObjectPathResponseMessage*>(event.packet->data);
-                    
-                    auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME);
-                    
-                    scene->RemoveAllSceneObjectsWithNameStartingWith(PATH_DEBUG_SCENE_OBJECT_NAME_PREFIX + std::to_string(message->objectId));
-                    
-                    for (int i = 0; i < message->pathData.debugPathPositionsCount; ++i)
-                    {
-                        auto pathSceneObject = scene->CreateSceneObject(strutils::StringId(PATH_DEBUG_SCENE_OBJECT_NAME_PREFIX + std::to_string(message->objectId) + "_" + std::to_string(i)));
-                        pathSceneObject->mPosition = message->pathData.debugPathPositions[i];
-                        pathSceneObject->mScale = glm::vec3(network::MAP_TILE_SIZE/10.0f) * glm::vec3(i + 1);
-                        pathSceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "debug/debug_circle.png");
-                        pathSceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 1.0f;
-                        pathSceneObject->mInvisible = !sShowObjectPaths;
-                    }
-                } break;
-                    
-                case network::MessageType::PlayerConnectedMessage:
-                {
-                    auto* message = reinterpret_cast<network::PlayerConnectedMessage*>(event.packet->data);
-                    mLocalPlayerId = message->objectId;
-                    logging::Log(logging::LogType::INFO, "Received player ID %d", mLocalPlayerId);
-                } break;
-                    
-                case network::MessageType::PlayerDisconnectedMessage:
-                {
-                    auto* message = reinterpret_cast<network::PlayerDisconnectedMessage*>(event.packet->data);
-                    DestroyObject(message->objectId);
-                } break;
-                    
-                case network::MessageType::ObjectCreatedMessage:
-                {
-                    auto* message = reinterpret_cast<network::ObjectCreatedMessage*>(event.packet->data);
-                    CreateObject(message->objectData);
-                } break;
-                
-                case network::MessageType::ObjectDestroyedMessage:
-                {
-                    auto* message = reinterpret_cast<network::ObjectDestroyedMessage*>(event.packet->data);
-                    DestroyObject(message->objectId);
-                } break;
-                
-                case network::MessageType::BeginAttackResponseMessage:
-                {
-                    auto* message = reinterpret_cast<network::BeginAttackResponseMessage*>(event.packet->data);
-                    if (message->allowed)
-                    {
-                        mCastBarController->BeginCast(message->chargeDurationSecs, [this]()
-                        {
-                            mLocalObjectWrappers[mLocalPlayerId].mObjectData.objectState = network::ObjectState::MELEE_ATTACK;
-                        });
-                    }
-                    else
-                    {
-                        mLocalObjectWrappers[mLocalPlayerId].mObjectData.objectState = network::ObjectState::IDLE;
-                    }
-                } break;
-                
-                case network::MessageType::NPCAttackMessage:
-                {
-                    auto* message = reinterpret_cast<network::NPCAttackMessage*>(event.packet->data);
-                    mObjectAnimationController->OnNPCAttack(GetSceneObjectNameId(message->attackerId));
-                } break;
-                
-                case network::MessageType::BeginAttackRequestMessage:
-                case network::MessageType::CancelAttackMessage:
-                case network::MessageType::DebugGetQuadtreeRequestMessage:
-                case network::MessageType::DebugGetObjectPathRequestMessage:
-                case network::MessageType::DebugSetSwarmParams:
-                case network::MessageType::UNUSED:
-                    break;
-            }
-            
+            HandleServerMessage(event.packet->data, event.packet->dataLength);
             enet_packet_destroy(event.packet);
         }
     }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Game::Update(const float dtMillis)
+{
+    // Events posted from other threads (e.g. loader/worker tasks) are delivered here, once per step
+    events::EventSystem::GetInstance().FlushQueuedEvents();
+    
+    if (mInitTaskGraph)
+    {
+        UpdateLoadingScreen();
+        return;
+    }
+    
+    ServiceNetwork();
     
     auto& systemsEngine = CoreSystemsEngine::GetInstance();
     auto scene = systemsEngine.GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME);
     
-    for (auto& [objectId, objectWrapperData]: mLocalObjectWrappers)
+    const auto& objectIds = mEntityRegistry.GetObjectIds();
+    auto& networkStates = mEntityRegistry.GetNetworkStates();
+    auto& interpolationBuffers = mEntityRegistry.GetInterpolationBuffers();
+    auto& renderLinks = mEntityRegistry.GetRenderLinks();
+    auto& animationHandles = mEntityRegistry.GetAnimationHandles();
+    
+    for (size_t entityIndex = 0; entityIndex < mEntityRegistry.GetEntityCount(); ++entityIndex)
     {
-        auto rootSceneObject = objectWrapperData.mSceneObjects.front();
+        auto& objectData = networkStates[entityIndex];
+        const auto& sceneObjects = renderLinks[entityIndex].mSceneObjects;
+        const auto& animationHandle = animationHandles[entityIndex];
+        const auto& rootSceneObject = sceneObjects.front();
         
         assert(rootSceneObject);
 
-        if (objectId == mLocalPlayerId)
+        if (objectIds[entityIndex] == mLocalPlayerId)
         {
-            if (CoreSystemsEngine::GetInstance().GetInputStateManager().VButtonTapped(input::Button::SECONDARY_BUTTON) && objectWrapperData.mObjectData.objectState != network::ObjectState::BEGIN_MELEE &&
-                objectWrapperData.mObjectData.objectState != network::ObjectState::MELEE_ATTACK)
+            if (CoreSystemsEngine::GetInstance().GetInputStateManager().VButtonTapped(input::Button::SECONDARY_BUTTON) && objectData.objectState != network::ObjectState::BEGIN_MELEE &&
+                objectData.objectState != network::ObjectState::MELEE_ATTACK)
             {
                 // Cooldown checks etc..
                 const auto& cam = systemsEngine.GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME)->GetCamera();
-                const auto& pointingPos = CoreSystemsEngine::GetInstance().GetInputStateManager().VGetPointingPosInWorldSpace(cam.GetViewMatrix(), cam.GetProjMatrix());
-                const auto& playerToPointingPos = glm::normalize(glm::vec3(pointingPos.x, pointingPos.y, objectWrapperData.mObjectData.position.z) - objectWrapperData.mObjectData.position);
+                const auto& pointingPos = CoreSystemsEngine::GetInstance().GetInputStateManager().VGetPointingPosInWorldSpace(cam);
+                const auto& playerToPointingPos = glm::normalize(glm::vec3(pointingPos.x, pointingPos.y, objectData.position.z) - objectData.position);
                 const auto facingDirection = network::VecToFacingDirection(playerToPointingPos);
                 
-                objectWrapperData.mObjectData.objectState = network::ObjectState::BEGIN_MELEE;
-                objectWrapperData.mObjectData.facingDirection = facingDirection;
-                mObjectAnimationController->UpdateObjectAnimation(rootSceneObject, objectWrapperData.mObjectData.objectType, objectWrapperData.mObjectData.objectState, facingDirection, glm::vec3(0.0f), dtMillis);
+                objectData.objectState = network::ObjectState::BEGIN_MELEE;
+                objectData.facingDirection = facingDirection;
+                mObjectAnimationController->UpdateObjectAnimation(animationHandle, objectData.objectState, facingDirection, glm::vec3(0.0f), dtMillis);
                 
                 network::ObjectStateUpdateMessage stateUpdateMessage = {};
-                stateUpdateMessage.objectData = objectWrapperData.mObjectData;
+                stateUpdateMessage.objectData = objectData;
                 
                 network::SendMessage(sServer, &stateUpdateMessage, sizeof(stateUpdateMessage), network::channels::RELIABLE);
                 
@@ -348,27 +458,27 @@ void Game::Update(const float dtMillis)
 
                 network::SendMessage(sServer, &attackRequestMessage, sizeof(attackRequestMessage), network::channels::RELIABLE);
             }
-            else if (objectWrapperData.mObjectData.objectState == network::ObjectState::BEGIN_MELEE)
+            else if (objectData.objectState == network::ObjectState::BEGIN_MELEE)
             {
-                mObjectAnimationController->UpdateObjectAnimation(rootSceneObject, objectWrapperData.mObjectData.objectType, objectWrapperData.mObjectData.objectState, objectWrapperData.mObjectData.facingDirection, glm::vec3(0.0f), dtMillis);
+                mObjectAnimationController->UpdateObjectAnimation(animationHandle, objectData.objectState, objectData.facingDirection, glm::vec3(0.0f), dtMillis);
             }
-            else if (objectWrapperData.mObjectData.objectState == network::ObjectState::MELEE_ATTACK)
+            else if (objectData.objectState == network::ObjectState::MELEE_ATTACK)
             {
-                const auto& animationInfoResult = mObjectAnimationController->UpdateObjectAnimation(rootSceneObject, objectWrapperData.mObjectData.objectType, objectWrapperData.mObjectData.objectState, objectWrapperData.mObjectData.facingDirection, glm::vec3(0.0f), dtMillis);
+                const auto& animationInfoResult = mObjectAnimationController->UpdateObjectAnimation(animationHandle, objectData.objectState, objectData.facingDirection, glm::vec3(0.0f), dtMillis);
                 if (animationInfoResult.mAnimationFinished)
                 {
-                    objectWrapperData.mObjectData.objectState = network::ObjectState::IDLE;
+                    objectData.objectState = network::ObjectState::IDLE;
                 }
             }
-            else if (objectWrapperData.mObjectData.objectState == network::ObjectState::IDLE || objectWrapperData.mObjectData.objectState == network::ObjectState::RUNNING)
+            else if (objectData.objectState == network::ObjectState::IDLE || objectData.objectState == network::ObjectState::RUNNING)
             {
                 const auto& globalMapDataRepo = GlobalMapDataRepository::GetInstance();
                 const auto& currentMapDefinition = globalMapDataRepo.GetMapDefinition(mCurrentMap);
                 
                 auto inputDirection = LocalPlayerInputController::GetMovementDirection();
-                auto velocity = glm::vec3(inputDirection.x, inputDirection.y, 0.0f) * objectWrapperData.mObjectData.speed * sDebugPlayerVelocityMultiplier * dtMillis;
+                auto velocity = glm::vec3(inputDirection.x, inputDirection.y, 0.0f) * objectData.speed * sDebugPlayerVelocityMultiplier * dtMillis;
                 
-                const auto& animationInfoResult = mObjectAnimationController->UpdateObjectAnimation(rootSceneObject, objectWrapperData.mObjectData.objectType, objectWrapperData.mObjectData.objectState, network::VecToFacingDirection(velocity), velocity, dtMillis);
+                const auto& animationInfoResult = mObjectAnimationController->UpdateObjectAnimation(animationHandle, objectData.objectState, network::VecToFacingDirection(velocity), velocity, dtMillis);
                 
                 // Movement integration first horizontally
                 rootSceneObject->mPosition.x += velocity.x;
@@ -426,34 +536,29 @@ void Game::Update(const float dtMillis)
                     }
                 }
                 
-                objectWrapperData.mObjectData.position = rootSceneObject->mPosition;
-                objectWrapperData.mObjectData.velocity = velocity;
-                objectWrapperData.mObjectData.objectState = network::ObjectState::RUNNING;
-                objectWrapperData.mObjectData.facingDirection = animationInfoResult.mFacingDirection;
-                network::SetCurrentMap(objectWrapperData.mObjectData, mCurrentMap.GetString());
+                objectData.position = rootSceneObject->mPosition;
+                objectData.velocity = velocity;
+                objectData.objectState = network::ObjectState::RUNNING;
+                objectData.facingDirection = animationInfoResult.mFacingDirection;
+                network::SetCurrentMap(objectData, mCurrentMap.GetString());
                 
                 network::ObjectStateUpdateMessage stateUpdateMessage = {};
-                stateUpdateMessage.objectData = mLocalObjectWrappers[mLocalPlayerId].mObjectData;
+                stateUpdateMessage.objectData = objectData;
                 
                 network::SendMessage(sServer, &stateUpdateMessage, sizeof(stateUpdateMessage), network::channels::UNRELIABLE);
             }
         }
         else
         {
-            auto vecToPosition = objectWrapperData.mObjectData.position - rootSceneObject->mPosition;
+            auto vecToPosition = interpolationBuffers[entityIndex].GetLatest() - rootSceneObject->mPosition;
             if (glm::length(vecToPosition) > 0.002f)
             {
                 auto direction = glm::normalize(vecToPosition);
-                auto velocity = glm::vec3(direction.x, direction.y, 0.0f) * objectWrapperData.mObjectData.speed * dtMillis;
+                auto velocity = glm::vec3(direction.x, direction.y, 0.0f) * objectData.speed * dtMillis;
                 rootSceneObject->mPosition += velocity;
             }
             
-            mObjectAnimationController->UpdateObjectAnimation(rootSceneObject, objectWrapperData.mObjectData.objectType, objectWrapperData.mObjectData.objectState, objectWrapperData.mObjectData.facingDirection, objectWrapperData.mObjectData.velocity, dtMillis);
-        }
-        
-        for (auto otherSceneObject: objectWrapperData.mSceneObjects)
-        {
-            otherSceneObject->mPosition = glm::vec3(rootSceneObject->mPosition.x, rootSceneObject->mPosition.y, otherSceneObject->mPosition.z);
+            mObjectAnimationController->UpdateObjectAnimation(animationHandle, objectData.objectState, objectData.facingDirection, objectData.velocity, dtMillis);
         }
     }
     
@@ -480,11 +585,11 @@ void Game::Update(const float dtMillis)
             sRequestObjectPathTimer = 0.1f;
             network::DebugGetObjectPathRequestMessage requestPathDataMessage = {};
             
-            for (auto& [objectId, objectWrapperData]: mLocalObjectWrappers)
+            for (size_t entityIndex = 0; entityIndex < mEntityRegistry.GetEntityCount(); ++entityIndex)
             {
-                if (objectWrapperData.mObjectData.objectType == network::ObjectType::NPC)
+                if (networkStates[entityIndex].objectType == network::ObjectType::NPC)
                 {
-                    requestPathDataMessage.objectId = objectId;
+                    requestPathDataMessage.objectId = objectIds[entityIndex];
                     network::SendMessage(sServer, &requestPathDataMessage, sizeof(requestPathDataMessage), network::channels::UNRELIABLE);
                 }
             }
@@ -517,6 +622,146 @@ void Game::Update(const float dtMillis)
 
 ///------------------------------------------------------------------------------------------------
 
+void Game::HandleServerMessage(const unsigned char* messageData, const size_t messageSize)
+{
+    if (messageSize == 0)
+    {
+        return;
+    }
+    
+    PROFILE_SCOPE("Game::HandleServerMessage");
+    auto messageType = static_cast<network::MessageType>(messageData[0]);
+    switch (messageType)
+    {
+        case network::MessageType::ObjectStateUpdateMessage:
+        {
+            auto* message = reinterpret_cast<const network::ObjectStateUpdateMessage*>(messageData);
+            
+            // Pre-existing object
+            auto entityHandle = mEntityRegistry.FindEntity(message->objectData.objectId);
+            if (!entityHandle.IsValid())
+            {
+                entityHandle = CreateObject(message->objectData);
+            }
+            
+            // Update everything but local player's data (for now)
+            if (message->objectData.objectId != mLocalPlayerId)
+            {
+                mEntityRegistry.GetNetworkState(entityHandle) = message->objectData;
+                mEntityRegistry.GetInterpolationBuffer(entityHandle).Push(message->objectData.position);
+            }
+            
+            assert(math::Abs(mEntityRegistry.GetRenderLink(entityHandle).mSceneObjects.front()->mScale.x - message->objectData.objectScale) < 0.0001f);
+        } break;
+        
+        case network::MessageType::DebugGetQuadtreeResponseMessage:
+        {
+            auto* message = reinterpret_cast<const network::DebugGetQuadtreeResponseMessage*>(messageData);
+            
+            auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME);
+            
+            scene->RemoveAllSceneObjectsWithNameStartingWith(QUADTREE_DEBUG_SCENE_OBJECT_NAME_PREFIX);
+            for (int i = 0; i < message->quadtreeData.debugRectCount; ++i)
+            {
+                auto quadtreeSceneObject = scene->CreateSceneObject(strutils::StringId(QUADTREE_DEBUG_SCENE_OBJECT_NAME_PREFIX + std::to_string(i)));
+                quadtreeSceneObject->mPosition = message->quadtreeData.debugRectPositions[i];
+                quadtreeSceneObject->mScale = message->quadtreeData.debugRectDimensions[i];
+                quadtreeSceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "debug/debug_quadtree.png");
+                quadtreeSceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 1.0f;
+                quadtreeSceneObject->mInvisible = !sShowQuadtree;
+            }
+        } break;
+            
+        case network::MessageType::DebugGetObjectPathResponseMessage:
+        {
+            auto* message = reinterpret_cast<const network::DebugGetObjectPathResponseMessage*>(messageData);
+            
+            auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME);
+            
+            scene->RemoveAllSceneObjectsWithNameStartingWith(PATH_DEBUG_SCENE_OBJECT_NAME_PREFIX + std::to_string(message->objectId));
+            
+            for (int i = 0; i < message->pathData.debugPathPositionsCount; ++i)
+            {
+                auto pathSceneObject = scene->CreateSceneObject(strutils::StringId(PATH_DEBUG_SCENE_OBJECT_NAME_PREFIX + std::to_string(message->objectId) + "_" + std::to_string(i)));
+                pathSceneObject->mPosition = message->pathData.debugPathPositions[i];
+                pathSceneObject->mScale = glm::vec3(network::MAP_TILE_SIZE/10.0f) * glm::vec3(i + 1);
+                pathSceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "debug/debug_circle.png");
+                pathSceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 1.0f;
+                pathSceneObject->mInvisible = !sShowObjectPaths;
+            }
+        } break;
+            
+        case network::MessageType::PlayerConnectedMessage:
+        {
+            auto* message = reinterpret_cast<const network::PlayerConnectedMessage*>(messageData);
+            mLocalPlayerId = message->objectId;
+            logging::Log(logging::LogType::INFO, "Received player ID %d", mLocalPlayerId);
+        } break;
+            
+        case network::MessageType::PlayerDisconnectedMessage:
+        {
+            auto* message = reinterpret_cast<const network::PlayerDisconnectedMessage*>(messageData);
+            DestroyObject(message->objectId);
+        } break;
+            
+        case network::MessageType::ObjectCreatedMessage:
+        {
+            auto* message = reinterpret_cast<const network::ObjectCreatedMessage*>(messageData);
+            CreateObject(message->objectData);
+        } break;
+        
+        case network::MessageType::ObjectDestroyedMessage:
+        {
+            auto* message = reinterpret_cast<const network::ObjectDestroyedMessage*>(messageData);
+            DestroyObject(message->objectId);
+        } break;
+        
+        case network::MessageType::BeginAttackResponseMessage:
+        {
+            auto* message = reinterpret_cast<const network::BeginAttackResponseMessage*>(messageData);
+            if (message->allowed)
+            {
+                mCastBarController->BeginCast(message->chargeDurationSecs, [this]()
+                {
+                    const auto localPlayerHandle = mEntityRegistry.FindEntity(mLocalPlayerId);
+                    if (localPlayerHandle.IsValid())
+                    {
+                        mEntityRegistry.GetNetworkState(localPlayerHandle).objectState = network::ObjectState::MELEE_ATTACK;
+                    }
+                });
+            }
+            else
+            {
+                const auto localPlayerHandle = mEntityRegistry.FindEntity(mLocalPlayerId);
+                if (localPlayerHandle.IsValid())
+                {
+                    mEntityRegistry.GetNetworkState(localPlayerHandle).objectState = network::ObjectState::IDLE;
+                }
+            }
+        } break;
+        
+        case network::MessageType::NPCAttackMessage:
+        {
+            auto* message = reinterpret_cast<const network::NPCAttackMessage*>(messageData);
+            const auto attackerHandle = mEntityRegistry.FindEntity(message->attackerId);
+            if (attackerHandle.IsValid())
+            {
+                mObjectAnimationController->OnNPCAttack(mEntityRegistry.GetAnimationHandle(attackerHandle));
+            }
+        } break;
+        
+        case network::MessageType::BeginAttackRequestMessage:
+        case network::MessageType::CancelAttackMessage:
+        case network::MessageType::DebugGetQuadtreeRequestMessage:
+        case network::MessageType::DebugGetObjectPathRequestMessage:
+        case network::MessageType::DebugSetSwarmParams:
+        case network::MessageType::UNUSED:
+            break;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
 void Game::ApplicationMovedToBackground()
 {
 }
@@ -538,8 +783,16 @@ void Game::WindowResize()
 
 ///------------------------------------------------------------------------------------------------
 
-void Game::CreateObject(const network::ObjectData& objectData)
+EntityHandle Game::CreateObject(const network::ObjectData& objectData)
 {
+    auto entityHandle = mEntityRegistry.FindEntity(objectData.objectId);
+    if (entityHandle.IsValid())
+    {
+        logging::Log(logging::LogType::WARNING, "Attempted to re-create pre-existing object %s", GetSceneObjectName(objectData.objectId).c_str());
+        mEntityRegistry.GetNetworkState(entityHandle) = objectData;
+        return entityHandle;
+    }
+    
     if (objectData.objectId == mLocalPlayerId)
     {
         assert(!mMapResourceController);
@@ -554,25 +807,36 @@ void Game::CreateObject(const network::ObjectData& objectData)
         }
     }
     
-    mLocalObjectWrappers[objectData.objectId].mObjectData = objectData;
+    entityHandle = mEntityRegistry.CreateEntity(objectData);
+    NetworkEntitySceneObjectFactory::CreateSceneObjects(mEntityRegistry, entityHandle, sShowColliders);
+    mEntityRegistry.GetAnimationHandle(entityHandle) = mObjectAnimationController->RegisterObject(mEntityRegistry.GetRenderLink(entityHandle).mSceneObjects.front(), objectData.objectType);
     
-    NetworkEntitySceneObjectFactory::CreateSceneObjects(objectData, sShowColliders, mLocalObjectWrappers[objectData.objectId].mSceneObjects);
+    return entityHandle;
 }
 
 ///------------------------------------------------------------------------------------------------
 
 void Game::DestroyObject(const network::objectId_t objectId)
 {
+    const auto entityHandle = mEntityRegistry.FindEntity(objectId);
+    if (!entityHandle.IsValid())
+    {
+        logging::Log(logging::LogType::WARNING, "Attempted to destroy unknown object %s", GetSceneObjectName(objectId).c_str());
+        return;
+    }
+    
     events::EventSystem::GetInstance().DispatchEvent<events::ObjectDestroyedEvent>(GetSceneObjectNameId(objectId));
+    mObjectAnimationController->UnregisterObject(mEntityRegistry.GetAnimationHandle(entityHandle));
+    
     auto& animationManager = CoreSystemsEngine::GetInstance().GetAnimationManager();
-    for (auto sceneObject: mLocalObjectWrappers.at(objectId).mSceneObjects)
+    for (auto sceneObject: mEntityRegistry.GetRenderLink(entityHandle).mSceneObjects)
     {
-        animationManager.StartAnimation(std::make_unique<rendering::TweenAlphaAnimation>(sceneObject, 0.0f, DESTROYED_OBJECT_FADE_OUT_TIME_SECS), [sceneObject]()
+        animationManager.StartAnimation(rendering::AlphaTween(sceneObject, 0.0f, DESTROYED_OBJECT_FADE_OUT_TIME_SECS), [sceneObject]()
         {
             CoreSystemsEngine::GetInstance().GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME)->RemoveSceneObject(sceneObject->mName);
         });
     }
-    mLocalObjectWrappers.erase(objectId);
+    mEntityRegistry.DestroyEntity(entityHandle);
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -660,9 +924,9 @@ void Game::CreateDebugWidgets()
     ImGui::SameLine();
     if (ImGui::Checkbox("##", &sShowColliders))
     {
-        for (const auto& [objectId, objectWrapperData]: mLocalObjectWrappers)
+        for (const auto& renderLink: mEntityRegistry.GetRenderLinks())
         {
-            for (auto sceneObject: objectWrapperData.mSceneObjects)
+            for (auto sceneObject: renderLink.mSceneObjects)
             {
                 if (strutils::StringEndsWith(sceneObject->mName.GetString(), "collider"))
                 {
@@ -686,32 +950,35 @@ void Game::CreateDebugWidgets()
     
     
     ImGui::SeparatorText("Network Object Data");
-    for (const auto& [objectId, objectWrapperData]: mLocalObjectWrappers)
+    for (size_t entityIndex = 0; entityIndex < mEntityRegistry.GetEntityCount(); ++entityIndex)
     {
+        const auto objectId = mEntityRegistry.GetObjectIds()[entityIndex];
+        const auto& objectData = mEntityRegistry.GetNetworkStates()[entityIndex];
+        const auto& sceneObjects = mEntityRegistry.GetRenderLinks()[entityIndex].mSceneObjects;
         auto name = objectId == mLocalPlayerId ? std::string("localPlayer") : GetSceneObjectName(objectId);
         if (ImGui::CollapsingHeader(name.c_str(), ImGuiTreeNodeFlags_None))
         {
             ImGui::PushID(name.c_str());
-            ImGui::Text("Object Type: %s", network::GetObjectTypeString(objectWrapperData.mObjectData.objectType));
-            ImGui::Text("Object State: %s", network::GetObjectStateString(objectWrapperData.mObjectData.objectState));
-            ImGui::Text("Facing Direction: %s", network::GetFacingDirectionString(objectWrapperData.mObjectData.facingDirection));
-            ImGui::Text("Object Faction: %s", network::GetObjectFactionString(objectWrapperData.mObjectData.objectFaction));
-            ImGui::Text("Attack Type: %s", network::GetAttackTypeString(objectWrapperData.mObjectData.attackType));
-            ImGui::Text("Projectile Type: %s", network::GetProjectileTypeString(objectWrapperData.mObjectData.projectileType));
-            ImGui::Text("Current Map: %s", network::GetCurrentMapString(objectWrapperData.mObjectData).c_str());
-            ImGui::Text("Object Speed: %.4f", objectWrapperData.mObjectData.speed);
-            ImGui::Text("Object Scale: %.4f", objectWrapperData.mObjectData.objectScale);
-            ImGui::Text("Action Timer: %.4f", objectWrapperData.mObjectData.actionTimer);
-            ImGui::Text("Object position: %.4f, %.4f, %.4f", objectWrapperData.mObjectData.position.x, objectWrapperData.mObjectData.position.y, objectWrapperData.mObjectData.position.z);
-            ImGui::Text("Object velocity: %.4f, %.4f, %.4f", objectWrapperData.mObjectData.velocity.x, objectWrapperData.mObjectData.velocity.y, objectWrapperData.mObjectData.velocity.z);
-            ImGui::Text("Object Speed: %.4f", objectWrapperData.mObjectData.speed);
+            ImGui::Text("Object Type: %s", network::GetObjectTypeString(objectData.objectType));
+            ImGui::Text("Object State: %s", network::GetObjectStateString(objectData.objectState));
+            ImGui::Text("Facing Direction: %s", network::GetFacingDirectionString(objectData.facingDirection));
+            ImGui::Text("Object Faction: %s", network::GetObjectFactionString(objectData.objectFaction));
+            ImGui::Text("Attack Type: %s", network::GetAttackTypeString(objectData.attackType));
+            ImGui::Text("Projectile Type: %s", network::GetProjectileTypeString(objectData.projectileType));
+            ImGui::Text("Current Map: %s", network::GetCurrentMapString(objectData).c_str());
+            ImGui::Text("Object Speed: %.4f", objectData.speed);
+            ImGui::Text("Object Scale: %.4f", objectData.objectScale);
+            ImGui::Text("Action Timer: %.4f", objectData.actionTimer);
+            ImGui::Text("Object position: %.4f, %.4f, %.4f", objectData.position.x, objectData.position.y, objectData.position.z);
+            ImGui::Text("Object velocity: %.4f, %.4f, %.4f", objectData.velocity.x, objectData.velocity.y, objectData.velocity.z);
+            ImGui::Text("Object Speed: %.4f", objectData.speed);
             const auto& globalMapDataRepo = GlobalMapDataRepository::GetInstance();
-            const auto& mapName = strutils::StringId(network::GetCurrentMapString(objectWrapperData.mObjectData));
+            const auto& mapName = strutils::StringId(network::GetCurrentMapString(objectData));
             if (mMapResourceController && mMapResourceController->GetAllLoadedMapResources().contains(mapName) && mMapResourceController->GetAllLoadedMapResources().at(mapName).mMapResourcesState == MapResourcesState::LOADED)
             {
                 const auto& mapDefinition = globalMapDataRepo.GetMapDefinition(mapName);
                 auto navmap = mMapResourceController->GetAllLoadedMapResources().at(mapName).mNavmap;
-                auto currentNavmapCoords = navmap->GetNavmapCoord(objectWrapperData.mSceneObjects.front()->mPosition, mapDefinition.mMapPosition, network::MAP_GAME_SCALE);
+                auto currentNavmapCoords = navmap->GetNavmapCoord(sceneObjects.front()->mPosition, mapDefinition.mMapPosition, network::MAP_GAME_SCALE);
                 auto currentNavmapTileType = navmap->GetNavmapTileAt(currentNavmapCoords);
                 
                 ImGui::Text("Navmap Tile: x:%d, y:%d", currentNavmapCoords.x, currentNavmapCoords.y);
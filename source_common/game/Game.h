@@ -12,10 +12,12 @@
 
 #include <atomic>
 #include <memory>
+#include <engine/utils/InitTaskGraph.h>
 #include <engine/utils/MathUtils.h>
 #include <engine/utils/StringUtils.h>
 #include <net_common/NetworkCommon.h>
 #include <game/events/EventSystem.h>
+#include <game/EntityRegistry.h>
 #include <vector>
 
 ///------------------------------------------------------------------------------------------------
@@ -30,40 +32,51 @@ namespace network
     class Navmap;
 }
 
-class ObjectAnimationController;
 class AnimatedButton;
 class CastBarController;
+class FillableBar;
 class MapResourceController;
 class Game final
 {
 public:
     Game(const int argc, char** argv);
+    
+    // Neither starts the engine loop nor connects to the server (benchmarks & tools drive Init() etc. directly)
+    Game();
     ~Game();
     
+    // Runs all startup tasks to completion, without connecting to the server
     void Init();
+    
+    // Kicks off the startup tasks, which then progress over the following Update()s behind a loading screen
+    void BeginInit(const bool connectToServer);
+    
+    void HandleServerMessage(const unsigned char* messageData, const size_t messageSize);
+    void ServiceNetwork();
     void Update(const float dtMillis);
     void ApplicationMovedToBackground();
     void WindowResize();
     void OnOneSecondElapsed();
-    void CreateObject(const network::ObjectData& objectData);
+    EntityHandle CreateObject(const network::ObjectData& objectData);
     void DestroyObject(const network::objectId_t objectId);
     void CreateMapSceneObjects(const strutils::StringId& mapName);
     void CreateDebugWidgets();
     
 private:
+    void CreateStartupTasks(const bool connectToServer);
+    void CreateLoadingScreen();
+    void UpdateLoadingScreen();
+    void FinishInit();
+    [[noreturn]] void AbortInit(const std::string& reason);
+    void ConnectToServer();
+    InitTaskGraph::TaskStatus UpdateServerHandshake();
     void ShowDebugNavmap();
     void HideDebugNavmap();
     
-private:
-    struct LocalObjectWrapper
-    {
-        // Anim(equipment) layers
-        network::ObjectData mObjectData;
-        std::vector<std::shared_ptr<scene::SceneObject>> mSceneObjects;
-    };
-
 private:
     network::objectId_t mLocalPlayerId;
+    std::unique_ptr<InitTaskGraph> mInitTaskGraph;
+    std::unique_ptr<FillableBar> mLoadingBar;
     std::unique_ptr<AnimatedButton> mTestButton;
     std::unique_ptr<CastBarController> mCastBarController;
     std::unique_ptr<ObjectAnimationController> mObjectAnimationController;
@@ -73,7 +86,7 @@ private:
     std::unique_ptr<MapResourceController> mMapResourceController;
     std::shared_ptr<network::Navmap> mCurrentNavmap;
     strutils::StringId mCurrentMap;
-    std::unordered_map<network::objectId_t, LocalObjectWrapper> mLocalObjectWrappers;
+    EntityRegistry mEntityRegistry;
 };
 
 ///------------------------------------------------------------------------------------------------
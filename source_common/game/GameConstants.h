@@ -30,6 +30,7 @@ namespace game_constants
     // Game Constants
     inline const strutils::StringId WORLD_SCENE_NAME = strutils::StringId("world");
     inline const strutils::StringId GUI_SCENE_NAME = strutils::StringId("gui");
+    inline const strutils::StringId LOADING_SCENE_NAME = strutils::StringId("loading");
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 ///  Created by Alex Koukoulas on 05/02/2026
 ///------------------------------------------------------------------------------------------------
 
+#include <game/EntityRegistry.h>
 #include <game/NetworkEntitySceneObjectFactory.h>
 #include <game/GameCommon.h>
 #include <game/GameConstants.h>
@@ -19,8 +20,11 @@
 
 ///------------------------------------------------------------------------------------------------
 
-void NetworkEntitySceneObjectFactory::CreateSceneObjects(const network::ObjectData& objectData, const bool collidersVisible, std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects)
+void NetworkEntitySceneObjectFactory::CreateSceneObjects(EntityRegistry& entityRegistry, const EntityHandle& entityHandle, const bool collidersVisible)
 {
+    const auto& objectData = entityRegistry.GetNetworkState(entityHandle);
+    auto& sceneObjects = entityRegistry.GetRenderLink(entityHandle).mSceneObjects;
+    
     auto& resService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
     auto scene = CoreSystemsEngine::GetInstance().GetSceneManager().FindScene(game_constants::WORLD_SCENE_NAME);
     auto sceneObjectName = GetSceneObjectNameId(objectData.objectId);
@@ -95,10 +99,11 @@ void NetworkEntitySceneObjectFactory::CreateSceneObjects(const network::ObjectDa
             } break;
         }
 
+        // Follows the root object around as its child, so position & scale are relative to the root's
+        const auto& rootSceneObject = sceneObjects.front();
+        colliderSceneObject->mParent = rootSceneObject;
         colliderSceneObject->mScale = glm::vec3(objectData.colliderData.colliderRelativeDimensions.x, objectData.colliderData.colliderRelativeDimensions.y, 1.0f);
-        colliderSceneObject->mScale *= sceneObjects.front()->mScale;
-        colliderSceneObject->mPosition = objectData.position;
-        colliderSceneObject->mPosition.z = map_constants::TILE_NAVMAP_LAYER_Z;
+        colliderSceneObject->mPosition = glm::vec3(0.0f, 0.0f, (map_constants::TILE_NAVMAP_LAYER_Z - rootSceneObject->mPosition.z)/rootSceneObject->mScale.z);
         colliderSceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 0.5f;
         colliderSceneObject->mInvisible = !collidersVisible;
         sceneObjects.push_back(colliderSceneObject);
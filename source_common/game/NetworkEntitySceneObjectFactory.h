@@ -16,12 +16,13 @@
 
 ///------------------------------------------------------------------------------------------------
 
-namespace network { struct ObjectData; }
-namespace scene { struct SceneObject; }
+class EntityRegistry;
+struct EntityHandle;
 class NetworkEntitySceneObjectFactory
 {
 public:
-    static void CreateSceneObjects(const network::ObjectData& objectData, const bool collidersVisible, std::vector<std::shared_ptr<scene::SceneObject>>& sceneObjects);
+    // Creates the entity's scene objects off of its network state, and links them to it
+    static void CreateSceneObjects(EntityRegistry& entityRegistry, const EntityHandle& entityHandle, const bool collidersVisible);
     
 private:
     NetworkEntitySceneObjectFactory(){};
@@ -1,255 +1,415 @@
 ///------------------------------------------------------------------------------------------------
 ///  ObjectAnimationController.cpp
-///  TinyMMOClient                                                                                            
-///                                                                                                
-///  Created by Alex Koukoulas on 27/12/2025                                                       
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 27/12/2025
 ///------------------------------------------------------------------------------------------------
 
+#include <cassert>
+#include <engine/CoreSystemsEngine.h>
+#include <engine/resloading/DataFileResource.h>
 #include <engine/scene/SceneObject.h>
 #include <engine/rendering/CommonUniforms.h>
 #include <engine/utils/Logging.h>
 #include <game/ObjectAnimationController.h>
-#include <unordered_map>
+#include <string>
 
 ///------------------------------------------------------------------------------------------------
 
-static const float UV_X_STEP = 0.3333f; // Assuming 3 columns
-static const float UV_Y_STEP = 0.2f;    // Assuming 5 rows
-static const float PLAYER_ANIMATION_TIME_CONSTANT = 0.000492f;
-static const float ATTACK_FRAME_ANIMATION_TIME_SECS = 0.05f;
-static const float NPC_FRAME_ANIMATION_TIME_SECS = 0.15f;
+static const std::string ANIMATION_CLIPS_FILE_NAME = "animation_clips.json";
 
 ///------------------------------------------------------------------------------------------------
 
-static const std::pair<glm::vec2, glm::vec2> ANIMATION_UV_MAP[5][3] =
+// Only consulted while loading the clips
+static const std::pair<const char*, network::ObjectType> OBJECT_TYPE_NAMES[] =
 {
-    {{ {0.0f, UV_Y_STEP * 4.0f}, {UV_X_STEP, UV_Y_STEP * 5.0f} }, { {UV_X_STEP, UV_Y_STEP * 4.0f}, {UV_X_STEP * 2.0f, UV_Y_STEP * 5.0f} }, { {UV_X_STEP * 2.0f, UV_Y_STEP * 4.0f}, { UV_X_STEP * 3.0f, UV_Y_STEP * 5.0f} }},
-    {{ {0.0f, UV_Y_STEP * 3.0f}, {UV_X_STEP, UV_Y_STEP * 4.0f} }, { {UV_X_STEP, UV_Y_STEP * 3.0f}, {UV_X_STEP * 2.0f, UV_Y_STEP * 4.0f} }, { {UV_X_STEP * 2.0f, UV_Y_STEP * 3.0f}, { UV_X_STEP * 3.0f, UV_Y_STEP * 4.0f} }},
-    {{ {0.0f, UV_Y_STEP * 2.0f}, {UV_X_STEP, UV_Y_STEP * 3.0f} }, { {UV_X_STEP, UV_Y_STEP * 2.0f}, {UV_X_STEP * 2.0f, UV_Y_STEP * 3.0f} }, { {UV_X_STEP * 2.0f, UV_Y_STEP * 2.0f}, { UV_X_STEP * 3.0f, UV_Y_STEP * 3.0f} }},
-    {{ {0.0f, UV_Y_STEP * 1.0f}, {UV_X_STEP, UV_Y_STEP * 2.0f} }, { {UV_X_STEP, UV_Y_STEP * 1.0f}, {UV_X_STEP * 2.0f, UV_Y_STEP * 2.0f} }, { {UV_X_STEP * 2.0f, UV_Y_STEP * 1.0f}, { UV_X_STEP * 3.0f, UV_Y_STEP * 2.0f} }},
-    {{ {0.0f, 0.0f}, {UV_X_STEP, UV_Y_STEP} }, { {UV_X_STEP, 0.0f}, {UV_X_STEP * 2.0f, UV_Y_STEP} }, { {UV_X_STEP * 2.0f, 0.0f}, { UV_X_STEP * 3.0f, UV_Y_STEP } }}
+    { "PLAYER", network::ObjectType::PLAYER },
+    { "NPC", network::ObjectType::NPC },
+    { "ATTACK", network::ObjectType::ATTACK },
+    { "STATIC", network::ObjectType::STATIC }
+};
+
+static const std::pair<const char*, network::ObjectState> OBJECT_STATE_NAMES[] =
+{
+    { "IDLE", network::ObjectState::IDLE },
+    { "RUNNING", network::ObjectState::RUNNING },
+    { "BEGIN_MELEE", network::ObjectState::BEGIN_MELEE },
+    { "MELEE_ATTACK", network::ObjectState::MELEE_ATTACK },
+    { "CASTING", network::ObjectState::CASTING }
+};
+
+static const std::pair<const char*, network::FacingDirection> FACING_DIRECTION_NAMES[] =
+{
+    { "NORTH", network::FacingDirection::NORTH },
+    { "NORTH_EAST", network::FacingDirection::NORTH_EAST },
+    { "EAST", network::FacingDirection::EAST },
+    { "SOUTH_EAST", network::FacingDirection::SOUTH_EAST },
+    { "SOUTH", network::FacingDirection::SOUTH },
+    { "SOUTH_WEST", network::FacingDirection::SOUTH_WEST },
+    { "WEST", network::FacingDirection::WEST },
+    { "NORTH_WEST", network::FacingDirection::NORTH_WEST }
 };
 
 ///------------------------------------------------------------------------------------------------
 
-static inline int GetAnimationRowFromFacingDirection(const network::FacingDirection direction)
+template<typename EnumType, size_t N>
+static EnumType ParseEnumName(const std::pair<const char*, EnumType> (&enumNames)[N], const std::string& name)
 {
-    switch (direction)
+    for (const auto& enumName: enumNames)
     {
-        case network::FacingDirection::NORTH_WEST:
-        case network::FacingDirection::NORTH_EAST:
-            return 3;
-        
-        case network::FacingDirection::SOUTH_WEST:
-        case network::FacingDirection::SOUTH_EAST:
-            return 1;
-        
-        case network::FacingDirection::NORTH:
-            return 4;
-
-        case network::FacingDirection::SOUTH:
-            return 0;
-            
-        case network::FacingDirection::EAST:
-        case network::FacingDirection::WEST:
-            return 2;
+        if (name == enumName.first)
+        {
+            return enumName.second;
+        }
     }
-};
 
-static inline bool ShouldFlipAnimation(const network::FacingDirection direction)
+    logging::Log(logging::LogType::ERROR, "Unknown enum name %s in %s", name.c_str(), ANIMATION_CLIPS_FILE_NAME.c_str());
+    assert(false);
+    return enumNames[0].second;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static inline int GetObjectTypeIndex(const network::ObjectType objectType)
 {
-    return direction == network::FacingDirection::NORTH_WEST ||
-           direction == network::FacingDirection::SOUTH_WEST ||
-           direction == network::FacingDirection::WEST;
-};
+    switch (objectType)
+    {
+        case network::ObjectType::PLAYER: return 0;
+        case network::ObjectType::NPC: return 1;
+        case network::ObjectType::ATTACK: return 2;
+        case network::ObjectType::STATIC: return 3;
+    }
+    return 0;
+}
+
+static inline int GetObjectStateIndex(const network::ObjectState objectState)
+{
+    switch (objectState)
+    {
+        case network::ObjectState::IDLE: return 0;
+        case network::ObjectState::RUNNING: return 1;
+        case network::ObjectState::BEGIN_MELEE: return 2;
+        case network::ObjectState::MELEE_ATTACK: return 3;
+        case network::ObjectState::CASTING: return 4;
+    }
+    return 0;
+}
+
+static inline int GetFacingDirectionIndex(const network::FacingDirection facingDirection)
+{
+    switch (facingDirection)
+    {
+        case network::FacingDirection::NORTH: return 0;
+        case network::FacingDirection::NORTH_EAST: return 1;
+        case network::FacingDirection::EAST: return 2;
+        case network::FacingDirection::SOUTH_EAST: return 3;
+        case network::FacingDirection::SOUTH: return 4;
+        case network::FacingDirection::SOUTH_WEST: return 5;
+        case network::FacingDirection::WEST: return 6;
+        case network::FacingDirection::NORTH_WEST: return 7;
+    }
+    return 0;
+}
 
 ///------------------------------------------------------------------------------------------------
 
-ObjectAnimationController::ObjectAnimationController()
+static nlohmann::json LoadAnimationClipsJson()
 {
-    events::EventSystem::GetInstance().RegisterForEvent<events::ObjectDestroyedEvent>(this, &ObjectAnimationController::OnObjectDestroyedEvent);
+    auto& resService = CoreSystemsEngine::GetInstance().GetResourceLoadingService();
+    auto animationClipsJsonResourceId = resService.LoadResource(resources::ResourceLoadingService::RES_DATA_ROOT + ANIMATION_CLIPS_FILE_NAME);
+    return nlohmann::json::parse(resService.GetResource<resources::DataFileResource>(animationClipsJsonResourceId).GetContents());
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void ObjectAnimationController::OnObjectDestroyedEvent(const events::ObjectDestroyedEvent& objectDestroyedEvent)
+ObjectAnimationController::ObjectAnimationController()
+    : ObjectAnimationController(LoadAnimationClipsJson())
 {
-    mObjectAnimationInfoMap.erase(objectDestroyedEvent.mSceneObjectName);
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void ObjectAnimationController::OnNPCAttack(const strutils::StringId& npcNameId)
+ObjectAnimationController::ObjectAnimationController(const nlohmann::json& animationClipsJson)
 {
-    if (mObjectAnimationInfoMap.contains(npcNameId))
+    for (auto& clipIndices: mClipIndices)
     {
-        mObjectAnimationInfoMap.at(npcNameId).mFrameIndex = 0;
+        clipIndices.fill(-1);
     }
+
+    LoadAnimationClips(animationClipsJson);
 }
 
 ///------------------------------------------------------------------------------------------------
 
-const ObjectAnimationController::ObjectAnimationInfo& ObjectAnimationController::UpdateObjectAnimation(std::shared_ptr<scene::SceneObject> sceneObject, const network::ObjectType objectType, const network::ObjectState objectState, const network::FacingDirection facingDirection, const glm::vec3& velocity, const float dtMillis)
+ObjectAnimationHandle ObjectAnimationController::RegisterObject(std::shared_ptr<scene::SceneObject> sceneObject, const network::ObjectType objectType)
 {
-    if (!mObjectAnimationInfoMap.count(sceneObject->mName))
+    ObjectAnimationHandle handle;
+    if (mFreeSlotIndices.empty())
     {
-        mObjectAnimationInfoMap[sceneObject->mName] = {};
+        handle.mSlotIndex = static_cast<uint32_t>(mSlots.size());
+        mSlots.emplace_back();
     }
-    
-    if (objectType == network::ObjectType::PLAYER || objectType == network::ObjectType::NPC)
+    else
     {
-        UpdateCharacterAnimation(sceneObject, objectType, objectState, facingDirection, velocity, dtMillis);
+        handle.mSlotIndex = mFreeSlotIndices.back();
+        mFreeSlotIndices.pop_back();
     }
-    else if (objectType == network::ObjectType::ATTACK)
+
+    auto& slot = mSlots[handle.mSlotIndex];
+    slot.mStateIndex = static_cast<uint32_t>(mObjectAnimationStates.size());
+    handle.mGeneration = slot.mGeneration;
+
+    // The uniform map's values are node based, hence their addresses survive any later insertions
+    ObjectAnimationState objectAnimationState = {};
+    objectAnimationState.mMinU = &sceneObject->mShaderFloatUniformValues[MIN_U_UNIFORM_NAME];
+    objectAnimationState.mMinV = &sceneObject->mShaderFloatUniformValues[MIN_V_UNIFORM_NAME];
+    objectAnimationState.mMaxU = &sceneObject->mShaderFloatUniformValues[MAX_U_UNIFORM_NAME];
+    objectAnimationState.mMaxV = &sceneObject->mShaderFloatUniformValues[MAX_V_UNIFORM_NAME];
+    objectAnimationState.mSceneObject = std::move(sceneObject);
+    objectAnimationState.mObjectTypeIndex = GetObjectTypeIndex(objectType);
+    objectAnimationState.mSlotIndex = handle.mSlotIndex;
+    mObjectAnimationStates.push_back(std::move(objectAnimationState));
+
+    return handle;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ObjectAnimationController::UnregisterObject(const ObjectAnimationHandle& handle)
+{
+    if (!IsObjectRegistered(handle))
+    {
+        return;
+    }
+
+    auto& slot = mSlots[handle.mSlotIndex];
+    const auto stateIndex = slot.mStateIndex;
+    if (stateIndex != mObjectAnimationStates.size() - 1)
     {
-        UpdateAttackAnimation(sceneObject, facingDirection, dtMillis);
+        mObjectAnimationStates[stateIndex] = std::move(mObjectAnimationStates.back());
+        mSlots[mObjectAnimationStates[stateIndex].mSlotIndex].mStateIndex = stateIndex;
     }
-    
-    sceneObject->mShaderFloatUniformValues[MIN_U_UNIFORM_NAME] = ANIMATION_UV_MAP[mObjectAnimationInfoMap[sceneObject->mName].mAnimationRow][mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex].first.x;
-    sceneObject->mShaderFloatUniformValues[MIN_V_UNIFORM_NAME] = ANIMATION_UV_MAP[mObjectAnimationInfoMap[sceneObject->mName].mAnimationRow][mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex].first.y;
-    sceneObject->mShaderFloatUniformValues[MAX_U_UNIFORM_NAME] = ANIMATION_UV_MAP[mObjectAnimationInfoMap[sceneObject->mName].mAnimationRow][mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex].second.x;
-    sceneObject->mShaderFloatUniformValues[MAX_V_UNIFORM_NAME] = ANIMATION_UV_MAP[mObjectAnimationInfoMap[sceneObject->mName].mAnimationRow][mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex].second.y;
-    
-    if (mObjectAnimationInfoMap[sceneObject->mName].mFlippedAnimation)
+    mObjectAnimationStates.pop_back();
+
+    slot.mGeneration++;
+    mFreeSlotIndices.push_back(handle.mSlotIndex);
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ObjectAnimationController::IsObjectRegistered(const ObjectAnimationHandle& handle) const
+{
+    return handle.mSlotIndex < mSlots.size() && mSlots[handle.mSlotIndex].mGeneration == handle.mGeneration;
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t ObjectAnimationController::GetRegisteredObjectCount() const
+{
+    return mObjectAnimationStates.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+size_t ObjectAnimationController::GetAnimationClipCount() const
+{
+    return mAnimationClips.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ObjectAnimationController::OnNPCAttack(const ObjectAnimationHandle& handle)
+{
+    if (IsObjectRegistered(handle))
     {
-        std::swap(sceneObject->mShaderFloatUniformValues[MIN_U_UNIFORM_NAME], sceneObject->mShaderFloatUniformValues[MAX_U_UNIFORM_NAME]);
+        auto& info = GetObjectAnimationState(handle).mInfo;
+        info.mFrameIndex = 0;
+        info.mAnimationTimeAccum = 0.0f;
+        info.mAnimationFinished = false;
     }
-    
-    return mObjectAnimationInfoMap[sceneObject->mName];
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void ObjectAnimationController::UpdateCharacterAnimation(std::shared_ptr<scene::SceneObject> sceneObject, const network::ObjectType objectType, const network::ObjectState objectState, const network::FacingDirection facingDirection, const glm::vec3 &velocity, const float dtMillis)
+const ObjectAnimationController::ObjectAnimationInfo& ObjectAnimationController::UpdateObjectAnimation(const ObjectAnimationHandle& handle, const network::ObjectState objectState, const network::FacingDirection facingDirection, const glm::vec3& velocity, const float dtMillis)
 {
-    if (mObjectAnimationInfoMap[sceneObject->mName].mObjectState != objectState)
+    auto& objectAnimationState = GetObjectAnimationState(handle);
+    auto& info = objectAnimationState.mInfo;
+
+    const auto clipIndex = mClipIndices[objectAnimationState.mObjectTypeIndex][GetObjectStateIndex(objectState)];
+    if (clipIndex < 0)
+    {
+        return info;
+    }
+
+    if (clipIndex != info.mClipIndex)
     {
-        // Animation Change
-        switch (objectState)
+        StartClip(objectAnimationState, clipIndex);
+    }
+
+    const auto& clip = mAnimationClips[clipIndex];
+    switch (clip.mPlayback)
+    {
+        case ClipPlayback::HOLD_FIRST_FRAME:
         {
-            case network::ObjectState::IDLE:
-            case network::ObjectState::RUNNING:
+            info.mFrameIndex = 0;
+            info.mFacingDirection = facingDirection;
+        } break;
+
+        case ClipPlayback::PLAY_ONCE:
+        {
+            info.mAnimationTimeAccum += dtMillis/1000.0f;
+            if (info.mAnimationTimeAccum > clip.mFrameDurationSecs)
             {
-                switch (objectType)
+                info.mAnimationTimeAccum -= clip.mFrameDurationSecs;
+                info.mFrameIndex++;
+                if (info.mFrameIndex > clip.mFrameCount - 1)
                 {
-                    case network::ObjectType::PLAYER:
-                    {
-                        sceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "game/anims/player_running/core.png");
-                    } break;
-                        
-                    case network::ObjectType::NPC:
-                    {
-                        sceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "game/anims/rat_running/core.png");
-                    } break;
-                        
-                    default: assert(false);
+                    info.mFrameIndex = clip.mFrameCount - 1;
+                    info.mAnimationFinished = true;
                 }
-                
-            } break;
-                
-            case network::ObjectState::BEGIN_MELEE:
-            case network::ObjectState::MELEE_ATTACK:
+            }
+            info.mFacingDirection = facingDirection;
+        } break;
+
+        case ClipPlayback::LOOP_WITH_VELOCITY:
+        {
+            const auto speed = glm::length(velocity);
+            if (speed <= 0.0f && clip.mIdleFrameIndex >= 0)
             {
-                mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex = 0;
-                switch (objectType)
-                {
-                    case network::ObjectType::PLAYER:
-                    {
-                        sceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "game/anims/player_melee_attack/core.png");
-                    } break;
-                        
-                    case network::ObjectType::NPC:
-                    {
-                        sceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "game/anims/rat_melee_attack/core.png");
-                    } break;
-                        
-                    default: assert(false);
-                }
+                info.mFrameIndex = clip.mIdleFrameIndex;
+                break;
+            }
 
-            } break;
-            case network::ObjectState::CASTING:
+            if (speed > 0.0f)
             {
-                switch (objectType)
+                info.mAnimationTimeAccum += dtMillis/1000.0f;
+
+                const auto frameTimeSecs = clip.mVelocityFrameTimeConstant/speed;
+                if (info.mAnimationTimeAccum > frameTimeSecs)
                 {
-                    case network::ObjectType::PLAYER:
-                    {
-                        sceneObject->mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + "game/anims/player_casting/core.png");
-                    } break;
-                    default: assert(false);
+                    info.mAnimationTimeAccum -= frameTimeSecs;
+                    info.mFrameIndex = (info.mFrameIndex + 1) % clip.mFrameCount;
                 }
-            } break;
-        }
+            }
+            info.mFacingDirection = facingDirection;
+        } break;
     }
-    
-    mObjectAnimationInfoMap[sceneObject->mName].mObjectState = objectState;
-    mObjectAnimationInfoMap[sceneObject->mName].mFacingDirection = facingDirection;
-    
-    auto shouldProgressAnimation = objectState != network::ObjectState::BEGIN_MELEE;
-    if (!shouldProgressAnimation)
+
+    const auto& frameRect = mFrameRects[clip.mFrameRectsOffset + GetFacingDirectionIndex(info.mFacingDirection) * clip.mFrameCount + info.mFrameIndex];
+    *objectAnimationState.mMinU = frameRect.mMinU;
+    *objectAnimationState.mMinV = frameRect.mMinV;
+    *objectAnimationState.mMaxU = frameRect.mMaxU;
+    *objectAnimationState.mMaxV = frameRect.mMaxV;
+
+    return info;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ObjectAnimationController::LoadAnimationClips(const nlohmann::json& animationClipsJson)
+{
+    std::array<int, FACING_DIRECTION_COUNT> directionRows = {};
+    std::array<bool, FACING_DIRECTION_COUNT> flippedDirections = {};
+    for (const auto& [directionName, row]: animationClipsJson["direction_rows"].items())
     {
-        mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex = 0;
-        mObjectAnimationInfoMap[sceneObject->mName].mAnimationRow = GetAnimationRowFromFacingDirection(facingDirection);
-        mObjectAnimationInfoMap[sceneObject->mName].mFlippedAnimation = ShouldFlipAnimation(facingDirection);
+        directionRows[GetFacingDirectionIndex(ParseEnumName(FACING_DIRECTION_NAMES, directionName))] = row.get<int>();
     }
-    else
+    for (const auto& directionName: animationClipsJson["flipped_directions"])
     {
-        if ((objectState == network::ObjectState::IDLE || objectState == network::ObjectState::RUNNING) && glm::length(velocity) <= 0.0f)
+        flippedDirections[GetFacingDirectionIndex(ParseEnumName(FACING_DIRECTION_NAMES, directionName.get<std::string>()))] = true;
+    }
+
+    for (const auto& clipObject: animationClipsJson["animation_clips"])
+    {
+        AnimationClip clip = {};
+        clip.mHasTexture = clipObject.count("texture") != 0;
+        if (clip.mHasTexture)
         {
-            mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex = 1;
+            clip.mTextureResourceId = CoreSystemsEngine::GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_TEXTURES_ROOT + clipObject["texture"].get<std::string>());
         }
+
+        clip.mFrameCount = clipObject["frame_count"].get<int>();
+        clip.mIdleFrameIndex = clipObject.count("idle_frame") ? clipObject["idle_frame"].get<int>() : -1;
+        clip.mFrameDurationSecs = clipObject.count("frame_duration_secs") ? clipObject["frame_duration_secs"].get<float>() : 0.0f;
+        clip.mVelocityFrameTimeConstant = clipObject.count("velocity_frame_time_constant") ? clipObject["velocity_frame_time_constant"].get<float>() : 0.0f;
+
+        const auto playback = clipObject["playback"].get<std::string>();
+        if (playback == "hold_first_frame") clip.mPlayback = ClipPlayback::HOLD_FIRST_FRAME;
+        else if (playback == "play_once") clip.mPlayback = ClipPlayback::PLAY_ONCE;
+        else if (playback == "loop_with_velocity") clip.mPlayback = ClipPlayback::LOOP_WITH_VELOCITY;
         else
         {
-            mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum += dtMillis/1000.0f;
-            
-            if (objectState == network::ObjectState::MELEE_ATTACK)
-            {
-                float targetAnimationDuration = objectType == network::ObjectType::NPC ? NPC_FRAME_ANIMATION_TIME_SECS : ATTACK_FRAME_ANIMATION_TIME_SECS;
-                if (mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum > targetAnimationDuration)
-                {
-                    mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum -= targetAnimationDuration;
-                    mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex++;
-                    if (mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex > 2)
-                    {
-                        mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex = 2;
-                        mObjectAnimationInfoMap[sceneObject->mName].mAnimationFinished = true;
-                    }
-                }
-            }
-            else
+            logging::Log(logging::LogType::ERROR, "Unknown playback %s for animation clip %s", playback.c_str(), clipObject["name"].get<std::string>().c_str());
+            assert(false);
+        }
+
+        // The sheet's rect defaults to the whole texture. Rows run top to bottom, as in the sprite sheets.
+        const auto& sheetObject = clipObject["sheet"];
+        const auto columns = sheetObject["columns"].get<int>();
+        const auto rows = sheetObject["rows"].get<int>();
+        const auto sheetRect = sheetObject.count("rect") ? sheetObject["rect"].get<std::array<float, 4>>() : std::array<float, 4>{ 0.0f, 0.0f, 1.0f, 1.0f };
+        const auto frameWidth = (sheetRect[2] - sheetRect[0])/columns;
+        const auto frameHeight = (sheetRect[3] - sheetRect[1])/rows;
+        assert(clip.mFrameCount <= columns);
+
+        clip.mFrameRectsOffset = mFrameRects.size();
+        for (int directionIndex = 0; directionIndex < FACING_DIRECTION_COUNT; ++directionIndex)
+        {
+            const auto row = directionRows[directionIndex];
+            assert(row < rows);
+
+            for (int frameIndex = 0; frameIndex < clip.mFrameCount; ++frameIndex)
             {
-                float targetAnimationTime = PLAYER_ANIMATION_TIME_CONSTANT/glm::length(velocity);
-                if (mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum > targetAnimationTime)
+                FrameRect frameRect = {};
+                frameRect.mMinU = sheetRect[0] + frameIndex * frameWidth;
+                frameRect.mMaxU = frameRect.mMinU + frameWidth;
+                frameRect.mMinV = sheetRect[3] - (row + 1) * frameHeight;
+                frameRect.mMaxV = sheetRect[3] - row * frameHeight;
+
+                if (flippedDirections[directionIndex])
                 {
-                    mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum -= targetAnimationTime;
-                    mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex = (mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex + 1) % 3;
+                    std::swap(frameRect.mMinU, frameRect.mMaxU);
                 }
+
+                mFrameRects.push_back(frameRect);
             }
-            
-            mObjectAnimationInfoMap[sceneObject->mName].mAnimationRow = GetAnimationRowFromFacingDirection(facingDirection);
-            mObjectAnimationInfoMap[sceneObject->mName].mFlippedAnimation = ShouldFlipAnimation(facingDirection);
+        }
+
+        const auto clipIndex = static_cast<int>(mAnimationClips.size());
+        mAnimationClips.push_back(clip);
+
+        const auto objectTypeIndex = GetObjectTypeIndex(ParseEnumName(OBJECT_TYPE_NAMES, clipObject["object_type"].get<std::string>()));
+        for (const auto& objectStateName: clipObject["object_states"])
+        {
+            mClipIndices[objectTypeIndex][GetObjectStateIndex(ParseEnumName(OBJECT_STATE_NAMES, objectStateName.get<std::string>()))] = clipIndex;
         }
     }
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void ObjectAnimationController::UpdateAttackAnimation(std::shared_ptr<scene::SceneObject> sceneObject, const network::FacingDirection facingDirection, const float dtMillis)
+ObjectAnimationController::ObjectAnimationState& ObjectAnimationController::GetObjectAnimationState(const ObjectAnimationHandle& handle)
+{
+    assert(IsObjectRegistered(handle));
+    return mObjectAnimationStates[mSlots[handle.mSlotIndex].mStateIndex];
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ObjectAnimationController::StartClip(ObjectAnimationState& objectAnimationState, const int clipIndex)
 {
-    mObjectAnimationInfoMap[sceneObject->mName].mFacingDirection = facingDirection;
-    mObjectAnimationInfoMap[sceneObject->mName].mAnimationRow = GetAnimationRowFromFacingDirection(facingDirection);
-    mObjectAnimationInfoMap[sceneObject->mName].mFlippedAnimation = ShouldFlipAnimation(facingDirection);
-    
-    mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum += dtMillis/1000.0f;
-    
-    if (mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum > ATTACK_FRAME_ANIMATION_TIME_SECS)
+    const auto& clip = mAnimationClips[clipIndex];
+
+    auto& info = objectAnimationState.mInfo;
+    info.mClipIndex = clipIndex;
+    info.mFrameIndex = 0;
+    info.mAnimationTimeAccum = 0.0f;
+    info.mAnimationFinished = false;
+
+    if (clip.mHasTexture)
     {
-        mObjectAnimationInfoMap[sceneObject->mName].mAnimationTimeAccum -= ATTACK_FRAME_ANIMATION_TIME_SECS;
-        mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex++;
-        if (mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex > 2)
-        {
-            mObjectAnimationInfoMap[sceneObject->mName].mFrameIndex = 2;
-            mObjectAnimationInfoMap[sceneObject->mName].mAnimationFinished = true;
-        }
+        objectAnimationState.mSceneObject->mTextureResourceId = clip.mTextureResourceId;
     }
 }
 
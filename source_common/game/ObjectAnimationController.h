@@ -1,8 +1,8 @@
 ///------------------------------------------------------------------------------------------------
 ///  ObjectAnimationController.h
-///  TinyMMOClient                                                                                            
-///                                                                                                
-///  Created by Alex Koukoulas on 27/12/2025                                                       
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 27/12/2025
 ///------------------------------------------------------------------------------------------------
 
 #ifndef ObjectAnimationController_h
@@ -10,44 +10,125 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include <array>
+#include <cstdint>
+#include <engine/resloading/ResourceLoadingService.h>
 #include <engine/utils/MathUtils.h>
-#include <game/events/Events.h>
-#include <game/events/EventSystem.h>
 #include <net_common/NetworkCommon.h>
 #include <memory>
-#include <unordered_map>
+#include <nlohmann/json.hpp>
+#include <vector>
 
 ///------------------------------------------------------------------------------------------------
 
 namespace scene { class SceneObject; }
-class ObjectAnimationController: public events::IListener
+
+///------------------------------------------------------------------------------------------------
+
+struct ObjectAnimationHandle
+{
+    static constexpr uint32_t INVALID_SLOT_INDEX = 0xFFFFFFFF;
+
+    bool IsValid() const { return mSlotIndex != INVALID_SLOT_INDEX; }
+
+    uint32_t mSlotIndex = INVALID_SLOT_INDEX;
+    uint32_t mGeneration = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Drives the sprite sheet animations of network objects. The animation clips (texture, sheet layout,
+/// frame timings per object type & state) are loaded once from animation_clips.json and referenced by
+/// index. Per object state is densely packed and addressed by the handle returned on registration,
+/// with the object's frame uv uniforms bound up front, so that per frame updates don't hash anything.
+class ObjectAnimationController final
 {
 public:
     struct ObjectAnimationInfo
     {
         int mFrameIndex = 0;
-        int mAnimationRow = 0;
-        bool mFlippedAnimation = false;
+        int mClipIndex = -1;
         bool mAnimationFinished = false;
         float mAnimationTimeAccum = 0.0f;
-        network::FacingDirection mFacingDirection;
-        network::ObjectState mObjectState;
+        network::FacingDirection mFacingDirection = network::FacingDirection::SOUTH;
     };
-    
+
 public:
     ObjectAnimationController();
-    
-    void OnObjectDestroyedEvent(const events::ObjectDestroyedEvent& objectDestroyedEvent);
-    void OnNPCAttack(const strutils::StringId& npcNameId);
+    explicit ObjectAnimationController(const nlohmann::json& animationClipsJson);
+
+    [[nodiscard]] ObjectAnimationHandle RegisterObject(std::shared_ptr<scene::SceneObject> sceneObject, const network::ObjectType objectType);
+    void UnregisterObject(const ObjectAnimationHandle& handle);
+    bool IsObjectRegistered(const ObjectAnimationHandle& handle) const;
+    size_t GetRegisteredObjectCount() const;
+    size_t GetAnimationClipCount() const;
+
+    // Restarts the object's current clip
+    void OnNPCAttack(const ObjectAnimationHandle& handle);
+
+    const ObjectAnimationInfo& UpdateObjectAnimation(const ObjectAnimationHandle& handle, const network::ObjectState objectState, const network::FacingDirection facingDirection, const glm::vec3& velocity, const float dtMillis);
 
-    const ObjectAnimationInfo& UpdateObjectAnimation(std::shared_ptr<scene::SceneObject> sceneObject, const network::ObjectType objectType, const network::ObjectState objectState, const network::FacingDirection facingDirection, const glm::vec3& velocity, const float dtMillis);
-    
 private:
-    void UpdateCharacterAnimation(std::shared_ptr<scene::SceneObject> sceneObject, const network::ObjectType objectType, const network::ObjectState objectState, const network::FacingDirection facingDirection, const glm::vec3& velocity, const float dtMillis);
-    void UpdateAttackAnimation(std::shared_ptr<scene::SceneObject> sceneObject, const network::FacingDirection facingDirection, const float dtMillis);
-    
+    static constexpr int OBJECT_TYPE_COUNT = 4;
+    static constexpr int OBJECT_STATE_COUNT = 5;
+    static constexpr int FACING_DIRECTION_COUNT = 8;
+
+    enum class ClipPlayback
+    {
+        HOLD_FIRST_FRAME,
+        PLAY_ONCE,
+        LOOP_WITH_VELOCITY
+    };
+
+    struct FrameRect
+    {
+        float mMinU;
+        float mMinV;
+        float mMaxU;
+        float mMaxV;
+    };
+
+    struct AnimationClip
+    {
+        resources::ResourceId mTextureResourceId;
+        bool mHasTexture;
+        ClipPlayback mPlayback;
+        int mFrameCount;
+        int mIdleFrameIndex; // (LOOP_WITH_VELOCITY only, -1 for none) shown, in the last facing direction, while not moving
+        float mFrameDurationSecs; // (PLAY_ONCE only)
+        float mVelocityFrameTimeConstant; // (LOOP_WITH_VELOCITY only) frame duration = constant/|velocity|
+        size_t mFrameRectsOffset; // frame rects, laid out per facing direction then per frame, with flips baked in
+    };
+
+    struct ObjectAnimationState
+    {
+        ObjectAnimationInfo mInfo;
+        std::shared_ptr<scene::SceneObject> mSceneObject;
+        float* mMinU;
+        float* mMinV;
+        float* mMaxU;
+        float* mMaxV;
+        int mObjectTypeIndex;
+        uint32_t mSlotIndex;
+    };
+
+    struct ObjectSlot
+    {
+        uint32_t mStateIndex = 0;
+        uint32_t mGeneration = 0;
+    };
+
+private:
+    void LoadAnimationClips(const nlohmann::json& animationClipsJson);
+    ObjectAnimationState& GetObjectAnimationState(const ObjectAnimationHandle& handle);
+    void StartClip(ObjectAnimationState& objectAnimationState, const int clipIndex);
+
 private:
-    std::unordered_map<strutils::StringId, ObjectAnimationInfo, strutils::StringIdHasher> mObjectAnimationInfoMap;
+    std::vector<AnimationClip> mAnimationClips;
+    std::vector<FrameRect> mFrameRects;
+    std::array<std::array<int, OBJECT_STATE_COUNT>, OBJECT_TYPE_COUNT> mClipIndices;
+    std::vector<ObjectAnimationState> mObjectAnimationStates;
+    std::vector<ObjectSlot> mSlots;
+    std::vector<uint32_t> mFreeSlotIndices;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 ///  Created by Alex Koukoulas on 01/11/2023                                                       
 ///------------------------------------------------------------------------------------------------
 
+#include <atomic>
 #include <game/events/EventSystem.h>
 
 ///------------------------------------------------------------------------------------------------
@@ -22,17 +23,24 @@ EventSystem& EventSystem::GetInstance()
 
 ///------------------------------------------------------------------------------------------------
 
+void EventSystem::FlushQueuedEvents()
+{
+    mQueuedEvents.Drain([](std::function<void()>& dispatchQueuedEvent){ dispatchQueuedEvent(); });
+}
+
+///------------------------------------------------------------------------------------------------
+
 void EventSystem::UnregisterAllEventsForListener(const IListener* listener)
 {
-    for (auto& eventEntry: mEventIdToDeadListenerIds)
+    for (auto& listenerArray: mListenerArrays)
     {
-        eventEntry.second.insert(std::make_pair(listener, listener->mInstanceId));
+        listenerArray->VRemove(listener);
     }
 }
 
 ///------------------------------------------------------------------------------------------------
 
-static std::size_t sInstanceIdCounter = 0;
+static std::atomic<std::size_t> sInstanceIdCounter = 0;
 IListener::IListener()
     : mInstanceId(sInstanceIdCounter++)
 {
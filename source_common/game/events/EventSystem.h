@@ -10,13 +10,12 @@
 
 ///------------------------------------------------------------------------------------------------
 
-#include <engine/utils/TypeTraits.h>
+#include <algorithm>
+#include <cstdint>
+#include <engine/utils/BlockingQueue.h>
 #include <game/events/Events.h>
 #include <functional>
-#include <string>
 #include <unordered_map>
-#include <unordered_set>
-#include <set>
 #include <vector>
 #include <memory>
 
@@ -32,109 +31,229 @@ class IListener
 public:
     IListener();
     virtual ~IListener();
-    
+
 public:
     const std::size_t mInstanceId;
 };
 
 ///------------------------------------------------------------------------------------------------
 
-struct DeadListenerHasher
+class IListenerArray
 {
-    std::size_t operator()(const std::pair<const IListener*, std::size_t>& key) const
-    {
-        return key.second;
-    }
+public:
+    virtual ~IListenerArray() = default;
+    virtual void VRemove(const IListener* listener) = 0;
 };
 
+///------------------------------------------------------------------------------------------------
+/// Listeners of a single event type, densely packed in registration order. Each listener owns a slot
+/// whose generation is bumped on unregistration, which invalidates its entry (and handle) in O(1).
+/// Invalidated entries are skipped by dispatches and compacted away once no dispatch is in flight,
+/// so listeners can safely (un)register themselves or others from within callbacks.
 template<typename EventType>
-bool operator < (const std::pair<IListener*, std::function<void(const EventType&)>>& lhs, const std::pair<IListener*, std::function<void(const EventType&)>>& rhs)
+class ListenerArray final: public IListenerArray
 {
-    return lhs.first->mInstanceId < rhs.first->mInstanceId;
-}
+public:
+    void Add(const IListener* listener, std::function<void(const EventType&)> callback)
+    {
+        // Double registration is a no-op
+        if (mListenerHandles.count(listener->mInstanceId))
+        {
+            return;
+        }
 
-///------------------------------------------------------------------------------------------------
+        ListenerHandle handle;
+        if (mFreeSlotIndices.empty())
+        {
+            handle.mSlotIndex = static_cast<uint32_t>(mSlotGenerations.size());
+            mSlotGenerations.push_back(0);
+        }
+        else
+        {
+            handle.mSlotIndex = mFreeSlotIndices.back();
+            mFreeSlotIndices.pop_back();
+        }
+        handle.mGeneration = mSlotGenerations[handle.mSlotIndex];
+        mListenerHandles[listener->mInstanceId] = handle;
+
+        // Entries registered mid dispatch only join once it is over
+        auto& entries = mDispatchDepth > 0 ? mEntriesToAdd : mEntries;
+        entries.push_back(Entry{ std::move(callback), handle });
+
+        if (mDispatchDepth == 0 && mDeadEntryCount > mEntries.size()/2)
+        {
+            CompactEntries();
+        }
+    }
+
+    void VRemove(const IListener* listener) override
+    {
+        auto findIter = mListenerHandles.find(listener->mInstanceId);
+        if (findIter == mListenerHandles.end())
+        {
+            return;
+        }
+
+        const auto handle = findIter->second;
+        mListenerHandles.erase(findIter);
+
+        if (mSlotGenerations[handle.mSlotIndex] == handle.mGeneration)
+        {
+            mSlotGenerations[handle.mSlotIndex]++;
+            mFreeSlotIndices.push_back(handle.mSlotIndex);
+            mDeadEntryCount++;
+        }
+    }
+
+    void Dispatch(const EventType& event)
+    {
+        mDispatchDepth++;
+
+        // Indexed, and bounded by the entry count up front, as the array is only ever appended to meanwhile
+        const auto entryCount = mEntries.size();
+        for (size_t i = 0; i < entryCount; ++i)
+        {
+            if (IsAlive(mEntries[i]))
+            {
+                mEntries[i].mCallback(event);
+            }
+        }
+
+        if (--mDispatchDepth == 0)
+        {
+            for (auto& entry: mEntriesToAdd)
+            {
+                mEntries.push_back(std::move(entry));
+            }
+            mEntriesToAdd.clear();
+
+            if (mDeadEntryCount > 0)
+            {
+                CompactEntries();
+            }
+        }
+    }
+
+    size_t GetListenerCount() const
+    {
+        return mListenerHandles.size();
+    }
+
+private:
+    struct ListenerHandle
+    {
+        uint32_t mSlotIndex = 0;
+        uint32_t mGeneration = 0;
+    };
 
+    struct Entry
+    {
+        std::function<void(const EventType&)> mCallback;
+        ListenerHandle mHandle;
+    };
+
+    bool IsAlive(const Entry& entry) const
+    {
+        return mSlotGenerations[entry.mHandle.mSlotIndex] == entry.mHandle.mGeneration;
+    }
+
+    void CompactEntries()
+    {
+        mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(), [this](const Entry& entry){ return !IsAlive(entry); }), mEntries.end());
+        mEntriesToAdd.erase(std::remove_if(mEntriesToAdd.begin(), mEntriesToAdd.end(), [this](const Entry& entry){ return !IsAlive(entry); }), mEntriesToAdd.end());
+        mDeadEntryCount = 0;
+    }
+
+private:
+    std::vector<Entry> mEntries;
+    std::vector<Entry> mEntriesToAdd;
+    std::vector<uint32_t> mSlotGenerations;
+    std::vector<uint32_t> mFreeSlotIndices;
+    std::unordered_map<std::size_t, ListenerHandle> mListenerHandles; // keyed by listener instance id
+    size_t mDeadEntryCount = 0;
+    int mDispatchDepth = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Registration, unregistration and (synchronous) dispatching are main thread only, whereas events
+/// can be queued from any thread, to be dispatched on the main thread at the next FlushQueuedEvents().
 class EventSystem final
 {
 public:
     static EventSystem& GetInstance();
-    
+
     template<typename EventType, class... Args>
     void DispatchEvent(Args&&... args)
     {
-        EventType event(std::forward<Args>(args)...);
-        
-        CleanCallbacks<EventType>();
-        if (!mEventCallbacks<EventType>.empty())
+        const EventType event(std::forward<Args>(args)...);
+        GetListenerArray<EventType>().Dispatch(event);
+    }
+
+    /// Thread-safe.
+    template<typename EventType, class... Args>
+    void QueueEvent(Args&&... args)
+    {
+        mQueuedEvents.Push([this, event = EventType(std::forward<Args>(args)...)]()
         {
-            for (auto callbackIter = mEventCallbacks<EventType>.begin(); callbackIter != mEventCallbacks<EventType>.end();)
-            {
-                callbackIter->second(event);
-                callbackIter++;
-            }
-        }
-    };
-    
+            GetListenerArray<EventType>().Dispatch(event);
+        });
+    }
+
+    /// Dispatches all events queued so far, in queueing order. Events queued by the listeners themselves
+    /// are left for the next flush.
+    void FlushQueuedEvents();
+
     template<typename EventType, typename FunctionType>
     [[nodiscard]] std::unique_ptr<IListener> RegisterForEvent(FunctionType callback)
     {
-        CleanCallbacks<EventType>();
         auto listener = std::make_unique<IListener>();
-        mEventCallbacks<EventType>.insert(std::make_pair(listener.get(), callback));
+        GetListenerArray<EventType>().Add(listener.get(), std::move(callback));
         return listener;
     }
-    
+
     template<typename EventType, typename InstanceType, typename FunctionType>
     void RegisterForEvent(InstanceType* listener, FunctionType callback)
     {
-        CleanCallbacks<EventType>();
-        mEventCallbacks<EventType>.insert(std::make_pair(listener, [listener, callback](const EventType& e){ (listener->*callback)(e); }));
+        GetListenerArray<EventType>().Add(listener, [listener, callback](const EventType& e){ (listener->*callback)(e); });
     }
-    
+
     template<typename EventType>
     void UnregisterForEvent(IListener* listener)
     {
-        mEventCallbacks<EventType>.erase(std::make_pair(listener, nullptr));
+        GetListenerArray<EventType>().VRemove(listener);
     }
-    
+
     void UnregisterAllEventsForListener(const IListener* listener);
-    
+
+    template<typename EventType>
+    size_t GetListenerCount()
+    {
+        return GetListenerArray<EventType>().GetListenerCount();
+    }
+
 private:
     template<typename EventType>
-    void CleanCallbacks()
+    ListenerArray<EventType>& GetListenerArray()
     {
-        auto eventTypeId = GetTypeHash<EventType>();
-        mEventIdToDeadListenerIds[eventTypeId];
-        
-        for (auto callbackIter = mEventCallbacks<EventType>.begin(); callbackIter != mEventCallbacks<EventType>.end();)
-        {
-            bool foundInDeadListenerIds = false;
-            for (auto deadListenerIter = mEventIdToDeadListenerIds[eventTypeId].begin(); deadListenerIter != mEventIdToDeadListenerIds[eventTypeId].end() && !foundInDeadListenerIds;)
-            {
-                if (deadListenerIter->first == callbackIter->first)
-                {
-                    callbackIter = mEventCallbacks<EventType>.erase(callbackIter);
-                    mEventIdToDeadListenerIds[eventTypeId].erase(deadListenerIter);
-                    foundInDeadListenerIds = true;
-                    break;
-                }
-                deadListenerIter++;
-            }
-            
-            if (!foundInDeadListenerIds)
-            {
-                callbackIter++;
-            }
-        }
+        // Created on first use, and tracked for UnregisterAllEventsForListener
+        static ListenerArray<EventType>& listenerArray = CreateListenerArray<EventType>();
+        return listenerArray;
+    }
+
+    template<typename EventType>
+    ListenerArray<EventType>& CreateListenerArray()
+    {
+        auto listenerArray = std::make_unique<ListenerArray<EventType>>();
+        auto& listenerArrayRef = *listenerArray;
+        mListenerArrays.push_back(std::move(listenerArray));
+        return listenerArrayRef;
     }
-    
+
     EventSystem() = default;
-    
+
 private:
-    template<typename EventType>
-    static inline std::set<std::pair<IListener*, std::function<void(const EventType&)>>> mEventCallbacks;
-    std::unordered_map<std::size_t, std::unordered_set<std::pair<const IListener*, std::size_t>, DeadListenerHasher>> mEventIdToDeadListenerIds;
+    std::vector<std::unique_ptr<IListenerArray>> mListenerArrays;
+    BlockingQueue<std::function<void()>> mQueuedEvents;
 };
 
 ///------------------------------------------------------------------------------------------------
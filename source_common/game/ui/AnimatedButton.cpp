@@ -139,7 +139,7 @@ AnimatedButton::AnimatedButton
     auto textSceneObjectWidth = textSceneObjectRect.topRight.x - textSceneObjectRect.bottomLeft.x;
     auto textSceneObjectHeight = textSceneObjectRect.topRight.y - textSceneObjectRect.bottomLeft.y;
     
-    mSceneObjects.front()->mPosition.x += std::powf(textSceneObjectWidth * DYNAMIC_TEXTURE_X_OFFSET_MULTIPLIER, DYNAMIC_TEXTURE_X_OFFSET_POWER);
+    mSceneObjects.front()->mPosition.x += std::pow(textSceneObjectWidth * DYNAMIC_TEXTURE_X_OFFSET_MULTIPLIER, DYNAMIC_TEXTURE_X_OFFSET_POWER);
     mSceneObjects.front()->mPosition.y -= textSceneObjectHeight * DYNAMIC_TEXTURE_Y_OFFSET_MULTIPLIER;
     mSceneObjects.front()->mScale.x = math::Max(textSceneObjectHeight * DYNAMIC_TEXTURE_HEIGHT_MULTIPLIER, (textSceneObjectWidth + textSceneObjectHeight) * MIN_DYNAMIC_TEXTURE_HEIGHT_MULTIPLIER);
     mSceneObjects.front()->mScale.y = mSceneObjects.front()->mScale.x / textureAspectRatio;
@@ -215,7 +215,7 @@ AnimatedButton::~AnimatedButton()
 {
     for (auto& sceneObject: mSceneObjects)
     {
-        CoreSystemsEngine::GetInstance().GetAnimationManager().StopAllAnimationsPlayingForSceneObject(sceneObject->mName);
+        CoreSystemsEngine::GetInstance().GetAnimationManager().StopAllAnimationsPlayingForSceneObject(*sceneObject);
     }
     
     CoreSystemsEngine::GetInstance().GetAnimationManager().StopAnimation(BUTTON_CLICK_ANIMATION_NAME);
@@ -228,7 +228,7 @@ ButtonUpdateInteractionResult AnimatedButton::Update(const float)
     ButtonUpdateInteractionResult interactionResult = ButtonUpdateInteractionResult::NOT_CLICKED;
     
     const auto& inputStateManager = CoreSystemsEngine::GetInstance().GetInputStateManager();
-    auto worldTouchPos = inputStateManager.VGetPointingPosInWorldSpace(mScene->GetCamera().GetViewMatrix(), mScene->GetCamera().GetProjMatrix());
+    auto worldTouchPos = inputStateManager.VGetPointingPosInWorldSpace(mScene->GetCamera());
     
     auto baseSceneObject = mSceneObjects.front();
     auto sceneObjectRect = scene_object_utils::GetSceneObjectBoundingRect(*baseSceneObject);
@@ -51,7 +51,7 @@ FillableBar::~FillableBar()
 {
     for (auto& sceneObject: mSceneObjects)
     {
-        CoreSystemsEngine::GetInstance().GetAnimationManager().StopAllAnimationsPlayingForSceneObject(sceneObject->mName);
+        CoreSystemsEngine::GetInstance().GetAnimationManager().StopAllAnimationsPlayingForSceneObject(*sceneObject);
     }
 }
 
@@ -9,7 +9,9 @@
 #include <engine/CoreSystemsEngine.h>
 #include <engine/resloading/DataFileResource.h>
 #include <engine/resloading/ResourceLoadingService.h>
+#include <engine/resloading/VirtualFileSystem.h>
 #include <engine/utils/BaseDataFileDeserializer.h>
+#include <engine/utils/Logging.h>
 #include <nlohmann/json.hpp>
 
 ///------------------------------------------------------------------------------------------------
@@ -71,14 +73,89 @@ const strutils::StringId& GlobalMapDataRepository::GetConnectedMapName(const str
 
 ///------------------------------------------------------------------------------------------------
 
-void GlobalMapDataRepository::LoadMapDefinitions()
+bool GlobalMapDataRepository::LoadMapDefinitions()
 {
     auto& systemsEngine = CoreSystemsEngine::GetInstance();
     auto globalMapDataResourceId = systemsEngine.GetInstance().GetResourceLoadingService().LoadResource(resources::ResourceLoadingService::RES_DATA_ROOT + GLOBAL_MAP_DATA_FILE_PATH);
     auto& globalMapDataFileResource = systemsEngine.GetInstance().GetResourceLoadingService().GetResource<resources::DataFileResource>(globalMapDataResourceId);
-    auto globalMapDataJson = nlohmann::json::parse(globalMapDataFileResource.GetContents());
+    return ParseMapDefinitions(globalMapDataFileResource.GetContents());
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool GlobalMapDataRepository::LoadMapDefinitionsFromVirtualFileSystem()
+{
+    const auto& virtualFileSystem = CoreSystemsEngine::GetInstance().GetResourceLoadingService().GetVirtualFileSystem();
+    const auto globalMapDataFilePath = resources::ResourceLoadingService::RES_DATA_ROOT + GLOBAL_MAP_DATA_FILE_PATH;
+    const auto globalMapDataFileContents = virtualFileSystem.ReadFile(globalMapDataFilePath);
+    if (!globalMapDataFileContents.IsValid())
+    {
+        logging::Log(logging::LogType::ERROR, "Could not read global map data %s", globalMapDataFilePath.c_str());
+        return false;
+    }
     
+    return ParseMapDefinitions(globalMapDataFileContents.ToString());
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool IsValidGlobalMapData(const nlohmann::json& globalMapDataJson)
+{
+    if (globalMapDataJson.is_discarded() || !globalMapDataJson.is_object() || !globalMapDataJson.contains(MAP_TRANSFORMS_JSON) || !globalMapDataJson.contains(MAP_CONNECTIONS_JSON))
+    {
+        return false;
+    }
+    
+    const auto& mapTransformsJson = globalMapDataJson.at(MAP_TRANSFORMS_JSON);
+    const auto& mapConnectionsJson = globalMapDataJson.at(MAP_CONNECTIONS_JSON);
+    if (!mapTransformsJson.is_object() || !mapConnectionsJson.is_object())
+    {
+        return false;
+    }
+    
+    for (auto mapTransformIter = mapTransformsJson.begin(); mapTransformIter != mapTransformsJson.end(); ++mapTransformIter)
+    {
+        const auto& mapTransformJson = mapTransformIter.value();
+        for (const auto* transformField: { "x", "y", "width", "height" })
+        {
+            if (!mapTransformJson.contains(transformField) || !mapTransformJson.at(transformField).is_number())
+            {
+                return false;
+            }
+        }
+        
+        if (!mapConnectionsJson.contains(mapTransformIter.key()))
+        {
+            return false;
+        }
+        
+        const auto& mapConnectionJson = mapConnectionsJson.at(mapTransformIter.key());
+        for (const auto* connectionField: { "top", "right", "bottom", "left" })
+        {
+            if (!mapConnectionJson.contains(connectionField) || !mapConnectionJson.at(connectionField).is_string())
+            {
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool GlobalMapDataRepository::ParseMapDefinitions(const std::string& globalMapDataContents)
+{
     mMapDefinitions.clear();
+    
+    // Validated upfront, so that a corrupt file is reported rather than throw (possibly on a worker thread)
+    auto globalMapDataJson = nlohmann::json::parse(globalMapDataContents, nullptr, false);
+    if (!IsValidGlobalMapData(globalMapDataJson))
+    {
+        logging::Log(logging::LogType::ERROR, "Malformed global map data %s", GLOBAL_MAP_DATA_FILE_PATH.c_str());
+        return false;
+    }
+    
     for (auto mapTransformIter = globalMapDataJson[MAP_TRANSFORMS_JSON].begin(); mapTransformIter != globalMapDataJson[MAP_TRANSFORMS_JSON].end(); ++mapTransformIter)
     {
         auto mapFileName = mapTransformIter.key();
@@ -100,6 +177,8 @@ void GlobalMapDataRepository::LoadMapDefinitions()
         
         mMapDefinitions.emplace(std::make_pair(mapNameId, MapDefinition(strutils::StringId(mapNameId), mapConnections, mapDimensions, mapPosition)));
     }
+    
+    return true;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -64,10 +64,16 @@ public:
     bool HasMapDefinition(const strutils::StringId& mapName) const;
     const MapDefinition& GetMapDefinition(const strutils::StringId& mapName) const;
     const strutils::StringId& GetConnectedMapName(const strutils::StringId& mapName, const MapConnectionDirection direction) const;
-    void LoadMapDefinitions();
+    bool LoadMapDefinitions();
+    
+    // Reads the global map data straight through the VirtualFileSystem rather than the (main thread only)
+    // ResourceLoadingService, so that it can run on a startup worker thread. Never throws (a missing or
+    // malformed file is logged and reported through the return value instead).
+    bool LoadMapDefinitionsFromVirtualFileSystem();
     
 private:
     GlobalMapDataRepository();
+    bool ParseMapDefinitions(const std::string& globalMapDataContents);
     
 private:
     std::unordered_map<strutils::StringId, MapDefinition, strutils::StringIdHasher> mMapDefinitions;
@@ -13,6 +13,8 @@
 #include <engine/resloading/DataFileResource.h>
 #include <engine/resloading/ImageSurfaceResource.h>
 #include <engine/resloading/ResourceLoadingService.h>
+#include <engine/resloading/TextureResource.h>
+#include <engine/utils/Logging.h>
 #include <imgui/imgui.h>
 #include <nlohmann/json.hpp>
 
@@ -34,7 +36,9 @@ static std::shared_ptr<network::Navmap> CreateNavmap(resources::ResourceId navma
 MapResourceController::MapResourceController(const strutils::StringId& initialMapName)
     : mCurrentMapName(initialMapName)
 {
+    mDecodedImageCacheStatisticsAtMapLoadStart = CoreSystemsEngine::GetInstance().GetResourceLoadingService().GetDecodedImageCacheStatistics();
     LoadMapResourceTree(mCurrentMapName, 0, false);
+    LogMapLoadStatistics(mCurrentMapName);
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -71,6 +75,9 @@ void MapResourceController::Update(const strutils::StringId& currentMapName)
             mapResourceEntry.second.mMapResourcesState = MapResourcesState::INVALIDATED;
         }
             
+        mDecodedImageCacheStatisticsAtMapLoadStart = systemsEngine.GetResourceLoadingService().GetDecodedImageCacheStatistics();
+        mMapLoadInProgress = true;
+        
         systemsEngine.GetResourceLoadingService().SetAsyncLoading(true);
         LoadMapResourceTree(mCurrentMapName, 0, true);
         systemsEngine.GetResourceLoadingService().SetAsyncLoading(false);
@@ -94,10 +101,13 @@ void MapResourceController::Update(const strutils::StringId& currentMapName)
     
     // Check for loaded async map resources
     const auto& resourceService = systemsEngine.GetResourceLoadingService();
+    auto hasPendingMapResources = false;
     for (auto& mapResourceEntry: mLoadedMapResourceTree)
     {
         if (mapResourceEntry.second.mMapResourcesState == MapResourcesState::PENDING)
         {
+            hasPendingMapResources = true;
+
             if (resourceService.HasLoadedResource(mapResourceEntry.second.mBottomLayerTextureResourceId) &&
                 resourceService.HasLoadedResource(mapResourceEntry.second.mTopLayerTextureResourceId) &&
                 resourceService.HasLoadedResource(mapResourceEntry.second.mNavmapImageResourceId))
@@ -108,6 +118,12 @@ void MapResourceController::Update(const strutils::StringId& currentMapName)
             }
         }
     }
+    
+    if (mMapLoadInProgress && !hasPendingMapResources)
+    {
+        mMapLoadInProgress = false;
+        LogMapLoadStatistics(mCurrentMapName);
+    }
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -153,6 +169,22 @@ void MapResourceController::LoadMapResources(const strutils::StringId& mapName,
     mLoadedMapResourceTree.emplace(std::make_pair(mapName, std::move(mapResources)));
 }
 
+///------------------------------------------------------------------------------------------------
+
+void MapResourceController::LogMapLoadStatistics(const strutils::StringId& mapName) const
+{
+    const auto currentStatistics = CoreSystemsEngine::GetInstance().GetResourceLoadingService().GetDecodedImageCacheStatistics();
+    const auto hitCount = currentStatistics.mHitCount - mDecodedImageCacheStatisticsAtMapLoadStart.mHitCount;
+    const auto missCount = currentStatistics.mMissCount - mDecodedImageCacheStatisticsAtMapLoadStart.mMissCount;
+    const auto decodeMillisSaved = currentStatistics.mDecodeMillisSaved - mDecodedImageCacheStatisticsAtMapLoadStart.mDecodeMillisSaved;
+    
+    const auto textureMemoryMegabytes = resources::TextureResource::GetTotalTextureMemoryBytes()/(1024.0f * 1024.0f);
+    
+    logging::Log(logging::LogType::INFO, "Loaded map resources for %s: %d/%d images from decoded image cache, %.2fms decode time saved, %.2fMB total texture memory", mapName.GetString().c_str(), hitCount, hitCount + missCount, decodeMillisSaved, textureMemoryMegabytes);
+}
+
+///------------------------------------------------------------------------------------------------
+
 #if defined(USE_IMGUI)
 void MapResourceController::CreateDebugWidgets()
 {
@@ -59,9 +59,14 @@ public:
     
     void CreateDebugWidgets();
 
+private:
+    void LogMapLoadStatistics(const strutils::StringId& mapName) const;
+    
 private:
     std::mutex mMapResourceMutex;
     strutils::StringId mCurrentMapName;
+    resources::DecodedImageCache::Statistics mDecodedImageCacheStatisticsAtMapLoadStart;
+    bool mMapLoadInProgress = false;
     std::unordered_map<strutils::StringId, MapResources, strutils::StringIdHasher> mLoadedMapResourceTree;
 };
 
@@ -5,22 +5,39 @@
 ///  Created by Alex Koukoulas on 03/10/2023
 ///------------------------------------------------------------------------------------------------
 
-#include <chrono>
+#include <cassert>
+#include <cstdlib>
+#include <ctime>
 #include <engine/CoreSystemsEngine.h>
 #include <engine/rendering/AnimationManager.h>
 #include <engine/rendering/Fonts.h>
+#include <engine/rendering/NullRenderer.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/rendering/ParticleManager.h>
 #include <engine/rendering/RenderingUtils.h>
 #include <engine/resloading/ResourceLoadingService.h>
+#include <engine/resloading/TextureResource.h>
 #include <engine/scene/SceneManager.h>
 #include <engine/scene/Scene.h>
 #include <engine/sound/SoundManager.h>
 #include <engine/utils/BaseDataFileDeserializer.h>
 #include <engine/utils/BaseDataFileSerializer.h>
 #include <engine/utils/FileUtils.h>
+#include <engine/utils/FixedTimestep.h>
+#include <engine/utils/JobSystem.h>
+#include <engine/utils/FrameLimiter.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/OSMessageBox.h>
+#include <engine/utils/PlatformMacros.h>
+#include <engine/utils/Profiler.h>
+#if defined(MACOS)
+#include <platform_utilities/AppleUtils.h>
+#elif defined(WINDOWS)
+#include <platform_utilities/WindowsUtils.h>
+#elif defined(LINUX)
+#include <platform_utilities/LinuxUtils.h>
+#endif
+#include <functional>
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_sdl2.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
@@ -44,7 +61,7 @@ static constexpr int MIN_WINDOW_WIDTH      = 500;
 static constexpr int MIN_WINDOW_HEIGHT     = 390;
 #endif
 
-static const float DEFAULT_FRAME_MILLIS = 1000.0f/60.0f;
+static const float MAX_FRAME_MILLIS = 250.0f; // e.g. breakpoints or window drags shouldn't be simulated as elapsed game time
 
 ///------------------------------------------------------------------------------------------------
 
@@ -52,10 +69,20 @@ bool CoreSystemsEngine::mInitialized = false;
 
 ///------------------------------------------------------------------------------------------------
 
+static FixedTimestep sFixedTimestep;
+static FrameLimiter sFrameLimiter;
+static std::function<void()> sThrottledFrameTickFunction;
+static double sLastProcessCPUTimeSecs = 0.0;
+static float sLastSecondCPUUsagePercent = 0.0f; // process CPU time (all threads) over wall time, i.e. 100% being a full core
 static float sGameSpeed = 1.0f;
-static float sLastGameLogicDtMillis = 0.0f;
+static int sLastFrameSimulationStepCount = 0;
 static bool sPrintFPS = false;
 static bool sShuttingDown = false;
+static bool sHeadless = false;
+static bool sHeadlessWindowStateSimulated = false;
+static bool sHeadlessWindowFocused = true;
+static bool sHeadlessWindowVisible = true;
+static bool sOffscreen = false;
 
 #if defined(USE_EDITOR)
 static const std::string WINDOW_TITLE = "TinyMMOEditor";
@@ -65,7 +92,8 @@ static const std::string WINDOW_TITLE = "TinyMMOClient";
 
 #if defined(USE_IMGUI)
 static const strutils::StringId PLAYGROUND_SCENE_NAME = strutils::StringId("playground_scene");
-static const int PROFILLING_SAMPLE_COUNT = 300;
+static const char* CHROME_TRACE_EXPORT_FILE_NAME = "chrome_trace.json";
+static const float FLAME_VIEW_ROW_HEIGHT = 18.0f;
 static const int TEST_PARTICLE_Z = 5.0f;
 static bool sParticlePaintEnabled = false;
 static float sPitch = 1.0f;
@@ -74,16 +102,18 @@ static size_t sSfxIndex = 0;
 static size_t sParticleIndex = 0;
 static std::vector<std::string> sAvailableSfx;
 static std::vector<std::string> sAvailableParticleNames;
-static float sUpdateLogicMillisSamples[PROFILLING_SAMPLE_COUNT];
-static float sRenderingMillisSamples[PROFILLING_SAMPLE_COUNT];
+static int sSelectedProfiledFrameOffset = 0; // from the latest captured frame
+static bool sMainButtonTappedThisFrame = false; // taps are consumed by the first simulation step, before the debug widgets run
 #endif
 
 ///------------------------------------------------------------------------------------------------
 
 struct CoreSystemsEngine::SystemsImpl
 {
+    JobSystem mJobSystem;
     rendering::AnimationManager mAnimationManager;
     rendering::RendererPlatformImpl mRenderer;
+    rendering::NullRenderer mNullRenderer;
     rendering::ParticleManager mParticleManager;
     rendering::FontRepository mFontRepository;
     input::InputStateManagerPlatformImpl mInputStateManager;
@@ -110,8 +140,57 @@ CoreSystemsEngine::~CoreSystemsEngine()
 
 ///------------------------------------------------------------------------------------------------
 
+void CoreSystemsEngine::SetHeadless(const bool headless)
+{
+    assert(!mInitialized && "Headless mode needs to be set before the engine is initialized");
+    sHeadless = headless;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool CoreSystemsEngine::IsHeadless()
+{
+    return sHeadless;
+}
+
+///------------------------------------------------------------------------------------------------
+
 void CoreSystemsEngine::Initialize()
 {
+    if (const auto* headlessEnvVar = std::getenv("TINYMMO_HEADLESS"); headlessEnvVar && std::string(headlessEnvVar) == "1")
+    {
+        sHeadless = true;
+    }
+    
+    if (const auto* printFPSEnvVar = std::getenv("TINYMMO_PRINT_FPS"); printFPSEnvVar && std::string(printFPSEnvVar) == "1")
+    {
+        sPrintFPS = true;
+    }
+    
+    if (sHeadless)
+    {
+        // Headless runs have no window, so the window state the frame limiter sees can be simulated instead
+        // (e.g. to measure the CPU usage of each frame limiter mode on CI machines)
+        if (const auto* windowStateEnvVar = std::getenv("TINYMMO_HEADLESS_WINDOW_STATE"); windowStateEnvVar)
+        {
+            sHeadlessWindowStateSimulated = true;
+            sHeadlessWindowFocused = std::string(windowStateEnvVar) == "focused";
+            sHeadlessWindowVisible = std::string(windowStateEnvVar) != "minimized";
+        }
+        
+        InitializeHeadless();
+        return;
+    }
+    
+    // Offscreen runs still render through the platform renderer, but into a hidden EGL pbuffer backed
+    // window (e.g. Mesa's software rasterizer on CI machines without a display), so that pixel tests
+    // can read back what was rendered
+    if (const auto* offscreenEnvVar = std::getenv("TINYMMO_OFFSCREEN"); offscreenEnvVar && std::string(offscreenEnvVar) == "1")
+    {
+        sOffscreen = true;
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+    }
+    
     // Initialize SDL
     if (SDL_Init(SDL_INIT_VIDEO) < 0)
     {
@@ -120,7 +199,7 @@ void CoreSystemsEngine::Initialize()
     }
 
     // Create window
-    mWindow = SDL_CreateWindow(WINDOW_TITLE.c_str(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT, SDL_WINDOW_SHOWN | SDL_WINDOW_OPENGL | SDL_WINDOW_INPUT_FOCUS | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
+    mWindow = SDL_CreateWindow(WINDOW_TITLE.c_str(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT, (sOffscreen ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN) | SDL_WINDOW_OPENGL | SDL_WINDOW_INPUT_FOCUS | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
 
     // Set minimum window size
     SDL_SetWindowMinimumSize(mWindow, MIN_WINDOW_WIDTH, MIN_WINDOW_HEIGHT);
@@ -149,7 +228,7 @@ void CoreSystemsEngine::Initialize()
         return;
     }
 
-#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+#if defined(WINDOWS) || defined(LINUX)
     if (glewInit() != GLEW_OK)
     {
         ospopups::ShowInfoMessageBox(ospopups::MessageBoxType::ERROR, "GLEW could not initialize!", "GLEW Fatal Error");
@@ -201,11 +280,90 @@ void CoreSystemsEngine::Initialize()
 
 ///------------------------------------------------------------------------------------------------
 
-void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::function<void(const float)> clientUpdateFunction, std::function<void()> clientApplicationMovingToBackgroundFunction, std::function<void()> clientApplicationWindowResizeFunction, std::function<void()> clientCreateDebugWidgetsFunction, std::function<void()> clientOnOneSecondElapsedFunction)
+void CoreSystemsEngine::InitializeHeadless()
 {
-    mSystems->mParticleManager.LoadParticleData();
+    // Timer and events only (the main loop still polls for quit events, e.g. SIGINT/SIGTERM)
+    if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) < 0)
+    {
+        logging::Log(logging::LogType::ERROR, "SDL could not initialize! %s", SDL_GetError());
+        return;
+    }
+    
+    logging::Log(logging::LogType::INFO, "Running headless (no window or GL context)");
+    
+    // Systems Initialization (scenes are only recorded by the null renderer, the platform one is never initialized nor used)
+    mSystems = std::make_unique<SystemsImpl>();
+    mSystems->mNullRenderer.VInitialize();
+    mSystems->mResourceLoadingService.Initialize();
+    mSystems->mSoundManager.Initialize();
+    
+    mInitialized = true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool IsUserInputEvent(const SDL_Event& event)
+{
+    switch (event.type)
+    {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+        case SDL_TEXTINPUT:
+        case SDL_MOUSEMOTION:
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+        case SDL_MOUSEWHEEL:
+        case SDL_FINGERDOWN:
+        case SDL_FINGERMOTION:
+        case SDL_CONTROLLERBUTTONDOWN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static const char* GetFrameLimiterModeName(const FrameLimiter::Mode mode)
+{
+    switch (mode)
+    {
+        case FrameLimiter::Mode::ACTIVE: return "Active";
+        case FrameLimiter::Mode::IDLE: return "Idle";
+        case FrameLimiter::Mode::BACKGROUND: return "Background";
+    }
+    return "";
+}
 
-    clientInitFunction();
+///------------------------------------------------------------------------------------------------
+
+static void SleepOffThrottledFrame(const float frameStartMillis)
+{
+    PROFILE_SCOPE("FrameLimiter");
+    auto remainingMillis = sFrameLimiter.GetRemainingFrameMillis(frameStartMillis, static_cast<float>(SDL_GetTicks()));
+    while (remainingMillis > 0.0f)
+    {
+        // Sliced, so that e.g. the network keeps getting serviced at its usual cadence
+        SDL_Delay(static_cast<Uint32>(math::Max(1.0f, math::Min(remainingMillis, FrameLimiter::MAX_SLEEP_SLICE_MILLIS))));
+        if (sThrottledFrameTickFunction)
+        {
+            sThrottledFrameTickFunction();
+        }
+        remainingMillis = sFrameLimiter.GetRemainingFrameMillis(frameStartMillis, static_cast<float>(SDL_GetTicks()));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::function<void(const float)> clientUpdateFunction, std::function<void()> clientApplicationMovingToBackgroundFunction, std::function<void()> clientApplicationWindowResizeFunction, std::function<void()> clientCreateDebugWidgetsFunction, std::function<void()> clientOnOneSecondElapsedFunction)
+{
+    auto& profiler = profiling::Profiler::GetInstance();
+    
+    {
+        PROFILE_SCOPE("ClientInit");
+        mSystems->mParticleManager.LoadParticleData();
+        clientInitFunction();
+    }
     
     //While application is running
     SDL_Event event;
@@ -221,6 +379,10 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
     
     while(!shouldQuit)
     {
+        // Frames span whole loop iterations (i.e. including the buffer swap)
+        profiler.EndFrame();
+        profiler.BeginFrame();
+        
         bool windowSizeChanged = false;
         bool applicationMovingToBackground = false;
         bool applicationMovingToForeground = false;
@@ -234,14 +396,35 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
         secsAccumulator += dtMillis * 0.001f; // dt in seconds;
         
         //Handle events on queue
-        while(SDL_PollEvent(&event) != 0)
         {
-            mSystems->mInputStateManager.VProcessInputEvent(event, shouldQuit, windowSizeChanged, applicationMovingToBackground, applicationMovingToForeground);
-            if (shouldQuit)
+            PROFILE_SCOPE("Events");
+            while(SDL_PollEvent(&event) != 0)
             {
-                break;
+                mSystems->mInputStateManager.VProcessInputEvent(event, shouldQuit, windowSizeChanged, applicationMovingToBackground, applicationMovingToForeground);
+                if (shouldQuit)
+                {
+                    break;
+                }
+                
+                if (IsUserInputEvent(event))
+                {
+                    sFrameLimiter.OnInput(currentMillisSinceInit);
+                }
+            }
+        }
+        
+        if (sHeadless)
+        {
+            if (sHeadlessWindowStateSimulated)
+            {
+                sFrameLimiter.Update(currentMillisSinceInit, sHeadlessWindowFocused, sHeadlessWindowVisible);
             }
         }
+        else
+        {
+            const auto windowFlags = SDL_GetWindowFlags(mWindow);
+            sFrameLimiter.Update(currentMillisSinceInit, (windowFlags & SDL_WINDOW_INPUT_FOCUS) != 0, (windowFlags & (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN)) == 0);
+        }
         
         if (applicationMovingToBackground)
         {
@@ -253,20 +436,31 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
             mSystems->mSoundManager.ResumeAudio();
         }
         
-        if (mSystems->mInputStateManager.VButtonTapped(input::Button::MIDDLE_BUTTON))
+        // Game speed scales simulated time, whereas the step itself stays fixed. Frames running no simulation
+        // step (i.e. on displays faster than the simulation rate) don't consume input, so that taps carry over
+        // to the next frame that does, rather than get lost.
+        const auto simulationStepCount = freezeGame ? 0 : sFixedTimestep.Advance(math::Min(MAX_FRAME_MILLIS, dtMillis) * sGameSpeed);
+        const auto consumesInput = freezeGame || simulationStepCount > 0;
+        sLastFrameSimulationStepCount = simulationStepCount;
+        
+        if (consumesInput && mSystems->mInputStateManager.VButtonTapped(input::Button::MIDDLE_BUTTON))
         {
 #if defined(USE_IMGUI) && !defined(USE_EDITOR)
             freezeGame = !freezeGame;
 #endif
         }
             
-        if (mSystems->mInputStateManager.VKeyTapped(input::Key::Z))
+        if (consumesInput && mSystems->mInputStateManager.VKeyTapped(input::Key::Z))
         {
 #if defined(USE_IMGUI)
             GLOBAL_IMGUI_WINDOW_FLAGS = GLOBAL_IMGUI_WINDOW_FLAGS == ImGuiWindowFlags_NoMove ? ImGuiWindowFlags_None : ImGuiWindowFlags_NoMove;
 #endif
         }
         
+#if defined(USE_IMGUI)
+        sMainButtonTappedThisFrame = consumesInput && mSystems->mInputStateManager.VButtonTapped(input::Button::MAIN_BUTTON);
+#endif
+        
         if (windowSizeChanged)
         {
             for (auto& scene: mSystems->mSceneManager.GetScenes())
@@ -278,14 +472,32 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
         
         if (secsAccumulator > 1.0f)
         {
+#if defined(MACOS)
+            const auto processCPUTimeSecs = apple_utils::GetProcessCPUTimeSecs();
+#elif defined(WINDOWS)
+            const auto processCPUTimeSecs = windows_utils::GetProcessCPUTimeSecs();
+#elif defined(LINUX)
+            const auto processCPUTimeSecs = linux_utils::GetProcessCPUTimeSecs();
+#else
+            const auto processCPUTimeSecs = static_cast<double>(std::clock())/CLOCKS_PER_SEC;
+#endif
+            sLastSecondCPUUsagePercent = 100.0f * static_cast<float>(processCPUTimeSecs - sLastProcessCPUTimeSecs)/secsAccumulator;
+            sLastProcessCPUTimeSecs = processCPUTimeSecs;
+            
             if (sPrintFPS)
             {
-                logging::Log(logging::LogType::INFO, "FPS: %d", framesAccumulator);
+                logging::Log(logging::LogType::INFO, "FPS: %d, CPU: %.1f%% (%s)", static_cast<int>(framesAccumulator), sLastSecondCPUUsagePercent, GetFrameLimiterModeName(sFrameLimiter.GetMode()));
+                if (sHeadless)
+                {
+                    const auto& renderStats = mSystems->mNullRenderer.GetLastFrameStats();
+                    logging::Log(logging::LogType::INFO, "Draw Calls: %d, Uniform Uploads: %d, Buffer Upload Bytes: %d, State Changes: %d (%d redundant)", static_cast<int>(renderStats.mDrawCalls), static_cast<int>(renderStats.mUniformUploads), static_cast<int>(renderStats.mBufferUploadBytes), static_cast<int>(renderStats.GetStateChanges()), static_cast<int>(renderStats.mRedundantStateChanges));
+                }
             }
             
             framesAccumulator = 0;
             secsAccumulator -= 1.0f;
             
+            PROFILE_SCOPE("OneSecondElapsed");
             mSystems->mResourceLoadingService.ReloadMarkedResourcesFromDisk();
             mSystems->mFontRepository.ReloadMarkedFontsFromDisk();
             mSystems->mParticleManager.ReloadParticlesFromDisk();
@@ -294,93 +506,173 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
         }
         
         mSystems->mResourceLoadingService.Update();
-        mSystems->mSoundManager.Update(dtMillis);
-        
-        float gameLogicMillis = math::Max(16.0f, math::Min(32.0f, dtMillis)) * sGameSpeed * targetFpsMillis/DEFAULT_FRAME_MILLIS;
-
-        // Update logic
-#if defined(USE_IMGUI)
-        sLastGameLogicDtMillis = gameLogicMillis;
-        const auto logicUpdateTimeStart = std::chrono::system_clock::now();
-#else
-        (void)sLastGameLogicDtMillis;
-#endif
         
-        if (!freezeGame)
         {
-            mSystems->mAnimationManager.Update(gameLogicMillis);
-            clientUpdateFunction(gameLogicMillis);
+            PROFILE_SCOPE("SoundManager::Update");
+            mSystems->mSoundManager.Update(dtMillis);
         }
         
-        if (!freezeGame)
+        // Update logic
+        if (simulationStepCount > 0)
         {
-            for (auto& scene: mSystems->mSceneManager.GetScenes())
+            PROFILE_SCOPE("Logic");
+            const auto stepMillis = sFixedTimestep.GetStepMillis();
+            for (int i = 0; i < simulationStepCount; ++i)
             {
-                if (scene->IsLoaded())
+                if (i == simulationStepCount - 1)
                 {
-                    if (scene->GetUpdateTimeSpeedFactor() >= 1.0f)
+                    mSystems->mSceneManager.CaptureInterpolationStates();
+                }
+                
+                mSystems->mAnimationManager.Update(stepMillis);
+                
+                {
+                    PROFILE_SCOPE("ClientUpdate");
+                    clientUpdateFunction(stepMillis);
+                }
+                
+                // Taps are only seen by the first step of the frame
+                if (i == 0)
+                {
+                    mSystems->mInputStateManager.VUpdate();
+                }
+                
+                for (auto& scene: mSystems->mSceneManager.GetScenes())
+                {
+                    if (scene->IsLoaded())
                     {
-                        scene->GetCamera().Update(gameLogicMillis * scene->GetUpdateTimeSpeedFactor());
+                        if (scene->GetUpdateTimeSpeedFactor() >= 1.0f)
+                        {
+                            scene->GetCamera().Update(stepMillis * scene->GetUpdateTimeSpeedFactor());
+                        }
+                        
+                        mSystems->mParticleManager.UpdateSceneParticles(stepMillis * scene->GetUpdateTimeSpeedFactor(), *scene);
+                        
+                        PROFILE_SCOPE("SceneManager::SortSceneObjects");
+                        mSystems->mSceneManager.SortSceneObjects(scene);
                     }
-                    
-                    mSystems->mParticleManager.UpdateSceneParticles(gameLogicMillis * scene->GetUpdateTimeSpeedFactor(), *scene);
-                    mSystems->mSceneManager.SortSceneObjects(scene);
                 }
             }
         }
+        else if (consumesInput)
+        {
+            mSystems->mInputStateManager.VUpdate();
+        }
         
-#if defined(USE_IMGUI)
-        const auto logicUpdateTimeEnd = std::chrono::system_clock::now();
-        sUpdateLogicMillisSamples[PROFILLING_SAMPLE_COUNT - 1] = std::chrono::duration_cast<std::chrono::milliseconds>(logicUpdateTimeEnd - logicUpdateTimeStart).count();
-#endif
-        
-        // Rendering Logic
-        mSystems->mRenderer.VBeginRenderPass();
+        // Scenes are rendered in between the last two simulated states
+        const auto interpolationAlpha = freezeGame ? 1.0f : sFixedTimestep.GetInterpolationAlpha();
         
-#if defined(USE_IMGUI)
-        clientCreateDebugWidgetsFunction();
-        CreateEngineDebugWidgets();
-        
-        const auto renderingTimeStart = std::chrono::system_clock::now();
-#endif
+        // Minimized/hidden windows have nothing to present
+        if (sFrameLimiter.GetMode() == FrameLimiter::Mode::BACKGROUND)
+        {
+            SleepOffThrottledFrame(currentMillisSinceInit);
+            continue;
+        }
         
-        for (auto& scene: mSystems->mSceneManager.GetScenes())
+        if (sHeadless)
         {
-            if (scene->IsLoaded())
+            // Scenes are only recorded (so that draw call & submission cost regressions can be caught without a GPU),
+            // and there is no vsync to pace the loop, so sleep off the rest of the frame instead
+            {
+                PROFILE_SCOPE("Rendering");
+                mSystems->mSceneManager.ApplyInterpolatedStates(interpolationAlpha);
+                mSystems->mNullRenderer.VBeginRenderPass();
+                for (auto& scene: mSystems->mSceneManager.GetScenes())
+                {
+                    if (scene->IsLoaded())
+                    {
+                        mSystems->mNullRenderer.VRenderScene(*scene);
+                    }
+                }
+                mSystems->mNullRenderer.VEndRenderPass();
+            }
+            mSystems->mSceneManager.RestoreSimulatedStates();
+            
+            if (sFrameLimiter.GetMode() == FrameLimiter::Mode::IDLE)
+            {
+                SleepOffThrottledFrame(currentMillisSinceInit);
+                continue;
+            }
+            
+            const auto frameMillis = static_cast<float>(SDL_GetTicks()) - currentMillisSinceInit;
+            if (frameMillis < targetFpsMillis)
             {
-                mSystems->mRenderer.VRenderScene(*scene);
+                SDL_Delay(static_cast<Uint32>(targetFpsMillis - frameMillis));
             }
+            continue;
         }
         
-#if defined(USE_IMGUI)
-        const auto renderingTimeEnd = std::chrono::system_clock::now();
-        sRenderingMillisSamples[PROFILLING_SAMPLE_COUNT - 1] = std::chrono::duration_cast<std::chrono::milliseconds>(renderingTimeEnd - renderingTimeStart).count();
-        
-        for (int i = 0; i < PROFILLING_SAMPLE_COUNT - 1; ++i)
+        // Rendering Logic
         {
-            if (!freezeGame)
+            PROFILE_SCOPE("Rendering");
+            mSystems->mRenderer.VBeginRenderPass();
+            
+#if defined(USE_IMGUI)
             {
-                sUpdateLogicMillisSamples[i] = sUpdateLogicMillisSamples[i + 1];
+                PROFILE_SCOPE("DebugWidgets");
+                clientCreateDebugWidgetsFunction();
+                CreateEngineDebugWidgets();
             }
-            
-            sRenderingMillisSamples[i] = sRenderingMillisSamples[i + 1];
-        }
 #else
-        (void)clientCreateDebugWidgetsFunction;
+            (void)clientCreateDebugWidgetsFunction;
 #endif
+            
+            // Only after the debug widgets, which may edit or create scene objects
+            mSystems->mSceneManager.ApplyInterpolatedStates(interpolationAlpha);
+            
+            {
+                PROFILE_SCOPE("RenderScenes");
+                for (auto& scene: mSystems->mSceneManager.GetScenes())
+                {
+                    if (scene->IsLoaded())
+                    {
+                        mSystems->mRenderer.VRenderScene(*scene);
+                    }
+                }
+            }
+            
+            // Includes ImGui's draw data submission and the (vsync paced) buffer swap
+            PROFILE_SCOPE("EndRenderPass");
+            mSystems->mRenderer.VEndRenderPass();
+        }
+        mSystems->mSceneManager.RestoreSimulatedStates();
         
-        mSystems->mRenderer.VEndRenderPass();
-        mSystems->mInputStateManager.VUpdate();
+        SleepOffThrottledFrame(currentMillisSinceInit);
     }
+    profiler.EndFrame();
     
 #if defined(USE_IMGUI)
-    ImGui::DestroyContext();
+    if (!sHeadless)
+    {
+        ImGui::DestroyContext();
+    }
 #endif
     clientApplicationMovingToBackgroundFunction();
 }
 
 ///------------------------------------------------------------------------------------------------
 
+void CoreSystemsEngine::SetThrottledFrameTickFunction(std::function<void()> throttledFrameTickFunction)
+{
+    sThrottledFrameTickFunction = throttledFrameTickFunction;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CoreSystemsEngine::SetSimulationStepsPerSecond(const float stepsPerSecond)
+{
+    sFixedTimestep.SetStepsPerSecond(stepsPerSecond);
+}
+
+///------------------------------------------------------------------------------------------------
+
+float CoreSystemsEngine::GetSimulationStepsPerSecond() const
+{
+    return sFixedTimestep.GetStepsPerSecond();
+}
+
+///------------------------------------------------------------------------------------------------
+
 bool CoreSystemsEngine::IsShuttingDown()
 {
     return sShuttingDown;
@@ -397,6 +689,10 @@ rendering::AnimationManager& CoreSystemsEngine::GetAnimationManager()
 
 rendering::IRenderer& CoreSystemsEngine::GetRenderer()
 {
+    if (sHeadless)
+    {
+        return mSystems->mNullRenderer;
+    }
     return mSystems->mRenderer;
 }
 
@@ -444,6 +740,13 @@ sound::SoundManager& CoreSystemsEngine::GetSoundManager()
 
 ///------------------------------------------------------------------------------------------------
 
+JobSystem& CoreSystemsEngine::GetJobSystem()
+{
+    return mSystems->mJobSystem;
+}
+
+///------------------------------------------------------------------------------------------------
+
 float CoreSystemsEngine::GetDefaultAspectRatio() const
 {
     return static_cast<float>(DEFAULT_WINDOW_WIDTH)/DEFAULT_WINDOW_HEIGHT;
@@ -460,6 +763,11 @@ SDL_Window& CoreSystemsEngine::GetContextWindow() const
 
 glm::vec2 CoreSystemsEngine::GetContextRenderableDimensions() const
 {
+    if (sHeadless)
+    {
+        return glm::vec2(DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT);
+    }
+    
     int w,h; SDL_GetWindowSize(mWindow, &w, &h); return glm::vec2(w, h);
 }
 
@@ -476,6 +784,112 @@ void CoreSystemsEngine::SpecialEventHandling(SDL_Event& event)
 
 ///------------------------------------------------------------------------------------------------
 
+#if defined(USE_IMGUI)
+static void CreateProfilerDebugWidgets()
+{
+    auto& profiler = profiling::Profiler::GetInstance();
+    const auto& capturedFrames = profiler.GetCapturedFrames();
+    
+    ImGui::Begin("Profiler", nullptr, GLOBAL_IMGUI_WINDOW_FLAGS);
+    bool captureEnabled = profiler.IsEnabled();
+    if (ImGui::Checkbox("Capture", &captureEnabled))
+    {
+        profiler.SetEnabled(captureEnabled);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Export Chrome Trace"))
+    {
+        profiler.ExportChromeTrace(CHROME_TRACE_EXPORT_FILE_NAME);
+    }
+    
+    if (capturedFrames.empty())
+    {
+        ImGui::Text("No captured frames");
+        ImGui::End();
+        return;
+    }
+    
+    // Frame times (oldest to latest)
+    static float frameMillis[profiling::Profiler::MAX_CAPTURED_FRAMES];
+    const auto frameCount = static_cast<int>(capturedFrames.size());
+    auto worstFrameIndex = 0;
+    auto worstFrameMillis = -1.0f;
+    for (int i = 0; i < frameCount; ++i)
+    {
+        frameMillis[i] = capturedFrames[i].mDurationMicros/1000.0f;
+        if (frameMillis[i] > worstFrameMillis)
+        {
+            worstFrameMillis = frameMillis[i];
+            worstFrameIndex = i;
+        }
+    }
+    ImGui::PlotHistogram("Frames (millis)", frameMillis, frameCount, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+    
+    sSelectedProfiledFrameOffset = math::Min(sSelectedProfiledFrameOffset, frameCount - 1);
+    ImGui::SliderInt("Frames Ago", &sSelectedProfiledFrameOffset, 0, frameCount - 1);
+    ImGui::SameLine();
+    if (ImGui::Button("Worst"))
+    {
+        sSelectedProfiledFrameOffset = frameCount - 1 - worstFrameIndex;
+    }
+    
+    const auto& frame = capturedFrames[frameCount - 1 - sSelectedProfiledFrameOffset];
+    ImGui::Text("Frame %d: %.3f millis, %d scopes (%d dropped)", static_cast<int>(frame.mFrameIndex), frame.mDurationMicros/1000.0f, static_cast<int>(frame.mSamples.size()), static_cast<int>(frame.mDroppedSampleCount));
+    
+    // Flame view: the frame spans the full width, with a row per nesting depth (threads stacked below one another)
+    std::vector<uint32_t> threadRowCounts;
+    for (const auto& sample: frame.mSamples)
+    {
+        if (sample.mThreadIndex >= threadRowCounts.size())
+        {
+            threadRowCounts.resize(sample.mThreadIndex + 1, 0);
+        }
+        threadRowCounts[sample.mThreadIndex] = math::Max(threadRowCounts[sample.mThreadIndex], sample.mDepth + 1);
+    }
+    
+    std::vector<uint32_t> threadFirstRows(threadRowCounts.size(), 0);
+    uint32_t totalRowCount = 0;
+    for (size_t i = 0; i < threadRowCounts.size(); ++i)
+    {
+        threadFirstRows[i] = totalRowCount;
+        totalRowCount += threadRowCounts[i];
+    }
+    
+    auto* drawList = ImGui::GetWindowDrawList();
+    const auto origin = ImGui::GetCursorScreenPos();
+    const auto width = math::Max(ImGui::GetContentRegionAvail().x, 1.0f);
+    const auto frameDurationMicros = static_cast<float>(math::Max(frame.mDurationMicros, static_cast<int64_t>(1)));
+    
+    for (const auto& sample: frame.mSamples)
+    {
+        // Scopes that started before the frame (e.g. long running async loads) are clamped to its start
+        const auto startRatio = math::Max(0.0f, math::Min(1.0f, (sample.mStartMicros - frame.mStartMicros)/frameDurationMicros));
+        const auto endRatio = math::Max(0.0f, math::Min(1.0f, (sample.mStartMicros + sample.mDurationMicros - frame.mStartMicros)/frameDurationMicros));
+        const auto row = threadFirstRows[sample.mThreadIndex] + sample.mDepth;
+        
+        const auto rectMin = ImVec2(origin.x + startRatio * width, origin.y + row * FLAME_VIEW_ROW_HEIGHT);
+        const auto rectMax = ImVec2(origin.x + math::Max(endRatio * width, startRatio * width + 1.0f), rectMin.y + FLAME_VIEW_ROW_HEIGHT - 1.0f);
+        
+        // Stable color per scope name
+        const auto hue = static_cast<float>(std::hash<std::string>()(sample.mName) % 360)/360.0f;
+        drawList->AddRectFilled(rectMin, rectMax, ImColor::HSV(hue, sample.mThreadIndex == 0 ? 0.5f : 0.25f, 0.8f));
+        
+        drawList->PushClipRect(rectMin, rectMax, true);
+        drawList->AddText(ImVec2(rectMin.x + 2.0f, rectMin.y + 2.0f), IM_COL32_BLACK, sample.mName);
+        drawList->PopClipRect();
+        
+        if (ImGui::IsMouseHoveringRect(rectMin, rectMax))
+        {
+            ImGui::SetTooltip("%s\n%.3f millis (thread %d)", sample.mName, sample.mDurationMicros/1000.0f, static_cast<int>(sample.mThreadIndex));
+        }
+    }
+    ImGui::Dummy(ImVec2(width, math::Max(1u, totalRowCount) * FLAME_VIEW_ROW_HEIGHT));
+    ImGui::End();
+}
+#endif
+
+///------------------------------------------------------------------------------------------------
+
 void CoreSystemsEngine::CreateEngineDebugWidgets()
 {
 #if defined(USE_IMGUI)
@@ -530,8 +944,8 @@ void CoreSystemsEngine::CreateEngineDebugWidgets()
     ImGui::End();
     
     auto playgroundScene = mSystems->mSceneManager.FindScene(PLAYGROUND_SCENE_NAME);
-    auto worldTouchPos = mSystems->mInputStateManager.VGetPointingPosInWorldSpace(playgroundScene->GetCamera().GetViewMatrix(), playgroundScene->GetCamera().GetProjMatrix());
-    if (sParticlePaintEnabled && mSystems->mInputStateManager.VButtonTapped(input::Button::MAIN_BUTTON))
+    auto worldTouchPos = mSystems->mInputStateManager.VGetPointingPosInWorldSpace(playgroundScene->GetCamera());
+    if (sParticlePaintEnabled && sMainButtonTappedThisFrame)
     {
         mSystems->mParticleManager.CreateParticleEmitterAtPosition(strutils::StringId(sAvailableParticleNames.at(sParticleIndex)), glm::vec3(worldTouchPos.x, worldTouchPos.y, TEST_PARTICLE_Z), *playgroundScene);
     }
@@ -566,21 +980,32 @@ void CoreSystemsEngine::CreateEngineDebugWidgets()
     // Create runtime configs
     ImGui::Begin("Engine Runtime", nullptr, GLOBAL_IMGUI_WINDOW_FLAGS);
     ImGui::SeparatorText("General");
-    ImGui::Text("Game Logic Dt %.3f", sLastGameLogicDtMillis);
+    ImGui::Text("Simulation Steps %d (%.3fms each, %.1f%% into next)", sLastFrameSimulationStepCount, sFixedTimestep.GetStepMillis(), sFixedTimestep.GetInterpolationAlpha() * 100.0f);
+    float simulationStepsPerSecond = sFixedTimestep.GetStepsPerSecond();
+    if (ImGui::SliderFloat("Simulation Rate", &simulationStepsPerSecond, 10.0f, 240.0f, "%.0fHz"))
+    {
+        sFixedTimestep.SetStepsPerSecond(simulationStepsPerSecond);
+    }
+    ImGui::Text("Texture Memory %.2fMB", resources::TextureResource::GetTotalTextureMemoryBytes()/(1024.0f * 1024.0f));
     ImGui::Checkbox("Print FPS", &sPrintFPS);
+    ImGui::Text("CPU %.1f%% (%s)", sLastSecondCPUUsagePercent, GetFrameLimiterModeName(sFrameLimiter.GetMode()));
+    bool frameLimiterEnabled = sFrameLimiter.IsEnabled();
+    if (ImGui::Checkbox("Idle/Background Frame Limiter", &frameLimiterEnabled))
+    {
+        sFrameLimiter.SetEnabled(frameLimiterEnabled);
+    }
     ImGui::SliderFloat("Game Speed", &sGameSpeed, 0.01f, 10.0f);
     ImGui::SameLine();
     if (ImGui::Button("Reset"))
     {
         sGameSpeed = 1.0f;
     }
-    ImGui::SeparatorText("Profilling");
-    ImGui::PlotLines("Update (millis)", sUpdateLogicMillisSamples, PROFILLING_SAMPLE_COUNT);
-    ImGui::PlotLines("Rendering (millis)", sRenderingMillisSamples, PROFILLING_SAMPLE_COUNT);
     ImGui::SeparatorText("Input");
     const auto& cursorPos = CoreSystemsEngine::GetInstance().GetInputStateManager().VGetPointingPos();
     ImGui::Text("Cursor %.3f,%.3f",cursorPos.x, cursorPos.y);
     ImGui::End();
+    
+    CreateProfilerDebugWidgets();
 #endif
 }
 
@@ -5,6 +5,7 @@
 ///  Created by Alex Koukoulas on 03/10/2023                                                       
 ///------------------------------------------------------------------------------------------------
 
+#include <engine/rendering/Camera.h>
 #include <engine/utils/Logging.h>
 #include <imgui/backends/imgui_impl_sdl2.h>
 #include <platform_specific/InputStateManagerPlatformImpl.h>
@@ -30,12 +31,9 @@ const glm::ivec2& InputStateManagerPlatformImpl::VGetScrollDelta() const
 
 ///------------------------------------------------------------------------------------------------
 
-glm::vec2 InputStateManagerPlatformImpl::VGetPointingPosInWorldSpace(const glm::mat4& viewMatrix, const glm::mat4& projMatrix) const
+glm::vec2 InputStateManagerPlatformImpl::VGetPointingPosInWorldSpace(const rendering::Camera& camera) const
 {
-    const auto& invVP = glm::inverse(projMatrix * viewMatrix);
-    const auto& screenPos = glm::vec4(mPointingPos.x, mPointingPos.y, 1.0f, 1.0f);
-    const auto& worldPos = invVP * screenPos;
-    return glm::vec2(worldPos.x, worldPos.y);
+    return camera.ScreenToWorldPos(mPointingPos);
 }
 
 ///------------------------------------------------------------------------------------------------
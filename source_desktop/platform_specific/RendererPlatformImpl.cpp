@@ -11,6 +11,7 @@
 #include <engine/rendering/Fonts.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/rendering/CommonUniforms.h>
+#include <engine/rendering/RenderingUtils.h>
 #include <engine/resloading/MeshResource.h>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/resloading/ShaderResource.h>
@@ -34,6 +35,8 @@ namespace rendering
 
 static const glm::ivec4 RENDER_TO_TEXTURE_VIEWPORT = {-972, -48, 6144, 4096};
 static const glm::vec4 RENDER_TO_TEXTURE_CLEAR_COLOR = {1.0f, 1.0f, 1.0f, 0.0f};
+static const strutils::StringId DEFERRED_OBJECTS_PASS_NAME = strutils::StringId("deferred_objects");
+static const strutils::StringId IMGUI_PASS_NAME = strutils::StringId("imgui");
 
 static const std::vector<std::vector<float>> GLYPH_DEFAULT_VERTEX_POSITIONS =
 {
@@ -95,36 +98,18 @@ public:
         auto* currentMesh = &(resService.GetResource<resources::MeshResource>(mSceneObject.mMeshResourceId));
         GL_CALL(glBindVertexArray(currentMesh->GetVertexArrayObject()));
         
-        auto* currentTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mTextureResourceId));
-        GL_CALL(glActiveTexture(GL_TEXTURE0));
-        GL_CALL(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
+        rendering::BindSceneObjectTexture(mSceneObject, *currentShader);
         
-        for (int i = 0; i < scene::EFFECT_TEXTURES_COUNT; ++i)
-        {
-            if (mSceneObject.mEffectTextureResourceIds[i] != 0)
-            {
-                auto* currentEffectTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mEffectTextureResourceIds[i]));
-                GL_CALL(glActiveTexture(GL_TEXTURE1 + i));
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, currentEffectTexture->GetGLTextureId()));
-            }
-        }
-        
-        glm::mat4 world(1.0f);
-        world = glm::translate(world, mSceneObject.mPosition);
+        rendering::BindSceneObjectEffectTextures(mSceneObject);
         
-        glm::mat4 rot(1.0f);
-        rot = glm::rotate(rot, mSceneObject.mRotation.x, math::X_AXIS);
-        rot = glm::rotate(rot, mSceneObject.mRotation.y, math::Y_AXIS);
-        rot = glm::rotate(rot, mSceneObject.mRotation.z, math::Z_AXIS);
-        world *= rot;
-        world = glm::scale(world, mSceneObject.mScale);
+        const auto& world = scene_object_utils::GetWorldMatrix(mSceneObject);
+        const auto& rot = scene_object_utils::GetWorldRotationMatrix(mSceneObject);
         
         currentShader->SetFloat(CUSTOM_ALPHA_UNIFORM_NAME, 1.0f);
         currentShader->SetBool(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME, mSceneObject.mShaderBoolUniformValues.count(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME) ? mSceneObject.mShaderBoolUniformValues.at(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME) : false);
         currentShader->SetBool(IS_TEXTURE_SHEET_UNIFORM_NAME, false);
         currentShader->SetMatrix4fv(WORLD_MATRIX_UNIFORM_NAME, world);
-        currentShader->SetMatrix4fv(VIEW_MATRIX_UNIFORM_NAME, mCamera.GetViewMatrix());
-        currentShader->SetMatrix4fv(PROJ_MATRIX_UNIFORM_NAME, mCamera.GetProjMatrix());
+        currentShader->SetCameraMatrices(mCamera.GetViewMatrix(), mCamera.GetProjMatrix(), mCamera.GetVersion());
         currentShader->SetMatrix4fv(ROT_MATRIX_UNIFORM_NAME, rot);
         
         for (const auto& vec3Entry: mSceneObject.mShaderVec3UniformValues) currentShader->SetFloatVec3(vec3Entry.first, vec3Entry.second);
@@ -133,7 +118,7 @@ public:
         for (const auto& intEntry: mSceneObject.mShaderIntUniformValues) currentShader->SetInt(intEntry.first, intEntry.second);
         for (const auto& boolEntry: mSceneObject.mShaderBoolUniformValues) currentShader->SetBool(boolEntry.first, boolEntry.second);
         
-        GL_CALL(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), GL_UNSIGNED_SHORT, (void*)0));
+        GL_CALL(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), currentMesh->GetElementType(), (void*)0));
         sDrawCallCounter++;
     }
     
@@ -163,26 +148,28 @@ public:
         const auto stringWidth = stringRect.topRight.x - stringRect.bottomLeft.x;
         const auto stringHeight = stringRect.topRight.y - stringRect.bottomLeft.y;
 
-        float xCursor = mSceneObject.mPosition.x;
+        const auto worldPosition = scene_object_utils::GetWorldPosition(mSceneObject);
+        const auto& worldScale = scene_object_utils::GetWorldScale(mSceneObject);
+        float xCursor = worldPosition.x;
         
         const auto& stringFontGlyphs = font.FindGlyphs(sceneObjectTypeData.mText);
         for (size_t i = 0; i < stringFontGlyphs.size(); ++i)
         {
             const auto& glyph = stringFontGlyphs[i];
-            float yCursor = mSceneObject.mPosition.y - glyph.mHeightPixels * mSceneObject.mScale.y;
+            float yCursor = worldPosition.y - glyph.mHeightPixels * worldScale.y;
             
-            float targetX = xCursor + glyph.mXOffsetPixels * mSceneObject.mScale.x;
-            float targetY = yCursor - glyph.mYOffsetPixels * mSceneObject.mScale.y;
+            float targetX = xCursor + glyph.mXOffsetPixels * worldScale.x;
+            float targetY = yCursor - glyph.mYOffsetPixels * worldScale.y;
             
-            currentFontRenderData.mGlyphPositions.emplace_back(targetX - stringWidth/2.0f, targetY - stringHeight/2.0f, mSceneObject.mPosition.z + 0.00001f * i);
-            currentFontRenderData.mGlyphScales.emplace_back(glyph.mWidthPixels * mSceneObject.mScale.x, glyph.mHeightPixels * mSceneObject.mScale.y, 1.0f);
+            currentFontRenderData.mGlyphPositions.emplace_back(targetX - stringWidth/2.0f, targetY - stringHeight/2.0f, worldPosition.z + 0.00001f * i);
+            currentFontRenderData.mGlyphScales.emplace_back(glyph.mWidthPixels * worldScale.x, glyph.mHeightPixels * worldScale.y, 1.0f);
             currentFontRenderData.mGlyphMinUVs.emplace_back(glyph.minU, glyph.minV);
             currentFontRenderData.mGlyphMaxUVs.emplace_back(glyph.maxU, glyph.maxV);
             currentFontRenderData.mGlyphAlphas.emplace_back(mSceneObject.mShaderFloatUniformValues.contains(CUSTOM_ALPHA_UNIFORM_NAME) ? mSceneObject.mShaderFloatUniformValues.at(CUSTOM_ALPHA_UNIFORM_NAME) : 1.0f);
             
             if (i != stringFontGlyphs.size() - 1)
             {
-                xCursor += glyph.mAdvancePixels * mSceneObject.mScale.x;
+                xCursor += glyph.mAdvancePixels * worldScale.x;
             }
         }
     }
@@ -199,23 +186,12 @@ public:
             currentShader->SetInt(currentShader->GetUniformSamplerNames().at(i), static_cast<int>(i));
         }
         
-        auto* currentTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mTextureResourceId));
-        GL_CALL(glActiveTexture(GL_TEXTURE0));
-        GL_CALL(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
+        rendering::BindSceneObjectTexture(mSceneObject, *currentShader);
         
-        for (int i = 0; i < scene::EFFECT_TEXTURES_COUNT; ++i)
-        {
-            if (mSceneObject.mEffectTextureResourceIds[i] != 0)
-            {
-                auto* currentEffectTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mEffectTextureResourceIds[i]));
-                GL_CALL(glActiveTexture(GL_TEXTURE1 + i));
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, currentEffectTexture->GetGLTextureId()));
-            }
-        }
+        rendering::BindSceneObjectEffectTextures(mSceneObject);
         
         currentShader->SetFloat(CUSTOM_ALPHA_UNIFORM_NAME, 1.0f);
-        currentShader->SetMatrix4fv(VIEW_MATRIX_UNIFORM_NAME, mCamera.GetViewMatrix());
-        currentShader->SetMatrix4fv(PROJ_MATRIX_UNIFORM_NAME, mCamera.GetProjMatrix());
+        currentShader->SetCameraMatrices(mCamera.GetViewMatrix(), mCamera.GetProjMatrix(), mCamera.GetVersion());
         
         for (const auto& vec3Entry: mSceneObject.mShaderVec3UniformValues) currentShader->SetFloatVec3(vec3Entry.first, vec3Entry.second);
         for (const auto& vec4Entry: mSceneObject.mShaderVec4UniformValues) currentShader->SetFloatVec4(vec4Entry.first, vec4Entry.second);
@@ -320,6 +296,8 @@ void RendererPlatformImpl::VInitialize()
     GL_CALL(glBufferData(GL_ARRAY_BUFFER, GLYPH_DEFAULT_UVS.size() * sizeof(float) , GLYPH_DEFAULT_UVS.data(), GL_STATIC_DRAW));
     
     GL_CALL(glBindVertexArray(0));
+    
+    mGPUTimerQueries.Initialize();
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -329,6 +307,7 @@ void RendererPlatformImpl::VBeginRenderPass()
     sDrawCallCounter = 0;
     sParticleCounter = 0;
     mSceneObjectsWithDeferredRendering.clear();
+    mGPUTimerQueries.BeginFrame();
 
     // Set View Port
     int w, h;
@@ -360,6 +339,7 @@ void RendererPlatformImpl::VRenderScene(scene::Scene& scene)
 {
     mCachedScenes.push_back(scene);
     mFontRenderingPassData.clear();
+    mGPUTimerQueries.BeginPass(scene.GetName());
     
     for (const auto& sceneObject: scene.GetSceneObjects())
     {
@@ -373,6 +353,7 @@ void RendererPlatformImpl::VRenderScene(scene::Scene& scene)
     }
     
     RenderSceneText(scene);
+    mGPUTimerQueries.EndPass();
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -404,10 +385,12 @@ void RendererPlatformImpl::VRenderSceneObjectsToTexture(const std::vector<std::s
 
 void RendererPlatformImpl::VEndRenderPass()
 {
+    mGPUTimerQueries.BeginPass(DEFERRED_OBJECTS_PASS_NAME);
     for (const auto& sceneObjectEntry: mSceneObjectsWithDeferredRendering)
     {
         std::visit(SceneObjectTypeRendererVisitor(*sceneObjectEntry.second, *sceneObjectEntry.first, mFontRenderingPassData), sceneObjectEntry.second->mSceneObjectTypeData);
     }
+    mGPUTimerQueries.EndPass();
     
 #if defined(USE_IMGUI)
     // Create all custom GUIs
@@ -417,7 +400,10 @@ void RendererPlatformImpl::VEndRenderPass()
     // Imgui end-of-frame calls
     ImGui::EndFrame();
     ImGui::Render();
+    
+    mGPUTimerQueries.BeginPass(IMGUI_PASS_NAME);
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    mGPUTimerQueries.EndPass();
 #endif
     
     // Swap window buffers
@@ -451,8 +437,7 @@ void RendererPlatformImpl::RenderSceneText(scene::Scene& scene)
             GL_CALL(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
 
             currentShader->SetFloat(CUSTOM_ALPHA_UNIFORM_NAME, 1.0f);
-            currentShader->SetMatrix4fv(VIEW_MATRIX_UNIFORM_NAME, scene.GetCamera().GetViewMatrix());
-            currentShader->SetMatrix4fv(PROJ_MATRIX_UNIFORM_NAME, scene.GetCamera().GetProjMatrix());
+            currentShader->SetCameraMatrices(scene.GetCamera().GetViewMatrix(), scene.GetCamera().GetProjMatrix(), scene.GetCamera().GetVersion());
             
             GL_CALL(glBindVertexArray(sFontVertexArrayObject));
             
@@ -576,6 +561,34 @@ void RendererPlatformImpl::CreateIMGuiWidgets()
     ImGui::Text("Draw Calls %d", sDrawCallCounter);
     ImGui::Text("Particle Count %d", sParticleCounter);
     ImGui::Text("Anims Live %d", CoreSystemsEngine::GetInstance().GetAnimationManager().GetAnimationsPlayingCount());
+    
+    // Lagging BUFFERED_FRAME_COUNT frames behind, so that reading the GPU timings never stalls
+    ImGui::SeparatorText("Passes (CPU/GPU millis)");
+    if (!mGPUTimerQueries.IsSupported())
+    {
+        ImGui::Text("GPU timer queries unsupported");
+    }
+    if (ImGui::BeginTable("Pass Timings", 3))
+    {
+        for (const auto& passTiming: mGPUTimerQueries.GetResolvedPassTimings())
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", passTiming.mPassName.GetString().c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", passTiming.mCPUMillis);
+            ImGui::TableNextColumn();
+            if (passTiming.mGPUMillisAvailable)
+            {
+                ImGui::Text("%.3f", passTiming.mGPUMillis);
+            }
+            else
+            {
+                ImGui::Text("-");
+            }
+        }
+        ImGui::EndTable();
+    }
     ImGui::End();
     
     // Create scene data viewer
@@ -599,7 +612,7 @@ void RendererPlatformImpl::CreateIMGuiWidgets()
         // Scene Input propertues
         if (ImGui::CollapsingHeader("Input", ImGuiTreeNodeFlags_None))
         {
-            auto worldPos = CoreSystemsEngine::GetInstance().GetInputStateManager().VGetPointingPosInWorldSpace(sceneRef.get().GetCamera().GetViewMatrix(), sceneRef.get().GetCamera().GetProjMatrix());
+            auto worldPos = CoreSystemsEngine::GetInstance().GetInputStateManager().VGetPointingPosInWorldSpace(sceneRef.get().GetCamera());
             ImGui::Text("Cursor %.3f,%.3f",worldPos.x, worldPos.y);
         }
         
@@ -663,7 +676,7 @@ void RendererPlatformImpl::CreateIMGuiWidgets()
                 
                 if (ImGui::SliderFloat("SnapToEdge factor", &sceneObject->mSnapToEdgeScaleOffsetFactor, -3.0f, 3.0f))
                 {
-                    sceneRef.get().RecalculatePositionOfEdgeSnappingSceneObject(sceneObject, sceneRef.get().GetCamera().CalculateFrustum());
+                    sceneRef.get().RecalculatePositionOfEdgeSnappingSceneObject(sceneObject, sceneRef.get().GetCamera().GetFrustum());
                 }
                 
                 ImGui::SliderFloat("x", &sceneObject->mPosition.x, -0.5f, 0.5f);
@@ -10,6 +10,7 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include <engine/rendering/GPUTimerQueries.h>
 #include <engine/rendering/IRenderer.h>
 #include <engine/CoreSystemsEngine.h>
 #include <functional>
@@ -57,6 +58,7 @@ private:
     std::vector<std::pair<rendering::Camera*, std::shared_ptr<scene::SceneObject>>> mSceneObjectsWithDeferredRendering;
     FontRenderingDataMap mFontRenderingPassData;
     std::vector<std::reference_wrapper<scene::Scene>> mCachedScenes;
+    GPUTimerQueries mGPUTimerQueries;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -15,8 +15,11 @@
 #include <engine/sound/SoundManager.h>
 #include <engine/scene/SceneManager.h>
 #include <engine/scene/Scene.h>
+#include <engine/utils/FixedTimestep.h>
+#include <engine/utils/JobSystem.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/OSMessageBox.h>
+#include <engine/utils/Profiler.h>
 #include <platform_specific/InputStateManagerPlatformImpl.h>
 #include <platform_specific/IOSUtils.h>
 #include <platform_specific/RendererPlatformImpl.h>
@@ -29,17 +32,19 @@ static constexpr int DEFAULT_WINDOW_WIDTH  = 585;
 static constexpr int DEFAULT_WINDOW_HEIGHT = 1688;
 static constexpr int MIN_WINDOW_WIDTH      = 390;
 static constexpr int MIN_WINDOW_HEIGHT     = 844;
-static constexpr int TARGET_GAME_LOGIC_FPS = 60;
+static constexpr float MAX_FRAME_MILLIS = 250.0f;
 
 ///------------------------------------------------------------------------------------------------
 
 bool CoreSystemsEngine::mInitialized = false;
 static bool sIsShuttingDown = false;
+static FixedTimestep sFixedTimestep;
 
 ///------------------------------------------------------------------------------------------------
 
 struct CoreSystemsEngine::SystemsImpl
 {
+    JobSystem mJobSystem;
     rendering::AnimationManager mAnimationManager;
     rendering::RendererPlatformImpl mRenderer;
     rendering::ParticleManager mParticleManager;
@@ -68,6 +73,20 @@ CoreSystemsEngine::~CoreSystemsEngine()
 
 ///------------------------------------------------------------------------------------------------
 
+void CoreSystemsEngine::SetHeadless(const bool)
+{
+    // Always has a window and GL context on mobile
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool CoreSystemsEngine::IsHeadless()
+{
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
 void CoreSystemsEngine::Initialize()
 {
     // Initialize SDL
@@ -150,8 +169,13 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
     const int refreshRate = rendering::GetDisplayRefreshRate();
     const float targetFpsMillis = 1000.0f / refreshRate;
     
+    auto& profiler = profiling::Profiler::GetInstance();
+    
     while(!shouldQuit)
     {
+        profiler.EndFrame();
+        profiler.BeginFrame();
+        
         bool windowSizeChanged = false;
         bool applicationMovedToBackground = false;
         bool applicationMovedToForeground = true;
@@ -198,7 +222,7 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
         mSystems->mResourceLoadingService.Update();
         mSystems->mSoundManager.Update(dtMillis);
         
-        float gameLogicMillis = math::Max(16.0f, math::Min(32.0f, dtMillis)) * (TARGET_GAME_LOGIC_FPS/static_cast<float>(refreshRate));
+        const auto simulationStepCount = sFixedTimestep.Advance(math::Min(MAX_FRAME_MILLIS, dtMillis));
         if (secsAccumulator > 1.0f)
         {
             logging::Log(logging::LogType::INFO, "FPS: %d", framesAccumulator);
@@ -211,35 +235,58 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
             clientOnOneSecondElapsedFunction();
         }
   
-        mSystems->mAnimationManager.Update(gameLogicMillis);
-        clientUpdateFunction(gameLogicMillis);
-        mSystems->mInputStateManager.VUpdate();
-        
-        for (auto& scene: mSystems->mSceneManager.GetScenes())
+        // Frames running no simulation step keep their input (taps) for the next one that does
+        if (simulationStepCount > 0)
         {
-            if (scene->IsLoaded())
+            PROFILE_SCOPE("Logic");
+            const auto stepMillis = sFixedTimestep.GetStepMillis();
+            for (int i = 0; i < simulationStepCount; ++i)
             {
-                if (scene->GetUpdateTimeSpeedFactor() >= 1.0f)
+                if (i == simulationStepCount - 1)
+                {
+                    mSystems->mSceneManager.CaptureInterpolationStates();
+                }
+                
+                mSystems->mAnimationManager.Update(stepMillis);
+                clientUpdateFunction(stepMillis);
+                
+                if (i == 0)
+                {
+                    mSystems->mInputStateManager.VUpdate();
+                }
+                
+                for (auto& scene: mSystems->mSceneManager.GetScenes())
                 {
-                    scene->GetCamera().Update(gameLogicMillis * scene->GetUpdateTimeSpeedFactor());
+                    if (scene->IsLoaded())
+                    {
+                        if (scene->GetUpdateTimeSpeedFactor() >= 1.0f)
+                        {
+                            scene->GetCamera().Update(stepMillis * scene->GetUpdateTimeSpeedFactor());
+                        }
+                        mSystems->mParticleManager.UpdateSceneParticles(stepMillis * scene->GetUpdateTimeSpeedFactor(), *scene);
+                        mSystems->mSceneManager.SortSceneObjects(scene);
+                    }
                 }
-                mSystems->mParticleManager.UpdateSceneParticles(gameLogicMillis * scene->GetUpdateTimeSpeedFactor(), *scene);
-                mSystems->mSceneManager.SortSceneObjects(scene);
             }
         }
         
-        mSystems->mRenderer.VBeginRenderPass();
-        
-        for (auto& scene: mSystems->mSceneManager.GetScenes())
         {
-            if (scene->IsLoaded())
+            PROFILE_SCOPE("Rendering");
+            mSystems->mSceneManager.ApplyInterpolatedStates(sFixedTimestep.GetInterpolationAlpha());
+            mSystems->mRenderer.VBeginRenderPass();
+            
+            for (auto& scene: mSystems->mSceneManager.GetScenes())
             {
-                mSystems->mRenderer.VRenderScene(*scene);
+                if (scene->IsLoaded())
+                {
+                    mSystems->mRenderer.VRenderScene(*scene);
+                }
             }
+            
+            mSystems->mRenderer.VEndRenderPass();
+            mSystems->mSceneManager.RestoreSimulatedStates();
         }
         
-        mSystems->mRenderer.VEndRenderPass();
-        
         auto frameEndMillisDiff = static_cast<float>(SDL_GetTicks()) - currentMillisSinceInit;
         if (frameEndMillisDiff < targetFpsMillis)
         {
@@ -250,6 +297,27 @@ void CoreSystemsEngine::Start(std::function<void()> clientInitFunction, std::fun
 
 ///------------------------------------------------------------------------------------------------
 
+void CoreSystemsEngine::SetThrottledFrameTickFunction(std::function<void()>)
+{
+    // Execution is paused altogether while in the background on mobile
+}
+
+///------------------------------------------------------------------------------------------------
+
+void CoreSystemsEngine::SetSimulationStepsPerSecond(const float stepsPerSecond)
+{
+    sFixedTimestep.SetStepsPerSecond(stepsPerSecond);
+}
+
+///------------------------------------------------------------------------------------------------
+
+float CoreSystemsEngine::GetSimulationStepsPerSecond() const
+{
+    return sFixedTimestep.GetStepsPerSecond();
+}
+
+///------------------------------------------------------------------------------------------------
+
 bool CoreSystemsEngine::IsShuttingDown()
 {
     return sIsShuttingDown;
@@ -313,6 +381,13 @@ sound::SoundManager& CoreSystemsEngine::GetSoundManager()
 
 ///------------------------------------------------------------------------------------------------
 
+JobSystem& CoreSystemsEngine::GetJobSystem()
+{
+    return mSystems->mJobSystem;
+}
+
+///------------------------------------------------------------------------------------------------
+
 float CoreSystemsEngine::GetDefaultAspectRatio() const
 {
     return static_cast<float>(DEFAULT_WINDOW_WIDTH)/DEFAULT_WINDOW_HEIGHT;
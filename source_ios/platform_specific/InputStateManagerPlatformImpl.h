@@ -29,7 +29,7 @@ class InputStateManagerPlatformImpl final: public IInputStateManager
 public:
     const glm::vec2& VGetPointingPos() const override;
     const glm::ivec2& VGetScrollDelta() const override;
-    glm::vec2 VGetPointingPosInWorldSpace(const glm::mat4& viewMatrix, const glm::mat4& projMatrix) const override;
+    glm::vec2 VGetPointingPosInWorldSpace(const rendering::Camera& camera) const override;
     bool VIsTouchInputPlatform() const override;
     bool VButtonPressed(const Button button) const override;
     bool VButtonTapped(const Button button) const override;
@@ -9,12 +9,14 @@
 #include <engine/rendering/Fonts.h>
 #include <engine/rendering/OpenGL.h>
 #include <engine/rendering/CommonUniforms.h>
+#include <engine/rendering/RenderingUtils.h>
 #include <engine/resloading/MeshResource.h>
 #include <engine/resloading/ResourceLoadingService.h>
 #include <engine/resloading/ShaderResource.h>
 #include <engine/resloading/TextureResource.h>
 #include <engine/scene/Scene.h>
 #include <engine/scene/SceneObject.h>
+#include <engine/scene/SceneObjectUtils.h>
 #include <engine/utils/Logging.h>
 #include <engine/utils/StringUtils.h>
 #include <imgui/backends/imgui_impl_sdl2.h>
@@ -61,35 +63,18 @@ public:
         auto* currentMesh = &(resService.GetResource<resources::MeshResource>(mSceneObject.mMeshResourceId));
         GL_CALL(glBindVertexArray(currentMesh->GetVertexArrayObject()));
         
-        auto* currentTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mTextureResourceId));
-        GL_CALL(glActiveTexture(GL_TEXTURE0));
-        GL_CALL(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
+        rendering::BindSceneObjectTexture(mSceneObject, *currentShader);
         
-        for (int i = 0; i < scene::EFFECT_TEXTURES_COUNT; ++i)
-        {
-            if (mSceneObject.mEffectTextureResourceIds[i] != 0)
-            {
-                auto* currentEffectTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mEffectTextureResourceIds[i]));
-                GL_CALL(glActiveTexture(GL_TEXTURE1 + i));
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, currentEffectTexture->GetGLTextureId()));
-            }
-        }
+        rendering::BindSceneObjectEffectTextures(mSceneObject);
         
-        glm::mat4 world(1.0f);
-        world = glm::translate(world, mSceneObject.mPosition);
-        glm::mat4 rot(1.0f);
-        rot = glm::rotate(rot, mSceneObject.mRotation.x, math::X_AXIS);
-        rot = glm::rotate(rot, mSceneObject.mRotation.y, math::Y_AXIS);
-        rot = glm::rotate(rot, mSceneObject.mRotation.z, math::Z_AXIS);
-        world *= rot;
-        world = glm::scale(world, mSceneObject.mScale);
+        const auto& world = scene_object_utils::GetWorldMatrix(mSceneObject);
+        const auto& rot = scene_object_utils::GetWorldRotationMatrix(mSceneObject);
         
         currentShader->SetFloat(CUSTOM_ALPHA_UNIFORM_NAME, 1.0f);
         currentShader->SetBool(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME, mSceneObject.mShaderBoolUniformValues.count(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME) ? mSceneObject.mShaderBoolUniformValues.at(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME) : false);
         currentShader->SetBool(IS_TEXTURE_SHEET_UNIFORM_NAME, false);
         currentShader->SetMatrix4fv(WORLD_MATRIX_UNIFORM_NAME, world);
-        currentShader->SetMatrix4fv(VIEW_MATRIX_UNIFORM_NAME, mCamera.GetViewMatrix());
-        currentShader->SetMatrix4fv(PROJ_MATRIX_UNIFORM_NAME, mCamera.GetProjMatrix());
+        currentShader->SetCameraMatrices(mCamera.GetViewMatrix(), mCamera.GetProjMatrix(), mCamera.GetVersion());
         currentShader->SetMatrix4fv(ROT_MATRIX_UNIFORM_NAME, rot);
         
         for (const auto& vec3Entry: mSceneObject.mShaderVec3UniformValues) currentShader->SetFloatVec3(vec3Entry.first, vec3Entry.second);
@@ -97,7 +82,7 @@ public:
         for (const auto& intEntry: mSceneObject.mShaderIntUniformValues) currentShader->SetInt(intEntry.first, intEntry.second);
         for (const auto& boolEntry: mSceneObject.mShaderBoolUniformValues) currentShader->SetBool(boolEntry.first, boolEntry.second);
         
-        GL_CALL(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), GL_UNSIGNED_SHORT, (void*)0));
+        GL_CALL(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), currentMesh->GetElementType(), (void*)0));
         GL_CALL(glBindVertexArray(0));
     }
     
@@ -124,30 +109,24 @@ public:
         GL_CALL(glActiveTexture(GL_TEXTURE0));
         GL_CALL(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
         
-        for (int i = 0; i < scene::EFFECT_TEXTURES_COUNT; ++i)
-        {
-            if (mSceneObject.mEffectTextureResourceIds[i] != 0)
-            {
-                auto* currentEffectTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mEffectTextureResourceIds[i]));
-                GL_CALL(glActiveTexture(GL_TEXTURE1 + i));
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, currentEffectTexture->GetGLTextureId()));
-            }
-        }        
+        rendering::BindSceneObjectEffectTextures(mSceneObject);
         
-        float xCursor = mSceneObject.mPosition.x;
+        const auto worldPosition = scene_object_utils::GetWorldPosition(mSceneObject);
+        const auto& worldScale = scene_object_utils::GetWorldScale(mSceneObject);
+        float xCursor = worldPosition.x;
         
         const auto& stringFontGlyphs = font.FindGlyphs(sceneObjectTypeData.mText);
         for (size_t i = 0; i < stringFontGlyphs.size(); ++i)
         {
             const auto& glyph = stringFontGlyphs[i];
-            float yCursor = mSceneObject.mPosition.y - glyph.mHeightPixels/2.0f * mSceneObject.mScale.y;
+            float yCursor = worldPosition.y - glyph.mHeightPixels/2.0f * worldScale.y;
             
-            float targetX = xCursor + glyph.mXOffsetPixels * mSceneObject.mScale.x;
-            float targetY = yCursor - glyph.mYOffsetPixels * mSceneObject.mScale.y;
+            float targetX = xCursor + glyph.mXOffsetPixels * worldScale.x;
+            float targetY = yCursor - glyph.mYOffsetPixels * worldScale.y;
             
             glm::mat4 world(1.0f);
-            world = glm::translate(world, glm::vec3(targetX, targetY, mSceneObject.mPosition.z));
-            world = glm::scale(world, glm::vec3(glyph.mWidthPixels * mSceneObject.mScale.x, glyph.mHeightPixels * mSceneObject.mScale.y, 1.0f));
+            world = glm::translate(world, glm::vec3(targetX, targetY, worldPosition.z));
+            world = glm::scale(world, glm::vec3(glyph.mWidthPixels * worldScale.x, glyph.mHeightPixels * worldScale.y, 1.0f));
             
             currentShader->SetFloat(CUSTOM_ALPHA_UNIFORM_NAME, 1.0f);
             currentShader->SetBool(IS_TEXTURE_SHEET_UNIFORM_NAME, true);
@@ -156,19 +135,18 @@ public:
             currentShader->SetFloat(MAX_U_UNIFORM_NAME, glyph.maxU);
             currentShader->SetFloat(MAX_V_UNIFORM_NAME, glyph.maxV);
             currentShader->SetMatrix4fv(WORLD_MATRIX_UNIFORM_NAME, world);
-            currentShader->SetMatrix4fv(VIEW_MATRIX_UNIFORM_NAME, mCamera.GetViewMatrix());
-            currentShader->SetMatrix4fv(PROJ_MATRIX_UNIFORM_NAME, mCamera.GetProjMatrix());
+            currentShader->SetCameraMatrices(mCamera.GetViewMatrix(), mCamera.GetProjMatrix(), mCamera.GetVersion());
             
             for (const auto& vec3Entry: mSceneObject.mShaderVec3UniformValues) currentShader->SetFloatVec3(vec3Entry.first, vec3Entry.second);
             for (const auto& floatEntry: mSceneObject.mShaderFloatUniformValues) currentShader->SetFloat(floatEntry.first, floatEntry.second);
             for (const auto& intEntry: mSceneObject.mShaderIntUniformValues) currentShader->SetInt(intEntry.first, intEntry.second);
             for (const auto& boolEntry: mSceneObject.mShaderBoolUniformValues) currentShader->SetBool(boolEntry.first, boolEntry.second);
             
-            GL_CALL(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), GL_UNSIGNED_SHORT, (void*)0));
+            GL_CALL(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), currentMesh->GetElementType(), (void*)0));
 
             if (i != stringFontGlyphs.size() - 1)
             {
-                xCursor += (glyph.mAdvancePixels * mSceneObject.mScale.x)/2.0f + (stringFontGlyphs[i + 1].mAdvancePixels * mSceneObject.mScale.y)/2.0f;
+                xCursor += (glyph.mAdvancePixels * worldScale.x)/2.0f + (stringFontGlyphs[i + 1].mAdvancePixels * worldScale.y)/2.0f;
             }
         }
         
@@ -187,23 +165,12 @@ public:
             currentShader->SetInt(currentShader->GetUniformSamplerNames().at(i), static_cast<int>(i));
         }
         
-        auto* currentTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mTextureResourceId));
-        GL_CALL(glActiveTexture(GL_TEXTURE0));
-        GL_CALL(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
+        rendering::BindSceneObjectTexture(mSceneObject, *currentShader);
         
-        for (int i = 0; i < scene::EFFECT_TEXTURES_COUNT; ++i)
-        {
-            if (mSceneObject.mEffectTextureResourceIds[i] != 0)
-            {
-                auto* currentEffectTexture = &(resService.GetResource<resources::TextureResource>(mSceneObject.mEffectTextureResourceIds[i]));
-                GL_CALL(glActiveTexture(GL_TEXTURE1 + i));
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, currentEffectTexture->GetGLTextureId()));
-            }
-        }
+        rendering::BindSceneObjectEffectTextures(mSceneObject);
         
         currentShader->SetFloat(CUSTOM_ALPHA_UNIFORM_NAME, 1.0f);
-        currentShader->SetMatrix4fv(VIEW_MATRIX_UNIFORM_NAME, mCamera.GetViewMatrix());
-        currentShader->SetMatrix4fv(PROJ_MATRIX_UNIFORM_NAME, mCamera.GetProjMatrix());
+        currentShader->SetCameraMatrices(mCamera.GetViewMatrix(), mCamera.GetProjMatrix(), mCamera.GetVersion());
         
         for (const auto& vec3Entry: mSceneObject.mShaderVec3UniformValues) currentShader->SetFloatVec3(vec3Entry.first, vec3Entry.second);
         for (const auto& floatEntry: mSceneObject.mShaderFloatUniformValues) currentShader->SetFloat(floatEntry.first, floatEntry.second);
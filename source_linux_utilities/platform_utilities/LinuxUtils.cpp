@@ -0,0 +1,82 @@
+///------------------------------------------------------------------------------------------------
+///  LinuxUtils.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///-----------------------------------------------------------------------------------------------
+
+#include <platform_utilities/LinuxUtils.h>
+#include <cstdlib>
+#include <filesystem>
+#include <netdb.h>
+#include <sys/resource.h>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace linux_utils
+{
+
+///-----------------------------------------------------------------------------------------------
+
+bool IsConnectedToTheInternet()
+{
+    // A successful DNS resolution is a good enough proxy (and doesn't need any extra dependencies)
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    
+    addrinfo* result = nullptr;
+    if (getaddrinfo("www.google.com", "80", &hints, &result) != 0)
+    {
+        return false;
+    }
+    
+    freeaddrinfo(result);
+    return true;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::string GetPersistentDataDirectoryPath()
+{
+    // XDG base directory spec, falling back to ~/.local/share (or the temp directory for daemon users without a home)
+    if (const auto* xdgDataHome = std::getenv("XDG_DATA_HOME"); xdgDataHome && *xdgDataHome)
+    {
+        return std::string(xdgDataHome) + "/RealmofBeasts/";
+    }
+    
+    if (const auto* home = std::getenv("HOME"); home && *home)
+    {
+        return std::string(home) + "/.local/share/RealmofBeasts/";
+    }
+    
+    return (std::filesystem::temp_directory_path() / "RealmofBeasts").string() + "/";
+}
+
+///-----------------------------------------------------------------------------------------------
+
+double GetProcessCPUTimeSecs()
+{
+    // User + system time of all threads (std::clock is wall time on some platforms)
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec)/1000000.0;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void SetAssetFolder()
+{
+    // Resource paths are relative to the executable (same layout as the Windows build), not the
+    // directory the binary happens to be launched from (e.g. CI runners, systemd units)
+    std::error_code errorCode;
+    const auto executablePath = std::filesystem::read_symlink("/proc/self/exe", errorCode);
+    if (!errorCode)
+    {
+        std::filesystem::current_path(executablePath.parent_path(), errorCode);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
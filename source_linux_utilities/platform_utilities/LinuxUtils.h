@@ -0,0 +1,33 @@
+///------------------------------------------------------------------------------------------------
+///  LinuxUtils.h
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///-----------------------------------------------------------------------------------------------
+
+#ifndef LinuxUtils_h
+#define LinuxUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include <string>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace linux_utils
+{
+
+///-----------------------------------------------------------------------------------------------
+
+bool IsConnectedToTheInternet();
+std::string GetPersistentDataDirectoryPath();
+double GetProcessCPUTimeSecs();
+void SetAssetFolder();
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* LinuxUtils_h */
@@ -0,0 +1,110 @@
+///------------------------------------------------------------------------------------------------
+///  CameraTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/rendering/Camera.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const std::vector<glm::vec2> TEST_RENDERABLE_DIMENSIONS = { glm::vec2(1920.0f, 1080.0f), glm::vec2(1080.0f, 1920.0f), glm::vec2(1024.0f, 1024.0f), glm::vec2(2560.0f, 1080.0f) };
+static const std::vector<float> TEST_ZOOM_FACTORS = { 5.0f, 60.0f, 240.0f };
+static const std::vector<glm::vec3> TEST_CAMERA_POSITIONS = { glm::vec3(0.0f, 0.0f, -5.0f), glm::vec3(1.5f, -0.75f, -5.0f) };
+
+///------------------------------------------------------------------------------------------------
+
+TEST(CameraTests, TestScreenToWorldRoundTrips)
+{
+    for (const auto& renderableDimensions: TEST_RENDERABLE_DIMENSIONS)
+    {
+        for (const auto zoomFactor: TEST_ZOOM_FACTORS)
+        {
+            for (const auto& cameraPosition: TEST_CAMERA_POSITIONS)
+            {
+                rendering::Camera camera;
+                camera.SetZoomFactor(zoomFactor);
+                camera.SetPosition(cameraPosition);
+                camera.RecalculateMatrices(renderableDimensions);
+                
+                // Screen corners & center
+                for (const auto& screenPos: { glm::vec2(-1.0f, -1.0f), glm::vec2(1.0f, 1.0f), glm::vec2(-1.0f, 1.0f), glm::vec2(0.0f, 0.0f), glm::vec2(0.25f, -0.5f) })
+                {
+                    const auto worldPos = camera.ScreenToWorldPos(screenPos);
+                    const auto roundTripScreenPos = camera.WorldToScreenPos(glm::vec3(worldPos, 0.0f));
+                    EXPECT_NEAR(roundTripScreenPos.x, screenPos.x, 0.0001f);
+                    EXPECT_NEAR(roundTripScreenPos.y, screenPos.y, 0.0001f);
+                    
+                    // Matches the uncached inverse
+                    const auto referenceWorldPos = glm::inverse(camera.GetProjMatrix() * camera.GetViewMatrix()) * glm::vec4(screenPos.x, screenPos.y, 1.0f, 1.0f);
+                    EXPECT_NEAR(worldPos.x, referenceWorldPos.x, 0.0001f);
+                    EXPECT_NEAR(worldPos.y, referenceWorldPos.y, 0.0001f);
+                }
+                
+                // The screen center is always where the camera looks at, regardless of zoom & aspect ratio
+                const auto centerWorldPos = camera.ScreenToWorldPos(glm::vec2(0.0f));
+                EXPECT_NEAR(centerWorldPos.x, cameraPosition.x, 0.0001f);
+                EXPECT_NEAR(centerWorldPos.y, cameraPosition.y, 0.0001f);
+            }
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(CameraTests, TestVersionOnlyChangesWithMatrices)
+{
+    rendering::Camera camera;
+    rendering::Camera otherCamera;
+    EXPECT_NE(camera.GetVersion(), 0u);
+    EXPECT_NE(camera.GetVersion(), otherCamera.GetVersion());
+    
+    // Settle any aspect ratio adjustment
+    camera.RecalculateMatrices(TEST_RENDERABLE_DIMENSIONS.front());
+    camera.RecalculateMatrices(TEST_RENDERABLE_DIMENSIONS.front());
+    
+    const auto version = camera.GetVersion();
+    camera.RecalculateMatrices(TEST_RENDERABLE_DIMENSIONS.front());
+    camera.SetPosition(camera.GetPosition());
+    camera.SetZoomFactor(camera.GetZoomFactor());
+    EXPECT_EQ(camera.GetVersion(), version);
+    
+    camera.SetPosition(camera.GetPosition() + glm::vec3(0.1f, 0.0f, 0.0f));
+    EXPECT_NE(camera.GetVersion(), version);
+    
+    const auto movedVersion = camera.GetVersion();
+    camera.SetZoomFactor(camera.GetZoomFactor() * 2.0f);
+    EXPECT_NE(camera.GetVersion(), movedVersion);
+    EXPECT_NE(camera.GetVersion(), version);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(CameraTests, TestCachedMatricesAndFrustumMatchCamera)
+{
+    rendering::Camera camera;
+    camera.SetPosition(glm::vec3(2.0f, 3.0f, -5.0f));
+    camera.SetZoomFactor(30.0f);
+    
+    const auto viewProjMatrix = camera.GetProjMatrix() * camera.GetViewMatrix();
+    EXPECT_EQ(camera.GetViewProjMatrix(), viewProjMatrix);
+    
+    const auto identity = camera.GetInverseViewProjMatrix() * camera.GetViewProjMatrix();
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            EXPECT_NEAR(identity[i][j], i == j ? 1.0f : 0.0f, 0.0001f);
+        }
+    }
+    
+    // The point the camera looks at is inside the frustum, whereas a far away one is not
+    int breachedSideIndex = 0;
+    EXPECT_TRUE(math::IsMeshAtLeastPartlyInsideFrustum(glm::vec3(2.0f, 3.0f, 0.0f), glm::vec3(1.0f), glm::vec3(0.0f), camera.GetFrustum(), breachedSideIndex));
+    EXPECT_FALSE(math::IsMeshAtLeastPartlyInsideFrustum(glm::vec3(200.0f, 3.0f, 0.0f), glm::vec3(1.0f), glm::vec3(0.0f), camera.GetFrustum(), breachedSideIndex));
+}
+
+///------------------------------------------------------------------------------------------------
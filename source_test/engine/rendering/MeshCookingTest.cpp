@@ -0,0 +1,231 @@
+///------------------------------------------------------------------------------------------------
+///  MeshCookingTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <engine/rendering/MeshCooking.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <tuple>
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string TEST_COOKED_MESH_PATH = (std::filesystem::temp_directory_path() / "mesh_cooking_test.tmmesh").string();
+
+static const std::string QUAD_OBJ_CONTENTS =
+    "# www.blender.org\n"
+    "v -0.5 -0.5 -0.0\n"
+    "v 0.5 -0.5 -0.0\n"
+    "v -0.5 0.5 -0.0\n"
+    "v 0.5 0.5 -0.0\n"
+    "vt 1.0 0.0\n"
+    "vt 0.0 1.0\n"
+    "vt 0.0 0.0\n"
+    "vt 1.0 1.0\n"
+    "vn 0.0000 -0.0000 1.0000\n"
+    "s off\n"
+    "f 2/1/1 3/2/1 1/3/1\n"
+    "f 2/1/1 4/4/1 3/2/1\n";
+
+///------------------------------------------------------------------------------------------------
+
+static std::string CreateGridOBJContents(const int quadsPerSide, const bool shuffleFaces)
+{
+    std::stringstream objContents;
+    for (int y = 0; y <= quadsPerSide; ++y)
+    {
+        for (int x = 0; x <= quadsPerSide; ++x)
+        {
+            objContents << "v " << x << " " << y << " 0.0\n";
+            objContents << "vt " << static_cast<float>(x)/quadsPerSide << " " << static_cast<float>(y)/quadsPerSide << "\n";
+        }
+    }
+    objContents << "vn 0.0 0.0 1.0\n";
+
+    std::vector<std::string> faces;
+    for (int y = 0; y < quadsPerSide; ++y)
+    {
+        for (int x = 0; x < quadsPerSide; ++x)
+        {
+            const auto bottomLeft = y * (quadsPerSide + 1) + x + 1;
+            const auto bottomRight = bottomLeft + 1;
+            const auto topLeft = bottomLeft + quadsPerSide + 1;
+            const auto topRight = topLeft + 1;
+            faces.push_back("f " + std::to_string(bottomLeft) + "/" + std::to_string(bottomLeft) + "/1 " + std::to_string(bottomRight) + "/" + std::to_string(bottomRight) + "/1 " + std::to_string(topRight) + "/" + std::to_string(topRight) + "/1\n");
+            faces.push_back("f " + std::to_string(bottomLeft) + "/" + std::to_string(bottomLeft) + "/1 " + std::to_string(topRight) + "/" + std::to_string(topRight) + "/1 " + std::to_string(topLeft) + "/" + std::to_string(topLeft) + "/1\n");
+        }
+    }
+
+    if (shuffleFaces)
+    {
+        std::mt19937 randomEngine(7);
+        std::shuffle(faces.begin(), faces.end(), randomEngine);
+    }
+
+    for (const auto& face: faces)
+    {
+        objContents << face;
+    }
+
+    return objContents.str();
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<glm::vec3> GetTriangleCorners(const rendering::CookedMesh& mesh)
+{
+    std::vector<glm::vec3> corners;
+    for (const auto index: mesh.mIndices)
+    {
+        corners.push_back(mesh.mPositions[index]);
+    }
+    return corners;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MeshCookingTests, TestOBJImportDeduplicatesVerticesAndHandlesAllFaceFormats)
+{
+    rendering::CookedMesh quadMesh;
+    ASSERT_TRUE(rendering::ImportOBJMesh(QUAD_OBJ_CONTENTS.data(), QUAD_OBJ_CONTENTS.size(), quadMesh));
+
+    // 6 face corners, 4 unique vertices
+    EXPECT_EQ(quadMesh.mPositions.size(), 4u);
+    EXPECT_EQ(quadMesh.mIndices.size(), 6u);
+    EXPECT_FLOAT_EQ(quadMesh.mDimensions.x, 1.0f);
+    EXPECT_FLOAT_EQ(quadMesh.mDimensions.y, 1.0f);
+    EXPECT_FLOAT_EQ(quadMesh.mDimensions.z, 0.0f);
+
+    // First corner of the first face: v 2, vt 1, vn 1
+    EXPECT_EQ(quadMesh.mPositions[quadMesh.mIndices[0]], glm::vec3(0.5f, -0.5f, 0.0f));
+    EXPECT_EQ(quadMesh.mTexCoords[quadMesh.mIndices[0]], glm::vec2(1.0f, 0.0f));
+    EXPECT_EQ(quadMesh.mNormals[quadMesh.mIndices[0]], glm::vec3(0.0f, 0.0f, 1.0f));
+
+    // Quad polygon with position only, position//normal and negative index corners, CRLF line endings
+    const std::string polygonOBJContents = "v 0 0 0\r\nv 1 0 0\r\nv 1 1 0\r\nv 0 1 0\r\nvn 0 0 1\r\nf 1//1 2//1 -2//1 -1//1\r\nf 1 2 3\r\n";
+    rendering::CookedMesh polygonMesh;
+    ASSERT_TRUE(rendering::ImportOBJMesh(polygonOBJContents.data(), polygonOBJContents.size(), polygonMesh));
+    EXPECT_EQ(polygonMesh.mIndices.size(), 9u);
+    EXPECT_EQ(polygonMesh.mPositions.size(), 7u);
+    EXPECT_EQ(polygonMesh.mPositions[polygonMesh.mIndices[5]], glm::vec3(0.0f, 1.0f, 0.0f));
+    EXPECT_EQ(polygonMesh.mTexCoords[polygonMesh.mIndices[5]], glm::vec2(0.0f));
+
+    // Out of range indices are rejected
+    const std::string invalidOBJContents = "v 0 0 0\nv 1 0 0\nf 1 2 3\n";
+    rendering::CookedMesh invalidMesh;
+    EXPECT_FALSE(rendering::ImportOBJMesh(invalidOBJContents.data(), invalidOBJContents.size(), invalidMesh));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MeshCookingTests, TestVertexCacheOptimizationLowersCacheMissesAndPreservesTriangles)
+{
+    const auto gridOBJContents = CreateGridOBJContents(64, true);
+    rendering::CookedMesh gridMesh;
+    ASSERT_TRUE(rendering::ImportOBJMesh(gridOBJContents.data(), gridOBJContents.size(), gridMesh));
+    EXPECT_EQ(gridMesh.mPositions.size(), 65u * 65u);
+
+    auto originalCorners = GetTriangleCorners(gridMesh);
+    const auto originalCacheMissRatio = rendering::ComputeAverageCacheMissRatio(gridMesh.mIndices, gridMesh.mPositions.size(), 16);
+
+    rendering::OptimizeVertexCache(gridMesh);
+    const auto optimizedCacheMissRatio = rendering::ComputeAverageCacheMissRatio(gridMesh.mIndices, gridMesh.mPositions.size(), 16);
+
+    // Randomly ordered triangles transform close to 1.5 vertices each, a well optimized grid stays well under 1
+    EXPECT_GT(originalCacheMissRatio, 1.2f);
+    EXPECT_LT(optimizedCacheMissRatio, 0.8f);
+
+    // Same set of triangles (with their winding), with vertices laid out in first use order
+    EXPECT_EQ(gridMesh.mPositions.size(), 65u * 65u);
+    auto optimizedCorners = GetTriangleCorners(gridMesh);
+    auto toTriangleKeys = [](const std::vector<glm::vec3>& corners)
+    {
+        std::vector<std::string> triangleKeys;
+        for (size_t i = 0; i < corners.size(); i += 3)
+        {
+            // Rotate so that the smallest corner comes first, which preserves winding
+            std::array<glm::vec3, 3> triangle = { corners[i], corners[i + 1], corners[i + 2] };
+            auto less = [](const glm::vec3& lhs, const glm::vec3& rhs) { return std::tie(lhs.x, lhs.y, lhs.z) < std::tie(rhs.x, rhs.y, rhs.z); };
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end(), less), triangle.end());
+
+            std::stringstream triangleKey;
+            for (const auto& corner: triangle) triangleKey << corner.x << "," << corner.y << "," << corner.z << ";";
+            triangleKeys.push_back(triangleKey.str());
+        }
+        std::sort(triangleKeys.begin(), triangleKeys.end());
+        return triangleKeys;
+    };
+    EXPECT_EQ(toTriangleKeys(originalCorners), toTriangleKeys(optimizedCorners));
+
+    uint32_t nextExpectedNewVertex = 0;
+    for (const auto index: gridMesh.mIndices)
+    {
+        ASSERT_LE(index, nextExpectedNewVertex);
+        if (index == nextExpectedNewVertex) nextExpectedNewVertex++;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MeshCookingTests, TestCookedMeshFileRoundTripsWithSixteenAndThirtyTwoBitIndices)
+{
+    for (const auto quadsPerSide: { 8, 300 })
+    {
+        const auto gridOBJContents = CreateGridOBJContents(quadsPerSide, false);
+        rendering::CookedMesh gridMesh;
+        ASSERT_TRUE(rendering::ImportOBJMesh(gridOBJContents.data(), gridOBJContents.size(), gridMesh));
+        rendering::OptimizeVertexCache(gridMesh);
+
+        ASSERT_TRUE(rendering::WriteCookedMesh(TEST_COOKED_MESH_PATH, gridMesh));
+
+        std::ifstream cookedMeshFile(TEST_COOKED_MESH_PATH, std::ios::binary);
+        const std::string cookedMeshFileContents((std::istreambuf_iterator<char>(cookedMeshFile)), std::istreambuf_iterator<char>());
+
+        rendering::CookedMeshView view;
+        ASSERT_TRUE(rendering::ParseCookedMesh(cookedMeshFileContents.data(), cookedMeshFileContents.size(), view));
+
+        // 301x301 vertices don't fit in 16 bit indices
+        const auto expectedIndexSize = gridMesh.mPositions.size() > 65536 ? 4u : 2u;
+        EXPECT_EQ(view.mIndexSize, expectedIndexSize);
+        EXPECT_EQ(view.mVertexCount, gridMesh.mPositions.size());
+        EXPECT_EQ(view.mIndexCount, gridMesh.mIndices.size());
+        EXPECT_EQ(view.mDimensions, gridMesh.mDimensions);
+        EXPECT_EQ(std::memcmp(view.mPositions, gridMesh.mPositions.data(), gridMesh.mPositions.size() * sizeof(glm::vec3)), 0);
+        EXPECT_EQ(std::memcmp(view.mTexCoords, gridMesh.mTexCoords.data(), gridMesh.mTexCoords.size() * sizeof(glm::vec2)), 0);
+        EXPECT_EQ(std::memcmp(view.mNormals, gridMesh.mNormals.data(), gridMesh.mNormals.size() * sizeof(glm::vec3)), 0);
+
+        for (size_t i = 0; i < gridMesh.mIndices.size(); ++i)
+        {
+            uint32_t index = 0;
+            if (view.mIndexSize == 2)
+            {
+                uint16_t shortIndex;
+                std::memcpy(&shortIndex, view.mIndices + i * 2, 2);
+                index = shortIndex;
+            }
+            else
+            {
+                std::memcpy(&index, view.mIndices + i * 4, 4);
+            }
+            ASSERT_EQ(index, gridMesh.mIndices[i]);
+        }
+
+        // Truncated/corrupted files are rejected
+        EXPECT_FALSE(rendering::ParseCookedMesh(cookedMeshFileContents.data(), cookedMeshFileContents.size() / 2, view));
+        auto corruptedContents = cookedMeshFileContents;
+        corruptedContents[0] = 'X';
+        EXPECT_FALSE(rendering::ParseCookedMesh(corruptedContents.data(), corruptedContents.size(), view));
+    }
+
+    std::filesystem::remove(TEST_COOKED_MESH_PATH);
+}
+
+///------------------------------------------------------------------------------------------------
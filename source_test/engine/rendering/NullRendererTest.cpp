@@ -0,0 +1,128 @@
+///------------------------------------------------------------------------------------------------
+///  NullRendererTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/rendering/NullRenderer.h>
+#include <engine/scene/Scene.h>
+#include <engine/scene/SceneObject.h>
+
+///------------------------------------------------------------------------------------------------
+
+static const size_t TEST_PARTICLE_COUNT = 10;
+
+///------------------------------------------------------------------------------------------------
+
+static void PopulateTestScene(scene::Scene& testScene)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        auto sceneObject = testScene.CreateSceneObject();
+        sceneObject->mPosition.z = static_cast<float>(i);
+    }
+
+    auto invisibleSceneObject = testScene.CreateSceneObject();
+    invisibleSceneObject->mInvisible = true;
+
+    auto deferredSceneObject = testScene.CreateSceneObject();
+    deferredSceneObject->mDeferredRendering = true;
+
+    scene::ParticleEmitterObjectData particleEmitterData = {};
+    particleEmitterData.mParticleCount = TEST_PARTICLE_COUNT;
+    particleEmitterData.mParticlePositions.resize(TEST_PARTICLE_COUNT);
+    particleEmitterData.mParticleLifetimeSecs.resize(TEST_PARTICLE_COUNT);
+    particleEmitterData.mParticleSizes.resize(TEST_PARTICLE_COUNT);
+    particleEmitterData.mParticleAngles.resize(TEST_PARTICLE_COUNT);
+
+    auto particleEmitterSceneObject = testScene.CreateSceneObject();
+    particleEmitterSceneObject->mSceneObjectTypeData = std::move(particleEmitterData);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(NullRendererTests, TestSceneWalkRecordsDrawCallsAndStreamedBuffers)
+{
+    scene::Scene testScene(strutils::StringId("null_renderer_test"));
+    PopulateTestScene(testScene);
+
+    rendering::NullRenderer renderer;
+    renderer.VInitialize();
+
+    renderer.VBeginRenderPass();
+    renderer.VRenderScene(testScene);
+
+    // 3 default objects & the particle emitter (the invisible one is skipped, the deferred one waits for the end of the pass)
+    EXPECT_EQ(renderer.GetCurrentFrameStats().mDrawCalls, 4u);
+    EXPECT_EQ(renderer.GetFrameCount(), 0u);
+
+    renderer.VEndRenderPass();
+
+    const auto& stats = renderer.GetLastFrameStats();
+    EXPECT_EQ(renderer.GetFrameCount(), 1u);
+    EXPECT_EQ(stats.mDrawCalls, 5u);
+    EXPECT_EQ(stats.mDrawnInstances, TEST_PARTICLE_COUNT);
+    EXPECT_EQ(stats.mBufferUploadBytes, TEST_PARTICLE_COUNT * (sizeof(glm::vec3) + 3 * sizeof(float)));
+    EXPECT_EQ(stats.mShaderBinds, 5u);
+    EXPECT_EQ(stats.mTextureBinds, 5u);
+
+    // Mesh VAOs for the 4 default objects, and the particle emitter's own (bound & unbound)
+    EXPECT_EQ(stats.mVertexArrayBinds, 6u);
+    EXPECT_EQ(stats.GetStateChanges(), stats.mShaderBinds + stats.mTextureBinds + stats.mVertexArrayBinds);
+
+    // All objects share the default shader & texture
+    EXPECT_GE(stats.mRedundantStateChanges, 8u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(NullRendererTests, TestFramesAreRecordedIndependentlyAndTrackUniformUploads)
+{
+    scene::Scene testScene(strutils::StringId("null_renderer_test"));
+    PopulateTestScene(testScene);
+
+    rendering::NullRenderer renderer;
+    renderer.VInitialize();
+
+    renderer.VBeginRenderPass();
+    renderer.VRenderScene(testScene);
+    renderer.VEndRenderPass();
+    const auto firstFrameStats = renderer.GetLastFrameStats();
+
+    // Identical frames record identical stats, except for the view & projection matrices which the (shared) shader
+    // already received in the first frame and only gets again once the camera changes
+    renderer.VBeginRenderPass();
+    renderer.VRenderScene(testScene);
+    renderer.VEndRenderPass();
+    const auto steadyCameraFrameStats = renderer.GetLastFrameStats();
+    EXPECT_EQ(steadyCameraFrameStats.mDrawCalls, firstFrameStats.mDrawCalls);
+    EXPECT_EQ(steadyCameraFrameStats.mUniformUploads, firstFrameStats.mUniformUploads - 2);
+    EXPECT_EQ(steadyCameraFrameStats.mBufferUploadBytes, firstFrameStats.mBufferUploadBytes);
+
+    testScene.GetCamera().SetPosition(testScene.GetCamera().GetPosition() + glm::vec3(1.0f, 0.0f, 0.0f));
+
+    renderer.VBeginRenderPass();
+    renderer.VRenderScene(testScene);
+    renderer.VEndRenderPass();
+    EXPECT_EQ(renderer.GetLastFrameStats().mUniformUploads, firstFrameStats.mUniformUploads);
+
+    // Every custom uniform is an extra upload per frame
+    testScene.GetSceneObjects().front()->mShaderFloatUniformValues[strutils::StringId("custom_float")] = 1.0f;
+    testScene.GetSceneObjects().front()->mShaderVec3UniformValues[strutils::StringId("custom_vec3")] = glm::vec3(1.0f);
+
+    renderer.VBeginRenderPass();
+    renderer.VRenderScene(testScene);
+    renderer.VEndRenderPass();
+    EXPECT_EQ(renderer.GetLastFrameStats().mUniformUploads, steadyCameraFrameStats.mUniformUploads + 2);
+    EXPECT_EQ(renderer.GetFrameCount(), 4u);
+
+    // Rendering to texture skips neither invisible nor deferred objects
+    renderer.VBeginRenderPass();
+    renderer.VRenderSceneObjectsToTexture(testScene.GetSceneObjects(), testScene.GetCamera());
+    EXPECT_EQ(renderer.GetCurrentFrameStats().mDrawCalls, 6u);
+    renderer.VEndRenderPass();
+}
+
+///------------------------------------------------------------------------------------------------
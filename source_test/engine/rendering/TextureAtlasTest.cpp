@@ -0,0 +1,178 @@
+///------------------------------------------------------------------------------------------------
+///  TextureAtlasTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/rendering/TextureAtlas.h>
+#include <cmath>
+#include <random>
+
+///------------------------------------------------------------------------------------------------
+
+static constexpr int TEST_PAGE_SIZE = 512;
+static constexpr int TEST_PADDING = 2;
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<unsigned char> CreateTestImage(const int imageIndex, const int width, const int height)
+{
+    // Every texel is unique across all test images
+    std::vector<unsigned char> pixels(static_cast<size_t>(width) * height * 4);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            auto* texel = &pixels[(static_cast<size_t>(y) * width + x) * 4];
+            texel[0] = static_cast<unsigned char>(x);
+            texel[1] = static_cast<unsigned char>(y);
+            texel[2] = static_cast<unsigned char>(imageIndex);
+            texel[3] = 255;
+        }
+    }
+    return pixels;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static const unsigned char* SampleNearest(const std::vector<unsigned char>& page, const glm::vec2& uv)
+{
+    const auto x = static_cast<int>(std::floor(uv.x * TEST_PAGE_SIZE));
+    const auto y = static_cast<int>(std::floor(uv.y * TEST_PAGE_SIZE));
+    return &page[(static_cast<size_t>(y) * TEST_PAGE_SIZE + x) * 4];
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TextureAtlasTests, TestPackingEfficiencyOfSpriteSheetsAndSmallTextures)
+{
+    rendering::TextureAtlasBuilder builder(TEST_PAGE_SIZE, TEST_PADDING);
+
+    // Mirrors the sprites atlas: character animation sheets plus small fx/debug textures
+    auto imageIndex = 0;
+    for (int i = 0; i < 25; ++i, ++imageIndex) EXPECT_TRUE(builder.AddImage("sheet_" + std::to_string(i), CreateTestImage(imageIndex, 96, 160).data(), 96, 160));
+    EXPECT_TRUE(builder.AddImage("fireball_fx", CreateTestImage(imageIndex++, 16, 16).data(), 16, 16));
+    EXPECT_TRUE(builder.AddImage("debug_square", CreateTestImage(imageIndex++, 16, 16).data(), 16, 16));
+    EXPECT_TRUE(builder.AddImage("debug_circle", CreateTestImage(imageIndex++, 64, 64).data(), 64, 64));
+    builder.Build();
+
+    EXPECT_EQ(builder.GetManifest().size(), 28u);
+    EXPECT_EQ(builder.GetPages().size(), 2u);
+    EXPECT_GT(builder.GetPackingEfficiency(), 0.7f);
+
+    // Many differently sized small images (UI/particles)
+    rendering::TextureAtlasBuilder mixedBuilder(TEST_PAGE_SIZE, TEST_PADDING);
+    std::mt19937 randomEngine(1337);
+    std::uniform_int_distribution<int> sizeDistribution(8, 64);
+    for (int i = 0; i < 300; ++i)
+    {
+        const auto width = sizeDistribution(randomEngine);
+        const auto height = sizeDistribution(randomEngine);
+        EXPECT_TRUE(mixedBuilder.AddImage("image_" + std::to_string(i), CreateTestImage(i, width, height).data(), width, height));
+    }
+    mixedBuilder.Build();
+
+    EXPECT_EQ(mixedBuilder.GetManifest().size(), 300u);
+    EXPECT_GT(mixedBuilder.GetPackingEfficiency(), 0.75f);
+
+    // Images that can never fit in a page are rejected
+    EXPECT_FALSE(mixedBuilder.AddImage("too_big", CreateTestImage(0, TEST_PAGE_SIZE, 16).data(), TEST_PAGE_SIZE, 16));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TextureAtlasTests, TestPaddedRegionsStayInsidePagesAndNeverOverlap)
+{
+    rendering::TextureAtlasBuilder builder(TEST_PAGE_SIZE, TEST_PADDING);
+    std::mt19937 randomEngine(42);
+    std::uniform_int_distribution<int> sizeDistribution(1, 200);
+    for (int i = 0; i < 150; ++i)
+    {
+        const auto width = sizeDistribution(randomEngine);
+        const auto height = sizeDistribution(randomEngine);
+        builder.AddImage("image_" + std::to_string(i), CreateTestImage(i, width, height).data(), width, height);
+    }
+    builder.Build();
+
+    std::vector<std::vector<int>> pageOwners(builder.GetPages().size(), std::vector<int>(TEST_PAGE_SIZE * TEST_PAGE_SIZE, -1));
+    auto regionIndex = 0;
+    for (const auto& [name, region]: builder.GetManifest())
+    {
+        ASSERT_LT(region.mPageIndex, static_cast<int>(pageOwners.size()));
+        const auto minX = region.mPixelRect.x - TEST_PADDING;
+        const auto minY = region.mPixelRect.y - TEST_PADDING;
+        const auto maxX = region.mPixelRect.x + region.mPixelRect.z + TEST_PADDING;
+        const auto maxY = region.mPixelRect.y + region.mPixelRect.w + TEST_PADDING;
+        ASSERT_GE(minX, 0);
+        ASSERT_GE(minY, 0);
+        ASSERT_LE(maxX, TEST_PAGE_SIZE);
+        ASSERT_LE(maxY, TEST_PAGE_SIZE);
+
+        for (int y = minY; y < maxY; ++y)
+        {
+            for (int x = minX; x < maxX; ++x)
+            {
+                auto& owner = pageOwners[region.mPageIndex][y * TEST_PAGE_SIZE + x];
+                ASSERT_EQ(owner, -1) << name << " overlaps another region at " << x << "," << y;
+                owner = regionIndex;
+            }
+        }
+        regionIndex++;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TextureAtlasTests, TestUVRectsSampleTheOriginalImageTexels)
+{
+    struct TestImage { int mWidth; int mHeight; };
+    const std::vector<TestImage> testImages = { {96, 160}, {16, 16}, {64, 64}, {37, 5}, {1, 1}, {128, 33}, {96, 160}, {200, 100} };
+
+    rendering::TextureAtlasBuilder builder(TEST_PAGE_SIZE, TEST_PADDING);
+    for (size_t i = 0; i < testImages.size(); ++i)
+    {
+        builder.AddImage("image_" + std::to_string(i), CreateTestImage(static_cast<int>(i), testImages[i].mWidth, testImages[i].mHeight).data(), testImages[i].mWidth, testImages[i].mHeight);
+    }
+    builder.Build();
+
+    for (size_t i = 0; i < testImages.size(); ++i)
+    {
+        const auto& region = builder.GetManifest().at("image_" + std::to_string(i));
+        const auto& page = builder.GetPages()[region.mPageIndex];
+        const auto width = testImages[i].mWidth;
+        const auto height = testImages[i].mHeight;
+
+        EXPECT_EQ(region.mPixelRect.z, width);
+        EXPECT_EQ(region.mPixelRect.w, height);
+
+        // Texel centers of the original image land on the same texels in the page
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const auto localUv = glm::vec2((x + 0.5f)/width, (y + 0.5f)/height);
+                const auto atlasUv = glm::vec2(region.mUVRect.x, region.mUVRect.y) + localUv * glm::vec2(region.mUVRect.z, region.mUVRect.w);
+                const auto* texel = SampleNearest(page, atlasUv);
+
+                ASSERT_EQ(texel[0], static_cast<unsigned char>(x));
+                ASSERT_EQ(texel[1], static_cast<unsigned char>(y));
+                ASSERT_EQ(texel[2], static_cast<unsigned char>(i));
+            }
+        }
+
+        // The full local [0,1] range stays within the image (+ its edge replicating padding)
+        const auto* bottomLeftEdgeTexel = SampleNearest(page, glm::vec2(region.mUVRect.x, region.mUVRect.y) - glm::vec2(0.5f/TEST_PAGE_SIZE));
+        EXPECT_EQ(bottomLeftEdgeTexel[0], 0);
+        EXPECT_EQ(bottomLeftEdgeTexel[1], 0);
+        EXPECT_EQ(bottomLeftEdgeTexel[2], static_cast<unsigned char>(i));
+
+        const auto* topRightEdgeTexel = SampleNearest(page, glm::vec2(region.mUVRect.x + region.mUVRect.z, region.mUVRect.y + region.mUVRect.w));
+        EXPECT_EQ(topRightEdgeTexel[0], static_cast<unsigned char>(width - 1));
+        EXPECT_EQ(topRightEdgeTexel[1], static_cast<unsigned char>(height - 1));
+        EXPECT_EQ(topRightEdgeTexel[2], static_cast<unsigned char>(i));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,253 @@
+///------------------------------------------------------------------------------------------------
+///  TextureCookingTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <engine/rendering/TextureCooking.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string TEST_COOKED_TEXTURE_PATH = (std::filesystem::temp_directory_path() / "texture_cooking_test.bc3.tmtex").string();
+
+///------------------------------------------------------------------------------------------------
+/// Reference decoders (straight from the format specs) to validate the encoders against.
+///------------------------------------------------------------------------------------------------
+
+static void DecodeBC3Block(const unsigned char* block, unsigned char* outBlockRGBAPixels)
+{
+    const int a0 = block[0], a1 = block[1];
+    int alphaPalette[8] = { a0, a1 };
+    if (a0 > a1) for (int k = 2; k < 8; ++k) alphaPalette[k] = ((8 - k) * a0 + (k - 1) * a1) / 7;
+    else { for (int k = 2; k < 6; ++k) alphaPalette[k] = ((6 - k) * a0 + (k - 1) * a1) / 5; alphaPalette[6] = 0; alphaPalette[7] = 255; }
+
+    uint64_t alphaIndices = 0;
+    for (int b = 0; b < 6; ++b) alphaIndices |= static_cast<uint64_t>(block[2 + b]) << (8 * b);
+
+    const auto ExpandColor = [](const int color565, int* outRGB)
+    {
+        outRGB[0] = (((color565 >> 11) & 0x1F) << 3) | (((color565 >> 11) & 0x1F) >> 2);
+        outRGB[1] = (((color565 >> 5) & 0x3F) << 2) | (((color565 >> 5) & 0x3F) >> 4);
+        outRGB[2] = ((color565 & 0x1F) << 3) | ((color565 & 0x1F) >> 2);
+    };
+
+    int colorPalette[4][3];
+    ExpandColor(block[8] | (block[9] << 8), colorPalette[0]);
+    ExpandColor(block[10] | (block[11] << 8), colorPalette[1]);
+    for (int c = 0; c < 3; ++c)
+    {
+        colorPalette[2][c] = (2 * colorPalette[0][c] + colorPalette[1][c]) / 3;
+        colorPalette[3][c] = (colorPalette[0][c] + 2 * colorPalette[1][c]) / 3;
+    }
+    const uint32_t colorIndices = block[12] | (block[13] << 8) | (block[14] << 16) | (static_cast<uint32_t>(block[15]) << 24);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        for (int c = 0; c < 3; ++c) outBlockRGBAPixels[i * 4 + c] = static_cast<unsigned char>(colorPalette[(colorIndices >> (2 * i)) & 0x3][c]);
+        outBlockRGBAPixels[i * 4 + 3] = static_cast<unsigned char>(alphaPalette[(alphaIndices >> (3 * i)) & 0x7]);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void DecodeETC2RGBA8Block(const unsigned char* block, unsigned char* outBlockRGBAPixels)
+{
+    static constexpr int EAC_TABLES[16][8] =
+    {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+    static constexpr int ETC_TABLES[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+    uint64_t alphaIndices = 0;
+    for (int b = 0; b < 6; ++b) alphaIndices = (alphaIndices << 8) | block[2 + b];
+
+    const auto* colorBlock = block + 8;
+    const auto isDifferential = (colorBlock[3] & 0x2) != 0;
+    const auto isFlipped = (colorBlock[3] & 0x1) != 0;
+    const int tables[2] = { colorBlock[3] >> 5, (colorBlock[3] >> 2) & 0x7 };
+
+    int baseColors[2][3];
+    for (int c = 0; c < 3; ++c)
+    {
+        if (isDifferential)
+        {
+            const auto first = colorBlock[c] >> 3;
+            const auto delta = (colorBlock[c] & 0x4) ? static_cast<int>(colorBlock[c] & 0x7) - 8 : static_cast<int>(colorBlock[c] & 0x7);
+            const auto second = first + delta;
+            baseColors[0][c] = (first << 3) | (first >> 2);
+            baseColors[1][c] = (second << 3) | (second >> 2);
+        }
+        else
+        {
+            baseColors[0][c] = (colorBlock[c] >> 4) * 17;
+            baseColors[1][c] = (colorBlock[c] & 0xF) * 17;
+        }
+    }
+
+    const auto msbs = (colorBlock[4] << 8) | colorBlock[5];
+    const auto lsbs = (colorBlock[6] << 8) | colorBlock[7];
+    for (int i = 0; i < 16; ++i)
+    {
+        const auto x = i / 4, y = i % 4;
+        const auto subblock = isFlipped ? (y < 2 ? 0 : 1) : (x < 2 ? 0 : 1);
+        const auto modifierIndex = (((msbs >> i) & 1) << 1) | ((lsbs >> i) & 1);
+        const int modifiers[4] = { ETC_TABLES[tables[subblock]][0], ETC_TABLES[tables[subblock]][1], -ETC_TABLES[tables[subblock]][0], -ETC_TABLES[tables[subblock]][1] };
+
+        auto* texel = &outBlockRGBAPixels[(y * 4 + x) * 4];
+        for (int c = 0; c < 3; ++c) texel[c] = static_cast<unsigned char>(std::clamp(baseColors[subblock][c] + modifiers[modifierIndex], 0, 255));
+
+        const auto alphaIndex = static_cast<int>((alphaIndices >> (45 - 3 * i)) & 0x7);
+        texel[3] = static_cast<unsigned char>(std::clamp(block[0] + EAC_TABLES[block[1] & 0xF][alphaIndex] * (block[1] >> 4), 0, 255));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<unsigned char> CreateTestBlock(const bool hasAlphaGradient)
+{
+    std::vector<unsigned char> blockRGBAPixels(64);
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            auto* texel = &blockRGBAPixels[(y * 4 + x) * 4];
+            texel[0] = static_cast<unsigned char>(40 + x * 12);
+            texel[1] = static_cast<unsigned char>(120 + y * 10);
+            texel[2] = static_cast<unsigned char>(60 + (x + y) * 5);
+            texel[3] = static_cast<unsigned char>(hasAlphaGradient ? x * 85 : 255);
+        }
+    }
+    return blockRGBAPixels;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static int GetMaxChannelError(const std::vector<unsigned char>& sourceBlockRGBAPixels, const unsigned char* decodedBlockRGBAPixels)
+{
+    auto maxChannelError = 0;
+    for (size_t i = 0; i < sourceBlockRGBAPixels.size(); ++i)
+    {
+        // The color of fully transparent texels is free to be anything
+        const auto isColorChannel = i % 4 != 3;
+        if (isColorChannel && sourceBlockRGBAPixels[i - i % 4 + 3] == 0)
+        {
+            continue;
+        }
+        maxChannelError = std::max(maxChannelError, std::abs(static_cast<int>(sourceBlockRGBAPixels[i]) - static_cast<int>(decodedBlockRGBAPixels[i])));
+    }
+    return maxChannelError;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TextureCookingTests, TestMipChainHalvesDownToOneByOneWithAlphaWeightedColors)
+{
+    // Left column opaque red, right column fully transparent green
+    const unsigned char pixels[] =
+    {
+        255, 0, 0, 255,    0, 255, 0, 0,
+        255, 0, 0, 255,    0, 255, 0, 0
+    };
+
+    const auto mipChain = rendering::GenerateMipChain(pixels, 2, 2);
+    ASSERT_EQ(mipChain.size(), 2u);
+    EXPECT_EQ(mipChain[1].mWidth, 1);
+    EXPECT_EQ(mipChain[1].mHeight, 1);
+
+    // Transparent texels don't bleed their color into the lower level
+    EXPECT_EQ(mipChain[1].mData[0], 255);
+    EXPECT_EQ(mipChain[1].mData[1], 0);
+    EXPECT_EQ(mipChain[1].mData[3], 128);
+
+    std::vector<unsigned char> largePixels(1024 * 512 * 4, 255);
+    const auto largeMipChain = rendering::GenerateMipChain(largePixels.data(), 1024, 512);
+    EXPECT_EQ(largeMipChain.size(), 11u);
+    EXPECT_EQ(largeMipChain.back().mWidth, 1);
+    EXPECT_EQ(largeMipChain.back().mHeight, 1);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TextureCookingTests, TestCompressedBlocksDecodeCloseToSource)
+{
+    for (const auto format: { rendering::CookedTextureFormat::BC3, rendering::CookedTextureFormat::ETC2_RGBA8 })
+    {
+        for (const auto hasAlphaGradient: { false, true })
+        {
+            const auto blockRGBAPixels = CreateTestBlock(hasAlphaGradient);
+
+            unsigned char compressedBlock[rendering::COMPRESSED_TEXTURE_BLOCK_BYTES];
+            rendering::CompressTextureBlock(blockRGBAPixels.data(), format, compressedBlock);
+
+            unsigned char decodedBlockRGBAPixels[64];
+            if (format == rendering::CookedTextureFormat::BC3)
+            {
+                DecodeBC3Block(compressedBlock, decodedBlockRGBAPixels);
+            }
+            else
+            {
+                DecodeETC2RGBA8Block(compressedBlock, decodedBlockRGBAPixels);
+            }
+
+            EXPECT_LE(GetMaxChannelError(blockRGBAPixels, decodedBlockRGBAPixels), 24);
+            if (!hasAlphaGradient)
+            {
+                for (int i = 0; i < 16; ++i) EXPECT_EQ(decodedBlockRGBAPixels[i * 4 + 3], 255);
+            }
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TextureCookingTests, TestCookedTextureFileRoundTripsAndRejectsCorruption)
+{
+    std::vector<unsigned char> pixels(16 * 16 * 4, 200);
+    const auto cookedTexture = rendering::CookTexture(pixels.data(), 16, 16, rendering::CookedTextureFormat::BC3, false);
+    ASSERT_EQ(cookedTexture.mMipLevels.size(), 5u);
+
+    // 16x16, 8x8, 4x4 and two sub-block levels that still take up a full block
+    EXPECT_EQ(rendering::GetCookedTextureMemoryBytes(cookedTexture), static_cast<size_t>((16 + 4 + 1 + 1 + 1) * rendering::COMPRESSED_TEXTURE_BLOCK_BYTES));
+    ASSERT_TRUE(rendering::WriteCookedTexture(TEST_COOKED_TEXTURE_PATH, cookedTexture));
+
+    std::stringstream fileContents;
+    fileContents << std::ifstream(TEST_COOKED_TEXTURE_PATH, std::ios::binary).rdbuf();
+    const auto fileContentsString = fileContents.str();
+
+    rendering::CookedTexture parsedCookedTexture;
+    ASSERT_TRUE(rendering::ParseCookedTexture(fileContentsString.data(), fileContentsString.size(), parsedCookedTexture));
+    EXPECT_EQ(parsedCookedTexture.mFormat, rendering::CookedTextureFormat::BC3);
+    EXPECT_FALSE(parsedCookedTexture.mNNFiltering);
+    ASSERT_EQ(parsedCookedTexture.mMipLevels.size(), cookedTexture.mMipLevels.size());
+    for (size_t i = 0; i < cookedTexture.mMipLevels.size(); ++i)
+    {
+        EXPECT_EQ(parsedCookedTexture.mMipLevels[i].mWidth, cookedTexture.mMipLevels[i].mWidth);
+        EXPECT_EQ(parsedCookedTexture.mMipLevels[i].mData, cookedTexture.mMipLevels[i].mData);
+    }
+
+    // Version 1 files predate the flags, and are read as nearest neighbour filtered
+    auto version1FileContentsString = fileContentsString;
+    const uint32_t version1 = 1;
+    std::memcpy(&version1FileContentsString[sizeof(rendering::COOKED_TEXTURE_MAGIC)], &version1, sizeof(version1));
+    version1FileContentsString.erase(sizeof(rendering::COOKED_TEXTURE_MAGIC) + 2 * sizeof(uint32_t), sizeof(uint32_t));
+    ASSERT_TRUE(rendering::ParseCookedTexture(version1FileContentsString.data(), version1FileContentsString.size(), parsedCookedTexture));
+    EXPECT_TRUE(parsedCookedTexture.mNNFiltering);
+    EXPECT_EQ(parsedCookedTexture.mMipLevels.size(), cookedTexture.mMipLevels.size());
+
+    EXPECT_FALSE(rendering::ParseCookedTexture(fileContentsString.data(), fileContentsString.size() - 1, parsedCookedTexture));
+    EXPECT_FALSE(rendering::ParseCookedTexture("TMIC", 4, parsedCookedTexture));
+
+    std::filesystem::remove(TEST_COOKED_TEXTURE_PATH);
+}
+
+///------------------------------------------------------------------------------------------------
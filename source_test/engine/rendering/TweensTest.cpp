@@ -0,0 +1,121 @@
+///------------------------------------------------------------------------------------------------
+///  TweensTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/rendering/Animations.h>
+#include <engine/rendering/CommonUniforms.h>
+#include <engine/rendering/Tweens.h>
+#include <engine/scene/SceneObject.h>
+#include <memory>
+
+///------------------------------------------------------------------------------------------------
+
+// Uneven steps, overshooting the tweens' durations
+static const float STEP_MILLIS[] = { 16.0f, 33.0f, 7.0f, 120.0f, 16.0f, 250.0f, 400.0f, 16.0f };
+
+///------------------------------------------------------------------------------------------------
+
+static std::shared_ptr<scene::SceneObject> CreateTestSceneObject()
+{
+    auto sceneObject = std::make_shared<scene::SceneObject>();
+    sceneObject->mPosition = glm::vec3(1.0f, 2.0f, 3.0f);
+    sceneObject->mRotation = glm::vec3(0.1f, 0.2f, 0.3f);
+    sceneObject->mScale = glm::vec3(2.0f, 2.0f, 1.0f);
+    sceneObject->mShaderFloatUniformValues[CUSTOM_ALPHA_UNIFORM_NAME] = 1.0f;
+    return sceneObject;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void ExpectVec3Near(const glm::vec3& lhs, const glm::vec3& rhs)
+{
+    EXPECT_NEAR(lhs.x, rhs.x, 1e-4f);
+    EXPECT_NEAR(lhs.y, rhs.y, 1e-4f);
+    EXPECT_NEAR(lhs.z, rhs.z, 1e-4f);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TweenTests, TestTweensMatchCorrespondingAnimations)
+{
+    auto animationTarget = CreateTestSceneObject();
+    auto tweenTarget = CreateTestSceneObject();
+    float animatedValue = 0.0f;
+    float tweenedValue = 0.0f;
+
+    rendering::TweenPositionScaleAnimation positionScaleAnimation(animationTarget, glm::vec3(-1.0f, 0.5f, 3.0f), glm::vec3(4.0f, 1.0f, 1.0f), 0.5f, animation_flags::NONE, 0.0f, math::QuadFunction, math::TweeningMode::EASE_OUT);
+    rendering::PositionScaleTween positionScaleTween(tweenTarget, glm::vec3(-1.0f, 0.5f, 3.0f), glm::vec3(4.0f, 1.0f, 1.0f), 0.5f, animation_flags::NONE, 0.0f, math::QuadFunction, math::TweeningMode::EASE_OUT);
+    rendering::TweenRotationAnimation rotationAnimation(animationTarget, glm::vec3(0.0f, 0.0f, 3.14f), 0.6f, animation_flags::NONE, 0.05f, math::CubicFunction, math::TweeningMode::EASE_IN_OUT);
+    rendering::RotationTween rotationTween(tweenTarget, glm::vec3(0.0f, 0.0f, 3.14f), 0.6f, animation_flags::NONE, 0.05f, math::CubicFunction, math::TweeningMode::EASE_IN_OUT);
+    rendering::TweenAlphaAnimation alphaAnimation(animationTarget, 0.0f, 0.4f);
+    rendering::AlphaTween alphaTween(tweenTarget, 0.0f, 0.4f);
+    rendering::TweenValueAnimation valueAnimation(animatedValue, 10.0f, 0.3f, animation_flags::NONE, 0.1f, math::BounceFunction);
+    rendering::ValueTween valueTween(tweenedValue, 10.0f, 0.3f, animation_flags::NONE, 0.1f, math::BounceFunction);
+
+    for (const auto stepMillis: STEP_MILLIS)
+    {
+        EXPECT_EQ(positionScaleAnimation.VUpdate(stepMillis), positionScaleTween.Update(stepMillis));
+        EXPECT_EQ(rotationAnimation.VUpdate(stepMillis), rotationTween.Update(stepMillis));
+        EXPECT_EQ(alphaAnimation.VUpdate(stepMillis), alphaTween.Update(stepMillis));
+        EXPECT_EQ(valueAnimation.VUpdate(stepMillis), valueTween.Update(stepMillis));
+
+        ExpectVec3Near(animationTarget->mPosition, tweenTarget->mPosition);
+        ExpectVec3Near(animationTarget->mScale, tweenTarget->mScale);
+        ExpectVec3Near(animationTarget->mRotation, tweenTarget->mRotation);
+        EXPECT_NEAR(animationTarget->mShaderFloatUniformValues.at(CUSTOM_ALPHA_UNIFORM_NAME), tweenTarget->mShaderFloatUniformValues.at(CUSTOM_ALPHA_UNIFORM_NAME), 1e-4f);
+        EXPECT_NEAR(animatedValue, tweenedValue, 1e-4f);
+    }
+
+    EXPECT_NEAR(tweenedValue, 10.0f, 1e-4f);
+    ExpectVec3Near(tweenTarget->mPosition, glm::vec3(-1.0f, 0.5f, 3.0f));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TweenTests, TestPulseAndBezierTweensMatchCorrespondingAnimations)
+{
+    auto animationTarget = CreateTestSceneObject();
+    auto tweenTarget = CreateTestSceneObject();
+    const math::BezierCurve curve({ glm::vec3(0.0f), glm::vec3(1.0f, 2.0f, 0.0f), glm::vec3(3.0f, -1.0f, 0.0f) });
+
+    rendering::PulseAnimation pulseAnimation(animationTarget, 1.5f, 0.2f, animation_flags::NONE, 0.0f, math::QuadFunction);
+    rendering::PulseTween pulseTween(tweenTarget, 1.5f, 0.2f, animation_flags::NONE, 0.0f, math::QuadFunction);
+    rendering::BezierCurveAnimation bezierAnimation(animationTarget, curve, 0.7f, animation_flags::IGNORE_Z_COMPONENT);
+    rendering::BezierTween bezierTween(tweenTarget, curve, 0.7f, animation_flags::IGNORE_Z_COMPONENT);
+
+    for (const auto stepMillis: STEP_MILLIS)
+    {
+        EXPECT_EQ(pulseAnimation.VUpdate(stepMillis), pulseTween.Update(stepMillis));
+        EXPECT_EQ(bezierAnimation.VUpdate(stepMillis), bezierTween.Update(stepMillis));
+
+        ExpectVec3Near(animationTarget->mScale, tweenTarget->mScale);
+        ExpectVec3Near(animationTarget->mPosition, tweenTarget->mPosition);
+    }
+
+    EXPECT_EQ(bezierTween.GetSceneObject(), tweenTarget.get());
+    EXPECT_FLOAT_EQ(tweenTarget->mPosition.z, 3.0f);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(TweenTests, TestTweenDelayAndIgnoredComponents)
+{
+    auto sceneObject = CreateTestSceneObject();
+    rendering::PositionScaleTween tween(sceneObject, glm::vec3(5.0f, 5.0f, 5.0f), glm::vec3(1.0f), 0.1f, animation_flags::IGNORE_Y_COMPONENT | animation_flags::IGNORE_SCALE, 0.05f);
+
+    EXPECT_EQ(tween.Update(40.0f), rendering::AnimationUpdateResult::ONGOING);
+    ExpectVec3Near(sceneObject->mPosition, glm::vec3(1.0f, 2.0f, 3.0f));
+
+    EXPECT_EQ(tween.Update(20.0f), rendering::AnimationUpdateResult::ONGOING);
+    EXPECT_EQ(tween.Update(50.0f), rendering::AnimationUpdateResult::ONGOING);
+    EXPECT_EQ(tween.Update(60.0f), rendering::AnimationUpdateResult::FINISHED);
+
+    ExpectVec3Near(sceneObject->mPosition, glm::vec3(5.0f, 2.0f, 5.0f));
+    ExpectVec3Near(sceneObject->mScale, glm::vec3(2.0f, 2.0f, 1.0f));
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,91 @@
+///------------------------------------------------------------------------------------------------
+///  AssetArchiveTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/resloading/AssetArchive.h>
+#include <engine/resloading/VirtualFileSystem.h>
+#include <filesystem>
+#include <fstream>
+
+///------------------------------------------------------------------------------------------------
+
+static const std::string TEST_ARCHIVE_PATH = (std::filesystem::temp_directory_path() / "asset_archive_test.tmaa").string();
+static const std::string TEST_LOOSE_FILE_NAME = "asset_archive_test_loose.json";
+
+///------------------------------------------------------------------------------------------------
+
+TEST(AssetArchiveTests, TestWrittenArchiveEntriesAreReadBackIntact)
+{
+    const std::string binaryContents("\x89PNG\0\x01\x02", 7);
+    ASSERT_TRUE(resources::AssetArchive::WriteArchive(TEST_ARCHIVE_PATH, { { "data/a.json", "{ \"a\": 1 }" }, { "textures/b.png", binaryContents }, { "data/empty.txt", "" } }));
+
+    resources::AssetArchive archive;
+    ASSERT_TRUE(archive.Open(TEST_ARCHIVE_PATH));
+    EXPECT_EQ(archive.GetEntryCount(), 3u);
+
+    size_t size = 0;
+    const auto* data = archive.GetEntryData("textures/b.png", size);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(std::string(data, size), binaryContents);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % resources::AssetArchive::ARCHIVE_DATA_ALIGNMENT, 0u);
+
+    data = archive.GetEntryData("data/empty.txt", size);
+    EXPECT_NE(data, nullptr);
+    EXPECT_EQ(size, 0u);
+
+    EXPECT_EQ(archive.GetEntryData("data/missing.json", size), nullptr);
+
+    archive.Close();
+    std::filesystem::remove(TEST_ARCHIVE_PATH);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(AssetArchiveTests, TestCorruptArchiveFailsToOpen)
+{
+    {
+        std::ofstream corruptArchive(TEST_ARCHIVE_PATH, std::ios::binary);
+        corruptArchive << "NOTANARCHIVE_NOTANARCHIVE_NOTANARCHIVE";
+    }
+
+    resources::AssetArchive archive;
+    EXPECT_FALSE(archive.Open(TEST_ARCHIVE_PATH));
+    EXPECT_FALSE(archive.IsOpen());
+
+    std::filesystem::remove(TEST_ARCHIVE_PATH);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(VirtualFileSystemTests, TestArchivedFilesArePreferredAndLooseFilesAreFallenBackTo)
+{
+    ASSERT_TRUE(resources::AssetArchive::WriteArchive(TEST_ARCHIVE_PATH, { { "data/packed.json", "packed" } }));
+    {
+        std::ofstream looseFile(TEST_LOOSE_FILE_NAME, std::ios::binary);
+        looseFile << "loose";
+    }
+
+    resources::VirtualFileSystem virtualFileSystem;
+    ASSERT_TRUE(virtualFileSystem.MountArchive(TEST_ARCHIVE_PATH, "assets_root/"));
+
+    EXPECT_TRUE(virtualFileSystem.IsFileArchived("assets_root/data/packed.json"));
+    EXPECT_FALSE(virtualFileSystem.IsFileArchived("data/packed.json"));
+    EXPECT_EQ(virtualFileSystem.ReadFile("assets_root/data/packed.json").ToString(), "packed");
+
+    EXPECT_FALSE(virtualFileSystem.IsFileArchived(TEST_LOOSE_FILE_NAME));
+    EXPECT_TRUE(virtualFileSystem.DoesFileExist(TEST_LOOSE_FILE_NAME));
+    EXPECT_EQ(virtualFileSystem.ReadFile(TEST_LOOSE_FILE_NAME).ToString(), "loose");
+
+    EXPECT_FALSE(virtualFileSystem.DoesFileExist("assets_root/data/missing.json"));
+    EXPECT_FALSE(virtualFileSystem.ReadFile("assets_root/data/missing.json").IsValid());
+
+    virtualFileSystem.UnmountArchive();
+    std::filesystem::remove(TEST_ARCHIVE_PATH);
+    std::filesystem::remove(TEST_LOOSE_FILE_NAME);
+}
+
+///------------------------------------------------------------------------------------------------
@@ -17,7 +17,7 @@ TEST(SceneManagerOperationTests, TestBasicInsertionAndRetrieval)
     
     auto testScene = sceneManager.CreateScene(strutils::StringId(NAME));
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 1);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 1u);
     
     auto sameTestScene = sceneManager.FindScene(NAME);
     
@@ -34,7 +34,7 @@ TEST(SceneManagerOperationTests, TestPointerValidityPostMassInsertion)
     
     auto testScene = sceneManager.CreateScene(strutils::StringId(NAME));
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 1);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 1u);
     
     auto sameTestScene = sceneManager.FindScene(NAME);
     
@@ -47,7 +47,7 @@ TEST(SceneManagerOperationTests, TestPointerValidityPostMassInsertion)
         auto so = sceneManager.CreateScene();
     }
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 10000);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 10000u);
     
     sameTestScene = sceneManager.FindScene(NAME);
     
@@ -64,7 +64,7 @@ TEST(SceneManagerOperationTests, TestBasicInsertionAndRemoval)
     
     auto testScene = sceneManager.CreateScene(strutils::StringId(NAME));
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 1);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 1u);
     
     auto sameTestScene = sceneManager.FindScene(NAME);
     
@@ -72,7 +72,7 @@ TEST(SceneManagerOperationTests, TestBasicInsertionAndRemoval)
     
     sceneManager.RemoveScene(NAME);
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 0);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 0u);
     
     EXPECT_EQ(sceneManager.FindScene(NAME), nullptr);
 }
@@ -86,17 +86,17 @@ TEST(SceneManagerOperationTests, TestRemovalOfEmptyName)
     
     auto testScene = sceneManager.CreateScene(strutils::StringId(NAME));
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 1);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 1u);
     
     sceneManager.RemoveScene(EMPTY_NAME);
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 1);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 1u);
     
     auto emptyNameTestSceneObject = sceneManager.CreateScene(EMPTY_NAME);
 
-    EXPECT_EQ(sceneManager.GetSceneCount(), 2);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 2u);
     
     sceneManager.RemoveScene(EMPTY_NAME);
     
-    EXPECT_EQ(sceneManager.GetSceneCount(), 1);
+    EXPECT_EQ(sceneManager.GetSceneCount(), 1u);
 }
@@ -0,0 +1,99 @@
+///------------------------------------------------------------------------------------------------
+///  SceneObjectUtilsTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/scene/SceneObject.h>
+#include <engine/scene/SceneObjectUtils.h>
+#include <memory>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SceneObjectUtilsTests, TestChildFollowsParent)
+{
+    auto parent = std::make_shared<scene::SceneObject>();
+    parent->mPosition = glm::vec3(1.0f, 2.0f, 3.0f);
+    parent->mScale = glm::vec3(2.0f);
+    
+    auto child = std::make_shared<scene::SceneObject>();
+    child->mParent = parent;
+    child->mPosition = glm::vec3(0.5f, 0.0f, 1.0f);
+    child->mScale = glm::vec3(0.5f, 0.25f, 1.0f);
+    
+    auto worldPosition = scene_object_utils::GetWorldPosition(*child);
+    EXPECT_FLOAT_EQ(worldPosition.x, 2.0f);
+    EXPECT_FLOAT_EQ(worldPosition.y, 2.0f);
+    EXPECT_FLOAT_EQ(worldPosition.z, 5.0f);
+    EXPECT_FLOAT_EQ(scene_object_utils::GetWorldScale(*child).x, 1.0f);
+    EXPECT_FLOAT_EQ(scene_object_utils::GetWorldScale(*child).y, 0.5f);
+    
+    parent->mPosition.x += 1.0f;
+    worldPosition = scene_object_utils::GetWorldPosition(*child);
+    EXPECT_FLOAT_EQ(worldPosition.x, 3.0f);
+    EXPECT_FLOAT_EQ(worldPosition.y, 2.0f);
+    
+    // Unparenting makes the local transform the world transform again
+    child->mParent.reset();
+    worldPosition = scene_object_utils::GetWorldPosition(*child);
+    EXPECT_FLOAT_EQ(worldPosition.x, 0.5f);
+    EXPECT_FLOAT_EQ(worldPosition.z, 1.0f);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SceneObjectUtilsTests, TestCachedMatricesOnlyRecomputedOnChange)
+{
+    auto parent = std::make_shared<scene::SceneObject>();
+    auto child = std::make_shared<scene::SceneObject>();
+    child->mParent = parent;
+    
+    scene_object_utils::GetWorldMatrix(*child);
+    const auto parentWorldVersion = parent->mTransformCache.mWorldVersion;
+    const auto childWorldVersion = child->mTransformCache.mWorldVersion;
+    
+    for (int i = 0; i < 10; ++i)
+    {
+        scene_object_utils::GetWorldMatrix(*child);
+        scene_object_utils::GetSceneObjectBoundingRect(*child);
+    }
+    EXPECT_EQ(parent->mTransformCache.mWorldVersion, parentWorldVersion);
+    EXPECT_EQ(child->mTransformCache.mWorldVersion, childWorldVersion);
+    
+    // A parent change dirties the child, even though the child's own transform is untouched
+    parent->mRotation.z = math::PI/2;
+    scene_object_utils::GetWorldMatrix(*child);
+    EXPECT_EQ(parent->mTransformCache.mWorldVersion, parentWorldVersion + 1);
+    EXPECT_EQ(child->mTransformCache.mWorldVersion, childWorldVersion + 1);
+    
+    // Whereas a child change leaves the parent alone
+    child->mPosition.x = 1.0f;
+    const auto worldPosition = scene_object_utils::GetWorldPosition(*child);
+    EXPECT_EQ(parent->mTransformCache.mWorldVersion, parentWorldVersion + 1);
+    EXPECT_EQ(child->mTransformCache.mWorldVersion, childWorldVersion + 2);
+    EXPECT_NEAR(worldPosition.x, 0.0f, 0.0001f);
+    EXPECT_NEAR(worldPosition.y, 1.0f, 0.0001f);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SceneObjectUtilsTests, TestBoundingRectUsesWorldTransform)
+{
+    auto parent = std::make_shared<scene::SceneObject>();
+    parent->mPosition = glm::vec3(10.0f, -10.0f, 0.0f);
+    parent->mScale = glm::vec3(4.0f);
+    
+    auto child = std::make_shared<scene::SceneObject>();
+    child->mParent = parent;
+    child->mScale = glm::vec3(0.5f);
+    
+    const auto boundingRect = scene_object_utils::GetSceneObjectBoundingRect(*child);
+    EXPECT_FLOAT_EQ(boundingRect.bottomLeft.x, 9.0f);
+    EXPECT_FLOAT_EQ(boundingRect.bottomLeft.y, -11.0f);
+    EXPECT_FLOAT_EQ(boundingRect.topRight.x, 11.0f);
+    EXPECT_FLOAT_EQ(boundingRect.topRight.y, -9.0f);
+}
+
+///------------------------------------------------------------------------------------------------
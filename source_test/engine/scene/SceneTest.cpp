@@ -18,7 +18,7 @@ TEST(SceneOperationTests, TestBasicInsertionAndRetrieval)
     auto testSceneObject = testScene.CreateSceneObject();
     testSceneObject->mName = NAME;
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 1);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 1u);
     
     auto sameTestSceneObject = testScene.FindSceneObject(NAME);
     
@@ -36,7 +36,7 @@ TEST(SceneOperationTests, TestPointerValidityPostMassInsertion)
     auto testSceneObject = testScene.CreateSceneObject();
     testSceneObject->mName = NAME;
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 1);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 1u);
     
     auto sameTestSceneObject = testScene.FindSceneObject(NAME);
     
@@ -49,7 +49,7 @@ TEST(SceneOperationTests, TestPointerValidityPostMassInsertion)
         auto so = testScene.CreateSceneObject();
     }
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 10000);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 10000u);
     
     sameTestSceneObject = testScene.FindSceneObject(NAME);
     
@@ -71,7 +71,7 @@ TEST(SceneOperationTests, TestBasicInsertionAndRemoval)
     auto testSceneObject = testScene.CreateSceneObject();
     testSceneObject->mName = NAME;
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 1);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 1u);
     
     auto sameTestSceneObject = testScene.FindSceneObject(NAME);
     
@@ -79,7 +79,7 @@ TEST(SceneOperationTests, TestBasicInsertionAndRemoval)
     
     testScene.RemoveSceneObject(NAME);
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 0);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 0u);
     
     EXPECT_EQ(testScene.FindSceneObject(NAME), nullptr);
 }
@@ -94,19 +94,19 @@ TEST(SceneOperationTests, TestRemovalOfEmptyName)
     auto testSceneObject = testScene.CreateSceneObject();
     testSceneObject->mName = NAME;
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 1);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 1u);
     
     testScene.RemoveSceneObject(EMPTY_NAME);
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 1);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 1u);
     
     auto emptyNameTestSceneObject = testScene.CreateSceneObject();
     // no-op
     testSceneObject->mName = EMPTY_NAME;
 
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 2);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 2u);
     
     testScene.RemoveSceneObject(EMPTY_NAME);
     
-    EXPECT_EQ(testScene.GetSceneObjectCount(), 1);
+    EXPECT_EQ(testScene.GetSceneObjectCount(), 1u);
 }
@@ -0,0 +1,195 @@
+///------------------------------------------------------------------------------------------------
+///  AudioMixerTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <engine/sound/AudioMixer.h>
+#include <filesystem>
+#include <fstream>
+#include <SDL.h>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+///------------------------------------------------------------------------------------------------
+
+void WriteLittleEndian(std::ofstream& file, const uint32_t value, const int byteCount)
+{
+    for (int i = 0; i < byteCount; ++i)
+    {
+        file.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+/// Writes a 16 bit PCM WAV file with all samples set to the given value.
+std::string WriteTestWav(const std::string& fileName, const int sampleRate, const int channelCount, const int frameCount, const int16_t sampleValue)
+{
+    const auto filePath = (std::filesystem::temp_directory_path() / fileName).string();
+    const auto dataSize = static_cast<uint32_t>(frameCount * channelCount * 2);
+
+    std::ofstream file(filePath, std::ios::binary);
+    file.write("RIFF", 4); WriteLittleEndian(file, 36 + dataSize, 4); file.write("WAVE", 4);
+    file.write("fmt ", 4); WriteLittleEndian(file, 16, 4);
+    WriteLittleEndian(file, 1, 2);
+    WriteLittleEndian(file, static_cast<uint32_t>(channelCount), 2);
+    WriteLittleEndian(file, static_cast<uint32_t>(sampleRate), 4);
+    WriteLittleEndian(file, static_cast<uint32_t>(sampleRate * channelCount * 2), 4);
+    WriteLittleEndian(file, static_cast<uint32_t>(channelCount * 2), 2);
+    WriteLittleEndian(file, 16, 2);
+    file.write("data", 4); WriteLittleEndian(file, dataSize, 4);
+    for (int i = 0; i < frameCount * channelCount; ++i)
+    {
+        WriteLittleEndian(file, static_cast<uint16_t>(sampleValue), 2);
+    }
+
+    return filePath;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(AudioMixerTests, TestPreloadedSfxPlaysToCompletion)
+{
+    const auto sfxPath = WriteTestWav("audio_mixer_test_sfx.wav", sound::AudioMixer::SAMPLE_RATE, 1, 1000, 16384);
+    std::vector<float> block(sound::AudioMixer::MIX_BLOCK_FRAMES * sound::AudioMixer::CHANNEL_COUNT);
+
+    sound::AudioMixer audioMixer;
+    audioMixer.PreloadSfx(sfxPath);
+    audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+    EXPECT_EQ(audioMixer.GetLoadedSfxCount(), 1);
+    EXPECT_EQ(block[0], 0.0f);
+
+    audioMixer.PlaySfx(sfxPath, false, 0.5f, 1.0f);
+    audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+    EXPECT_EQ(audioMixer.GetActiveVoiceCount(), 1);
+    EXPECT_EQ(audioMixer.GetLoadedSfxCount(), 1);
+    EXPECT_NEAR(block[0], 0.25f, 1e-4f);
+    EXPECT_NEAR(block[1], 0.25f, 1e-4f);
+
+    // 1000 frames only last for 2 blocks
+    audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+    EXPECT_EQ(audioMixer.GetActiveVoiceCount(), 0);
+    EXPECT_NEAR(block[0], 0.25f, 1e-4f);
+    EXPECT_EQ(block.back(), 0.0f);
+
+    std::filesystem::remove(sfxPath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(AudioMixerTests, TestVoiceLimitStealsOldestUnloopedVoice)
+{
+    const auto sfxPath = WriteTestWav("audio_mixer_test_voices.wav", sound::AudioMixer::SAMPLE_RATE, 2, 48000, 100);
+    std::vector<float> block(sound::AudioMixer::MIX_BLOCK_FRAMES * sound::AudioMixer::CHANNEL_COUNT);
+
+    sound::AudioMixer audioMixer;
+    audioMixer.PlaySfx(sfxPath, true, 1.0f, 1.0f);
+    for (int i = 0; i < sound::AudioMixer::MAX_VOICES + 4; ++i)
+    {
+        audioMixer.PlaySfx(sfxPath, false, 1.0f, 1.0f);
+    }
+    audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+
+    EXPECT_EQ(audioMixer.GetActiveVoiceCount(), sound::AudioMixer::MAX_VOICES);
+    EXPECT_EQ(audioMixer.GetStolenVoiceCount(), 5u);
+    EXPECT_EQ(audioMixer.GetDroppedCommandCount(), 0u);
+
+    std::filesystem::remove(sfxPath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(AudioMixerTests, TestMusicIsStreamedResampledAndCrossFaded)
+{
+    const auto firstMusicPath = WriteTestWav("audio_mixer_test_music_a.wav", 24000, 2, 24000, 8192);
+    const auto secondMusicPath = WriteTestWav("audio_mixer_test_music_b.wav", 44100, 1, 44100, -8192);
+    std::vector<float> block(sound::AudioMixer::MIX_BLOCK_FRAMES * sound::AudioMixer::CHANNEL_COUNT);
+
+    sound::AudioMixer audioMixer;
+    audioMixer.PlayMusic(firstMusicPath, true);
+
+    // Past the initial fade in
+    for (int i = 0; i < 60; ++i)
+    {
+        audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+    }
+    EXPECT_TRUE(audioMixer.IsMusicPlaying());
+    EXPECT_NEAR(block[0], 0.25f, 1e-3f);
+    EXPECT_NEAR(block.back(), 0.25f, 1e-3f);
+
+    // Fade out of the first track followed by a fade in of the second
+    audioMixer.PlayMusic(secondMusicPath, false);
+    for (int i = 0; i < 120; ++i)
+    {
+        audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+    }
+    EXPECT_TRUE(audioMixer.IsMusicPlaying());
+    EXPECT_NEAR(block[0], -0.25f, 1e-3f);
+
+    // The (unlooped) second track ends after a second
+    for (int i = 0; i < 100; ++i)
+    {
+        audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+    }
+    EXPECT_FALSE(audioMixer.IsMusicPlaying());
+    EXPECT_EQ(block[0], 0.0f);
+
+    std::filesystem::remove(firstMusicPath);
+    std::filesystem::remove(secondMusicPath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(AudioMixerTests, TestDisabledMixerIsSilent)
+{
+    const auto sfxPath = WriteTestWav("audio_mixer_test_disabled.wav", sound::AudioMixer::SAMPLE_RATE, 1, 48000, 16384);
+    std::vector<float> block(sound::AudioMixer::MIX_BLOCK_FRAMES * sound::AudioMixer::CHANNEL_COUNT);
+
+    sound::AudioMixer audioMixer;
+    audioMixer.PlaySfx(sfxPath, true, 1.0f, 1.0f);
+    audioMixer.SetEnabled(false);
+    audioMixer.PlaySfx(sfxPath, true, 1.0f, 1.0f);
+    audioMixer.MixBlock(block.data(), sound::AudioMixer::MIX_BLOCK_FRAMES);
+
+    EXPECT_EQ(audioMixer.GetActiveVoiceCount(), 0);
+    EXPECT_EQ(block[0], 0.0f);
+
+    std::filesystem::remove(sfxPath);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(AudioMixerTests, TestMixingThreadFeedsDummyDevice)
+{
+    SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+
+    sound::AudioMixer audioMixer;
+    ASSERT_TRUE(audioMixer.StartDevice());
+
+    const auto startTime = std::chrono::steady_clock::now();
+    while (audioMixer.GetMixedFrameCount() < 4 * sound::AudioMixer::MIX_BLOCK_FRAMES && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(5))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_GE(audioMixer.GetMixedFrameCount(), 4u * sound::AudioMixer::MIX_BLOCK_FRAMES);
+
+    audioMixer.StopDevice();
+    EXPECT_FALSE(audioMixer.IsDeviceRunning());
+}
+
+///------------------------------------------------------------------------------------------------
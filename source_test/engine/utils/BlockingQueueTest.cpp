@@ -0,0 +1,135 @@
+///------------------------------------------------------------------------------------------------
+///  BlockingQueueTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <engine/utils/BlockingQueue.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(BlockingQueueTests, TestElementsArePoppedInPushOrder)
+{
+    BlockingQueue<std::unique_ptr<int>> queue;
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(queue.Push(std::make_unique<int>(i)));
+    }
+    EXPECT_EQ(queue.GetSize(), 3u);
+
+    std::unique_ptr<int> value;
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(queue.Pop(value));
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(BlockingQueueTests, TestDrainRespectsMaxCount)
+{
+    BlockingQueue<int> queue;
+    for (int i = 0; i < 5; ++i)
+    {
+        queue.Push(i);
+    }
+
+    std::vector<int> drainedValues;
+    EXPECT_EQ(queue.Drain([&](int& value){ drainedValues.push_back(value); }, 2), 2u);
+    EXPECT_EQ(queue.Drain([&](int& value){ drainedValues.push_back(value); }), 3u);
+    EXPECT_EQ(drainedValues, std::vector<int>({ 0, 1, 2, 3, 4 }));
+    EXPECT_EQ(queue.GetSize(), 0u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(BlockingQueueTests, TestCloseWakesUpBlockedConsumersAfterRemainingElements)
+{
+    BlockingQueue<int> queue;
+    queue.Push(7);
+
+    std::atomic<int> poppedCount = 0;
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 3; ++i)
+    {
+        consumers.emplace_back([&]()
+        {
+            int value = 0;
+            while (queue.Pop(value))
+            {
+                poppedCount++;
+            }
+        });
+    }
+
+    queue.Close();
+    for (auto& consumer: consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(poppedCount, 1);
+    EXPECT_TRUE(queue.IsClosed());
+    EXPECT_FALSE(queue.Push(8));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(BlockingQueueTests, TestConcurrentProducersAndConsumersDeliverEveryElementOnce)
+{
+    constexpr int PRODUCER_COUNT = 4;
+    constexpr int CONSUMER_COUNT = 4;
+    constexpr int ELEMENTS_PER_PRODUCER = 20000;
+    BlockingQueue<int> queue;
+
+    std::vector<std::atomic<int>> receivedCounts(PRODUCER_COUNT * ELEMENTS_PER_PRODUCER);
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < CONSUMER_COUNT; ++i)
+    {
+        consumers.emplace_back([&]()
+        {
+            int value = 0;
+            while (queue.Pop(value))
+            {
+                receivedCounts[value]++;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < PRODUCER_COUNT; ++i)
+    {
+        producers.emplace_back([&, i]()
+        {
+            for (int j = 0; j < ELEMENTS_PER_PRODUCER; ++j)
+            {
+                queue.Push(i * ELEMENTS_PER_PRODUCER + j);
+            }
+        });
+    }
+
+    for (auto& producer: producers)
+    {
+        producer.join();
+    }
+    queue.Close();
+    for (auto& consumer: consumers)
+    {
+        consumer.join();
+    }
+
+    for (const auto& receivedCount: receivedCounts)
+    {
+        EXPECT_EQ(receivedCount, 1);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,47 @@
+///------------------------------------------------------------------------------------------------
+///  ChecksumTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <engine/utils/Checksum.h>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ChecksumTests, TestCRC32CKnownVectors)
+{
+    const std::string digits = "123456789";
+    EXPECT_EQ(serial::ComputeCRC32C(digits.data(), digits.size()), 0xE3069283);
+    EXPECT_EQ(serial::ComputeCRC32C(nullptr, 0), 0x00000000u);
+    
+    const std::string zeros(32, '\0');
+    EXPECT_EQ(serial::ComputeCRC32C(zeros.data(), zeros.size()), 0x8A9136AA);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ChecksumTests, TestCRC32CStreamedOverChunksMatchesSinglePass)
+{
+    std::string contents;
+    for (int i = 0; i < 1000; ++i)
+    {
+        contents += std::to_string(i * 7919);
+    }
+    
+    const auto singlePassChecksum = serial::ComputeCRC32C(contents.data(), contents.size());
+    for (const size_t chunkSize: { 1, 3, 8, 13, 4096 })
+    {
+        uint32_t streamedChecksum = 0;
+        for (size_t offset = 0; offset < contents.size(); offset += chunkSize)
+        {
+            streamedChecksum = serial::ComputeCRC32C(contents.data() + offset, std::min(chunkSize, contents.size() - offset), streamedChecksum);
+        }
+        EXPECT_EQ(streamedChecksum, singlePassChecksum);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
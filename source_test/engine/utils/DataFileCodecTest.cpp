@@ -0,0 +1,105 @@
+///------------------------------------------------------------------------------------------------
+///  DataFileCodecTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/utils/DataFileCodec.h>
+#include <engine/utils/StringUtils.h>
+
+///------------------------------------------------------------------------------------------------
+
+static nlohmann::json CreateTestState()
+{
+    nlohmann::json state;
+    state["player_name"] = "Rat & Co";
+    state["position"] = { 1.5f, -2.25f, 0.0f };
+    state["inventory"] = { {"item", "sword"}, {"count", 1} };
+    state["timestamp"] = 1760745600;
+    return state;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(DataFileCodecTests, TestRoundTripsInBothEncodings)
+{
+    for (const auto encoding: { serial::DataFileEncoding::JSON, serial::DataFileEncoding::BINARY })
+    {
+        const auto contents = serial::EncodeDataFile(CreateTestState(), encoding);
+        
+        nlohmann::json state;
+        EXPECT_EQ(serial::DecodeDataFile(contents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, state), serial::DataFileDecodeResult::SUCCESS);
+        EXPECT_EQ(state, CreateTestState());
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(DataFileCodecTests, TestCorruptedContentsFailChecksumValidation)
+{
+    for (const auto encoding: { serial::DataFileEncoding::JSON, serial::DataFileEncoding::BINARY })
+    {
+        auto contents = serial::EncodeDataFile(CreateTestState(), encoding);
+        contents[contents.size()/2] ^= 0x01;
+        
+        nlohmann::json state;
+        EXPECT_EQ(serial::DecodeDataFile(contents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, state), serial::DataFileDecodeResult::CHECKSUM_MISMATCH);
+        EXPECT_TRUE(state.is_null());
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(DataFileCodecTests, TestLegacyJsonFilesAreStillAccepted)
+{
+    // As written prior to CRC32C checksums
+    const auto legacyContents = CreateTestState().dump(4) + "&" + std::to_string(strutils::GetLegacyStringHash(CreateTestState().dump(4))) + "\n";
+    
+    nlohmann::json state;
+    EXPECT_EQ(serial::DecodeDataFile(legacyContents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, state), serial::DataFileDecodeResult::SUCCESS);
+    EXPECT_EQ(state, CreateTestState());
+    
+    // Re-encoding migrates them
+    nlohmann::json migratedState;
+    EXPECT_EQ(serial::DecodeDataFile(serial::EncodeDataFile(state, serial::DataFileEncoding::BINARY), serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, migratedState), serial::DataFileDecodeResult::SUCCESS);
+    EXPECT_EQ(migratedState, CreateTestState());
+    
+    nlohmann::json tamperedState;
+    const auto tamperedContents = CreateTestState().dump(4) + "&12345";
+    EXPECT_EQ(serial::DecodeDataFile(tamperedContents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, tamperedState), serial::DataFileDecodeResult::CHECKSUM_MISMATCH);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(DataFileCodecTests, TestChecksumlessAndMalformedContents)
+{
+    nlohmann::json state;
+    EXPECT_EQ(serial::DecodeDataFile(CreateTestState().dump(), serial::CheckSumValidationBehavior::SKIP_CHECKSUM_VALIDATION, state), serial::DataFileDecodeResult::SUCCESS);
+    EXPECT_EQ(state, CreateTestState());
+    
+    nlohmann::json missingChecksumState;
+    EXPECT_EQ(serial::DecodeDataFile(CreateTestState().dump(), serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, missingChecksumState), serial::DataFileDecodeResult::CHECKSUM_MISMATCH);
+    
+    nlohmann::json malformedState;
+    EXPECT_EQ(serial::DecodeDataFile("{\"unterminated\": ", serial::CheckSumValidationBehavior::SKIP_CHECKSUM_VALIDATION, malformedState), serial::DataFileDecodeResult::MALFORMED);
+    
+    auto truncatedContents = serial::EncodeDataFile(CreateTestState(), serial::DataFileEncoding::BINARY);
+    truncatedContents.pop_back();
+    EXPECT_EQ(serial::DecodeDataFile(truncatedContents, serial::CheckSumValidationBehavior::SKIP_CHECKSUM_VALIDATION, malformedState), serial::DataFileDecodeResult::MALFORMED);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(DataFileCodecTests, TestNewerBinaryVersionsAreRejected)
+{
+    auto contents = serial::EncodeDataFile(CreateTestState(), serial::DataFileEncoding::BINARY);
+    ASSERT_EQ(contents.compare(0, 4, "TMDF"), 0);
+    contents[4] = static_cast<char>(serial::BINARY_DATA_FILE_VERSION + 1);
+    
+    nlohmann::json state;
+    EXPECT_EQ(serial::DecodeDataFile(contents, serial::CheckSumValidationBehavior::VALIDATE_CHECKSUM, state), serial::DataFileDecodeResult::UNSUPPORTED_VERSION);
+}
+
+///------------------------------------------------------------------------------------------------
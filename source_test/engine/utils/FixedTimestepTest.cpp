@@ -0,0 +1,175 @@
+///------------------------------------------------------------------------------------------------
+///  FixedTimestepTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/scene/Scene.h>
+#include <engine/scene/SceneManager.h>
+#include <engine/scene/SceneObject.h>
+#include <engine/utils/FixedTimestep.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static const strutils::StringId TEST_SCENE_NAME = strutils::StringId("fixed_timestep_test_scene");
+static const float WALL_X = 1.0f;
+static const float TOTAL_SIMULATED_MILLIS = 2010.0f; // not a multiple of the step, so that no step boundary falls on the end
+
+///------------------------------------------------------------------------------------------------
+
+struct SimulationResult
+{
+    std::vector<glm::vec3> mPositions;
+    glm::vec3 mCameraPosition;
+    uint64_t mStepCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Mirrors the engine loop (headlessly): objects accelerate, bounce off a wall & are followed by the camera,
+/// while every frame is "rendered" in between the last two simulated states.
+static SimulationResult RunSimulation(const std::vector<float>& frameMillisPattern)
+{
+    scene::SceneManager sceneManager;
+    auto scene = sceneManager.CreateScene(TEST_SCENE_NAME);
+    
+    std::vector<glm::vec3> velocities;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto sceneObject = scene->CreateSceneObject();
+        sceneObject->mPosition = glm::vec3(-0.5f + i * 0.1f, 0.0f, 0.0f);
+        velocities.emplace_back(0.0001f * (i + 1), 0.00005f, 0.0f);
+    }
+    
+    FixedTimestep fixedTimestep;
+    float elapsedMillis = 0.0f;
+    size_t frameIndex = 0;
+    while (elapsedMillis < TOTAL_SIMULATED_MILLIS)
+    {
+        const auto frameMillis = math::Min(frameMillisPattern[frameIndex++ % frameMillisPattern.size()], TOTAL_SIMULATED_MILLIS - elapsedMillis);
+        elapsedMillis += frameMillis;
+        
+        const auto stepCount = fixedTimestep.Advance(frameMillis);
+        for (int step = 0; step < stepCount; ++step)
+        {
+            if (step == stepCount - 1)
+            {
+                sceneManager.CaptureInterpolationStates();
+            }
+            
+            const auto stepMillis = fixedTimestep.GetStepMillis();
+            auto& sceneObjects = scene->GetSceneObjects();
+            for (size_t i = 0; i < sceneObjects.size(); ++i)
+            {
+                velocities[i].x += 0.000001f * stepMillis;
+                sceneObjects[i]->mPosition += velocities[i] * stepMillis;
+                if (sceneObjects[i]->mPosition.x > WALL_X)
+                {
+                    sceneObjects[i]->mPosition.x = WALL_X;
+                    velocities[i].x = -velocities[i].x * 0.5f;
+                }
+            }
+            
+            scene->GetCamera().SetPosition(glm::vec3(sceneObjects.front()->mPosition.x, sceneObjects.front()->mPosition.y, scene->GetCamera().GetPosition().z));
+        }
+        
+        sceneManager.ApplyInterpolatedStates(fixedTimestep.GetInterpolationAlpha());
+        sceneManager.RestoreSimulatedStates();
+    }
+    
+    SimulationResult result;
+    for (const auto& sceneObject: scene->GetSceneObjects())
+    {
+        result.mPositions.push_back(sceneObject->mPosition);
+    }
+    result.mCameraPosition = scene->GetCamera().GetPosition();
+    result.mStepCount = fixedTimestep.GetStepCount();
+    return result;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(FixedTimestepTests, TestSimulationIsIdenticalAcrossRenderRates)
+{
+    const auto referenceResult = RunSimulation({ 1000.0f/60.0f });
+    
+    const std::vector<std::vector<float>> frameMillisPatterns =
+    {
+        { 1000.0f/30.0f },
+        { 1000.0f/144.0f },
+        { 1000.0f/240.0f },
+        { 5.0f, 31.0f, 2.0f, 16.0f, 70.0f, 1.0f }, // hitchy
+    };
+    
+    for (const auto& frameMillisPattern: frameMillisPatterns)
+    {
+        const auto result = RunSimulation(frameMillisPattern);
+        
+        EXPECT_EQ(result.mStepCount, referenceResult.mStepCount);
+        EXPECT_EQ(result.mCameraPosition, referenceResult.mCameraPosition);
+        ASSERT_EQ(result.mPositions.size(), referenceResult.mPositions.size());
+        for (size_t i = 0; i < result.mPositions.size(); ++i)
+        {
+            // Bit for bit, not just approximately
+            EXPECT_EQ(result.mPositions[i], referenceResult.mPositions[i]);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(FixedTimestepTests, TestFrameTimeIsPaidOutInWholeSteps)
+{
+    FixedTimestep fixedTimestep(50.0f);
+    
+    EXPECT_EQ(fixedTimestep.Advance(10.0f), 0);
+    EXPECT_FLOAT_EQ(fixedTimestep.GetInterpolationAlpha(), 0.5f);
+    
+    EXPECT_EQ(fixedTimestep.Advance(35.0f), 2);
+    EXPECT_FLOAT_EQ(fixedTimestep.GetInterpolationAlpha(), 0.25f);
+    EXPECT_EQ(fixedTimestep.GetStepCount(), 2u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(FixedTimestepTests, TestLongFramesAreCappedAndExcessTimeDropped)
+{
+    FixedTimestep fixedTimestep(100.0f);
+    
+    EXPECT_EQ(fixedTimestep.Advance(1005.0f), FixedTimestep::MAX_STEPS_PER_FRAME);
+    EXPECT_NEAR(fixedTimestep.GetInterpolationAlpha(), 0.5f, 1e-4f);
+    EXPECT_NEAR(fixedTimestep.GetDroppedMillis(), 1000.0 - FixedTimestep::MAX_STEPS_PER_FRAME * 10.0, 1e-4);
+    
+    // Back to normal right after
+    EXPECT_EQ(fixedTimestep.Advance(10.0f), 1);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(FixedTimestepTests, TestInterpolatedStatesAreRenderedAndThenRestored)
+{
+    scene::SceneManager sceneManager;
+    auto scene = sceneManager.CreateScene(TEST_SCENE_NAME);
+    auto sceneObject = scene->CreateSceneObject();
+    
+    sceneObject->mPosition = glm::vec3(0.0f, 0.0f, 1.0f);
+    sceneManager.CaptureInterpolationStates();
+    sceneObject->mPosition = glm::vec3(1.0f, 2.0f, 1.0f);
+    
+    // Objects created after the capture have nothing to interpolate from
+    auto newSceneObject = scene->CreateSceneObject();
+    newSceneObject->mPosition = glm::vec3(3.0f, 3.0f, 0.0f);
+    
+    sceneManager.ApplyInterpolatedStates(0.25f);
+    EXPECT_FLOAT_EQ(sceneObject->mPosition.x, 0.25f);
+    EXPECT_FLOAT_EQ(sceneObject->mPosition.y, 0.5f);
+    EXPECT_EQ(newSceneObject->mPosition, glm::vec3(3.0f, 3.0f, 0.0f));
+    
+    sceneManager.RestoreSimulatedStates();
+    EXPECT_EQ(sceneObject->mPosition, glm::vec3(1.0f, 2.0f, 1.0f));
+    EXPECT_EQ(newSceneObject->mPosition, glm::vec3(3.0f, 3.0f, 0.0f));
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,67 @@
+///------------------------------------------------------------------------------------------------
+///  FrameLimiterTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/utils/FrameLimiter.h>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(FrameLimiterTests, TestFocusedClientWithRecentInputIsUncapped)
+{
+    FrameLimiter frameLimiter;
+    frameLimiter.OnInput(0.0f);
+    frameLimiter.Update(100.0f, true, true);
+    
+    EXPECT_EQ(frameLimiter.GetMode(), FrameLimiter::Mode::ACTIVE);
+    EXPECT_EQ(frameLimiter.GetTargetFrameMillis(), 0.0f);
+    EXPECT_EQ(frameLimiter.GetRemainingFrameMillis(100.0f, 101.0f), 0.0f);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(FrameLimiterTests, TestInputIdleClientIsThrottledUntilNextInput)
+{
+    FrameLimiter frameLimiter;
+    frameLimiter.SetIdleTimeoutMillis(1000.0f);
+    frameLimiter.SetFrameRates(20.0f, 5.0f);
+    
+    frameLimiter.OnInput(0.0f);
+    frameLimiter.Update(500.0f, true, true);
+    EXPECT_EQ(frameLimiter.GetMode(), FrameLimiter::Mode::ACTIVE);
+    
+    frameLimiter.Update(1500.0f, true, true);
+    EXPECT_EQ(frameLimiter.GetMode(), FrameLimiter::Mode::IDLE);
+    EXPECT_FLOAT_EQ(frameLimiter.GetTargetFrameMillis(), 50.0f);
+    EXPECT_FLOAT_EQ(frameLimiter.GetRemainingFrameMillis(1500.0f, 1520.0f), 30.0f);
+    EXPECT_EQ(frameLimiter.GetRemainingFrameMillis(1500.0f, 1560.0f), 0.0f);
+    
+    frameLimiter.OnInput(1600.0f);
+    frameLimiter.Update(1600.0f, true, true);
+    EXPECT_EQ(frameLimiter.GetMode(), FrameLimiter::Mode::ACTIVE);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(FrameLimiterTests, TestUnfocusedAndHiddenClientsAreThrottled)
+{
+    FrameLimiter frameLimiter;
+    frameLimiter.SetFrameRates(20.0f, 5.0f);
+    frameLimiter.OnInput(0.0f);
+    
+    frameLimiter.Update(10.0f, false, true);
+    EXPECT_EQ(frameLimiter.GetMode(), FrameLimiter::Mode::IDLE);
+    
+    frameLimiter.Update(20.0f, false, false);
+    EXPECT_EQ(frameLimiter.GetMode(), FrameLimiter::Mode::BACKGROUND);
+    EXPECT_FLOAT_EQ(frameLimiter.GetTargetFrameMillis(), 200.0f);
+    
+    frameLimiter.SetEnabled(false);
+    frameLimiter.Update(30.0f, false, false);
+    EXPECT_EQ(frameLimiter.GetMode(), FrameLimiter::Mode::ACTIVE);
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,137 @@
+///------------------------------------------------------------------------------------------------
+///  InitTaskGraphTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <engine/utils/InitTaskGraph.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(InitTaskGraphTests, TestTasksRunAfterTheirDependencies)
+{
+    std::vector<std::string> executionOrder;
+    const auto recordTask = [&](const char* name)
+    {
+        return [&executionOrder, name](){ executionOrder.push_back(name); return InitTaskGraph::TaskStatus::DONE; };
+    };
+
+    InitTaskGraph initTaskGraph;
+    initTaskGraph.AddTask("scenes", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "fonts", "maps" }, recordTask("scenes"));
+    initTaskGraph.AddTask("maps", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "fonts" }, recordTask("maps"));
+    initTaskGraph.AddTask("fonts", InitTaskGraph::TaskAffinity::MAIN_THREAD, {}, recordTask("fonts"));
+    initTaskGraph.RunToCompletion();
+
+    EXPECT_TRUE(initTaskGraph.IsComplete());
+    EXPECT_EQ(initTaskGraph.GetProgress(), 1.0f);
+    EXPECT_EQ(executionOrder, std::vector<std::string>({ "fonts", "maps", "scenes" }));
+    EXPECT_EQ(initTaskGraph.GetTaskTimings().size(), 3u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(InitTaskGraphTests, TestInvalidGraphsAreRejected)
+{
+    InitTaskGraph cyclicTaskGraph;
+    cyclicTaskGraph.AddTask("a", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "b" }, [](){ return InitTaskGraph::TaskStatus::DONE; });
+    cyclicTaskGraph.AddTask("b", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "a" }, [](){ return InitTaskGraph::TaskStatus::DONE; });
+    EXPECT_FALSE(cyclicTaskGraph.Start());
+
+    InitTaskGraph unknownDependencyTaskGraph;
+    unknownDependencyTaskGraph.AddTask("a", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "missing" }, [](){ return InitTaskGraph::TaskStatus::DONE; });
+    EXPECT_FALSE(unknownDependencyTaskGraph.Start());
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(InitTaskGraphTests, TestFailedTasksStopTheGraph)
+{
+    auto dependentTaskRan = false;
+
+    InitTaskGraph initTaskGraph;
+    initTaskGraph.AddTask("maps", InitTaskGraph::TaskAffinity::WORKER_THREAD, {}, [](){ return InitTaskGraph::TaskStatus::FAILED; });
+    initTaskGraph.AddTask("scenes", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "maps" }, [&](){ dependentTaskRan = true; return InitTaskGraph::TaskStatus::DONE; });
+    initTaskGraph.RunToCompletion();
+
+    EXPECT_TRUE(initTaskGraph.HasFailed());
+    EXPECT_FALSE(initTaskGraph.IsComplete());
+    EXPECT_STREQ(initTaskGraph.GetFailedTaskName(), "maps");
+    EXPECT_FALSE(dependentTaskRan);
+
+    InitTaskGraph mainThreadFailureTaskGraph;
+    mainThreadFailureTaskGraph.AddTask("fonts", InitTaskGraph::TaskAffinity::MAIN_THREAD, {}, [](){ return InitTaskGraph::TaskStatus::FAILED; });
+    mainThreadFailureTaskGraph.RunToCompletion();
+
+    EXPECT_TRUE(mainThreadFailureTaskGraph.HasFailed());
+    EXPECT_STREQ(mainThreadFailureTaskGraph.GetFailedTaskName(), "fonts");
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(InitTaskGraphTests, TestWorkerTasksRunInParallelWithMainThreadTasks)
+{
+    std::atomic<bool> mainThreadTaskStarted = false;
+    std::atomic<bool> workerSawMainThreadTask = false;
+    std::thread::id workerThreadId;
+
+    InitTaskGraph initTaskGraph;
+    initTaskGraph.AddTask("worker", InitTaskGraph::TaskAffinity::WORKER_THREAD, {}, [&]()
+    {
+        // Only completes if the main thread task gets to run while this one is still in flight
+        const auto startTime = std::chrono::steady_clock::now();
+        while (!mainThreadTaskStarted && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(5))
+        {
+            std::this_thread::yield();
+        }
+        workerSawMainThreadTask = mainThreadTaskStarted.load();
+        workerThreadId = std::this_thread::get_id();
+        return InitTaskGraph::TaskStatus::DONE;
+    });
+    initTaskGraph.AddTask("main", InitTaskGraph::TaskAffinity::MAIN_THREAD, {}, [&]()
+    {
+        mainThreadTaskStarted = true;
+        return InitTaskGraph::TaskStatus::DONE;
+    });
+    initTaskGraph.AddTask("after_both", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "worker", "main" }, [](){ return InitTaskGraph::TaskStatus::DONE; });
+    initTaskGraph.RunToCompletion();
+
+    EXPECT_TRUE(workerSawMainThreadTask);
+    EXPECT_NE(workerThreadId, std::this_thread::get_id());
+    EXPECT_EQ(std::string(initTaskGraph.GetTaskTimings().back().mName), "after_both");
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(InitTaskGraphTests, TestPolledTasksAreResumedOnLaterUpdates)
+{
+    int pollCount = 0;
+    bool dependentTaskRan = false;
+
+    InitTaskGraph initTaskGraph;
+    initTaskGraph.AddTask("handshake", InitTaskGraph::TaskAffinity::MAIN_THREAD, {}, [&]()
+    {
+        return ++pollCount == 3 ? InitTaskGraph::TaskStatus::DONE : InitTaskGraph::TaskStatus::PENDING;
+    });
+    initTaskGraph.AddTask("after_handshake", InitTaskGraph::TaskAffinity::MAIN_THREAD, { "handshake" }, [&](){ dependentTaskRan = true; return InitTaskGraph::TaskStatus::DONE; });
+    ASSERT_TRUE(initTaskGraph.Start());
+
+    initTaskGraph.Update(1000.0f);
+    EXPECT_EQ(pollCount, 1);
+    EXPECT_EQ(initTaskGraph.GetProgress(), 0.0f);
+
+    initTaskGraph.Update(1000.0f);
+    initTaskGraph.Update(1000.0f);
+    EXPECT_EQ(pollCount, 3);
+    EXPECT_TRUE(dependentTaskRan);
+    EXPECT_TRUE(initTaskGraph.IsComplete());
+    EXPECT_EQ(initTaskGraph.GetTaskTimings().front().mExecutionCount, 3);
+}
+
+///------------------------------------------------------------------------------------------------
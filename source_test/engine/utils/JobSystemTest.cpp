@@ -0,0 +1,89 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystemTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <engine/utils/JobSystem.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(JobSystemTests, TestParallelForVisitsEveryIndexOnce)
+{
+    for (const auto workerThreadCount: { 0, 1, 3 })
+    {
+        JobSystem jobSystem(workerThreadCount);
+        EXPECT_EQ(jobSystem.GetWorkerThreadCount(), workerThreadCount);
+
+        std::vector<std::atomic<int>> visitCounts(10000);
+        jobSystem.ParallelFor(visitCounts.size(), 16, [&](const size_t begin, const size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                visitCounts[i]++;
+            }
+        });
+
+        for (const auto& visitCount: visitCounts)
+        {
+            EXPECT_EQ(visitCount, 1);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(JobSystemTests, TestParentJobOnlyFinishesAfterItsChildren)
+{
+    JobSystem jobSystem(2);
+    std::atomic<int> finishedGrandchildCount = 0;
+
+    auto* rootJob = jobSystem.CreateJob(nullptr);
+    for (int i = 0; i < 8; ++i)
+    {
+        // Children spawn their own children from within the worker threads
+        jobSystem.Run(jobSystem.CreateJob([&jobSystem, &finishedGrandchildCount, rootJob]()
+        {
+            for (int j = 0; j < 8; ++j)
+            {
+                jobSystem.Run(jobSystem.CreateJob([&finishedGrandchildCount](){ finishedGrandchildCount++; }, rootJob));
+            }
+        }, rootJob));
+    }
+
+    jobSystem.Run(rootJob);
+    jobSystem.Wait(rootJob);
+
+    EXPECT_TRUE(jobSystem.IsFinished(rootJob));
+    EXPECT_EQ(finishedGrandchildCount, 64);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(JobSystemTests, TestRepeatedFramesOfJobsRecycleTheJobPool)
+{
+    JobSystem jobSystem(3);
+    std::atomic<int> executedJobCount = 0;
+
+    // Way more jobs overall than the per thread job pool holds
+    constexpr int FRAME_COUNT = 200;
+    constexpr int JOBS_PER_FRAME = 100;
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        auto* frameJob = jobSystem.CreateJob(nullptr);
+        for (int i = 0; i < JOBS_PER_FRAME; ++i)
+        {
+            jobSystem.Run(jobSystem.CreateJob([&executedJobCount](){ executedJobCount++; }, frameJob));
+        }
+        jobSystem.Run(frameJob);
+        jobSystem.Wait(frameJob);
+    }
+
+    EXPECT_EQ(executedJobCount, FRAME_COUNT * JOBS_PER_FRAME);
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,114 @@
+///------------------------------------------------------------------------------------------------
+///  MPSCRingBufferTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/utils/MPSCRingBuffer.h>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MPSCRingBufferTests, TestCapacityIsRoundedUpToPowerOfTwo)
+{
+    MPSCRingBuffer<int> ringBuffer(100);
+    EXPECT_EQ(ringBuffer.GetCapacity(), 128u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MPSCRingBufferTests, TestElementsArePoppedInPushOrder)
+{
+    MPSCRingBuffer<int> ringBuffer(8);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.TryPush(i));
+    }
+
+    int value = -1;
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ringBuffer.TryPop(value));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MPSCRingBufferTests, TestPushFailsWhenFullAndSucceedsAfterPop)
+{
+    MPSCRingBuffer<int> ringBuffer(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.TryPush(i));
+    }
+    EXPECT_FALSE(ringBuffer.TryPush(4));
+
+    int value = -1;
+    EXPECT_TRUE(ringBuffer.TryPop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(ringBuffer.TryPush(4));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MPSCRingBufferTests, TestConcurrentProducersDeliverEveryElementOnce)
+{
+    static constexpr int PRODUCER_COUNT = 4;
+    static constexpr int ELEMENTS_PER_PRODUCER = 20000;
+
+    MPSCRingBuffer<int> ringBuffer(256);
+
+    std::vector<std::thread> producers;
+    for (int producerIndex = 0; producerIndex < PRODUCER_COUNT; ++producerIndex)
+    {
+        producers.emplace_back([&ringBuffer, producerIndex]()
+        {
+            for (int i = 0; i < ELEMENTS_PER_PRODUCER; ++i)
+            {
+                while (!ringBuffer.TryPush(producerIndex * ELEMENTS_PER_PRODUCER + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Per producer ordering must be preserved, and nothing lost or duplicated
+    std::vector<int> lastSeenPerProducer(PRODUCER_COUNT, -1);
+    long long poppedSum = 0;
+    int poppedCount = 0;
+    while (poppedCount < PRODUCER_COUNT * ELEMENTS_PER_PRODUCER)
+    {
+        int value = 0;
+        if (!ringBuffer.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto producerIndex = value / ELEMENTS_PER_PRODUCER;
+        EXPECT_GT(value % ELEMENTS_PER_PRODUCER, lastSeenPerProducer[producerIndex]);
+        lastSeenPerProducer[producerIndex] = value % ELEMENTS_PER_PRODUCER;
+
+        poppedSum += value;
+        poppedCount++;
+    }
+
+    for (auto& producer: producers)
+    {
+        producer.join();
+    }
+
+    const long long elementCount = PRODUCER_COUNT * ELEMENTS_PER_PRODUCER;
+    EXPECT_EQ(poppedSum, elementCount * (elementCount - 1) / 2);
+
+    int value = 0;
+    EXPECT_FALSE(ringBuffer.TryPop(value));
+}
+
+///------------------------------------------------------------------------------------------------
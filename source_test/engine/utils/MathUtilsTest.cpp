@@ -0,0 +1,51 @@
+///------------------------------------------------------------------------------------------------
+///  MathUtilsTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/utils/MathUtils.h>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<unsigned int> DrawOnThread(const size_t threadIndex)
+{
+    std::vector<unsigned int> draws;
+    std::thread([&]()
+    {
+        math::SetRandomEngineThreadIndex(threadIndex);
+        for (int i = 0; i < 8; ++i)
+        {
+            draws.push_back(math::GetRandomEngine()());
+        }
+    }).join();
+    return draws;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(MathUtilsTests, TestSeededRandomEnginesAreReproduciblePerThreadIndex)
+{
+    math::SeedRandomEngines(1337);
+    const auto firstRunWorkerDraws = DrawOnThread(1);
+    const auto firstRunMainDraws = DrawOnThread(0);
+    
+    math::SeedRandomEngines(1337);
+    const auto secondRunWorkerDraws = DrawOnThread(1);
+    const auto secondRunMainDraws = DrawOnThread(0);
+    
+    EXPECT_EQ(firstRunWorkerDraws, secondRunWorkerDraws);
+    EXPECT_EQ(firstRunMainDraws, secondRunMainDraws);
+    EXPECT_NE(firstRunWorkerDraws, firstRunMainDraws);
+    
+    // Threads already drawing from their engine pick the new seed up on their next draw
+    math::SeedRandomEngines(1337);
+    const auto reseededMainDraw = math::GetRandomEngine()();
+    EXPECT_EQ(reseededMainDraw, firstRunMainDraws.front());
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,163 @@
+///------------------------------------------------------------------------------------------------
+///  ProfilerTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/utils/Profiler.h>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+
+///------------------------------------------------------------------------------------------------
+
+static const profiling::ScopeSample* FindSample(const profiling::FrameProfile& frame, const std::string& name)
+{
+    for (const auto& sample: frame.mSamples)
+    {
+        if (name == sample.mName)
+        {
+            return &sample;
+        }
+    }
+    return nullptr;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ProfilerTests, TestNestedScopesAreRecordedWithTheirDepth)
+{
+    auto& profiler = profiling::Profiler::GetInstance();
+    profiler.ClearCapturedFrames();
+
+    profiler.BeginFrame();
+    {
+        PROFILE_SCOPE("Outer");
+        {
+            PROFILE_SCOPE("Inner");
+        }
+    }
+    profiler.EndFrame();
+
+    ASSERT_EQ(profiler.GetCapturedFrames().size(), 1u);
+    const auto& frame = profiler.GetCapturedFrames().back();
+    ASSERT_EQ(frame.mSamples.size(), 2u);
+
+    const auto* outer = FindSample(frame, "Outer");
+    const auto* inner = FindSample(frame, "Inner");
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+
+    EXPECT_EQ(outer->mDepth, 0u);
+    EXPECT_EQ(inner->mDepth, 1u);
+    EXPECT_EQ(outer->mThreadIndex, 0u);
+    EXPECT_GE(inner->mStartMicros, outer->mStartMicros);
+    EXPECT_LE(inner->mStartMicros + inner->mDurationMicros, outer->mStartMicros + outer->mDurationMicros);
+    EXPECT_GE(outer->mStartMicros, frame.mStartMicros);
+    EXPECT_LE(outer->mStartMicros + outer->mDurationMicros, frame.mStartMicros + frame.mDurationMicros);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ProfilerTests, TestOnlyTheLatestFramesAreKept)
+{
+    auto& profiler = profiling::Profiler::GetInstance();
+    profiler.ClearCapturedFrames();
+
+    for (size_t i = 0; i < profiling::Profiler::MAX_CAPTURED_FRAMES + 10; ++i)
+    {
+        profiler.BeginFrame();
+        PROFILE_SCOPE("Frame Work");
+        profiler.EndFrame();
+    }
+
+    const auto& frames = profiler.GetCapturedFrames();
+    ASSERT_EQ(frames.size(), profiling::Profiler::MAX_CAPTURED_FRAMES);
+    for (size_t i = 1; i < frames.size(); ++i)
+    {
+        EXPECT_EQ(frames[i].mFrameIndex, frames[i - 1].mFrameIndex + 1);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ProfilerTests, TestScopesFromOtherThreadsAreAttributedToTheFrame)
+{
+    auto& profiler = profiling::Profiler::GetInstance();
+    profiler.ClearCapturedFrames();
+
+    profiler.BeginFrame();
+    std::thread worker([]()
+    {
+        PROFILE_SCOPE("Worker");
+    });
+    worker.join();
+    profiler.EndFrame();
+
+    const auto* workerSample = FindSample(profiler.GetCapturedFrames().back(), "Worker");
+    ASSERT_NE(workerSample, nullptr);
+    EXPECT_NE(workerSample->mThreadIndex, 0u);
+    EXPECT_EQ(workerSample->mDepth, 0u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ProfilerTests, TestDisabledProfilerCapturesNothing)
+{
+    auto& profiler = profiling::Profiler::GetInstance();
+    profiler.ClearCapturedFrames();
+    profiler.SetEnabled(false);
+
+    profiler.BeginFrame();
+    {
+        PROFILE_SCOPE("Ignored");
+    }
+    profiler.EndFrame();
+    profiler.SetEnabled(true);
+
+    EXPECT_TRUE(profiler.GetCapturedFrames().empty());
+
+    // Nothing leaks into the next captured frame either
+    profiler.BeginFrame();
+    profiler.EndFrame();
+    ASSERT_EQ(profiler.GetCapturedFrames().size(), 1u);
+    EXPECT_TRUE(profiler.GetCapturedFrames().back().mSamples.empty());
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ProfilerTests, TestChromeTraceContainsFramesAndScopes)
+{
+    auto& profiler = profiling::Profiler::GetInstance();
+    profiler.ClearCapturedFrames();
+
+    profiler.BeginFrame();
+    {
+        PROFILE_SCOPE("Traced");
+    }
+    profiler.EndFrame();
+
+    const auto trace = nlohmann::json::parse(profiler.CreateChromeTraceJson());
+    ASSERT_TRUE(trace.contains("traceEvents"));
+
+    const auto& traceEvents = trace["traceEvents"];
+    ASSERT_EQ(traceEvents.size(), 2u);
+
+    bool foundFrame = false;
+    bool foundScope = false;
+    for (const auto& traceEvent: traceEvents)
+    {
+        EXPECT_EQ(traceEvent["ph"], "X");
+        EXPECT_GE(traceEvent["dur"].get<int64_t>(), 0);
+
+        const auto name = traceEvent["name"].get<std::string>();
+        foundFrame |= name.starts_with("Frame ");
+        foundScope |= name == "Traced";
+    }
+    EXPECT_TRUE(foundFrame);
+    EXPECT_TRUE(foundScope);
+}
+
+///------------------------------------------------------------------------------------------------
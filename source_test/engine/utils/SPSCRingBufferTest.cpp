@@ -0,0 +1,117 @@
+///------------------------------------------------------------------------------------------------
+///  SPSCRingBufferTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/utils/SPSCRingBuffer.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SPSCRingBufferTests, TestElementsArePoppedInPushOrder)
+{
+    SPSCRingBuffer<int> ringBuffer(8);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.TryPush(i));
+    }
+
+    int value = -1;
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ringBuffer.TryPop(value));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SPSCRingBufferTests, TestPushFailsWhenFullAndSucceedsAfterPop)
+{
+    SPSCRingBuffer<int> ringBuffer(4);
+    EXPECT_EQ(ringBuffer.GetCapacity(), 4u);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.TryPush(i));
+    }
+    EXPECT_FALSE(ringBuffer.TryPush(4));
+
+    int value = -1;
+    EXPECT_TRUE(ringBuffer.TryPop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(ringBuffer.TryPush(4));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SPSCRingBufferTests, TestMoveOnlyElements)
+{
+    SPSCRingBuffer<std::unique_ptr<int>> ringBuffer(4);
+    EXPECT_TRUE(ringBuffer.TryPush(std::make_unique<int>(42)));
+
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(ringBuffer.TryPop(value));
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 42);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SPSCRingBufferTests, TestDrainRespectsMaxCountAndOrder)
+{
+    SPSCRingBuffer<int> ringBuffer(8);
+    for (int i = 0; i < 6; ++i)
+    {
+        ringBuffer.TryPush(i);
+    }
+
+    std::vector<int> drainedValues;
+    EXPECT_EQ(ringBuffer.Drain([&](int& value){ drainedValues.push_back(value); }, 4), 4u);
+    EXPECT_EQ(ringBuffer.Drain([&](int& value){ drainedValues.push_back(value); }), 2u);
+    EXPECT_EQ(ringBuffer.Drain([&](int& value){ drainedValues.push_back(value); }), 0u);
+    EXPECT_EQ(drainedValues, std::vector<int>({ 0, 1, 2, 3, 4, 5 }));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(SPSCRingBufferTests, TestConcurrentProducerAndConsumerPreserveOrder)
+{
+    constexpr int ELEMENT_COUNT = 100000;
+    SPSCRingBuffer<int> ringBuffer(64);
+
+    std::thread producer([&]()
+    {
+        for (int i = 0; i < ELEMENT_COUNT; ++i)
+        {
+            while (!ringBuffer.TryPush(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Alternates single pops and batch drains to exercise both consumer paths
+    int expectedValue = 0;
+    bool inOrder = true;
+    while (expectedValue < ELEMENT_COUNT)
+    {
+        int value = -1;
+        if (ringBuffer.TryPop(value))
+        {
+            inOrder &= value == expectedValue++;
+        }
+        ringBuffer.Drain([&](int& drainedValue){ inOrder &= drainedValue == expectedValue++; }, 16);
+    }
+    producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(expectedValue, ELEMENT_COUNT);
+}
+
+///------------------------------------------------------------------------------------------------
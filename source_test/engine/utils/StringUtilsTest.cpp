@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 #include <engine/utils/MathUtils.h>
 #include <engine/utils/StringUtils.h>
+#include <unordered_set>
 
 TEST(StringIsIntTests, TestCharactersAreNotInts)
 {
@@ -147,3 +148,63 @@ TEST(FloatToStringTests, TestCastingsWithDifferentPrecisions)
     EXPECT_EQ(strutils::FloatToString(1.33333f, 2), "1.33");
     EXPECT_EQ(strutils::FloatToString(1.33333f, 3), "1.333");
 }
+
+TEST(StringIdTests, TestLiteralIdsMatchRuntimeIds)
+{
+    static constexpr auto LITERAL_ID = strutils::StringId::FromLiteral("string_id_literal_test");
+    static_assert(LITERAL_ID.GetStringId() == strutils::GetStringHash("string_id_literal_test"));
+    static_assert(strutils::StringId::FromLiteral("").isEmpty());
+    
+    EXPECT_EQ(strutils::StringId("string_id_literal_test"), LITERAL_ID);
+    EXPECT_EQ(LITERAL_ID.GetString(), "string_id_literal_test");
+    EXPECT_TRUE(strutils::StringId("").isEmpty());
+    EXPECT_TRUE(strutils::StringId().GetString().empty());
+}
+
+TEST(StringIdTests, TestReverseLookupOfInternedStrings)
+{
+    const auto registeredStringCount = strutils::string_id_table::GetRegisteredStringCount();
+    const auto stringId = strutils::StringId("string_id_reverse_lookup_test");
+    EXPECT_EQ(strutils::string_id_table::GetRegisteredStringCount(), registeredStringCount + 1);
+    
+    // Re-interning is a no-op
+    EXPECT_EQ(strutils::StringId(std::string("string_id_reverse_lookup_test")), stringId);
+    EXPECT_EQ(strutils::string_id_table::GetRegisteredStringCount(), registeredStringCount + 1);
+    
+    EXPECT_EQ(strutils::string_id_table::LookupString(stringId.GetStringId()), "string_id_reverse_lookup_test");
+    EXPECT_TRUE(strutils::StringId::FromLiteral("string_id_never_interned_test").GetString().empty());
+}
+
+TEST(StringIdTests, TestCollisionsKeepFirstStringAndAreReported)
+{
+    const auto collisionCount = strutils::string_id_table::GetCollisionCount();
+    const auto stringId = strutils::StringId("string_id_collision_test");
+    
+    // Simulates a different string hashing to the same id
+    strutils::string_id_table::RegisterString(stringId.GetStringId(), "string_id_colliding_string");
+    EXPECT_EQ(stringId.GetString(), "string_id_collision_test");
+    
+#if !defined(NDEBUG)
+    EXPECT_EQ(strutils::string_id_table::GetCollisionCount(), collisionCount + 1);
+#else
+    EXPECT_EQ(strutils::string_id_table::GetCollisionCount(), collisionCount);
+#endif
+    
+    // Registering the same string again is not a collision
+    const auto collisionCountAfterCollision = strutils::string_id_table::GetCollisionCount();
+    strutils::string_id_table::RegisterString(stringId.GetStringId(), "string_id_collision_test");
+    EXPECT_EQ(strutils::string_id_table::GetCollisionCount(), collisionCountAfterCollision);
+}
+
+TEST(StringIdTests, TestNoCollisionsAcrossSimilarStrings)
+{
+    const auto collisionCount = strutils::string_id_table::GetCollisionCount();
+    std::unordered_set<uint64_t> ids;
+    for (int i = 0; i < 100000; ++i)
+    {
+        ids.insert(strutils::StringId("tile_" + std::to_string(i)).GetStringId());
+    }
+    
+    EXPECT_EQ(ids.size(), 100000u);
+    EXPECT_EQ(strutils::string_id_table::GetCollisionCount(), collisionCount);
+}
@@ -0,0 +1,96 @@
+///------------------------------------------------------------------------------------------------
+///  EntityRegistryTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <game/EntityRegistry.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+static network::ObjectData CreateTestObjectData(const network::objectId_t objectId)
+{
+    network::ObjectData objectData = {};
+    objectData.objectId = objectId;
+    objectData.objectType = network::ObjectType::NPC;
+    objectData.position = glm::vec3(static_cast<float>(objectId), 0.0f, 1.0f);
+    return objectData;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(EntityRegistryTests, TestComponentsStayAlignedAcrossDestruction)
+{
+    EntityRegistry entityRegistry;
+
+    std::vector<EntityHandle> handles;
+    for (network::objectId_t objectId = 1; objectId <= 5; ++objectId)
+    {
+        handles.push_back(entityRegistry.CreateEntity(CreateTestObjectData(objectId)));
+        entityRegistry.GetAnimationHandle(handles.back()).mSlotIndex = static_cast<uint32_t>(objectId);
+    }
+
+    entityRegistry.DestroyEntity(handles[1]);
+    entityRegistry.DestroyEntity(handles[4]);
+    EXPECT_EQ(entityRegistry.GetEntityCount(), 3u);
+
+    for (size_t entityIndex = 0; entityIndex < entityRegistry.GetEntityCount(); ++entityIndex)
+    {
+        const auto objectId = entityRegistry.GetObjectIds()[entityIndex];
+        EXPECT_EQ(entityRegistry.GetNetworkStates()[entityIndex].objectId, objectId);
+        EXPECT_FLOAT_EQ(entityRegistry.GetInterpolationBuffers()[entityIndex].GetLatest().x, static_cast<float>(objectId));
+        EXPECT_EQ(entityRegistry.GetAnimationHandles()[entityIndex].mSlotIndex, static_cast<uint32_t>(objectId));
+    }
+
+    for (const auto objectId: { 1, 3, 4 })
+    {
+        const auto handle = entityRegistry.FindEntity(objectId);
+        ASSERT_TRUE(handle.IsValid());
+        EXPECT_EQ(entityRegistry.GetNetworkState(handle).objectId, static_cast<network::objectId_t>(objectId));
+    }
+    EXPECT_FALSE(entityRegistry.FindEntity(2).IsValid());
+    EXPECT_FALSE(entityRegistry.FindEntity(5).IsValid());
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(EntityRegistryTests, TestStaleHandlesAreNotRevivedBySlotReuse)
+{
+    EntityRegistry entityRegistry;
+    const auto firstHandle = entityRegistry.CreateEntity(CreateTestObjectData(1));
+    entityRegistry.DestroyEntity(firstHandle);
+
+    const auto secondHandle = entityRegistry.CreateEntity(CreateTestObjectData(2));
+    EXPECT_EQ(secondHandle.mSlotIndex, firstHandle.mSlotIndex);
+    EXPECT_FALSE(entityRegistry.IsEntityAlive(firstHandle));
+    EXPECT_TRUE(entityRegistry.IsEntityAlive(secondHandle));
+
+    // Destroying through a stale handle is a no-op
+    entityRegistry.DestroyEntity(firstHandle);
+    EXPECT_EQ(entityRegistry.GetEntityCount(), 1u);
+
+    // Re-creating a known object hands back its existing entity
+    const auto duplicateHandle = entityRegistry.CreateEntity(CreateTestObjectData(2));
+    EXPECT_EQ(duplicateHandle.mSlotIndex, secondHandle.mSlotIndex);
+    EXPECT_EQ(duplicateHandle.mGeneration, secondHandle.mGeneration);
+    EXPECT_EQ(entityRegistry.GetEntityCount(), 1u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(EntityRegistryTests, TestInterpolationBufferKeepsLatestPositions)
+{
+    EntityInterpolationBuffer interpolationBuffer;
+    for (int i = 0; i < EntityInterpolationBuffer::CAPACITY + 2; ++i)
+    {
+        interpolationBuffer.Push(glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        EXPECT_FLOAT_EQ(interpolationBuffer.GetLatest().x, static_cast<float>(i));
+    }
+
+    EXPECT_EQ(interpolationBuffer.mCount, EntityInterpolationBuffer::CAPACITY);
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,125 @@
+///------------------------------------------------------------------------------------------------
+///  ObjectAnimationControllerTest.cpp
+///  TinyMMOClient
+///
+///  Created by Alex Koukoulas on 18/10/2026
+///------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include <engine/rendering/CommonUniforms.h>
+#include <engine/scene/SceneObject.h>
+#include <game/ObjectAnimationController.h>
+#include <memory>
+
+///------------------------------------------------------------------------------------------------
+
+// Texture-less clips, so that no resources need loading
+static const char* TEST_ANIMATION_CLIPS_JSON = R"({
+    "direction_rows": {"SOUTH": 0, "SOUTH_EAST": 1, "SOUTH_WEST": 1, "EAST": 2, "WEST": 2, "NORTH_EAST": 3, "NORTH_WEST": 3, "NORTH": 4},
+    "flipped_directions": ["SOUTH_WEST", "WEST", "NORTH_WEST"],
+    "animation_clips":
+    [
+        { "name": "running", "object_type": "PLAYER", "object_states": ["IDLE", "RUNNING"], "sheet": {"columns": 3, "rows": 5}, "frame_count": 3, "playback": "loop_with_velocity", "velocity_frame_time_constant": 0.001, "idle_frame": 1 },
+        { "name": "melee_windup", "object_type": "PLAYER", "object_states": ["BEGIN_MELEE"], "sheet": {"columns": 3, "rows": 5}, "frame_count": 3, "playback": "hold_first_frame" },
+        { "name": "melee_attack", "object_type": "PLAYER", "object_states": ["MELEE_ATTACK"], "sheet": {"columns": 3, "rows": 5, "rect": [0.0, 0.0, 0.5, 0.5]}, "frame_count": 3, "playback": "play_once", "frame_duration_secs": 0.05 }
+    ]
+})";
+
+///------------------------------------------------------------------------------------------------
+
+static void ExpectFrameUVs(const scene::SceneObject& sceneObject, const float minU, const float minV, const float maxU, const float maxV)
+{
+    EXPECT_NEAR(sceneObject.mShaderFloatUniformValues.at(MIN_U_UNIFORM_NAME), minU, 1e-4f);
+    EXPECT_NEAR(sceneObject.mShaderFloatUniformValues.at(MIN_V_UNIFORM_NAME), minV, 1e-4f);
+    EXPECT_NEAR(sceneObject.mShaderFloatUniformValues.at(MAX_U_UNIFORM_NAME), maxU, 1e-4f);
+    EXPECT_NEAR(sceneObject.mShaderFloatUniformValues.at(MAX_V_UNIFORM_NAME), maxV, 1e-4f);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ObjectAnimationControllerTests, TestVelocityDrivenLoopAndIdleFrame)
+{
+    ObjectAnimationController controller(nlohmann::json::parse(TEST_ANIMATION_CLIPS_JSON));
+    EXPECT_EQ(controller.GetAnimationClipCount(), 3u);
+
+    auto sceneObject = std::make_shared<scene::SceneObject>();
+    const auto handle = controller.RegisterObject(sceneObject, network::ObjectType::PLAYER);
+
+    // Frame time = 0.001/|velocity| = 10ms
+    const auto velocity = glm::vec3(0.1f, 0.0f, 0.0f);
+    controller.UpdateObjectAnimation(handle, network::ObjectState::RUNNING, network::FacingDirection::EAST, velocity, 5.0f);
+    EXPECT_EQ(controller.UpdateObjectAnimation(handle, network::ObjectState::RUNNING, network::FacingDirection::EAST, velocity, 6.0f).mFrameIndex, 1);
+    EXPECT_EQ(controller.UpdateObjectAnimation(handle, network::ObjectState::RUNNING, network::FacingDirection::EAST, velocity, 11.0f).mFrameIndex, 2);
+    EXPECT_EQ(controller.UpdateObjectAnimation(handle, network::ObjectState::RUNNING, network::FacingDirection::EAST, velocity, 11.0f).mFrameIndex, 0);
+    ExpectFrameUVs(*sceneObject, 0.0f, 0.4f, 1.0f/3.0f, 0.6f);
+
+    // Flipped while facing west
+    controller.UpdateObjectAnimation(handle, network::ObjectState::RUNNING, network::FacingDirection::WEST, velocity, 1.0f);
+    ExpectFrameUVs(*sceneObject, 1.0f/3.0f, 0.4f, 0.0f, 0.6f);
+
+    // Stopping shows the idle frame, still facing the last direction
+    const auto& info = controller.UpdateObjectAnimation(handle, network::ObjectState::IDLE, network::FacingDirection::SOUTH, glm::vec3(0.0f), 16.0f);
+    EXPECT_EQ(info.mFrameIndex, 1);
+    EXPECT_EQ(info.mFacingDirection, network::FacingDirection::WEST);
+    ExpectFrameUVs(*sceneObject, 2.0f/3.0f, 0.4f, 1.0f/3.0f, 0.6f);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ObjectAnimationControllerTests, TestClipChangesRestartPlayback)
+{
+    ObjectAnimationController controller(nlohmann::json::parse(TEST_ANIMATION_CLIPS_JSON));
+    auto sceneObject = std::make_shared<scene::SceneObject>();
+    const auto handle = controller.RegisterObject(sceneObject, network::ObjectType::PLAYER);
+
+    EXPECT_EQ(controller.UpdateObjectAnimation(handle, network::ObjectState::BEGIN_MELEE, network::FacingDirection::NORTH, glm::vec3(0.0f), 100.0f).mFrameIndex, 0);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        EXPECT_FALSE(controller.UpdateObjectAnimation(handle, network::ObjectState::MELEE_ATTACK, network::FacingDirection::NORTH, glm::vec3(0.0f), 51.0f).mAnimationFinished);
+    }
+    const auto& info = controller.UpdateObjectAnimation(handle, network::ObjectState::MELEE_ATTACK, network::FacingDirection::NORTH, glm::vec3(0.0f), 51.0f);
+    EXPECT_TRUE(info.mAnimationFinished);
+    EXPECT_EQ(info.mFrameIndex, 2);
+
+    // Within the clip's sheet rect (bottom left quarter of the texture), top row facing north
+    ExpectFrameUVs(*sceneObject, 1.0f/3.0f, 0.0f, 0.5f, 0.1f);
+
+    // Going back to the attack afterwards plays it from the start again
+    controller.UpdateObjectAnimation(handle, network::ObjectState::IDLE, network::FacingDirection::NORTH, glm::vec3(0.0f), 16.0f);
+    EXPECT_FALSE(controller.UpdateObjectAnimation(handle, network::ObjectState::MELEE_ATTACK, network::FacingDirection::NORTH, glm::vec3(0.0f), 16.0f).mAnimationFinished);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(ObjectAnimationControllerTests, TestUnregistrationInvalidatesOnlyItsHandle)
+{
+    ObjectAnimationController controller(nlohmann::json::parse(TEST_ANIMATION_CLIPS_JSON));
+    auto firstSceneObject = std::make_shared<scene::SceneObject>();
+    auto secondSceneObject = std::make_shared<scene::SceneObject>();
+
+    const auto firstHandle = controller.RegisterObject(firstSceneObject, network::ObjectType::PLAYER);
+    const auto secondHandle = controller.RegisterObject(secondSceneObject, network::ObjectType::PLAYER);
+    controller.UpdateObjectAnimation(secondHandle, network::ObjectState::RUNNING, network::FacingDirection::SOUTH, glm::vec3(0.0f), 16.0f);
+
+    controller.UnregisterObject(firstHandle);
+    EXPECT_FALSE(controller.IsObjectRegistered(firstHandle));
+    EXPECT_TRUE(controller.IsObjectRegistered(secondHandle));
+    EXPECT_EQ(controller.GetRegisteredObjectCount(), 1u);
+
+    // The remaining object's state survives being moved into the vacated entry
+    EXPECT_EQ(controller.UpdateObjectAnimation(secondHandle, network::ObjectState::RUNNING, network::FacingDirection::SOUTH, glm::vec3(0.0f), 16.0f).mFrameIndex, 1);
+    ExpectFrameUVs(*secondSceneObject, 1.0f/3.0f, 0.8f, 2.0f/3.0f, 1.0f);
+
+    // Slot reuse doesn't revive the stale handle
+    const auto thirdHandle = controller.RegisterObject(firstSceneObject, network::ObjectType::PLAYER);
+    EXPECT_EQ(thirdHandle.mSlotIndex, firstHandle.mSlotIndex);
+    EXPECT_FALSE(controller.IsObjectRegistered(firstHandle));
+    EXPECT_TRUE(controller.IsObjectRegistered(thirdHandle));
+
+    // Unregistering a stale handle is a no-op
+    controller.UnregisterObject(firstHandle);
+    EXPECT_EQ(controller.GetRegisteredObjectCount(), 2u);
+}
+
+///------------------------------------------------------------------------------------------------
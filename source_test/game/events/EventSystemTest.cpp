@@ -7,6 +7,9 @@
 
 #include <gtest/gtest.h>
 #include <game/events/EventSystem.h>
+#include <memory>
+#include <thread>
+#include <vector>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -345,3 +348,133 @@ TEST(EventSystemTests, TestDoubleListenerRegistrationUnregistrationRegistration)
 }
 
 ///------------------------------------------------------------------------------------------------
+
+TEST(EventSystemTests, TestListenersCanUnregisterThemselvesAndOthersDuringDispatch)
+{
+    class SelfUnregistrationEvent {};
+    
+    int firstListenerCallCount = 0;
+    int secondListenerCallCount = 0;
+    std::unique_ptr<events::IListener> firstListener;
+    std::unique_ptr<events::IListener> secondListener;
+    
+    firstListener = events::EventSystem::GetInstance().RegisterForEvent<SelfUnregistrationEvent>([&](const SelfUnregistrationEvent&)
+    {
+        firstListenerCallCount++;
+        
+        // Destroys both the currently executing listener and the one after it
+        firstListener = nullptr;
+        secondListener = nullptr;
+    });
+    secondListener = events::EventSystem::GetInstance().RegisterForEvent<SelfUnregistrationEvent>([&](const SelfUnregistrationEvent&){ secondListenerCallCount++; });
+    
+    events::EventSystem::GetInstance().DispatchEvent<SelfUnregistrationEvent>();
+    events::EventSystem::GetInstance().DispatchEvent<SelfUnregistrationEvent>();
+    
+    EXPECT_EQ(firstListenerCallCount, 1);
+    EXPECT_EQ(secondListenerCallCount, 0);
+    EXPECT_EQ(events::EventSystem::GetInstance().GetListenerCount<SelfUnregistrationEvent>(), 0u);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(EventSystemTests, TestListenersRegisteredDuringDispatchOnlyReceiveSubsequentDispatches)
+{
+    class MidDispatchRegistrationEvent {};
+    
+    int lateListenerCallCount = 0;
+    std::unique_ptr<events::IListener> lateListener;
+    auto listener = events::EventSystem::GetInstance().RegisterForEvent<MidDispatchRegistrationEvent>([&](const MidDispatchRegistrationEvent&)
+    {
+        if (!lateListener)
+        {
+            lateListener = events::EventSystem::GetInstance().RegisterForEvent<MidDispatchRegistrationEvent>([&](const MidDispatchRegistrationEvent&){ lateListenerCallCount++; });
+        }
+    });
+    
+    events::EventSystem::GetInstance().DispatchEvent<MidDispatchRegistrationEvent>();
+    EXPECT_EQ(lateListenerCallCount, 0);
+    
+    events::EventSystem::GetInstance().DispatchEvent<MidDispatchRegistrationEvent>();
+    EXPECT_EQ(lateListenerCallCount, 1);
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(EventSystemTests, TestQueuedEventsAreOnlyDispatchedOnFlush)
+{
+    std::vector<int> receivedValues;
+    auto listener = events::EventSystem::GetInstance().RegisterForEvent<TestEvent2>([&](const TestEvent2& event)
+    {
+        receivedValues.push_back(event.GetVal());
+        
+        // Left for the next flush
+        if (event.GetVal() == 1)
+        {
+            events::EventSystem::GetInstance().QueueEvent<TestEvent2>(3);
+        }
+    });
+    
+    events::EventSystem::GetInstance().QueueEvent<TestEvent2>(1);
+    events::EventSystem::GetInstance().QueueEvent<TestEvent2>(2);
+    EXPECT_TRUE(receivedValues.empty());
+    
+    events::EventSystem::GetInstance().FlushQueuedEvents();
+    EXPECT_EQ(receivedValues, std::vector<int>({ 1, 2 }));
+    
+    events::EventSystem::GetInstance().FlushQueuedEvents();
+    EXPECT_EQ(receivedValues, std::vector<int>({ 1, 2, 3 }));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TEST(EventSystemTests, TestEventsQueuedFromOtherThreadsAreDispatchedOnTheFlushingThread)
+{
+    class WorkerThreadEvent
+    {
+    public:
+        WorkerThreadEvent(const int threadIndex, const int eventIndex) : mThreadIndex(threadIndex), mEventIndex(eventIndex) {}
+        
+        const int mThreadIndex;
+        const int mEventIndex;
+    };
+    
+    constexpr int THREAD_COUNT = 4;
+    constexpr int EVENTS_PER_THREAD = 1000;
+    
+    const auto flushingThreadId = std::this_thread::get_id();
+    bool allDispatchedOnFlushingThread = true;
+    bool inOrderPerThread = true;
+    std::vector<int> nextEventIndexPerThread(THREAD_COUNT, 0);
+    auto listener = events::EventSystem::GetInstance().RegisterForEvent<WorkerThreadEvent>([&](const WorkerThreadEvent& event)
+    {
+        allDispatchedOnFlushingThread &= std::this_thread::get_id() == flushingThreadId;
+        inOrderPerThread &= nextEventIndexPerThread[event.mThreadIndex]++ == event.mEventIndex;
+    });
+    
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([i]()
+        {
+            for (int j = 0; j < EVENTS_PER_THREAD; ++j)
+            {
+                events::EventSystem::GetInstance().QueueEvent<WorkerThreadEvent>(i, j);
+            }
+        });
+    }
+    
+    // Flushing while the threads are still queueing
+    for (auto& thread: threads)
+    {
+        events::EventSystem::GetInstance().FlushQueuedEvents();
+        thread.join();
+    }
+    events::EventSystem::GetInstance().FlushQueuedEvents();
+    
+    EXPECT_TRUE(allDispatchedOnFlushingThread);
+    EXPECT_TRUE(inOrderPerThread);
+    EXPECT_EQ(nextEventIndexPerThread, std::vector<int>(THREAD_COUNT, EVENTS_PER_THREAD));
+}
+
+///------------------------------------------------------------------------------------------------
@@ -5,7 +5,7 @@
 ///  Created by Alex Koukoulas on 20/01/2024.
 ///-----------------------------------------------------------------------------------------------
 
-#include <engine/utils/ThreadSafeQueue.h>
+#include <engine/utils/BlockingQueue.h>
 #include <platform_utilities/WindowsUtils.h>
 #include <winsock2.h>
 #include <ws2tcpip.h>
@@ -36,18 +36,43 @@ std::string GetPersistentDataDirectoryPath()
 
 ///-----------------------------------------------------------------------------------------------
 
+double GetProcessCPUTimeSecs()
+{
+    // User + system time of all threads (std::clock is wall time on MSVC), in 100ns units
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0.0;
+    }
+    
+    const auto toHundredNanos = [](const FILETIME& fileTime) { return (static_cast<unsigned long long>(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime; };
+    return (toHundredNanos(kernelTime) + toHundredNanos(userTime))/10000000.0;
+}
+
+///-----------------------------------------------------------------------------------------------
+
 class MessageSender
 {
 public:
     MessageSender() : mCanSendNetworkMessage(true) { Start(); }
 
+    ~MessageSender()
+    {
+        // Lets the sender finish its in flight message and exit, before the queue it pops from goes away
+        mMessageQueueToSend.Close();
+        if (mThread.joinable())
+        {
+            mThread.join();
+        }
+    }
+
     void Start()
     {
         mThread = std::thread([&]
         {
-            while (true)
+            std::pair<std::string, std::function<void(const networking::ServerResponseData&)>> messageJobToSend;
+            while (mMessageQueueToSend.Pop(messageJobToSend))
             {
-                auto messageJobToSend = mMessageQueueToSend.dequeue();                    
                 //mCanSendNetworkMessage = false;
                 const auto startTime = std::chrono::system_clock::now();
 
@@ -68,7 +93,7 @@ public:
                 if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
                 {
                     responseErrorLambda("WSAStartup failed.");
-                    return;
+                    continue;
                 }
 
                 // Create socket
@@ -76,7 +101,7 @@ public:
                 if (clientSocket == INVALID_SOCKET)
                 {
                     responseErrorLambda("Error: Socket creation failed");
-                    return;
+                    continue;
                 }
 
                 // Specify server address
@@ -89,13 +114,13 @@ public:
                 // Connect to server
                 if (connect(clientSocket, reinterpret_cast<sockaddr*>(&serverAddr), sizeof(serverAddr)) == SOCKET_ERROR) {
                     responseErrorLambda("Error: Connection failed");
-                    return;
+                    continue;
                 }
                     
                 if (send(clientSocket, messageJobToSend.first.c_str(), messageJobToSend.first.size(), 0) == SOCKET_ERROR)
                 {
                     responseErrorLambda("Error: Send Failed");
-                    return;
+                    continue;
                 }
 
                 // Send null character to indicate end of message
@@ -103,7 +128,7 @@ public:
                 if (send(clientSocket, &nullTerminator, sizeof(nullTerminator), 0) == SOCKET_ERROR)
                 {
                     responseErrorLambda("Error: Send Failed");
-                    return;
+                    continue;
                 }
 
                 while (true)
@@ -144,7 +169,6 @@ public:
                 mCanSendNetworkMessage = true;
             }
         });
-        mThread.detach();
     }
 
     void SendMessage(const nlohmann::json& networkMessage, const networking::MessageType messageType, const bool highPriority, std::function<void(const networking::ServerResponseData&)> serverResponseCallback)
@@ -153,14 +177,14 @@ public:
         {
             auto finalNetworkMessageJson = networkMessage;
             networking::PopulateMessageHeader(finalNetworkMessageJson, messageType);
-            mMessageQueueToSend.enqueue(std::make_pair(finalNetworkMessageJson.dump(), serverResponseCallback));
+            mMessageQueueToSend.Push(std::make_pair(finalNetworkMessageJson.dump(), std::move(serverResponseCallback)));
         }
     }
 
 private:
     std::thread mThread;
     std::atomic<bool> mCanSendNetworkMessage;
-    ThreadSafeQueue<std::pair<std::string, std::function<void(const networking::ServerResponseData&)>>> mMessageQueueToSend;
+    BlockingQueue<std::pair<std::string, std::function<void(const networking::ServerResponseData&)>>> mMessageQueueToSend;
 };
 
 
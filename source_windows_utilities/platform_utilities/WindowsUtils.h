@@ -23,6 +23,7 @@ namespace windows_utils
 
 bool IsConnectedToTheInternet();
 std::string GetPersistentDataDirectoryPath();
+double GetProcessCPUTimeSecs();
 void SendNetworkMessage(const nlohmann::json& networkMessage, const networking::MessageType messageType, const bool highPriority, std::function<void(const networking::ServerResponseData&)> serverResponseCallback);
 
 ///-----------------------------------------------------------------------------------------------